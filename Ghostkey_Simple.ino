@@ -18,9 +18,25 @@
 #include <SPI.h>
 #include <SD.h>
 #include <Keyboard.h>
+#include "lib/hid-output.h"
 #include "lib/simple-instructions.h"
 #include "lib/complex-instructions.h"
 #include "lib/layout-utils.h"
+#include "lib/low-power.h"
+#include "lib/payload-catalog.h"
+#include "lib/checkpoint.h"
+#include "lib/delay-work.h"
+#include "lib/chord-compiler.h"
+#include "lib/ducky-compiler.h"
+#include "lib/log-writer.h"
+#include "lib/extent-file.h"
+#include "lib/run-history.h"
+#include "lib/run-estimate.h"
+#include "lib/script-profile.h"
+#include "lib/report-timing.h"
+#include "lib/boot-timing.h"
+#include "lib/sd-mount.h"
+#include "lib/card-health.h"
 
 // Define diagnostic functions here instead of using external header
 // since we're having issues with the header file
@@ -33,36 +49,13 @@ String getSDCardTypeString() {
   if (!root) {
     return "Unknown";
   }
+  root.close();
   
   // Check for presence of common files on different card types
   if (SD.exists("/DCIM")) {
     return "SD/SDHC (Camera Card)";
   }
   
-  // Try to create a large test file to distinguish between SD and SDHC
-  File testFile = SD.open("/cardtype.bin", FILE_WRITE);
-  if (testFile) {
-    byte buffer[512];
-    memset(buffer, 0, 512);
-    
-    // Try to write 3GB of data (which would fail on regular SD)
-    bool canWriteLarge = true;
-    for (int i = 0; i < 10; i++) { // Just do a small sample test
-      if (testFile.write(buffer, 512) != 512) {
-        canWriteLarge = false;
-        break;
-      }
-    }
-    testFile.close();
-    SD.remove("/cardtype.bin");
-    
-    if (canWriteLarge) {
-      return "SDHC/SDXC (>2GB)";
-    } else {
-      return "SD (<= 2GB)";
-    }
-  }
-  
   return "SD Compatible";
 }
 
@@ -160,6 +153,43 @@ float testSDWriteSpeed() {
   return writeSpeed;
 }
 
+// Worst single-write latency (microseconds) of small log writes: plain
+// FILE_WRITE appends vs the preallocated SdLogWriter
+void testSDLogLatency(unsigned long &appendWorst, unsigned long &preallocatedWorst) {
+  const int writes = 256;
+  const char line[] = "Line 123: STRING latency test payload\n"; // A typical log line
+  appendWorst = 0;
+  preallocatedWorst = 0;
+
+  File testFile = SD.open("/logtest.bin", FILE_WRITE);
+  if (testFile) {
+    for (int i = 0; i < writes; i++) {
+      unsigned long start = micros();
+      testFile.write((const uint8_t *)line, sizeof(line) - 1);
+      unsigned long elapsed = micros() - start;
+      if (elapsed > appendWorst) {
+        appendWorst = elapsed;
+      }
+    }
+    testFile.close();
+    SD.remove("/logtest.bin");
+  }
+
+  SdLogWriter log;
+  if (log.begin("/logtest.log", writes * (sizeof(line) - 1), false)) { // Preallocation is not timed
+    for (int i = 0; i < writes; i++) {
+      unsigned long start = micros();
+      log.write(line);
+      unsigned long elapsed = micros() - start;
+      if (elapsed > preallocatedWorst) {
+        preallocatedWorst = elapsed;
+      }
+    }
+    log.close();
+    SD.remove("/logtest.log");
+  }
+}
+
 // Calculate approximate SD card capacity
 unsigned long getSDCardSizeApprox() {
   // This is an approximation method since the SD library doesn't provide direct size info
@@ -223,77 +253,19 @@ unsigned long getSDCardSizeApprox() {
   return lastSuccessSize / (1024 * 1024);
 }
 
-// Test SD card health and report issues
-void testSDCardHealth(char* result, int maxSize) {
-  // Initialize result buffer
-  strncpy(result, "Card Health: ", maxSize);
-  
-  // Create multiple test files and verify content
-  const int numTestFiles = 3;
-  const int testDataSize = 512;
-  byte writeBuffer[testDataSize];
-  byte readBuffer[testDataSize];
-  bool testPassed = true;
-  
-  // Fill write buffer with test pattern
-  for (int i = 0; i < testDataSize; i++) {
-    writeBuffer[i] = (i * 7 + 13) & 0xFF; // Simple unique pattern
-  }
-  
-  // Create and test each file
-  for (int fileNum = 0; fileNum < numTestFiles && testPassed; fileNum++) {
-    String fileName = "/sdtest";
-    fileName += fileNum;
-    fileName += ".bin";
-    
-    // Write test data
-    File testFile = SD.open(fileName, FILE_WRITE);
-    if (!testFile) {
-      testPassed = false;
-      strncat(result, "Write Error", maxSize - strlen(result) - 1);
-      break;
-    }
-    
-    testFile.write(writeBuffer, testDataSize);
-    testFile.close();
-    
-    // Read back and verify
-    testFile = SD.open(fileName);
-    if (!testFile) {
-      testPassed = false;
-      strncat(result, "Read Error", maxSize - strlen(result) - 1);
-      break;
-    }
-    
-    int bytesRead = testFile.read(readBuffer, testDataSize);
-    testFile.close();
-    
-    if (bytesRead != testDataSize) {
-      testPassed = false;
-      strncat(result, "Size Mismatch", maxSize - strlen(result) - 1);
-      break;
-    }
-    
-    // Compare buffers
-    for (int i = 0; i < testDataSize; i++) {
-      if (readBuffer[i] != writeBuffer[i]) {
-        testPassed = false;
-        strncat(result, "Data Corruption", maxSize - strlen(result) - 1);
-        break;
-      }
-    }
-    
-    // Clean up test file
-    SD.remove(fileName);
-  }
-  
-  // If all tests passed
-  if (testPassed) {
-    strncat(result, "Good", maxSize - strlen(result) - 1);
-  }
-}
+// Firmware version, recorded with every run in the run history
+#define FIRMWARE_VERSION "1.0"
 
 // Define pins
+#if defined(ARDUINO_ARCH_RP2040)
+// XIAO RP2040: the RGB LED stands in for the three SAMD21 LEDs (also active low)
+#define LED_USER 17  // Red
+#define LED_RX 16    // Green
+#define LED_TX 25    // Blue
+
+// Same socket as on the XIAO SAMD21: D7 is GPIO1, SPI0 on D8-D10
+#define SD_CS_PIN 1
+#else
 #define LED_USER 13  // User LED (orange)
 #define LED_RX 12    // RX LED (blue)
 #define LED_TX 11    // TX LED (blue)
@@ -303,9 +275,17 @@ void testSDCardHealth(char* result, int maxSize) {
 // MISO is connected to D8
 // MOSI is connected to D10
 // SCK is connected to D8
+#endif
 
-// Define constants
-const unsigned long TYPING_DELAY = 25; // Delay between keystrokes in milliseconds
+// On the RP2040 the engine runs on core 1 (setup1()/loop1()) and core 0
+// only sends the queued HID reports (usb_core.ino)
+#if defined(ARDUINO_ARCH_RP2040)
+#define GHOSTKEY_SETUP setup1
+#define GHOSTKEY_LOOP loop1
+#else
+#define GHOSTKEY_SETUP setup
+#define GHOSTKEY_LOOP loop
+#endif
 
 // Script file options (only one will be used based on mode selection)
 const String DUCKY_SCRIPT_FILE = "/payload.txt";    // Ducky Script file
@@ -327,6 +307,17 @@ bool repeatScriptMode = false; // Whether to repeat script execution
 int repeatScriptCount = 0; // Count of script repetitions
 int currentRepeat = 0; // Current repeat count
 
+// Byte range of the selected script within its file (length 0 = to end of file)
+unsigned long scriptRangeOffset = 0;
+unsigned long scriptRangeLength = 0;
+uint32_t scriptRangeCrc = 0; // CRC-32 from the payload catalog (0 = unknown)
+uint16_t scriptCatalogIndex = CATALOG_NO_ENTRY; // Catalog entry of the selected script (0-based)
+int selectedCatalogEntry = 0; // Catalog entry chosen over serial or with the button (1-based, 0 = none)
+int scriptLineBase = 0; // Lines already executed before the start offset (when resuming)
+volatile bool engineAbortRequested = false; // Set by the pause/abort controls (see engine_control.ino)
+SdMount sdMount; // Attempts and outcome of the boot-time card mount (see sd_mount.ino)
+bool cardHealthChecked = false; // The boot run's card health check is done (see card_health.ino)
+
 // Debug options
 const bool VERBOSE_DEBUG = true; // Set to false to reduce serial output
 
@@ -334,16 +325,27 @@ const bool VERBOSE_DEBUG = true; // Set to false to reduce serial output
 const String CONFIG_FILE = "/config.txt";
 
 // Default configuration values (used if config file not found or if specific setting missing)
-struct {
+struct GhostkeyConfig {
   byte scriptMode = 1;                // Default: Ducky Script (1)
   String duckyScriptFile = "/payload.txt";
   String customScriptFile = "/instructions.txt";
-  unsigned long typingDelay = 25;     // Default: 25ms delay between keystrokes
+  uint16_t typingRate = TYPING_DEFAULT_RATE;   // Default: 33 keystrokes per second (0 = unpaced)
+  uint8_t typingBurst = TYPING_DEFAULT_BURST;  // Default: keystrokes that may go out back to back
   bool useLayoutIndependent = true;   // Default: Use layout-independent typing
   bool autorunOnBoot = true;          // Default: Run script automatically on boot
   int initialDelay = 1000;            // Default: 1000ms delay before starting script execution
   int repeatCount = 0;                // Default: 0 = no repeat
   bool debugOutput = true;            // Default: Enable debug output
+  int buttonPin = -1;                 // Default: -1 = no idle/rerun button wired
+  bool idleSleep = true;              // Default: Sleep between events once idle
+  int payloadIndex = 0;               // Default: 0 = use the script file paths, n = catalog entry n
+  int checkpointInterval = 0;         // Default: 0 = no checkpoints, n = checkpoint every n lines
+  unsigned long checkpointMinMs = CHECKPOINT_MIN_MS; // Default: at least 30 s between checkpoint writes
+  unsigned long progressInterval = 1000; // Default: print progress/ETA every second while running (0 = off)
+  bool compileCache = true;           // Default: Compile the payload and cache the program on the card
+  bool runHistory = true;             // Default: Append a performance record to /history.log after each run
+  String cardModel = "";              // Default: no card model recorded in the run history
+  bool profile = false;               // Default: no line profile (payload.prof.txt) after the run
 } config;
 
 // Function to read and parse configuration file
@@ -406,10 +408,29 @@ void readConfigFile() {
       Serial.print(F("Config: Custom Script File = "));
       Serial.println(config.customScriptFile);
     }
+    else if (key.equalsIgnoreCase("TYPING_RATE")) {
+      long rate = value.toInt();
+      config.typingRate = (rate < 0) ? 0 : (rate > 0xFFFF) ? 0xFFFF : rate;
+      Serial.print(F("Config: Typing Rate = "));
+      Serial.print(config.typingRate);
+      Serial.println(config.typingRate == TYPING_RATE_UNLIMITED ? F(" (unpaced)") : F(" keys/s"));
+    }
+    else if (key.equalsIgnoreCase("TYPING_BURST")) {
+      long burst = value.toInt();
+      config.typingBurst = (burst < 1) ? 1 : (burst > TYPING_MAX_BURST) ? TYPING_MAX_BURST : burst;
+      Serial.print(F("Config: Typing Burst = "));
+      Serial.println(config.typingBurst);
+    }
     else if (key.equalsIgnoreCase("TYPING_DELAY")) {
-      config.typingDelay = value.toInt();
+      // Older setting: milliseconds between keystrokes
+      long ms = value.toInt();
+      config.typingRate = (ms <= 0) ? TYPING_RATE_UNLIMITED : (ms >= 1000) ? 1 : 1000 / ms;
+      config.typingBurst = 1;
       Serial.print(F("Config: Typing Delay = "));
-      Serial.println(config.typingDelay);
+      Serial.print(ms);
+      Serial.print(F("ms (Typing Rate = "));
+      Serial.print(config.typingRate);
+      Serial.println(F(")"));
     }
     else if (key.equalsIgnoreCase("USE_LAYOUT_INDEPENDENT")) {
       if (value.equalsIgnoreCase("true") || value.equalsIgnoreCase("1") || value.equalsIgnoreCase("yes")) {
@@ -448,6 +469,106 @@ void readConfigFile() {
       Serial.print(F("Config: Debug Output = "));
       Serial.println(config.debugOutput ? F("Enabled") : F("Disabled"));
     }
+    else if (key.equalsIgnoreCase("IDLE_SLEEP")) {
+      if (value.equalsIgnoreCase("false") || value.equalsIgnoreCase("0") || value.equalsIgnoreCase("no")) {
+        config.idleSleep = false;
+      } else {
+        config.idleSleep = true;
+      }
+      Serial.print(F("Config: Idle Sleep = "));
+      Serial.println(config.idleSleep ? F("Enabled") : F("Disabled"));
+    }
+    else if (key.equalsIgnoreCase("PAYLOAD_INDEX")) {
+      config.payloadIndex = value.toInt();
+      Serial.print(F("Config: Payload Index = "));
+      Serial.println(config.payloadIndex);
+    }
+    else if (key.equalsIgnoreCase("CHECKPOINT_INTERVAL")) {
+      config.checkpointInterval = value.toInt();
+      Serial.print(F("Config: Checkpoint Interval = "));
+      Serial.println(config.checkpointInterval);
+    }
+    else if (key.equalsIgnoreCase("CHECKPOINT_MIN_MS")) {
+      config.checkpointMinMs = value.toInt();
+      Serial.print(F("Config: Checkpoint Min Interval = "));
+      Serial.print(config.checkpointMinMs);
+      Serial.println(F("ms"));
+    }
+    else if (key.equalsIgnoreCase("PROGRESS_INTERVAL")) {
+      config.progressInterval = value.toInt();
+      Serial.print(F("Config: Progress Interval = "));
+      Serial.println(config.progressInterval);
+    }
+    else if (key.equalsIgnoreCase("COMPILE_CACHE")) {
+      if (value.equalsIgnoreCase("false") || value.equalsIgnoreCase("0") || value.equalsIgnoreCase("no")) {
+        config.compileCache = false;
+      } else {
+        config.compileCache = true;
+      }
+      Serial.print(F("Config: Compile Cache = "));
+      Serial.println(config.compileCache ? F("Enabled") : F("Disabled"));
+    }
+    else if (key.equalsIgnoreCase("RUN_HISTORY")) {
+      if (value.equalsIgnoreCase("false") || value.equalsIgnoreCase("0") || value.equalsIgnoreCase("no")) {
+        config.runHistory = false;
+      } else {
+        config.runHistory = true;
+      }
+      Serial.print(F("Config: Run History = "));
+      Serial.println(config.runHistory ? F("Enabled") : F("Disabled"));
+    }
+    else if (key.equalsIgnoreCase("CARD_MODEL")) {
+      config.cardModel = value;
+      Serial.print(F("Config: Card Model = "));
+      Serial.println(config.cardModel);
+    }
+    else if (key.equalsIgnoreCase("PROFILE")) {
+      if (value.equalsIgnoreCase("true") || value.equalsIgnoreCase("1") || value.equalsIgnoreCase("yes")) {
+        config.profile = true;
+      } else {
+        config.profile = false;
+      }
+      Serial.print(F("Config: Profile = "));
+      Serial.println(config.profile ? F("Enabled") : F("Disabled"));
+    }
+    else if (key.equalsIgnoreCase("KEYBOARD_LAYOUT")) {
+      if (selectTypingLayout(value)) {
+        Serial.print(F("Config: Keyboard Layout = "));
+        Serial.println(typingLayout().name);
+      } else {
+        Serial.print(F("Config: Unknown keyboard layout, keeping "));
+        Serial.println(typingLayout().name);
+      }
+    }
+    else if (key.equalsIgnoreCase("UNICODE_INPUT")) {
+      if (value.equalsIgnoreCase("linux")) {
+        unicodeInputMode = UNICODE_INPUT_LINUX;
+      } else if (value.equalsIgnoreCase("windows")) {
+        unicodeInputMode = UNICODE_INPUT_WINDOWS;
+      } else if (value.equalsIgnoreCase("mac")) {
+        unicodeInputMode = UNICODE_INPUT_MAC;
+      } else {
+        unicodeInputMode = UNICODE_INPUT_NONE;
+      }
+      Serial.print(F("Config: Unicode Input = "));
+      Serial.println(unicodeInputMode == UNICODE_INPUT_LINUX ? F("Linux") :
+                     unicodeInputMode == UNICODE_INPUT_WINDOWS ? F("Windows") :
+                     unicodeInputMode == UNICODE_INPUT_MAC ? F("Mac") : F("None"));
+    }
+    else if (key.equalsIgnoreCase("BUTTON_PIN")) {
+      // The pin indexes the variant's pin table and must have an external
+      // interrupt to wake the idle loop; anything else disables the button
+      int pin = value.toInt();
+      if (pin >= 0 && (pin >= (int)PINS_COUNT || digitalPinToInterrupt(pin) == NOT_AN_INTERRUPT)) {
+        Serial.print(F("Config: Button Pin "));
+        Serial.print(pin);
+        Serial.println(F(" is not an interrupt pin on this board - button disabled"));
+        pin = -1;
+      }
+      config.buttonPin = (pin >= 0) ? pin : -1;
+      Serial.print(F("Config: Button Pin = "));
+      Serial.println(config.buttonPin);
+    }
   }
   
   configFile.close();
@@ -457,14 +578,19 @@ void readConfigFile() {
 void processInstructionLine(String line);
 void processDuckyLine(String line);
 void flashLED(int led, int times, int duration);
-void typeWithDelay(String text);
+void applyTypingSpeed(uint32_t value);
+bool applySpeedDirective(const String &params);
 void pressKey(String keyString);
 void printDirectory(File dir, int numTabs);
-bool attemptSDCardRecovery();
 void showSDCardError(int errorPattern);
 void runSDCardDiagnostics();
+void resetExecutionState();
+bool selectScriptFile(String &scriptFile);
+void runScriptFile(const String &scriptFile);
 
-void setup() {
+void GHOSTKEY_SETUP() {
+  beginBootTiming();
+  
   // Initialize LEDs
   pinMode(LED_USER, OUTPUT);
   pinMode(LED_RX, OUTPUT);
@@ -479,6 +605,7 @@ void setup() {
   Serial.begin(9600);
   // Wait for serial port to connect
   delay(1000);
+  bootTimingMark(BOOT_PHASE_SERIAL);
     Serial.println(F("Ghostkey SD Card Edition - Startup"));
   Serial.print(F("Script Mode: "));
   Serial.println(SCRIPT_MODE == 1 ? F("Ducky Script") : F("Custom Format"));
@@ -488,148 +615,98 @@ void setup() {
   
   // Flash LED to indicate startup
   flashLED(LED_USER, 3, 200);
+  bootTimingMark(BOOT_PHASE_FLASH);
   // Initialize Keyboard
-  Keyboard.begin();
+  HidKeyboard.begin();
   Serial.println(F("Keyboard initialized"));
+  bootTimingMark(BOOT_PHASE_KEYBOARD);
   // Initialize SD card with advanced error handling
   Serial.print(F("Initializing SD card with CS on pin "));
   Serial.print(SD_CS_PIN);
   Serial.println(F("..."));
   
-  // Variables for SD card mounting
-  const int maxRetries = 3;
-  int retryCount = 0;
-  bool sdInitialized = false;
-  unsigned long sdInitStartTime = millis();
-
-  // Try to mount the SD card multiple times with increasing delays
-  while (retryCount < maxRetries && !sdInitialized) {
-    // Visual indication of attempt
-    if (retryCount > 0) {
-      Serial.print(F("Retry "));
-      Serial.print(retryCount);
-      Serial.print(F(" of "));
-      Serial.print(maxRetries - 1);
-      Serial.print(F(", after "));
-      Serial.print(retryCount * 500);
-      Serial.println(F("ms delay..."));
-      flashLED(LED_TX, 2, 100); // Flash TX LED to indicate retry attempt
-    }
-
-    // Attempt SD initialization
-    sdInitialized = SD.begin(SD_CS_PIN);
+  if (!mountSDCard()) {
+    Serial.print(F("FAILED after "));
+    Serial.print(sdMount.attempts);
+    Serial.print(F(" attempt(s) in "));
+    Serial.print(sdMount.totalMs);
+    Serial.println(F("ms"));
     
-    // If still not successful, wait and try again
-    if (!sdInitialized && retryCount < maxRetries - 1) {
-      delay(retryCount * 500 + 500); // Increasing delay with each retry
-    }
-    retryCount++;
-  }
-  // Handle SD card initialization result
-  if (!sdInitialized) {
-    // SD card initialization failed after all retries
-    unsigned long sdInitDuration = millis() - sdInitStartTime;
+    Serial.println(F("\nSD Card Error Diagnostics:"));
+    Serial.println(F("---------------------------"));
+    Serial.println(F("1. Hardware Check:"));
+    Serial.println(F("   - Ensure SD card is properly inserted"));
+    Serial.println(F("   - Check that SD card is not damaged or corrupted"));
+    Serial.println(F("   - Verify SD card is formatted as FAT16/FAT32"));
+    Serial.println(F("   - Try with a different SD card if available"));
     
-    Serial.println(F("FAILED after multiple attempts!"));
-    Serial.print(F("Time spent trying: "));
-    Serial.print(sdInitDuration);
-    Serial.println(F("ms"));
+    Serial.println(F("\n2. Wiring Check:"));
+    Serial.print(F("   - CS pin (D"));
+    Serial.print(SD_CS_PIN);
+    Serial.println(F(") connected properly"));
+    Serial.println(F("   - MISO connected to D8"));
+    Serial.println(F("   - MOSI connected to D10"));
+    Serial.println(F("   - SCK connected to D9"));
     
-    // Attempt recovery process
-    Serial.println(F("\nInitiating SD card recovery process..."));
-    bool recoverySuccess = attemptSDCardRecovery();
+    Serial.println(F("\n3. Power Issues:"));
+    Serial.println(F("   - Check for stable power supply"));
+    Serial.println(F("   - SD card may require more current than available"));
+    Serial.println(F("   - Try with a different SD card (preferably Class 4 or 10)"));
     
-    if (recoverySuccess) {
-      Serial.println(F("\n*** SD CARD RECOVERY SUCCESSFUL ***"));
-      Serial.println(F("Card has been remounted and is now available"));
-      
-      // Run basic tests to ensure card is working properly
-      runSDCardDiagnostics();
-      
-      // Continue with normal execution
-      sdInitialized = true;
+    Serial.println(F("\n4. Software Issues:"));
+    Serial.println(F("   - SD library might not support this specific card"));
+    Serial.println(F("   - Try formatting card with official SD Formatter tool"));
+    
+    Serial.println(F("\n5. Emergency Fix:"));
+    Serial.println(F("   - Format card in FAT32 using SD Association's formatter"));
+    Serial.println(F("   - Try using a different SD card reader"));
+    Serial.println(F("   - Check for physical damage to the SD slot"));
+    
+    // The CMD0 answers tell the likely cause apart
+    int errorType = sdMountDiagnosis(sdMount);
+    if (errorType == SD_DIAGNOSIS_DETECTION) {
+      Serial.println(F("\nDiagnosis: CARD DETECTION FAILURE"));
+      Serial.println(F("The SD card never answered. Check if card is inserted properly."));
+    } else if (errorType == SD_DIAGNOSIS_COMMUNICATION) {
+      Serial.println(F("\nDiagnosis: COMMUNICATION FAILURE"));
+      Serial.println(F("The SD card answered but not as expected. Check wiring."));
     } else {
-      // Recovery failed - report detailed diagnostic information
-      Serial.println(F("\n*** SD CARD RECOVERY FAILED ***"));
-      Serial.println(F("\nSD Card Error Diagnostics:"));
-      Serial.println(F("---------------------------"));
-      Serial.println(F("1. Hardware Check:"));
-      Serial.println(F("   - Ensure SD card is properly inserted"));
-      Serial.println(F("   - Check that SD card is not damaged or corrupted"));
-      Serial.println(F("   - Verify SD card is formatted as FAT16/FAT32"));
-      Serial.println(F("   - Try with a different SD card if available"));
-      
-      Serial.println(F("\n2. Wiring Check:"));
-      Serial.print(F("   - CS pin (D"));
-      Serial.print(SD_CS_PIN);
-      Serial.println(F(") connected properly"));
-      Serial.println(F("   - MISO connected to D8"));
-      Serial.println(F("   - MOSI connected to D10"));
-      Serial.println(F("   - SCK connected to D9"));
-      
-      Serial.println(F("\n3. Power Issues:"));
-      Serial.println(F("   - Check for stable power supply"));
-      Serial.println(F("   - SD card may require more current than available"));
-      Serial.println(F("   - Try with a different SD card (preferably Class 4 or 10)"));
-      
-      Serial.println(F("\n4. Software Issues:"));
-      Serial.println(F("   - SD library might not support this specific card"));
-      Serial.println(F("   - Try formatting card with official SD Formatter tool"));
-      
-      Serial.println(F("\n5. Emergency Fix:"));
-      Serial.println(F("   - Format card in FAT32 using SD Association's formatter"));
-      Serial.println(F("   - Try using a different SD card reader"));
-      Serial.println(F("   - Check for physical damage to the SD slot"));
-      
-      // Try to determine the most likely error type
-      int errorType;
-      
-      // Analyze timing of failure to guess error type
-      if (sdInitDuration < 100) {
-        errorType = 1; // Very quick failure suggests card detection issue
-        Serial.println(F("\nDiagnosis: CARD DETECTION FAILURE"));
-        Serial.println(F("The SD card is not being detected. Check if card is inserted properly."));
-      } else if (sdInitDuration < 500) {
-        errorType = 3; // Quick failure but with some activity suggests communication issue
-        Serial.println(F("\nDiagnosis: COMMUNICATION FAILURE"));
-        Serial.println(F("The SD card was detected but communication failed. Check wiring."));
-      } else {
-        errorType = 2; // Longer failure time suggests format or filesystem issue
-        Serial.println(F("\nDiagnosis: FORMAT OR FILESYSTEM ERROR"));
-        Serial.println(F("The SD card was detected but couldn't be mounted. Check format."));
-      }
-      
-      // Error visualization - Different patterns for different likely issues
-      Serial.println(F("\nError code visualization with LEDs:"));
-      Serial.println(F("Pattern 1: Card detection issue"));
-      Serial.println(F("Pattern 2: Format issue"));
-      Serial.println(F("Pattern 3: Wiring/communication issue"));
-      Serial.println(F("Pattern 4: File system corruption"));
-      
-      // Show the error pattern
+      Serial.println(F("\nDiagnosis: FORMAT OR FILESYSTEM ERROR"));
+      Serial.println(F("The SD card was detected but couldn't be mounted. Check format."));
+    }
+    
+    // Error visualization - Different patterns for different likely issues
+    Serial.println(F("\nError code visualization with LEDs:"));
+    Serial.println(F("Pattern 1: Card detection issue"));
+    Serial.println(F("Pattern 2: Format issue"));
+    Serial.println(F("Pattern 3: Wiring/communication issue"));
+    Serial.println(F("Pattern 4: File system corruption"));
+    
+    // Show the error pattern
+    showSDCardError(errorType);
+    
+    Serial.println(F("\nSystem halted due to unrecoverable SD card failure"));
+    Serial.println(F("Please fix the issues and restart the device"));
+    
+    // Halt system but with pattern indication
+    while (1) {
       showSDCardError(errorType);
-      
-      Serial.println(F("\nSystem halted due to unrecoverable SD card failure"));
-      Serial.println(F("Please fix the issues and restart the device"));
-      
-      // Halt system but with pattern indication
-      while (1) {
-        showSDCardError(errorType);
-        delay(1000);
-      }
+      delay(1000);
     }
   }
     // SD card initialization successful
   Serial.println(F("SUCCESS!"));
   Serial.print(F("SD card initialized after "));
-  Serial.print(retryCount);
+  Serial.print(sdMount.attempts);
   Serial.println(F(" attempt(s)"));
+  historySdMounted(sdMount.totalMs, sdMount.attempts);
+  bootTimingMark(BOOT_PHASE_SD_MOUNT);
   
   // Get SD card info when available
   Serial.println(F("\nSD Card Information:"));
   Serial.println(F("-------------------"));
   
-  // Run diagnostics on the SD card (with timeout protection)
+  // Read-only card information; nothing here writes to the card
   unsigned long diagStartTime = millis();
   
   // Show diagnostic running indicator
@@ -640,50 +717,8 @@ void setup() {
   Serial.print(F("Card Type: "));
   Serial.println(cardType);
   
-  // Test card health
-  char healthResult[50] = {0};
-  testSDCardHealth(healthResult, sizeof(healthResult));
-  Serial.println(healthResult);
-  
-  // Skip performance tests if they would take too long
-  if (millis() - diagStartTime < 3000) { // Only if diagnostics haven't taken too long already
-    // Test read speed
-    Serial.print(F("Testing read speed..."));
-    float readSpeed = testSDReadSpeed();
-    Serial.print(F(" "));
-    Serial.print(readSpeed, 1);
-    Serial.println(F(" KB/s"));
-    
-    // Test write speed if we still have time
-    if (millis() - diagStartTime < 5000) {
-      Serial.print(F("Testing write speed..."));
-      float writeSpeed = testSDWriteSpeed();
-      Serial.print(F(" "));
-      Serial.print(writeSpeed, 1);
-      Serial.println(F(" KB/s"));
-    }
-  } else {
-    Serial.println(F("Performance tests skipped (timeout)"));
-  }
-  
-  // Get approximate card size (skip if diagnostics taking too long)
-  if (millis() - diagStartTime < 7000) {
-    Serial.print(F("Approximate card size: "));
-    unsigned long sizeMB = getSDCardSizeApprox();
-    if (sizeMB > 0) {
-      if (sizeMB >= 1024) {
-        Serial.print(sizeMB / 1024);
-        Serial.println(F("GB+"));
-      } else {
-        Serial.print(sizeMB);
-        Serial.println(F("MB+"));
-      }
-    } else {
-      Serial.println(F("Unknown"));
-    }
-  } else {
-    Serial.println(F("Size detection skipped (timeout)"));
-  }
+  // The card health check reads the payload before it runs (card_health.ino);
+  // the tests that write to the card only run with the DIAG idle command
   
   // Calculate and show time spent on diagnostics
   unsigned long diagTime = millis() - diagStartTime;
@@ -693,15 +728,19 @@ void setup() {
   
   // Turn off diagnostic indicator LED
   digitalWrite(LED_USER, HIGH);
+  bootTimingMark(BOOT_PHASE_DIAGNOSTICS);
   
   // Display SD card info
   File root = SD.open("/");
   Serial.println(F("Files found on SD card:"));
   printDirectory(root, 0);
   root.close();
+  bootTimingMark(BOOT_PHASE_LISTING);
   
   // Read configuration file if it exists
   readConfigFile();
+  historyConfigLoaded();
+  bootTimingMark(BOOT_PHASE_CONFIG);
   
   // Apply initial delay from config if specified
   if (config.initialDelay > 0) {
@@ -710,8 +749,43 @@ void setup() {
     Serial.println(F(" milliseconds"));
     delay(config.initialDelay);
   }
+  bootTimingMark(BOOT_PHASE_INITIAL_DELAY);
   
   // Set repeat mode based on config
+  resetExecutionState();
+  
+  // Idle button (if wired) can re-run the script later without a reboot
+  setupIdleButton();
+  
+  // Skip script execution if autorun is disabled
+  if (!config.autorunOnBoot) {
+    Serial.println(F("Autorun is disabled in config. Skipping script execution."));
+    endBootTiming();
+    return;
+  }
+  // Choose appropriate script file based on config mode
+  String scriptFile;
+  if (!selectScriptFile(scriptFile)) {
+    // Stay idle rather than halt: a payload copied to the card can be run
+    // with RUN or the idle button without a reboot
+    Serial.println(F("Nothing to run. Add a script to the card, then send RUN or press the idle button."));
+    endBootTiming();
+    return;
+  }
+  bootTimingMark(BOOT_PHASE_SELECT);
+  
+  runScriptFile(scriptFile);
+  endBootTiming();
+}
+
+// Reset per-run interpreter state so a re-run starts from a clean slate
+void resetExecutionState() {
+  defaultDelay = 0;
+  setTypingSpeed(config.typingRate, config.typingBurst);
+  repeatScriptMode = false;
+  repeatScriptCount = 0;
+  currentRepeat = 0;
+  
   if (config.repeatCount > 0) {
     repeatScriptMode = true;
     repeatScriptCount = config.repeatCount;
@@ -719,14 +793,24 @@ void setup() {
     Serial.print(repeatScriptCount);
     Serial.println(F(" times"));
   }
-  
-  // Skip script execution if autorun is disabled
-  if (!config.autorunOnBoot) {
-    Serial.println(F("Autorun is disabled in config. Skipping script execution."));
-    return;
+}
+
+// Pick the script to run (catalog entry, primary, fallback or test file); false if none exists
+bool selectScriptFile(String &scriptFile) {
+  scriptRangeOffset = 0;
+  scriptRangeLength = 0;
+  scriptRangeCrc = 0;
+  scriptCatalogIndex = CATALOG_NO_ENTRY;
+  
+  // The catalog resolves the payload and any test file with one indexed read
+  bool catalogPresent = false;
+  if (selectFromCatalog(scriptFile, catalogPresent)) {
+    Serial.print(F("Using script file: "));
+    Serial.println(scriptFile);
+    return true;
   }
-  // Choose appropriate script file based on config mode
-  String scriptFile = (config.scriptMode == 1) ? config.duckyScriptFile : config.customScriptFile;
+  
+  scriptFile = (config.scriptMode == 1) ? config.duckyScriptFile : config.customScriptFile;
   Serial.print(F("Looking for primary script file: "));
   Serial.print(scriptFile);
   
@@ -744,14 +828,17 @@ void setup() {
       Serial.println(F("No script files found. Please add an instructions.txt or payload.txt file to your SD card."));
       // Script file not found
       flashLED(LED_TX, 5, 100); // Error indicator
-      while (1); // Stop execution
+      return false;
     }
     Serial.println(F(" - FOUND"));
   } else {
     Serial.println(F(" - FOUND"));
   }
-  // Check for test files
-  if (SD.exists("/test-layout.txt")) {
+  // Check for test files (already resolved by the catalog when there is one)
+  if (catalogPresent) {
+    // Nothing to probe
+  }
+  else if (SD.exists("/test-layout.txt")) {
     Serial.println(F("Layout test file found - running this instead to diagnose keyboard issues"));
     scriptFile = "/test-layout.txt";
   }
@@ -767,11 +854,48 @@ void setup() {
   Serial.print(F("Using script file: "));
   Serial.println(scriptFile);
   
+  return true;
+}
+
+// Execute the selected script, honouring the repeat settings
+void runScriptFile(const String &scriptFile) {
+  // Resume an interrupted run from its last checkpoint, if there is one
+  unsigned long resumeOffset = scriptRangeOffset;
+  int resumeLine = 0;
+  bool resuming = beginCheckpointedRun(scriptFile, resumeOffset, resumeLine);
+  beginRunHistory(resuming);
+  
+  // Watch the pause/abort controls for the whole run
+  beginEngineControl();
+  delayWorkSteps = 0;
+  delayWorkMicros = 0;
+  
+  // Compile the payload, or reuse the program cached from an earlier boot
+  bool compiled = prepareProgram(scriptFile);
+  
+  // Read-only check of the card, once per boot
+  if (!cardHealthChecked) {
+    compiled = checkCardHealth(scriptFile) && compiled;
+  }
+  
+  // Estimate the run time up front (from the program when there is one),
+  // then publish progress while it runs
+  unsigned long firstOffset = resuming ? resumeOffset : scriptRangeOffset;
+  unsigned long firstLength = (scriptRangeLength == 0) ? 0 : scriptRangeOffset + scriptRangeLength - firstOffset;
+  int iterations = !repeatScriptMode ? 1 : (repeatScriptCount == 0 ? 0 : repeatScriptCount - currentRepeat);
+  beginProgress(scriptFile, firstOffset, firstLength, scriptRangeOffset, scriptRangeLength, iterations, compiled);
+  
   // Announce Direct ASCII mode
   Serial.println(F("\n*** DIRECT ASCII MODE ACTIVE ***"));
   Serial.println(F("Using direct ASCII key handling to bypass layout issues"));
   
+  beginProfile(compiled);
+  beginReportTiming();
+  bootTimingMark(BOOT_PHASE_PREPARE);
+  
   do {
+    progressIterationStarted(repeatScriptMode && currentRepeat > 0);
+    
     // Reset for next iteration if in repeat mode
     if (repeatScriptMode && currentRepeat > 0) {
       Serial.print(F("Repeating script execution. Iteration "));
@@ -781,7 +905,7 @@ void setup() {
         Serial.print(repeatScriptCount);
       }
       Serial.println();
-      delay(1000); // Wait between repetitions
+      engineDelay(1000); // Wait between repetitions
       flashLED(LED_USER, 2, 100); // Signal new repetition
     }
       // Open and process script file
@@ -792,6 +916,7 @@ void setup() {
       flashLED(LED_USER, 2, 200);
       Serial.println(F("File opened successfully"));
       Serial.println(F("Executing script..."));
+      bootTimingMark(BOOT_PHASE_OPEN);
         // Process each line in the file
       int lineCount = 0;
       int executedCount = 0;
@@ -804,7 +929,19 @@ void setup() {
       if (useDirectASCII) {
         // Use direct ASCII mode execution
         Serial.println(F("Using DIRECT ASCII MODE for script execution"));
-        executeScript_DirectASCII(scriptFile);
+        unsigned long runOffset = resuming ? resumeOffset : scriptRangeOffset;
+        unsigned long runLength = (scriptRangeLength == 0) ? 0 : scriptRangeOffset + scriptRangeLength - runOffset;
+        scriptLineBase = resuming ? resumeLine : 0;
+        if (resuming) {
+          restoreCheckpointHeldKeys();
+        }
+        resuming = false;
+        if (compiled) {
+          executeProgram(scriptFile, runOffset);
+        } else {
+          executeScript_DirectASCII(scriptFile, runOffset, runLength);
+        }
+        profileLineStarted(0);
         
         // Since we're using an entirely different execution method,
         // we'll set some default counts
@@ -813,7 +950,9 @@ void setup() {
         skippedCount = 0;
       } else {
         // Use standard script execution
-        while (scriptFileHandle.available()) {
+        scriptFileHandle.seek(scriptRangeOffset);
+        while (!engineAbortRequested && scriptFileHandle.available() &&
+               (scriptRangeLength == 0 || scriptFileHandle.position() < scriptRangeOffset + scriptRangeLength)) {
           String line = scriptFileHandle.readStringUntil('\n');
           line.trim(); // Remove leading/trailing whitespace
           lineCount++;
@@ -875,6 +1014,12 @@ void setup() {
       Serial.print(F("Execution time: "));
       Serial.print(executionTime / 1000.0, 2);
       Serial.println(F(" seconds"));
+      Serial.print(F("Background work in delays: "));
+      Serial.print(delayWorkSteps);
+      Serial.print(F(" steps, "));
+      Serial.print(delayWorkMicros / 1000);
+      Serial.println(F("ms"));
+      printReportTiming();
       Serial.println(F("Script execution complete"));
       Serial.println(F("----------------------------------"));
       
@@ -889,6 +1034,11 @@ void setup() {
       
       currentRepeat++;
       
+      if (engineAbortRequested) {
+        Serial.println(F("Script aborted - remaining repetitions skipped"));
+        break;
+      }
+      
     } else {
       // Failed to open file
       Serial.print(F("ERROR: Failed to open script file: "));
@@ -897,30 +1047,46 @@ void setup() {
       break;
     }
   } while (repeatScriptMode && (repeatScriptCount == 0 || currentRepeat < repeatScriptCount));
+  
+  // Let go of keys the script left held
+  if (HidKeyboard.holding()) {
+    Serial.println(F("Releasing keys still held by HOLD"));
+    HidKeyboard.unholdAll();
+  }
+  
+  finishCheckpointedRun();
+  endRunHistory();
+  endProfile(scriptFile);
+  endProgress();
+  endEngineControl();
 }
 
 // Arduino SAMD doesn't have standard memory tracking variables like AVR
 // Using a simpler approach for SAMD21
 
-void loop() {
-  // Nothing to do in loop - all processing done in setup
-  // Just output a status message every 5 seconds to show the device is still running
+void GHOSTKEY_LOOP() {
+  // Script runs from setup(); the idle state only waits for a re-run request
+  handleIdleCommands();
+  
+  // Output a status message every 5 seconds when debugging, so a quiet
+  // device does not wake up just to print
   static unsigned long lastStatusTime = 0;
-  if (millis() - lastStatusTime > 5000) {
+  if (config.debugOutput && millis() - lastStatusTime > 5000) {
     Serial.println(F("Ghostkey idle - Script execution complete"));
-      // Only show extended debug info if debug output is enabled
-    if (config.debugOutput) {
-      // Report uptime
-      Serial.print(F("Uptime: "));
-      Serial.print(millis() / 1000);
-      Serial.println(F(" seconds"));
-      
-      // Note: Detailed memory usage reporting not available on SAMD21
-      // without external libraries
-    }
+    
+    // Report uptime
+    Serial.print(F("Uptime: "));
+    Serial.print(millis() / 1000);
+    Serial.println(F(" seconds"));
+    
+    // Note: Detailed memory usage reporting not available on SAMD21
+    // without external libraries
     
     lastStatusTime = millis();
   }
+  
+  // Sleep until the next tick, USB packet or button edge
+  idleSleepUntilEvent();
 }
 
 // Process a single instruction line from the custom format
@@ -954,34 +1120,45 @@ void processInstructionLine(String line) {
   
   // Execute the appropriate function based on the command
   if (command.equalsIgnoreCase("DELAY")) {
-    delay(params.toInt());
+    engineDelay(params.toInt());
   } 
   else if (command.equalsIgnoreCase("RUN")) {
     run();
   } 
   else if (command.equalsIgnoreCase("ADMIN")) {
     admin();
-  }  else if (command.equalsIgnoreCase("TYPE")) {
+  }
+  else if (command.equalsIgnoreCase("SPEED")) {
+    applySpeedDirective(params);
+  }
+  else if (command.equalsIgnoreCase("HOLD")) {
+    holdKeysLine(params);
+  }
+  else if (command.equalsIgnoreCase("RELEASE")) {
+    releaseKeysLine(params);
+  }
+  else if (command.equalsIgnoreCase("TYPE")) {
     if (config.useLayoutIndependent) {
       typeLayoutIndependent(params);
     } else {
-      Keyboard.print(params);
+      HidKeyboard.print(params);
     }
   }
   else if (command.equalsIgnoreCase("TYPELINE")) {
     if (config.useLayoutIndependent) {
       typeLayoutIndependent(params);
-      Keyboard.press(KEY_RETURN);
-      Keyboard.releaseAll();
+      HidKeyboard.press(KEY_RETURN);
+      HidKeyboard.releaseAll();
     } else {
-      Keyboard.println(params);
+      HidKeyboard.println(params);
     }
   }
   else if (command.equalsIgnoreCase("TYPESOFT")) {
+    // Same as TYPE; slow typing is set with SPEED now
     if (config.useLayoutIndependent) {
-      typeLayoutIndependentWithDelay(params, config.typingDelay);
+      typeLayoutIndependent(params);
     } else {
-      typeWithDelay(params);
+      HidKeyboard.print(params);
     }
   }
   else if (command.equalsIgnoreCase("OPENNOTPAD")) {
@@ -1011,18 +1188,18 @@ void processInstructionLine(String line) {
   else if (command.equalsIgnoreCase("KEY")) {
     // Handle special keys
     if (params.equalsIgnoreCase("RETURN") || params.equalsIgnoreCase("ENTER")) {
-      Keyboard.press(KEY_RETURN);
-      Keyboard.releaseAll();
+      HidKeyboard.press(KEY_RETURN);
+      HidKeyboard.releaseAll();
     }
     else if (params.equalsIgnoreCase("TAB")) {
-      Keyboard.press(KEY_TAB);
-      Keyboard.releaseAll();
+      HidKeyboard.press(KEY_TAB);
+      HidKeyboard.releaseAll();
     }
     // Add more special keys as needed
   }
   
   // Add a small delay between commands for stability
-  delay(defaultDelay);
+  engineDelay(defaultDelay);
 }
 
 // Process a single line in Ducky Script format
@@ -1077,7 +1254,18 @@ void processDuckyLine(String line) {
     Serial.print(F("Delaying for "));
     Serial.print(params.toInt());
     Serial.println(F("ms"));
-    delay(params.toInt());
+    engineDelay(params.toInt());
+  }
+  else if (command.equals("SPEED")) {
+    // Typing pace for the following lines
+    applySpeedDirective(params);
+  }
+  else if (command.equals("HOLD")) {
+    // Keep keys down across the following lines
+    holdKeysLine(params);
+  }
+  else if (command.equals("RELEASE")) {
+    releaseKeysLine(params);
   }
   else if (command.equals("STRING")) {
     // Type out a string of characters
@@ -1089,7 +1277,7 @@ void processDuckyLine(String line) {
       typeLayoutIndependent(params);
     } else {
       Serial.println(F("Using standard typing"));
-      Keyboard.print(params);
+      HidKeyboard.print(params);
     }
   }
   else if (command.equals("STRINGLN")) {
@@ -1101,14 +1289,18 @@ void processDuckyLine(String line) {
       Serial.println(F("Using layout-independent typing"));
       typeLayoutIndependent(params);
       delay(50); // Add delay before pressing Enter
-      Keyboard.press(KEY_RETURN);
+      HidKeyboard.press(KEY_RETURN);
       delay(50); // Hold Enter for a moment
-      Keyboard.releaseAll();
+      HidKeyboard.releaseAll();
     } else {
       Serial.println(F("Using standard typing"));
-      Keyboard.println(params);
+      HidKeyboard.println(params);
     }
   }
+  else if (command.equals("CHECKPOINT")) {
+    // Save the execution position after this line
+    requestCheckpoint();
+  }
   else if (command.equals("REPEAT")) {
     // Set script to repeat
     repeatScriptMode = true;
@@ -1123,7 +1315,7 @@ void processDuckyLine(String line) {
     
     if (params.length() > 0) {
       // GUI + key
-      Keyboard.press(KEY_LEFT_GUI);
+      HidKeyboard.press(KEY_LEFT_GUI);
       delay(50); // Add delay to ensure GUI key is registered
       
       if (params.length() == 1) {
@@ -1137,14 +1329,14 @@ void processDuckyLine(String line) {
           Serial.print(F("Using raw keycode: "));
           Serial.println(rawKey);
           
-          Keyboard.press(rawKey);
+          HidKeyboard.press(rawKey);
           delay(100); // Hold the combination longer
-          Keyboard.releaseAll();
+          HidKeyboard.releaseAll();
         } else {
           Serial.println(F("Using standard key press"));
-          Keyboard.press(key);
+          HidKeyboard.press(key);
           delay(100); // Hold the combination longer
-          Keyboard.releaseAll();
+          HidKeyboard.releaseAll();
         }
       } else {
         // For named keys like "ENTER", "TAB", etc.
@@ -1152,20 +1344,20 @@ void processDuckyLine(String line) {
         Serial.println(params);
         pressKey(params);
         delay(100);
-        Keyboard.releaseAll();
+        HidKeyboard.releaseAll();
       }
     } else {
       // Just GUI key
       Serial.println(F("Pressing GUI key alone"));
-      Keyboard.press(KEY_LEFT_GUI);
+      HidKeyboard.press(KEY_LEFT_GUI);
       delay(100);
-      Keyboard.releaseAll();
+      HidKeyboard.releaseAll();
     }
   }
   else if (command.equals("MENU") || command.equals("APP")) {
     // Menu/App key
-    Keyboard.press(KEY_MENU);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_MENU);
+    HidKeyboard.releaseAll();
   }  else if (command.equals("SHIFT")) {
     Serial.print(F("SHIFT + "));
     Serial.println(params);
@@ -1183,12 +1375,12 @@ void processDuckyLine(String line) {
           char upperKey = key - 32;  // Convert to uppercase ASCII
           Serial.print(F("Converting to uppercase ASCII: "));
           Serial.println(upperKey);
-          Keyboard.write(upperKey);
+          HidKeyboard.write(upperKey);
           delay(50);
         }
         // For numbers and special characters that need shift
         else {
-          Keyboard.press(KEY_LEFT_SHIFT);
+          HidKeyboard.press(KEY_LEFT_SHIFT);
           delay(250); // Much longer delay for SHIFT to register
           
           if (config.useLayoutIndependent && key >= '0' && key <= '9') {
@@ -1199,16 +1391,16 @@ void processDuckyLine(String line) {
             
             Serial.print(F("Using raw keycode for number: "));
             Serial.println(rawKey);
-            Keyboard.press(rawKey);
+            HidKeyboard.press(rawKey);
           } else {
             // For other characters
             Serial.print(F("Using standard SHIFT + key press: "));
             Serial.println(key);
-            Keyboard.press(key);
+            HidKeyboard.press(key);
           }
           
           delay(250); // Hold the combination much longer
-          Keyboard.releaseAll();
+          HidKeyboard.releaseAll();
           delay(50);  // Small delay after releasing
         }
       } else {
@@ -1217,29 +1409,29 @@ void processDuckyLine(String line) {
         Serial.println(params);
         
         // Press SHIFT first with a longer delay
-        Keyboard.press(KEY_LEFT_SHIFT);
+        HidKeyboard.press(KEY_LEFT_SHIFT);
         delay(250); // Much longer delay for SHIFT
         
         // Handle common special keys with direct keycodes
         if (params.equalsIgnoreCase("RIGHT") || params.equalsIgnoreCase("RIGHTARROW")) {
           Serial.println(F("Using direct keycode for RIGHT ARROW"));
-          Keyboard.press(KEY_RIGHT_ARROW);
+          HidKeyboard.press(KEY_RIGHT_ARROW);
         } 
         else if (params.equalsIgnoreCase("LEFT") || params.equalsIgnoreCase("LEFTARROW")) {
           Serial.println(F("Using direct keycode for LEFT ARROW"));
-          Keyboard.press(KEY_LEFT_ARROW);
+          HidKeyboard.press(KEY_LEFT_ARROW);
         }
         else if (params.equalsIgnoreCase("UP") || params.equalsIgnoreCase("UPARROW")) {
           Serial.println(F("Using direct keycode for UP ARROW"));
-          Keyboard.press(KEY_UP_ARROW);
+          HidKeyboard.press(KEY_UP_ARROW);
         }
         else if (params.equalsIgnoreCase("DOWN") || params.equalsIgnoreCase("DOWNARROW")) {
           Serial.println(F("Using direct keycode for DOWN ARROW"));
-          Keyboard.press(KEY_DOWN_ARROW);
+          HidKeyboard.press(KEY_DOWN_ARROW);
         }
         else if (params.equalsIgnoreCase("TAB")) {
           Serial.println(F("Using direct keycode for TAB"));
-          Keyboard.press(KEY_TAB);
+          HidKeyboard.press(KEY_TAB);
         }
         else {
           // For other keys, use standard method
@@ -1247,15 +1439,15 @@ void processDuckyLine(String line) {
         }
         
         delay(250); // Hold the combination much longer
-        Keyboard.releaseAll();
+        HidKeyboard.releaseAll();
         delay(50);  // Small delay after releasing
       }
     } else {
       // Just SHIFT key
       Serial.println(F("Pressing SHIFT key alone"));
-      Keyboard.press(KEY_LEFT_SHIFT);
+      HidKeyboard.press(KEY_LEFT_SHIFT);
       delay(250); // Much longer press for SHIFT alone
-      Keyboard.releaseAll();
+      HidKeyboard.releaseAll();
       delay(50);  // Small delay after releasing
     }
   }  else if (command.equals("ALT")) {
@@ -1264,7 +1456,7 @@ void processDuckyLine(String line) {
     
     if (params.length() > 0) {
       // ALT + key
-      Keyboard.press(KEY_LEFT_ALT);
+      HidKeyboard.press(KEY_LEFT_ALT);
       delay(200); // Increased delay to ensure ALT key is registered
       
       if (params.length() == 1) {
@@ -1278,14 +1470,14 @@ void processDuckyLine(String line) {
           Serial.print(F("Using raw keycode: "));
           Serial.println(rawKey);
           
-          Keyboard.press(rawKey);
+          HidKeyboard.press(rawKey);
           delay(200); // Increased: Hold the combination longer
-          Keyboard.releaseAll();
+          HidKeyboard.releaseAll();
         } else {
           Serial.println(F("Using standard key press"));
-          Keyboard.press(key);
+          HidKeyboard.press(key);
           delay(200); // Increased: Hold the combination longer
-          Keyboard.releaseAll();
+          HidKeyboard.releaseAll();
         }
       } else {
         // For named keys like "ENTER", "TAB", etc.
@@ -1293,14 +1485,14 @@ void processDuckyLine(String line) {
         Serial.println(params);
         pressKey(params);
         delay(200); // Increased delay
-        Keyboard.releaseAll();
+        HidKeyboard.releaseAll();
       }
     } else {
       // Just ALT key
       Serial.println(F("Pressing ALT key alone"));
-      Keyboard.press(KEY_LEFT_ALT);
+      HidKeyboard.press(KEY_LEFT_ALT);
       delay(200); // Increased delay
-      Keyboard.releaseAll();
+      HidKeyboard.releaseAll();
     }
   }  else if (command.equals("CTRL") || command.equals("CONTROL")) {
     Serial.print(F("CTRL + "));
@@ -1308,7 +1500,7 @@ void processDuckyLine(String line) {
     
     if (params.length() > 0) {
       // CTRL + key
-      Keyboard.press(KEY_LEFT_CTRL);
+      HidKeyboard.press(KEY_LEFT_CTRL);
       delay(200); // Increased delay to ensure CTRL key is registered
       
       if (params.length() == 1) {
@@ -1322,31 +1514,31 @@ void processDuckyLine(String line) {
           Serial.print(F("Using raw keycode: "));
           Serial.println(rawKey);
           
-          Keyboard.press(rawKey);
+          HidKeyboard.press(rawKey);
           delay(200); // Increased: Hold the combination longer
-          Keyboard.releaseAll();
+          HidKeyboard.releaseAll();
         } else {
           // For other characters
-          Keyboard.press(key);
+          HidKeyboard.press(key);
           delay(200); // Add delay before releasing
-          Keyboard.releaseAll();
+          HidKeyboard.releaseAll();
         }
       } else {
         pressKey(params);
         delay(200); // Add delay before releasing
-        Keyboard.releaseAll();
+        HidKeyboard.releaseAll();
       }
     } else {
       // Just CTRL key
-      Keyboard.press(KEY_LEFT_CTRL);
+      HidKeyboard.press(KEY_LEFT_CTRL);
       delay(200); // Longer press
-      Keyboard.releaseAll();
+      HidKeyboard.releaseAll();
     }
   }  else if (command.equals("ENTER")) {
     Serial.println(F("Pressing ENTER key"));
-    Keyboard.press(KEY_RETURN);
+    HidKeyboard.press(KEY_RETURN);
     delay(50); // Hold key for 50ms
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("SPACE")) {
     Serial.println(F("Pressing SPACE key"));
@@ -1355,182 +1547,211 @@ void processDuckyLine(String line) {
       pressRawKey(44, false); // Space is keycode 44
     } else {
       Serial.println(F("Using standard space key"));
-      Keyboard.press(' ');
+      HidKeyboard.press(' ');
       delay(50);
-      Keyboard.releaseAll();
+      HidKeyboard.releaseAll();
     }
   }  else if (command.equals("BACKSPACE")) {
     Serial.println(F("Pressing BACKSPACE key"));
-    Keyboard.press(KEY_BACKSPACE);
+    HidKeyboard.press(KEY_BACKSPACE);
     delay(200);  // Increased delay to ensure key is registered
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
     delay(50);  // Add a small delay after releasing
   }
   else if (command.equals("TAB")) {
     Serial.println(F("Pressing TAB key"));
-    Keyboard.press(KEY_TAB);
+    HidKeyboard.press(KEY_TAB);
     delay(200);  // Increased delay to ensure key is registered
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
     delay(50);  // Add a small delay after releasing
   }
   else if (command.equals("CAPSLOCK")) {
     Serial.println(F("Pressing CAPS LOCK key"));
-    Keyboard.press(KEY_CAPS_LOCK);
+    HidKeyboard.press(KEY_CAPS_LOCK);
     delay(50);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("DELETE")) {
     Serial.println(F("Pressing DELETE key"));
-    Keyboard.press(KEY_DELETE);
+    HidKeyboard.press(KEY_DELETE);
     delay(50);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("END")) {
     Serial.println(F("Pressing END key"));
-    Keyboard.press(KEY_END);
+    HidKeyboard.press(KEY_END);
     delay(50);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("ESC") || command.equals("ESCAPE")) {
     Serial.println(F("Pressing ESCAPE key"));
-    Keyboard.press(KEY_ESC);
+    HidKeyboard.press(KEY_ESC);
     delay(50);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("HOME")) {
     Serial.println(F("Pressing HOME key"));
-    Keyboard.press(KEY_HOME);
+    HidKeyboard.press(KEY_HOME);
     delay(50);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("INSERT")) {
     Serial.println(F("Pressing INSERT key"));
-    Keyboard.press(KEY_INSERT);
+    HidKeyboard.press(KEY_INSERT);
     delay(50);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("PAGEUP")) {
     Serial.println(F("Pressing PAGE UP key"));
-    Keyboard.press(KEY_PAGE_UP);
+    HidKeyboard.press(KEY_PAGE_UP);
     delay(50);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("PAGEDOWN")) {
     Serial.println(F("Pressing PAGE DOWN key"));
-    Keyboard.press(KEY_PAGE_DOWN);
+    HidKeyboard.press(KEY_PAGE_DOWN);
     delay(50);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("PRINTSCREEN")) {
-    Keyboard.press(KEY_PRINT_SCREEN);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_PRINT_SCREEN);
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("F1")) {
-    Keyboard.press(KEY_F1);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_F1);
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("F2")) {
-    Keyboard.press(KEY_F2);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_F2);
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("F3")) {
-    Keyboard.press(KEY_F3);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_F3);
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("F4")) {
-    Keyboard.press(KEY_F4);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_F4);
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("F5")) {
-    Keyboard.press(KEY_F5);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_F5);
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("F6")) {
-    Keyboard.press(KEY_F6);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_F6);
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("F7")) {
-    Keyboard.press(KEY_F7);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_F7);
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("F8")) {
-    Keyboard.press(KEY_F8);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_F8);
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("F9")) {
-    Keyboard.press(KEY_F9);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_F9);
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("F10")) {
-    Keyboard.press(KEY_F10);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_F10);
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("F11")) {
-    Keyboard.press(KEY_F11);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_F11);
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("F12")) {
-    Keyboard.press(KEY_F12);
-    Keyboard.releaseAll();
+    HidKeyboard.press(KEY_F12);
+    HidKeyboard.releaseAll();
   }  else if (command.equals("UP") || command.equals("UPARROW")) {
     Serial.println(F("Pressing UP ARROW key"));
-    Keyboard.press(KEY_UP_ARROW);
+    HidKeyboard.press(KEY_UP_ARROW);
     delay(50);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("DOWN") || command.equals("DOWNARROW")) {
     Serial.println(F("Pressing DOWN ARROW key"));
-    Keyboard.press(KEY_DOWN_ARROW);
+    HidKeyboard.press(KEY_DOWN_ARROW);
     delay(50);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("LEFT") || command.equals("LEFTARROW")) {
     Serial.println(F("Pressing LEFT ARROW key"));
-    Keyboard.press(KEY_LEFT_ARROW);
+    HidKeyboard.press(KEY_LEFT_ARROW);
     delay(50);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("RIGHT") || command.equals("RIGHTARROW")) {
     Serial.println(F("Pressing RIGHT ARROW key"));
-    Keyboard.press(KEY_RIGHT_ARROW);
+    HidKeyboard.press(KEY_RIGHT_ARROW);
     delay(50);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   else if (command.equals("PAUSE") || command.equals("BREAK")) {
     Serial.println(F("Pressing PAUSE/BREAK key"));
-    Keyboard.press(KEY_PAUSE);
+    HidKeyboard.press(KEY_PAUSE);
     delay(50);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
   }
   // Custom extension to support more complex key combinations
   else if (line.indexOf("+") != -1) {
-    // Process key combinations, e.g. CTRL+ALT+DELETE
-    int plusIndex = 0;
-    int startIndex = 0;
-    String combinedKeys[5]; // Support up to 5 keys in combination
-    int keyCount = 0;
-    
-    while ((plusIndex = line.indexOf("+", startIndex)) != -1 && keyCount < 5) {
-      combinedKeys[keyCount++] = line.substring(startIndex, plusIndex);
-      startIndex = plusIndex + 1;
-    }
-    
-    // Add the last key after the last +
-    if (startIndex < line.length() && keyCount < 5) {
-      combinedKeys[keyCount++] = line.substring(startIndex);
-    }
-    
-    // Press all keys in the combination
-    for (int i = 0; i < keyCount; i++) {
-      pressKey(combinedKeys[i]);
-    }
-    
-    // Release all keys
-    Keyboard.releaseAll();
+    // Process key combinations, e.g. CTRL+ALT+DELETE, as a single chord
+    pressChordLine(line);
   }
 
   // Wait the default delay after each command
-  delay(defaultDelay);
+  engineDelay(defaultDelay);
+}
+
+// Compile a "+" combination and send it as one press and one release report
+void pressChordLine(const String &line) {
+  KeyReport chord;
+  String badKey;
+  if (!compileChord(line, chord, badKey)) {
+    Serial.print(F("Unknown key in combination: "));
+    Serial.println(badKey);
+    return;
+  }
+  
+  Serial.print(F("Chord: modifiers 0x"));
+  Serial.print(chord.modifiers, HEX);
+  Serial.print(F(", keys"));
+  for (int i = 0; i < 6 && chord.keys[i] != 0; i++) {
+    Serial.print(F(" 0x"));
+    Serial.print(chord.keys[i], HEX);
+  }
+  Serial.println();
+  sendChord(chord);
+}
+
+// HOLD <combination>: press it and keep it down for the following lines
+void holdKeysLine(const String &params) {
+  KeyReport chord;
+  String badKey;
+  if (!compileChord(params, chord, badKey)) {
+    Serial.print(F("Unknown key in HOLD: "));
+    Serial.println(badKey);
+    return;
+  }
+  HidKeyboard.hold(chord);
+}
+
+// RELEASE [<combination>]: let go of held keys; all of them without a
+// combination or with ALL
+void releaseKeysLine(const String &params) {
+  if (params.length() == 0 || params.equalsIgnoreCase("ALL")) {
+    HidKeyboard.unholdAll();
+    return;
+  }
+  KeyReport chord;
+  String badKey;
+  if (!compileChord(params, chord, badKey)) {
+    Serial.print(F("Unknown key in RELEASE: "));
+    Serial.println(badKey);
+    return;
+  }
+  HidKeyboard.unhold(chord);
 }
 
 // Press a key based on its string name
@@ -1544,120 +1765,120 @@ void pressKey(String keyString) {
       typeLayoutIndependentChar(c);
       return;
     } else {
-      Keyboard.press(keyString[0]);
+      HidKeyboard.press(keyString[0]);
       return;
     }
   }
   
   // Check for function keys and other special keys
   if (keyString.equals("CTRL") || keyString.equals("CONTROL")) {
-    Keyboard.press(KEY_LEFT_CTRL);
+    HidKeyboard.press(KEY_LEFT_CTRL);
   }
   else if (keyString.equals("SHIFT")) {
-    Keyboard.press(KEY_LEFT_SHIFT);
+    HidKeyboard.press(KEY_LEFT_SHIFT);
   }
   else if (keyString.equals("ALT")) {
-    Keyboard.press(KEY_LEFT_ALT);
+    HidKeyboard.press(KEY_LEFT_ALT);
   }
   else if (keyString.equals("GUI") || keyString.equals("WINDOWS")) {
-    Keyboard.press(KEY_LEFT_GUI);
+    HidKeyboard.press(KEY_LEFT_GUI);
   }
   else if (keyString.equals("ENTER")) {
-    Keyboard.press(KEY_RETURN);
+    HidKeyboard.press(KEY_RETURN);
   }
   else if (keyString.equals("SPACE")) {
     if (USE_LAYOUT_INDEPENDENT) {
       pressRawKey(44, false); // Space is keycode 44
     } else {
-      Keyboard.press(' ');
+      HidKeyboard.press(' ');
     }
   }
   else if (keyString.equals("BACKSPACE")) {
-    Keyboard.press(KEY_BACKSPACE);
+    HidKeyboard.press(KEY_BACKSPACE);
   }
   else if (keyString.equals("TAB")) {
-    Keyboard.press(KEY_TAB);
+    HidKeyboard.press(KEY_TAB);
   }
   else if (keyString.equals("CAPSLOCK")) {
-    Keyboard.press(KEY_CAPS_LOCK);
+    HidKeyboard.press(KEY_CAPS_LOCK);
   }
   else if (keyString.equals("DELETE")) {
-    Keyboard.press(KEY_DELETE);
+    HidKeyboard.press(KEY_DELETE);
   }
   else if (keyString.equals("END")) {
-    Keyboard.press(KEY_END);
+    HidKeyboard.press(KEY_END);
   }
   else if (keyString.equals("ESC") || keyString.equals("ESCAPE")) {
-    Keyboard.press(KEY_ESC);
+    HidKeyboard.press(KEY_ESC);
   }
   else if (keyString.equals("HOME")) {
-    Keyboard.press(KEY_HOME);
+    HidKeyboard.press(KEY_HOME);
   }
   else if (keyString.equals("INSERT")) {
-    Keyboard.press(KEY_INSERT);
+    HidKeyboard.press(KEY_INSERT);
   }
   else if (keyString.equals("PAGEUP")) {
-    Keyboard.press(KEY_PAGE_UP);
+    HidKeyboard.press(KEY_PAGE_UP);
   }
   else if (keyString.equals("PAGEDOWN")) {
-    Keyboard.press(KEY_PAGE_DOWN);
+    HidKeyboard.press(KEY_PAGE_DOWN);
   }
   else if (keyString.equals("PRINTSCREEN")) {
-    Keyboard.press(KEY_PRINT_SCREEN);
+    HidKeyboard.press(KEY_PRINT_SCREEN);
   }
   else if (keyString.equals("F1")) {
-    Keyboard.press(KEY_F1);
+    HidKeyboard.press(KEY_F1);
   }
   else if (keyString.equals("F2")) {
-    Keyboard.press(KEY_F2);
+    HidKeyboard.press(KEY_F2);
   }
   else if (keyString.equals("F3")) {
-    Keyboard.press(KEY_F3);
+    HidKeyboard.press(KEY_F3);
   }
   else if (keyString.equals("F4")) {
-    Keyboard.press(KEY_F4);
+    HidKeyboard.press(KEY_F4);
   }
   else if (keyString.equals("F5")) {
-    Keyboard.press(KEY_F5);
+    HidKeyboard.press(KEY_F5);
   }
   else if (keyString.equals("F6")) {
-    Keyboard.press(KEY_F6);
+    HidKeyboard.press(KEY_F6);
   }
   else if (keyString.equals("F7")) {
-    Keyboard.press(KEY_F7);
+    HidKeyboard.press(KEY_F7);
   }
   else if (keyString.equals("F8")) {
-    Keyboard.press(KEY_F8);
+    HidKeyboard.press(KEY_F8);
   }
   else if (keyString.equals("F9")) {
-    Keyboard.press(KEY_F9);
+    HidKeyboard.press(KEY_F9);
   }
   else if (keyString.equals("F10")) {
-    Keyboard.press(KEY_F10);
+    HidKeyboard.press(KEY_F10);
   }
   else if (keyString.equals("F11")) {
-    Keyboard.press(KEY_F11);
+    HidKeyboard.press(KEY_F11);
   }
   else if (keyString.equals("F12")) {
-    Keyboard.press(KEY_F12);
+    HidKeyboard.press(KEY_F12);
   }
   else if (keyString.equals("UP") || keyString.equals("UPARROW")) {
-    Keyboard.press(KEY_UP_ARROW);
+    HidKeyboard.press(KEY_UP_ARROW);
   }
   else if (keyString.equals("DOWN") || keyString.equals("DOWNARROW")) {
-    Keyboard.press(KEY_DOWN_ARROW);
+    HidKeyboard.press(KEY_DOWN_ARROW);
   }
   else if (keyString.equals("LEFT") || keyString.equals("LEFTARROW")) {
-    Keyboard.press(KEY_LEFT_ARROW);
+    HidKeyboard.press(KEY_LEFT_ARROW);
   }
   else if (keyString.equals("RIGHT") || keyString.equals("RIGHTARROW")) {
-    Keyboard.press(KEY_RIGHT_ARROW);
+    HidKeyboard.press(KEY_RIGHT_ARROW);
   }
   else if (keyString.equals("PAUSE") || keyString.equals("BREAK")) {
-    Keyboard.press(KEY_PAUSE);
+    HidKeyboard.press(KEY_PAUSE);
   }
   else if (keyString.equals("MENU") || keyString.equals("APP")) {
-    Keyboard.press(KEY_MENU);
+    HidKeyboard.press(KEY_MENU);
   }
 }
 
@@ -1690,14 +1911,35 @@ void flashLED(int led, int times, int duration) {
   }
 }
 
-// Type text with delay between keystrokes
-void typeWithDelay(String text) {
-  for (unsigned int i = 0; i < text.length(); i++) {
-    Keyboard.write(text.charAt(i));
-    delay(TYPING_DELAY);
+// Set the typing pace from a typingSpeedValue() (or TYPING_SPEED_DEFAULT)
+void applyTypingSpeed(uint32_t value) {
+  if (value == TYPING_SPEED_DEFAULT) {
+    setTypingSpeed(config.typingRate, config.typingBurst);
+  } else {
+    setTypingSpeed(typingSpeedRate(value), typingSpeedBurst(value));
+  }
+  Serial.print(F("Typing speed: "));
+  if (typingPacer.rate() == TYPING_RATE_UNLIMITED) {
+    Serial.println(F("unpaced"));
+  } else {
+    Serial.print(typingPacer.rate());
+    Serial.print(F(" keys/s, burst "));
+    Serial.println(typingPacer.burst());
   }
 }
 
+// SPEED <keys per second> [burst] | MAX | DEFAULT
+bool applySpeedDirective(const String &params) {
+  uint32_t value;
+  if (!typingParseSpeed(params.c_str(), params.length(), value)) {
+    Serial.print(F("Invalid SPEED, ignored: "));
+    Serial.println(params);
+    return false;
+  }
+  applyTypingSpeed(value);
+  return true;
+}
+
 // Function to print directory contents with indentation
 void printDirectory(File dir, int numTabs) {
   while (true) {
@@ -1776,49 +2018,7 @@ void showSDCardError(int errorPattern) {
   }
 }
 
-// Function to attempt SD card recovery
-bool attemptSDCardRecovery() {
-  Serial.println(F("\nAttempting SD Card Recovery..."));
-  
-  // Visual indication of recovery attempt
-  flashLED(LED_USER, 2, 100);
-  
-  // Step 1: Reinitialize SPI bus
-  Serial.println(F("1. Reinitializing SPI bus..."));
-  SPI.end();
-  delay(250);
-  SPI.begin();
-  delay(250);
-  
-  // Step 2: Try with different SPI speed
-  Serial.println(F("2. Trying with lower SPI speed..."));
-  // Note: SD.begin() on SAMD21 doesn't allow setting the speed directly
-  // But we can try the basic initialization again
-  if (SD.begin(SD_CS_PIN)) {
-    Serial.println(F("Recovery successful!"));
-    return true;
-  }
-  
-  // Step 3: Check if card is physically present
-  Serial.println(F("3. Testing physical card presence..."));
-  pinMode(SD_CS_PIN, OUTPUT);
-  digitalWrite(SD_CS_PIN, LOW);
-  SPI.transfer(0xFF); // Send dummy byte
-  digitalWrite(SD_CS_PIN, HIGH);
-  delay(100);
-  
-  // Last attempt with standard settings
-  Serial.println(F("4. Final attempt with standard settings..."));
-  if (SD.begin(SD_CS_PIN)) {
-    Serial.println(F("Recovery successful on final attempt!"));
-    return true;
-  }
-  
-  Serial.println(F("Recovery failed. Please check hardware."));
-  return false;
-}
-
-// Function to run full SD card diagnostics
+// Full SD card diagnostics (DIAG idle command); most of these tests write to the card
 void runSDCardDiagnostics() {
   Serial.println(F("\nRunning full SD card diagnostics..."));
   
@@ -1833,10 +2033,10 @@ void runSDCardDiagnostics() {
   Serial.print(F("Card Type: "));
   Serial.println(cardType);
   
-  // 2. Test card health
-  char healthResult[50] = {0};
-  testSDCardHealth(healthResult, sizeof(healthResult));
-  Serial.println(healthResult);
+  // 2. Card health (read-only, measured by the boot run)
+  if (cardHealthChecked) {
+    printCardHealth();
+  }
   
   // 3. Test read speed
   Serial.print(F("Read Speed: "));
@@ -1849,6 +2049,15 @@ void runSDCardDiagnostics() {
   float writeSpeed = testSDWriteSpeed();
   Serial.print(writeSpeed, 1);
   Serial.println(F(" KB/s"));
+
+  // 4b. Worst latency of small log writes
+  unsigned long appendWorst, preallocatedWorst;
+  testSDLogLatency(appendWorst, preallocatedWorst);
+  Serial.print(F("Log Write Latency: "));
+  Serial.print(appendWorst);
+  Serial.print(F(" us worst appending, "));
+  Serial.print(preallocatedWorst);
+  Serial.println(F(" us worst preallocated"));
   
   // 5. Get card capacity (approximate)
   Serial.print(F("Approx. Capacity: "));
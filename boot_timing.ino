@@ -0,0 +1,45 @@
+/*
+ * Boot Timing - Reset to First Keystroke
+ *
+ * How long after plug-in the first keystroke lands is the figure that
+ * matters most in the field. setup() and the boot run mark the end of each
+ * boot phase (lib/boot-timing.h) and the first HID report closes the
+ * record. When the boot run ends the record is printed as one BOOT-TIMING
+ * line; the BOOT serial command prints it again while idle and REBOOT
+ * resets the board, so tools/boot_timing.py can repeat the boot over CDC
+ * and report the distribution of every phase.
+ *
+ * Re-runs from the idle state do not touch the record.
+ */
+
+BootTiming bootTiming;
+bool bootTimingOpen = false; // Phases are marked until the boot run ends
+
+// Called first thing in setup()
+void beginBootTiming() {
+  bootTimingClear(bootTiming);
+  bootTimingOpen = true;
+  bootTimingMark(BOOT_PHASE_SETUP);
+}
+
+// Record the end of a boot phase (only the first time it ends)
+void bootTimingMark(uint8_t phase) {
+  if (bootTimingOpen && bootTiming.endMs[phase] == BOOT_TIMING_NONE) {
+    bootTiming.endMs[phase] = millis();
+  }
+}
+
+void printBootTiming() {
+  char line[320];
+  bootTimingFormat(line, sizeof(line), bootTiming);
+  Serial.println(line);
+}
+
+// Called when setup() is done, after the boot run
+void endBootTiming() {
+  if (!bootTimingOpen) {
+    return;
+  }
+  bootTimingOpen = false;
+  printBootTiming();
+}
@@ -11,6 +11,43 @@
 // We're using the typeDirectASCII function defined in layout-utils.h
 // No need to redefine it here
 
+// Card path of an INCLUDE parameter (leading / added if missing)
+String includePath(String path) {
+  path.trim();
+  if (!path.startsWith("/")) {
+    path = "/" + path;
+  }
+  return path;
+}
+
+// Run the lines of an included snippet file, as if they stood in place of
+// the INCLUDE line. Snippets may include others up to PROGRAM_MAX_CALL_DEPTH.
+void runIncludedScript(const String &path) {
+  static int depth = 0;
+  if (depth >= PROGRAM_MAX_CALL_DEPTH) {
+    Serial.print(F("INCLUDE nested too deeply, skipped: "));
+    Serial.println(path);
+    return;
+  }
+  File snippet = SD.open(path);
+  if (!snippet) {
+    Serial.print(F("INCLUDE file not found: "));
+    Serial.println(path);
+    return;
+  }
+  
+  depth++;
+  while (snippet.available() && !engineAbortRequested) {
+    String line = snippet.readStringUntil('\n');
+    line.trim();
+    if (line.length() > 0 && !line.startsWith("//") && !line.startsWith("#") && !line.startsWith("REM")) {
+      processDuckyLine_DirectASCII(line);
+    }
+  }
+  depth--;
+  snippet.close();
+}
+
 // Modified process function for ducky script that uses direct ASCII mode
 void processDuckyLine_DirectASCII(String line) {
   // Flash activity indicator
@@ -63,7 +100,29 @@ void processDuckyLine_DirectASCII(String line) {
     Serial.print(F("Delaying for "));
     Serial.print(params.toInt());
     Serial.println(F("ms"));
-    delay(params.toInt());
+    engineDelay(params.toInt());
+  }
+  else if (command.equals("SPEED")) {
+    // Typing pace for the following lines
+    applySpeedDirective(params);
+  }
+  else if (command.equals("HOLD")) {
+    // Keep keys down across the following lines
+    holdKeysLine(params);
+  }
+  else if (command.equals("RELEASE")) {
+    releaseKeysLine(params);
+  }
+  else if (command.equals("CHECKPOINT")) {
+    // Save the execution position after this line
+    Serial.println(F("Checkpoint requested"));
+    requestCheckpoint();
+  }
+  else if (command.equals("INCLUDE")) {
+    // Run a shared snippet file from the card
+    Serial.print(F("Including "));
+    Serial.println(includePath(params));
+    runIncludedScript(includePath(params));
   }  else if (command.equals("STRING")) {
     // Type out a string of characters using direct ASCII mode
     Serial.print(F("Typing string (Direct ASCII): "));
@@ -80,13 +139,13 @@ void processDuckyLine_DirectASCII(String line) {
     // Using typeDirectASCII from layout-utils.h
     typeDirectASCII(params);
     delay(50); 
-    Keyboard.write(KEY_RETURN);  // Use write instead of press/release
+    HidKeyboard.write(KEY_RETURN);  // Use write instead of press/release
     delay(50); 
   }  else if (command.equals("ENTER")) {
     Serial.println(F("Direct ASCII - Pressing ENTER key"));
-    Keyboard.press(KEY_RETURN);
+    HidKeyboard.press(KEY_RETURN);
     delay(200);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
     delay(50);
   }else if (command.equals("GUI") || command.equals("WINDOWS")) {
     // Windows/GUI key
@@ -95,16 +154,16 @@ void processDuckyLine_DirectASCII(String line) {
     
     if (params.length() > 0) {
       // GUI + key with longer delays and more reliable approach
-      Keyboard.press(KEY_LEFT_GUI);
+      HidKeyboard.press(KEY_LEFT_GUI);
       delay(200);  // Increased to 200ms to make sure GUI is registered
       
       // Use write() for the key
       if (params.length() == 1) {
-        Keyboard.write(params[0]);
+        HidKeyboard.write(params[0]);
       } else {
         // Try to handle special keys
         if (params.equalsIgnoreCase("r")) {
-          Keyboard.write('r');
+          HidKeyboard.write('r');
         } else {
           // For other keys, fall back to standard approach
           pressKey(params);
@@ -112,12 +171,12 @@ void processDuckyLine_DirectASCII(String line) {
       }
       
       delay(200);  // Longer delay to ensure key combination is registered
-      Keyboard.releaseAll();
+      HidKeyboard.releaseAll();
     } else {
       // Just GUI key
-      Keyboard.press(KEY_LEFT_GUI);
+      HidKeyboard.press(KEY_LEFT_GUI);
       delay(200);
-      Keyboard.releaseAll();
+      HidKeyboard.releaseAll();
     }
   }
   else if (command.equals("CTRL") || command.equals("CONTROL")) {
@@ -127,7 +186,7 @@ void processDuckyLine_DirectASCII(String line) {
     
     if (params.length() > 0) {
       // CTRL + key with longer delays for more reliable operation
-      Keyboard.press(KEY_LEFT_CTRL);
+      HidKeyboard.press(KEY_LEFT_CTRL);
       delay(200);  // Increased to 200ms
       
       if (params.length() == 1) {
@@ -136,41 +195,41 @@ void processDuckyLine_DirectASCII(String line) {
         Serial.println(key);
         
         // For letters, use the letter directly
-        Keyboard.press(key);
+        HidKeyboard.press(key);
         delay(200);  // Longer delay
-        Keyboard.releaseAll();
+        HidKeyboard.releaseAll();
       } else {
         // For named keys, use proper key code
         Serial.print(F("Direct ASCII - Pressing CTRL + named key: "));
         Serial.println(params);
         
         if (params.equalsIgnoreCase("a")) {
-          Keyboard.press('a');
+          HidKeyboard.press('a');
         } else if (params.equalsIgnoreCase("c")) {
-          Keyboard.press('c');
+          HidKeyboard.press('c');
         } else if (params.equalsIgnoreCase("v")) {
-          Keyboard.press('v');
+          HidKeyboard.press('v');
         } else if (params.equalsIgnoreCase("x")) {
-          Keyboard.press('x');
+          HidKeyboard.press('x');
         } else if (params.equalsIgnoreCase("z")) {
-          Keyboard.press('z');
+          HidKeyboard.press('z');
         } else if (params.equalsIgnoreCase("y")) {
-          Keyboard.press('y');
+          HidKeyboard.press('y');
         } else if (params.equalsIgnoreCase("s")) {
-          Keyboard.press('s');
+          HidKeyboard.press('s');
         } else {
           // Try a more generic approach for other keys
           pressKey(params);
         }
         
         delay(200);
-        Keyboard.releaseAll();
+        HidKeyboard.releaseAll();
       }
     } else {
       // Just CTRL key
-      Keyboard.press(KEY_LEFT_CTRL);
+      HidKeyboard.press(KEY_LEFT_CTRL);
       delay(200);
-      Keyboard.releaseAll();
+      HidKeyboard.releaseAll();
     }
   }
   else if (command.equals("ALT")) {
@@ -180,7 +239,7 @@ void processDuckyLine_DirectASCII(String line) {
     
     if (params.length() > 0) {
       // ALT + key
-      Keyboard.press(KEY_LEFT_ALT);
+      HidKeyboard.press(KEY_LEFT_ALT);
       delay(200);  // Increased delay
       
       if (params.length() == 1) {
@@ -189,22 +248,22 @@ void processDuckyLine_DirectASCII(String line) {
         Serial.println(key);
         
         // For single characters
-        Keyboard.press(key);
+        HidKeyboard.press(key);
         delay(200);  // Longer delay
-        Keyboard.releaseAll();
+        HidKeyboard.releaseAll();
       } else {
         // For named keys
         Serial.print(F("Direct ASCII - Pressing ALT + named key: "));
         Serial.println(params);
         pressKey(params);
         delay(200);
-        Keyboard.releaseAll();
+        HidKeyboard.releaseAll();
       }
     } else {
       // Just ALT key
-      Keyboard.press(KEY_LEFT_ALT);
+      HidKeyboard.press(KEY_LEFT_ALT);
       delay(200);
-      Keyboard.releaseAll();
+      HidKeyboard.releaseAll();
     }
   }  else if (command.equals("SHIFT")) {
     // SHIFT key handling - completely revised for better compatibility
@@ -223,25 +282,25 @@ void processDuckyLine_DirectASCII(String line) {
           char upperKey = key - 32; // Convert to uppercase
           Serial.print(F("Converting to uppercase: "));
           Serial.println(upperKey);
-          Keyboard.write(upperKey); // Write directly as uppercase
+          HidKeyboard.write(upperKey); // Write directly as uppercase
         } 
         // Handle special keys with SHIFT
         else if (key >= '0' && key <= '9') {
           // For numbers, use SHIFT + number
-          Keyboard.press(KEY_LEFT_SHIFT);
+          HidKeyboard.press(KEY_LEFT_SHIFT);
           delay(250);  // Even longer delay for shift
-          Keyboard.press(key);
+          HidKeyboard.press(key);
           delay(250);  // Longer hold time
-          Keyboard.releaseAll();
+          HidKeyboard.releaseAll();
           delay(50);   // Delay after releasing
         }
         else {
           // For other characters, use SHIFT + key with extra delay
-          Keyboard.press(KEY_LEFT_SHIFT);
+          HidKeyboard.press(KEY_LEFT_SHIFT);
           delay(250);  // Even longer delay for shift
-          Keyboard.press(key);
+          HidKeyboard.press(key);
           delay(250);  // Longer delay
-          Keyboard.releaseAll();
+          HidKeyboard.releaseAll();
           delay(50);   // Delay after releasing
         }
       } 
@@ -251,24 +310,24 @@ void processDuckyLine_DirectASCII(String line) {
         Serial.println(params);
         
         // Handle arrow keys and other special keys
-        Keyboard.press(KEY_LEFT_SHIFT);
+        HidKeyboard.press(KEY_LEFT_SHIFT);
         delay(250); // Extended delay
         
         // Special handling for common arrow keys
         if (params.equalsIgnoreCase("RIGHT") || params.equalsIgnoreCase("RIGHTARROW")) {
-          Keyboard.press(KEY_RIGHT_ARROW);
+          HidKeyboard.press(KEY_RIGHT_ARROW);
         } 
         else if (params.equalsIgnoreCase("LEFT") || params.equalsIgnoreCase("LEFTARROW")) {
-          Keyboard.press(KEY_LEFT_ARROW);
+          HidKeyboard.press(KEY_LEFT_ARROW);
         }
         else if (params.equalsIgnoreCase("UP") || params.equalsIgnoreCase("UPARROW")) {
-          Keyboard.press(KEY_UP_ARROW);
+          HidKeyboard.press(KEY_UP_ARROW);
         }
         else if (params.equalsIgnoreCase("DOWN") || params.equalsIgnoreCase("DOWNARROW")) {
-          Keyboard.press(KEY_DOWN_ARROW);
+          HidKeyboard.press(KEY_DOWN_ARROW);
         }
         else if (params.equalsIgnoreCase("TAB")) {
-          Keyboard.press(KEY_TAB);
+          HidKeyboard.press(KEY_TAB);
         }
         else {
           // For other named keys
@@ -276,57 +335,204 @@ void processDuckyLine_DirectASCII(String line) {
         }
         
         delay(250); // Extended hold time
-        Keyboard.releaseAll();
+        HidKeyboard.releaseAll();
         delay(50);  // Delay after releasing
       }
     } else {
       // Just SHIFT key
       Serial.println(F("Pressing SHIFT key alone"));
-      Keyboard.press(KEY_LEFT_SHIFT);
+      HidKeyboard.press(KEY_LEFT_SHIFT);
       delay(250); // Longer press for SHIFT alone
-      Keyboard.releaseAll();
+      HidKeyboard.releaseAll();
       delay(50);  // Delay after releasing
     }
   }
   else if (command.equals("TAB")) {
     Serial.println(F("Direct ASCII - Pressing TAB key"));
     // More reliable method for TAB - using direct keycode
-    Keyboard.press(KEY_TAB);
+    HidKeyboard.press(KEY_TAB);
     delay(200);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
     delay(50);
   }
   else if (command.equals("BACKSPACE")) {
     Serial.println(F("Direct ASCII - Pressing BACKSPACE key"));
     // More reliable method for BACKSPACE - using direct keycode
-    Keyboard.press(KEY_BACKSPACE);
+    HidKeyboard.press(KEY_BACKSPACE);
     delay(200);
-    Keyboard.releaseAll();
+    HidKeyboard.releaseAll();
     delay(50);
   }
+  else if (command.indexOf('+') != -1) {
+    // Key combination, e.g. CTRL+ALT+DELETE, sent as a single chord
+    pressChordLine(command);
+  }
+  else if (params.length() == 0 && command.length() > 1 && chordKeyCode(command) != 0) {
+    // A single named key (RIGHTARROW, ESC, F5, ...), one press and one
+    // release report on top of any keys held with HOLD
+    pressChordLine(command);
+  }
   
   // Continue with other key handling, but prefer press/releaseAll with longer delays
   
   // Wait the default delay after each command
-  delay(defaultDelay);
+  engineDelay(defaultDelay);
+}
+
+// Snippet estimates of the current run (reset by beginProgress()), shared
+// by the interpreted and the compiled pre-pass and the progress tracking
+EstimateCallMemo estimateCalls;
+
+// Expected run time of one line in milliseconds, following the delays in
+// processDuckyLine_DirectASCII() above - keep the two in step. state
+// carries DEFAULT_DELAY and SPEED from line to line. Used by the progress pre-pass.
+unsigned long estimateDuckyLine_DirectASCII(String line, EstimateState &state) {
+  line.trim();
+  if (line.length() == 0 || line.startsWith("//") || line.startsWith("#") || line.startsWith("REM")) {
+    return 0;
+  }
+  
+  int spaceIndex = line.indexOf(' ');
+  String command = (spaceIndex != -1) ? line.substring(0, spaceIndex) : line;
+  String params = (spaceIndex != -1) ? line.substring(spaceIndex + 1) : "";
+  command.trim();
+  params.trim();
+  
+  uint16_t rate = typingSpeedRate(state.typingSpeed);
+  uint8_t burst = typingSpeedBurst(state.typingSpeed);
+  unsigned long ms = 25; // Activity LED flash
+  if (command.equals("DEFAULT_DELAY") || command.equals("DEFAULTDELAY")) {
+    state.defaultDelay = params.toInt();
+  }
+  else if (command.equals("SPEED")) {
+    uint32_t value;
+    if (typingParseSpeed(params.c_str(), params.length(), value)) {
+      state.typingSpeed = (value == TYPING_SPEED_DEFAULT) ? typingSpeedValue(config.typingRate, config.typingBurst)
+                                                          : value;
+    }
+  }
+  else if (command.equals("DELAY")) {
+    ms += params.toInt();
+  }
+  else if (command.equals("INCLUDE")) {
+    // The snippet's own lines, nested up to the same depth as when running.
+    // The snippet file is read once per run and entry state; a path hash
+    // collision would only skew the estimate.
+    static int depth = 0;
+    String path = includePath(params);
+    uint32_t key = programPathHash(path.c_str(), path.length());
+    if (depth < PROGRAM_MAX_CALL_DEPTH && !estimateCallLookup(estimateCalls, key, state, ms)) {
+      EstimateState entry = state;
+      int snippetLines = 0;
+      depth++;
+      unsigned long snippetMs = estimateScriptMillis(path, 0, 0, state, snippetLines);
+      depth--;
+      estimateCallStore(estimateCalls, key, entry, state, snippetMs);
+      ms += snippetMs;
+    }
+  }
+  else if (command.equals("STRING")) {
+    ms += typingPaceMillis(typingKeystrokes(params), rate, burst);
+  }
+  else if (command.equals("STRINGLN")) {
+    ms += typingPaceMillis(typingKeystrokes(params) + 1, rate, burst) + 100;
+  }
+  else if (command.equals("ENTER") || command.equals("TAB") || command.equals("BACKSPACE")) {
+    ms += 250;
+  }
+  else if (command.equals("GUI") || command.equals("WINDOWS") || command.equals("CTRL") ||
+           command.equals("CONTROL") || command.equals("ALT")) {
+    ms += (params.length() > 0) ? 400 : 200;
+  }
+  else if (command.equals("SHIFT")) {
+    // SHIFT + a lowercase letter is typed as one uppercase letter
+    bool letter = (params.length() == 1 && params[0] >= 'a' && params[0] <= 'z');
+    if (letter) {
+      ms += typingPaceMillis(1, rate, burst);
+    } else {
+      ms += (params.length() > 0) ? 550 : 300;
+    }
+  }
+  
+  return ms + state.defaultDelay;
+}
+
+// Look-ahead of upcoming script lines, filled from SD during DELAY windows
+// so the lines after a delay are ready without waiting on the card
+#define SCRIPT_READAHEAD_LINES 8
+#define SCRIPT_READAHEAD_BYTES 2048
+
+SdExtentFile activeScriptFile;          // Script being executed (read-ahead source)
+unsigned long activeScriptEnd = 0;      // End offset of the executed range (0 = end of file)
+String readAheadText[SCRIPT_READAHEAD_LINES];
+unsigned long readAheadEnd[SCRIPT_READAHEAD_LINES]; // File offset after each line
+int readAheadHead = 0;
+int readAheadCount = 0;
+unsigned int readAheadBytes = 0;
+unsigned long readAheadHits = 0;
+
+// True while the executed range still has unread bytes on the card
+bool scriptFileHasMore() {
+  return activeScriptFile.available() &&
+         (activeScriptEnd == 0 || activeScriptFile.position() < activeScriptEnd);
+}
+
+// Delay work hook: read one more line into the look-ahead buffer
+bool readAheadScriptLine() {
+  if (!activeScriptFile || readAheadCount >= SCRIPT_READAHEAD_LINES ||
+      readAheadBytes >= SCRIPT_READAHEAD_BYTES || !scriptFileHasMore()) {
+    return false;
+  }
+  int slot = (readAheadHead + readAheadCount) % SCRIPT_READAHEAD_LINES;
+  readAheadText[slot] = activeScriptFile.readStringUntil('\n');
+  readAheadEnd[slot] = activeScriptFile.position();
+  readAheadBytes += readAheadText[slot].length();
+  readAheadCount++;
+  return true;
+}
+
+// Next script line, from the look-ahead buffer if it was read during a delay
+String nextScriptLine(unsigned long &endOffset) {
+  if (readAheadCount > 0) {
+    String line = readAheadText[readAheadHead];
+    endOffset = readAheadEnd[readAheadHead];
+    readAheadBytes -= line.length();
+    readAheadText[readAheadHead] = "";
+    readAheadHead = (readAheadHead + 1) % SCRIPT_READAHEAD_LINES;
+    readAheadCount--;
+    readAheadHits++;
+    return line;
+  }
+  String line = activeScriptFile.readStringUntil('\n');
+  endOffset = activeScriptFile.position();
+  return line;
 }
 
 // Modified main script execution for direct ASCII mode
 // This function uses the typeDirectASCII function defined in layout-utils.h
-void executeScript_DirectASCII(String scriptFile) {
-  File scriptFileHandle = SD.open(scriptFile);
-  
-  if (scriptFileHandle) {
+// Executes length bytes starting at startOffset (length 0 = to end of file)
+void executeScript_DirectASCII(String scriptFile, unsigned long startOffset, unsigned long length) {
+  if (activeScriptFile.open(scriptFile)) {
+    activeScriptFile.seek(startOffset); // A lookup in the file's extent map
+    activeScriptEnd = (length == 0) ? 0 : startOffset + length;
+    readAheadHead = 0;
+    readAheadCount = 0;
+    readAheadBytes = 0;
+    readAheadHits = 0;
+    registerDelayWork(readAheadScriptLine);
     Serial.println(F("DIRECT ASCII MODE: File opened successfully"));
     Serial.println(F("Executing script..."));
     
     // Process each line in the file
-    int lineCount = 0;
+    int lineCount = scriptLineBase;
     
-    while (scriptFileHandle.available()) {
-      String line = scriptFileHandle.readStringUntil('\n');
+    while (readAheadCount > 0 || scriptFileHasMore()) {
+      unsigned long lineEnd;
+      String line = nextScriptLine(lineEnd);
       line.trim(); // Remove leading/trailing whitespace
       lineCount++;
+      progressLineStarted(line, lineCount);
+      profileLineStarted(lineCount);
       
       // Skip empty lines and comments
       if (line.length() > 0 && !line.startsWith("//") && !line.startsWith("#")) {
@@ -346,9 +552,25 @@ void executeScript_DirectASCII(String scriptFile) {
           Serial.println(F("  [Comment - Skipped]"));
         }
       }
+      
+      // Stop here when aborted; the position is not checkpointed
+      if (engineAbortRequested) {
+        Serial.print(F("DIRECT ASCII MODE: Aborted after line "));
+        Serial.println(lineCount);
+        break;
+      }
+      
+      checkpointAfterLine(lineEnd, lineCount);
     }
     
-    scriptFileHandle.close();
+    unregisterDelayWork(readAheadScriptLine);
+    for (int i = 0; i < SCRIPT_READAHEAD_LINES; i++) {
+      readAheadText[i] = "";
+    }
+    readAheadCount = 0;
+    activeScriptFile.close();
     Serial.println(F("DIRECT ASCII MODE: Script execution complete"));
+    Serial.print(F("Lines read ahead during delays: "));
+    Serial.println(readAheadHits);
   }
 }
@@ -0,0 +1,116 @@
+/*
+ * Card Health - Read-Only Check Every Boot
+ *
+ * The first run after boot reads the selected payload range and, when the
+ * payload is compiled, its program code, sector by sector (lib/card-health.h).
+ * Nothing is written to the card: the payload is verified against its
+ * catalog CRC, the code against the CRC in its block map, and the read
+ * times against the baseline kept in flash (cardHealthStore). Selection has
+ * already matched the catalog entry to the payload, so a payload that fails
+ * its CRC here was misread and is reported as a failure; the catalog is
+ * only rewritten by selection and REINDEX. A program whose code fails its
+ * CRC is not run and the script is interpreted from source instead.
+ *
+ * Re-runs from the idle state skip the check (cardHealthChecked, in the
+ * main tab); the HEALTH serial command prints its result again. The tests
+ * that write to the card (speed, log latency, capacity, file system) only
+ * run on demand, with the DIAG serial command.
+ */
+
+FlashStorage(cardHealthStore, CardHealthBaseline);
+
+CardHealth cardHealth;
+
+// Read [offset, offset + length) one sector at a time, timing every read.
+// The CRC covers the range only; complete is false if it was longer than
+// CARD_HEALTH_MAX_SECTORS. Returns false on a read error.
+bool cardHealthReadRange(SdExtentFile &file, uint32_t offset, uint32_t length, uint32_t &crc, bool &complete) {
+  uint8_t sector[CARD_HEALTH_SECTOR];
+  uint32_t end = offset + length;
+  uint32_t position = offset - offset % CARD_HEALTH_SECTOR; // File data starts on a sector
+  crc = 0;
+  complete = true;
+  if (!file.seek(position)) {
+    return false;
+  }
+
+  for (uint32_t sectors = 0; position < end; sectors++) {
+    if (sectors == CARD_HEALTH_MAX_SECTORS) {
+      complete = false;
+      break;
+    }
+    uint32_t wanted = (file.size() - position < CARD_HEALTH_SECTOR) ? file.size() - position : CARD_HEALTH_SECTOR;
+    if (wanted == 0) {
+      return false; // The range runs past the end of the file
+    }
+    unsigned long readStart = micros();
+    int bytesRead = file.read(sector, wanted);
+    cardHealthSectorRead(cardHealth, micros() - readStart);
+    if (bytesRead != (int)wanted) {
+      return false;
+    }
+
+    uint32_t from = (position < offset) ? offset - position : 0;
+    uint32_t to = (position + wanted > end) ? end - position : wanted;
+    crc = crc32Update(crc, sector + from, to - from);
+    position += wanted;
+  }
+  return true;
+}
+
+// Run the check on the selected payload; false if its compiled program
+// must not be run
+bool checkCardHealth(const String &scriptFile) {
+  unsigned long checkStart = millis();
+  cardHealthStart(cardHealth);
+  cardHealthChecked = true;
+  bool programUsable = true;
+  uint32_t payloadId = 0;
+
+  SdExtentFile payload;
+  if (!payload.open(scriptFile)) {
+    cardHealth.status = CARD_HEALTH_READ_ERROR;
+  } else {
+    uint32_t length = (scriptRangeLength > 0) ? scriptRangeLength : payload.size() - scriptRangeOffset;
+    uint32_t crc;
+    bool complete;
+    if (!cardHealthReadRange(payload, scriptRangeOffset, length, crc, complete)) {
+      cardHealth.status = CARD_HEALTH_READ_ERROR;
+    } else if (!complete) {
+      payloadId = (scriptRangeCrc != 0 ? scriptRangeCrc : length) ^ scriptRangeOffset;
+    } else {
+      // Selection already matched the entry to the payload, so a different
+      // CRC here means the card returned different data the second time
+      payloadId = crc ^ scriptRangeOffset;
+      if (scriptRangeCrc != 0 && crc != scriptRangeCrc) {
+        cardHealth.status = CARD_HEALTH_CORRUPT;
+      }
+      cardHealth.payloadVerified = scriptRangeCrc != 0;
+    }
+    payload.close();
+  }
+
+  if (cardHealth.status == CARD_HEALTH_GOOD) {
+    programUsable = checkProgramCodeHealth(scriptFile);
+  }
+
+  CardHealthBaseline baseline = cardHealthStore.read();
+  if (cardHealthJudge(cardHealth, baseline, payloadId)) {
+    cardHealthBaselineFrom(baseline, cardHealth, payloadId);
+    cardHealthStore.write(baseline);
+  }
+  cardHealth.elapsedMs = millis() - checkStart;
+  printCardHealth();
+
+  // Warn with LED_TX lit for the rest of the session, but run anyway
+  if (cardHealth.status >= CARD_HEALTH_DEGRADED) {
+    digitalWrite(LED_TX, LOW);
+  }
+  return programUsable;
+}
+
+void printCardHealth() {
+  char line[200];
+  cardHealthFormat(line, sizeof(line), cardHealth);
+  Serial.println(line);
+}
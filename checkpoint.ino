@@ -0,0 +1,175 @@
+/*
+ * Execution Checkpoints - Resume After Reset
+ * 
+ * With CHECKPOINT_INTERVAL set in config.txt, the script executor records
+ * the file offset of the next line, the repeat iteration, the default
+ * delay, the SPEED pacing and the keys held by HOLD every n lines (and at each CHECKPOINT command in the script). If the
+ * device resets before the run completes, the next boot resumes from the
+ * last checkpoint.
+ * 
+ * Each checkpoint costs one flash row erase/write. Writes are batched by
+ * the interval, held back until CHECKPOINT_MIN_MS (config) has passed since
+ * the last one, skipped when nothing has changed, and spread over the
+ * checkpoint rows (lib/checkpoint.h). A run writes nothing until its first
+ * checkpoint. Lines executed after the last checkpoint run again on resume.
+ */
+
+// RAM copy of the newest record in flash, and its row
+ExecutionCheckpoint savedCheckpoint;
+uint8_t savedCheckpointRow = 0;
+unsigned long lastCheckpointWrite = 0;
+KeyReport checkpointResumeHeld; // Keys to hold again when the resumed run starts
+bool checkpointRunActive = false;
+bool checkpointRequested = false;
+unsigned int linesSinceCheckpoint = 0;
+uint32_t checkpointPayloadId = 0;
+
+// Identify the payload contents so a checkpoint never resumes an edited
+// script. A payload selected from the catalog already has its CRC checked
+// at selection (payload_catalog.ino); only a payload without a catalog
+// entry is read here.
+uint32_t computeCheckpointPayloadId(const String &scriptFile) {
+  if (scriptRangeCrc != 0) {
+    return scriptRangeCrc ^ scriptRangeOffset;
+  }
+  SdExtentFile payload;
+  if (!payload.open(scriptFile)) {
+    return 0;
+  }
+  payload.seek(scriptRangeOffset);
+  unsigned long length = (scriptRangeLength > 0) ? scriptRangeLength : payload.size() - scriptRangeOffset;
+  uint32_t crc = crc32File(payload, length);
+  payload.close();
+  return crc ^ scriptRangeOffset;
+}
+
+// Write the checkpoint to the next flash row, only if it differs from the
+// stored copy
+void writeCheckpoint(ExecutionCheckpoint checkpoint) {
+  checkpoint.sequence = savedCheckpoint.sequence;
+  if (memcmp(&checkpoint, &savedCheckpoint, sizeof(checkpoint)) == 0) {
+    return;
+  }
+  checkpoint.sequence = savedCheckpoint.sequence + 1;
+  savedCheckpointRow = (savedCheckpointRow + 1) % CHECKPOINT_ROWS;
+  checkpointRowWrite(savedCheckpointRow, checkpoint);
+  savedCheckpoint = checkpoint;
+  linesSinceCheckpoint = 0;
+  lastCheckpointWrite = millis();
+  
+  if (config.debugOutput) {
+    Serial.print(F("Checkpoint saved at line "));
+    Serial.print(checkpoint.lineNumber);
+    Serial.print(F(" (offset "));
+    Serial.print(checkpoint.offset);
+    Serial.println(F(")"));
+  }
+}
+
+// Start a checkpointed run; returns true and the resume position if an
+// interrupted run of the same payload should be continued
+bool beginCheckpointedRun(const String &scriptFile, unsigned long &resumeOffset, int &resumeLine) {
+  checkpointRunActive = false;
+  checkpointRequested = false;
+  linesSinceCheckpoint = 0;
+  memset(&checkpointResumeHeld, 0, sizeof(checkpointResumeHeld));
+  
+  if (config.checkpointInterval <= 0) {
+    return false;
+  }
+  
+  checkpointPayloadId = computeCheckpointPayloadId(scriptFile);
+  savedCheckpointRow = checkpointReadNewest(savedCheckpoint);
+  checkpointRunActive = true;
+  lastCheckpointWrite = millis();
+  
+  bool resume = savedCheckpoint.magic == CHECKPOINT_MAGIC &&
+                savedCheckpoint.active == 1 &&
+                savedCheckpoint.payloadId == checkpointPayloadId &&
+                savedCheckpoint.offset >= scriptRangeOffset &&
+                (scriptRangeLength == 0 || savedCheckpoint.offset < scriptRangeOffset + scriptRangeLength);
+  
+  if (resume) {
+    resumeOffset = savedCheckpoint.offset;
+    resumeLine = savedCheckpoint.lineNumber;
+    currentRepeat = savedCheckpoint.repeat;
+    defaultDelay = savedCheckpoint.defaultDelay;
+    if (savedCheckpoint.typingBurst > 0) {
+      setTypingSpeed(savedCheckpoint.typingRate, savedCheckpoint.typingBurst);
+    }
+    memcpy(&checkpointResumeHeld, savedCheckpoint.held, sizeof(checkpointResumeHeld));
+    
+    Serial.print(F("Interrupted run detected - resuming at line "));
+    Serial.print(resumeLine + 1);
+    Serial.print(F(", iteration "));
+    Serial.println(currentRepeat + 1);
+    return true;
+  }
+  
+  // Nothing is written until the first checkpoint: a reset before it
+  // starts the run over, as it would have from a start-of-run record
+  return false;
+}
+
+// Press the keys the interrupted run held with HOLD again, just before
+// its first line runs, so the lines after the resume point get them
+void restoreCheckpointHeldKeys() {
+  static const KeyReport none = {};
+  if (memcmp(&checkpointResumeHeld, &none, sizeof(none)) != 0) {
+    Serial.println(F("Holding the keys held at the checkpoint again"));
+    HidKeyboard.hold(checkpointResumeHeld);
+    memset(&checkpointResumeHeld, 0, sizeof(checkpointResumeHeld));
+  }
+}
+
+// Ask for a checkpoint after the current line (CHECKPOINT script command)
+void requestCheckpoint() {
+  checkpointRequested = true;
+}
+
+// Called after each script line; nextOffset is where the next line starts
+void checkpointAfterLine(unsigned long nextOffset, int lineNumber) {
+  if (!checkpointRunActive) {
+    return;
+  }
+  
+  linesSinceCheckpoint++;
+  if (!checkpointRequested && linesSinceCheckpoint < (unsigned int)config.checkpointInterval) {
+    return;
+  }
+  // Too soon after the last write: keep it due for a later line
+  if (millis() - lastCheckpointWrite < config.checkpointMinMs) {
+    return;
+  }
+  checkpointRequested = false;
+  
+  ExecutionCheckpoint checkpoint = savedCheckpoint;
+  checkpoint.magic = CHECKPOINT_MAGIC;
+  checkpoint.payloadId = checkpointPayloadId;
+  checkpoint.offset = nextOffset;
+  checkpoint.lineNumber = lineNumber;
+  checkpoint.repeat = currentRepeat;
+  checkpoint.defaultDelay = defaultDelay;
+  checkpoint.typingRate = typingPacer.rate();
+  checkpoint.typingBurst = typingPacer.burst();
+  memcpy(checkpoint.held, &HidKeyboard.held(), sizeof(checkpoint.held));
+  checkpoint.active = 1;
+  writeCheckpoint(checkpoint);
+}
+
+// Called when the run (including repeats) has completed
+void finishCheckpointedRun() {
+  if (!checkpointRunActive) {
+    return;
+  }
+  checkpointRunActive = false;
+  
+  // Only a checkpoint of this run needs closing; other records already
+  // cannot resume it
+  if (savedCheckpoint.magic == CHECKPOINT_MAGIC && savedCheckpoint.active == 1 &&
+      savedCheckpoint.payloadId == checkpointPayloadId) {
+    ExecutionCheckpoint checkpoint = savedCheckpoint;
+    checkpoint.active = 0;
+    writeCheckpoint(checkpoint);
+  }
+}
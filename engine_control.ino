@@ -0,0 +1,242 @@
+/*
+ * Engine Control - Pause and Abort While a Script Runs
+ *
+ * The interpreter spends most of its time inside delay() (DELAY, the admin()
+ * sequences, modifier holds), so control inputs cannot wait for the next
+ * script line. The SAMD core calls yield() on every pass of its delay() loop;
+ * this tab overrides yield() and uses it as the scheduler tick that polls the
+ * control inputs. The HID output gate (lib/hid-output.h) polls them as well,
+ * right before every report.
+ *
+ * Controls while a script is running:
+ *   Serial: Ctrl-C or ABORT - release all keys and stop the script
+ *           PAUSE           - release all keys and wait
+ *           RESUME          - press the held keys again and continue
+ *   Button: short press     - pause / resume
+ *           hold for 1 s    - abort
+ *
+ * An abort releases all keys on the host and drops every report after it,
+ * so nothing more is typed from that point on. The interpreter itself stops
+ * at the end of the current command; DELAY and the default delay return
+ * early, library sequences (admin() and friends) run out silently.
+ */
+
+// Holding the button this long aborts the script
+const unsigned long CONTROL_ABORT_HOLD_MS = 1000;
+
+// Shorter presses are treated as contact bounce
+const unsigned long CONTROL_DEBOUNCE_MS = 50;
+
+// How long the end of an aborted run waits for the button to be let go
+const unsigned long CONTROL_RELEASE_WAIT_MS = 2000;
+
+// Ctrl-C in a serial terminal aborts without waiting for a newline
+const char CONTROL_ABORT_CHAR = 0x03;
+
+bool engineControlActive = false;
+bool enginePaused = false;
+String engineControlBuffer = "";
+bool engineButtonStillHeld = false; // The abort hold outlasted the wait; the idle handler skips it
+
+// How closely engineDelay() kept to the requested waits this run
+unsigned long engineDelayRequestedMs = 0;
+unsigned long engineDelayOvershootMs = 0;
+unsigned long engineDelayWorstOvershootMs = 0;
+
+// Drop reports once the script has been aborted
+bool engineReportGate(const KeyReport &report) {
+  (void)report;
+  engineControlPoll();
+  return !engineAbortRequested;
+}
+
+// Wait for the typing pacer's token before a keystroke; no waiting once
+// the script has been aborted (its reports are dropped anyway)
+void enginePaceKeystroke() {
+  unsigned long wait = typingPacer.take(micros());
+  unsigned long start = micros();
+  while (!engineAbortRequested && micros() - start < wait) {
+    yield();
+  }
+}
+
+// Start watching the control inputs; called when a run starts
+void beginEngineControl() {
+  engineAbortRequested = false;
+  enginePaused = false;
+  engineControlBuffer = "";
+  HidKeyboard.setGate(engineReportGate);
+  HidKeyboard.setPacer(enginePaceKeystroke);
+  engineControlActive = true;
+}
+
+// Stop watching the control inputs; called when a run ends
+void endEngineControl() {
+  engineControlActive = false;
+  enginePaused = false;
+
+  // Let go of an abort hold here, so the idle handler does not count it as
+  // a press. A button held (or stuck) past the wait is handed to the idle
+  // handler to ignore until it is released.
+  if (engineAbortRequested && config.buttonPin >= 0) {
+    unsigned long waitStart = millis();
+    while (digitalRead(config.buttonPin) == LOW && millis() - waitStart < CONTROL_RELEASE_WAIT_MS) {
+      yield();
+    }
+    engineButtonStillHeld = digitalRead(config.buttonPin) == LOW;
+    if (!engineButtonStillHeld) {
+      delay(CONTROL_DEBOUNCE_MS);
+    }
+  }
+}
+
+// Release everything on the host and stop the script
+void engineAbort(const __FlashStringHelper *source) {
+  if (engineAbortRequested) {
+    return;
+  }
+  engineAbortRequested = true;
+  enginePaused = false;
+  HidKeyboard.releaseOnHost();
+  digitalWrite(LED_USER, HIGH);
+
+  Serial.print(F("\n*** ABORTED by "));
+  Serial.print(source);
+  Serial.println(F(" - all keys released ***"));
+}
+
+// Release everything on the host and hold the script until resumed
+void enginePause(const __FlashStringHelper *source) {
+  if (enginePaused || engineAbortRequested) {
+    return;
+  }
+  enginePaused = true;
+  HidKeyboard.releaseOnHost();
+  digitalWrite(LED_USER, LOW); // Orange LED stays on while paused
+
+  Serial.print(F("\n*** PAUSED by "));
+  Serial.print(source);
+  Serial.println(F(" - send RESUME or press the button to continue ***"));
+}
+
+// Press the keys held at the pause again and continue
+void engineResume(const __FlashStringHelper *source) {
+  if (!enginePaused) {
+    return;
+  }
+  enginePaused = false;
+  HidKeyboard.sendRawReport(HidKeyboard.report());
+  digitalWrite(LED_USER, HIGH);
+
+  Serial.print(F("*** RESUMED by "));
+  Serial.print(source);
+  Serial.println(F(" ***"));
+}
+
+// Serial controls; any other input is discarded while a script runs
+void pollControlSerial() {
+  while (Serial.available() > 0) {
+    char c = Serial.read();
+    if (c == CONTROL_ABORT_CHAR) {
+      engineControlBuffer = "";
+      engineAbort(F("serial"));
+    } else if (c == '\n' || c == '\r') {
+      String command = engineControlBuffer;
+      engineControlBuffer = "";
+      command.trim();
+      command.toUpperCase();
+
+      if (command.equals("ABORT")) {
+        engineAbort(F("serial"));
+      } else if (command.equals("PAUSE")) {
+        enginePause(F("serial"));
+      } else if (command.equals("RESUME")) {
+        engineResume(F("serial"));
+      } else if (command.length() > 0) {
+        Serial.println(F("Script running - only ABORT, PAUSE and RESUME are accepted"));
+      }
+    } else if (engineControlBuffer.length() < 16) {
+      engineControlBuffer += c;
+    }
+  }
+}
+
+// Button controls: a short press toggles pause, a long hold aborts
+void pollControlButton() {
+  static bool down = false;
+  static bool holdHandled = false;
+  static unsigned long downTime = 0;
+
+  if (config.buttonPin < 0) {
+    return;
+  }
+
+  bool pressed = (digitalRead(config.buttonPin) == LOW); // Active low (INPUT_PULLUP)
+  unsigned long now = millis();
+
+  if (pressed && !down) {
+    down = true;
+    holdHandled = false;
+    downTime = now;
+  } else if (pressed && !holdHandled && now - downTime >= CONTROL_ABORT_HOLD_MS) {
+    holdHandled = true;
+    engineAbort(F("button"));
+  } else if (!pressed && down) {
+    down = false;
+    if (!holdHandled && now - downTime >= CONTROL_DEBOUNCE_MS) {
+      if (enginePaused) {
+        engineResume(F("button"));
+      } else {
+        enginePause(F("button"));
+      }
+    }
+  }
+}
+
+// Service the control inputs; blocks here while paused
+void engineControlPoll() {
+  static bool polling = false;
+  if (!engineControlActive || polling) {
+    return;
+  }
+  polling = true;
+
+  pollControlSerial();
+  pollControlButton();
+  while (enginePaused && !engineAbortRequested) {
+    pollControlSerial();
+    pollControlButton();
+  }
+
+  polling = false;
+}
+
+// delay() that returns as soon as the script is aborted. Long enough
+// windows first run the registered background work (lib/delay-work.h).
+void engineDelay(unsigned long ms) {
+  unsigned long start = millis();
+  unsigned long startMicros = micros();
+  if (ms >= DELAY_WORK_MIN_WINDOW_MS) {
+    unsigned long windowMicros = (ms < 3600000UL) ? ms * 1000UL : 3600000000UL;
+    runDelayWork(micros(), windowMicros, engineAbortRequested);
+  }
+  while (!engineAbortRequested && millis() - start < ms) {
+    yield();
+  }
+  if (!engineAbortRequested) {
+    unsigned long overshoot = millis() - start - ms;
+    engineDelayRequestedMs += ms;
+    engineDelayOvershootMs += overshoot;
+    if (overshoot > engineDelayWorstOvershootMs) {
+      engineDelayWorstOvershootMs = overshoot;
+    }
+    reportTimingDelayEnded(startMicros, ms);
+  }
+}
+
+// Called by the SAMD core's delay() on every pass, and by engineDelay()
+void yield() {
+  engineControlPoll();
+  progressTick();
+  profileYield();
+}
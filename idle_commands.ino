@@ -0,0 +1,287 @@
+/*
+ * Idle Commands - Re-run Without Rebooting
+ * 
+ * Once the script has finished, loop() hands control to this tab. A command
+ * on the serial port (CDC) or a press of the optional idle button re-reads
+ * config.txt and the payload and runs the script again. The SD card stays
+ * mounted and the USB keyboard stays enumerated, so none of the boot
+ * sequence (LED flashes, SD retries, diagnostics, INITIAL_DELAY) is repeated.
+ * 
+ * Between events the MCU sleeps (see lib/low-power.h) unless IDLE_SLEEP is
+ * disabled in config.txt. STATUS reports the share of idle time spent asleep,
+ * which is the figure to compare against a USB power meter reading taken
+ * with IDLE_SLEEP = false.
+ * 
+ * Serial commands (terminate with newline):
+ *   RUN or RELOAD - re-read config.txt and payload, then execute
+ *   RUN n         - select catalog entry n, then execute
+ *   SELECT n      - select catalog entry n for the next run
+ *   LIST          - list the payload catalog
+ *   REINDEX       - rebuild the payload catalog
+ *   STATUS        - show the currently loaded settings
+ *   TIMING        - show the report interval percentiles of the last run
+ *   BOOT          - show the boot timing and SD mount records
+ *   HEALTH        - show the card health check of the boot run
+ *   DIAG          - run the full SD diagnostics (writes test files)
+ *   REBOOT        - reset the board (boot timing measurements)
+ *   HELP          - list the available commands
+ * 
+ * A single press of the idle button re-runs the current selection; pressing
+ * it n >= 2 times in a row runs catalog entry n. Without a catalog any
+ * number of presses re-runs the script.
+ */
+
+// Debounce window for the idle button
+const unsigned long BUTTON_DEBOUNCE_MS = 50;
+
+// Presses further apart than this start a new press count
+const unsigned long BUTTON_SEQUENCE_MS = 800;
+
+// Start of the current idle period, for the sleep duty cycle
+unsigned long idleStartMicros = 0;
+unsigned long long idleElapsedMicros = 0;
+
+// Empty ISR - the button edge only needs to wake the CPU, loop() debounces it
+void idleButtonWake() {
+}
+
+// Configure the idle button as an input and as a wake-up source
+void setupIdleButton() {
+  if (config.buttonPin < 0) {
+    return;
+  }
+  pinMode(config.buttonPin, INPUT_PULLUP);
+  attachInterrupt(digitalPinToInterrupt(config.buttonPin), idleButtonWake, CHANGE);
+  lowPowerButtonWake(config.buttonPin);
+}
+
+// Sleep until something happens; returns immediately if sleep is disabled
+void idleSleepUntilEvent() {
+  unsigned long now = micros();
+  if (idleStartMicros != 0) {
+    idleElapsedMicros += now - idleStartMicros;
+  }
+  idleStartMicros = now;
+  
+  if (!config.idleSleep) {
+    return;
+  }
+  
+  // Debounce in progress - stay awake so the press is seen promptly
+  if (config.buttonPin >= 0 && digitalRead(config.buttonPin) == LOW) {
+    return;
+  }
+  
+  Serial.flush();
+  if (usbBusSuspended()) {
+    // millis() and micros() stop in standby; count the time on the RTC
+    idleElapsedMicros += standbyUntilWakeup(LOW_POWER_STANDBY_WAKE_MS);
+  } else {
+    sleepUntilInterrupt();
+  }
+}
+
+// Re-read config and payload and run the script again
+void reloadAndRunScript() {
+  unsigned long reloadStartTime = millis();
+  Serial.println(F("\nReloading configuration and payload (SD and USB stay mounted)..."));
+  
+  // Start from defaults so settings removed from config.txt revert as well
+  if (config.buttonPin >= 0) {
+    detachInterrupt(digitalPinToInterrupt(config.buttonPin));
+  }
+  config = GhostkeyConfig();
+  resetTypingLayout(); // KEYBOARD_LAYOUT and UNICODE_INPUT live outside config
+  readConfigFile();
+  resetExecutionState();
+  setupIdleButton();
+  
+  String scriptFile;
+  if (!selectScriptFile(scriptFile)) {
+    Serial.println(F("Reload aborted - fix the SD card contents and try again"));
+    return;
+  }
+  
+  Serial.print(F("Reload completed in "));
+  Serial.print(millis() - reloadStartTime);
+  Serial.println(F("ms"));
+  
+  runScriptFile(scriptFile);
+  
+  // Restart the sleep statistics for the new idle period
+  idleStartMicros = 0;
+  idleElapsedMicros = 0;
+  lowPowerSleepMicros = 0;
+}
+
+// Print the settings a re-run would use
+void printIdleStatus() {
+  Serial.println(F("------ Ghostkey Status ------"));
+  Serial.print(F("Script mode: "));
+  Serial.println(config.scriptMode == 1 ? F("Ducky Script") : F("Custom Format"));
+  Serial.print(F("Script file: "));
+  Serial.println(config.scriptMode == 1 ? config.duckyScriptFile : config.customScriptFile);
+  Serial.print(F("Catalog entry: "));
+  Serial.println((selectedCatalogEntry > 0) ? selectedCatalogEntry : config.payloadIndex);
+  Serial.print(F("Repeat count: "));
+  Serial.println(config.repeatCount);
+  Serial.print(F("Button pin: "));
+  Serial.println(config.buttonPin);
+  Serial.print(F("Idle sleep: "));
+  if (config.idleSleep) {
+    Serial.print(lowPowerSleepPercent(idleElapsedMicros), 1);
+    Serial.print(F("% of idle time asleep, "));
+    Serial.print(lowPowerStandbyCount);
+    Serial.println(F(" standby entries"));
+  } else {
+    Serial.println(F("Disabled"));
+  }
+  Serial.print(F("Uptime: "));
+  Serial.print(millis() / 1000);
+  Serial.println(F(" seconds"));
+  Serial.println(F("-----------------------------"));
+}
+
+// Process a single command line received over serial while idle
+void processIdleCommand(String command) {
+  command.trim();
+  command.toUpperCase();
+  
+  if (command.length() == 0) {
+    return;
+  }
+  
+  // Optional numeric argument, e.g. "SELECT 2"
+  String argument = "";
+  int spaceIndex = command.indexOf(' ');
+  if (spaceIndex != -1) {
+    argument = command.substring(spaceIndex + 1);
+    command = command.substring(0, spaceIndex);
+    argument.trim();
+  }
+  
+  if (command.equals("RUN") || command.equals("RELOAD")) {
+    if (argument.length() > 0) {
+      selectedCatalogEntry = argument.toInt();
+    }
+    reloadAndRunScript();
+  }
+  else if (command.equals("SELECT")) {
+    selectedCatalogEntry = argument.toInt();
+    Serial.print(F("Selected catalog entry "));
+    Serial.println(selectedCatalogEntry);
+  }
+  else if (command.equals("LIST")) {
+    listPayloadCatalog();
+  }
+  else if (command.equals("REINDEX")) {
+    buildPayloadCatalog();
+  }
+  else if (command.equals("STATUS")) {
+    printIdleStatus();
+  }
+  else if (command.equals("TIMING")) {
+    printReportTiming();
+  }
+  else if (command.equals("BOOT")) {
+    printBootTiming();
+    printSdMount();
+  }
+  else if (command.equals("HEALTH")) {
+    if (cardHealthChecked) {
+      printCardHealth();
+    } else {
+      Serial.println(F("Card health: not checked yet"));
+    }
+  }
+  else if (command.equals("DIAG")) {
+    runSDCardDiagnostics();
+  }
+  else if (command.equals("REBOOT")) {
+    Serial.println(F("Rebooting..."));
+    Serial.flush();
+    delay(100);
+#if defined(ARDUINO_ARCH_RP2040)
+    rp2040.reboot();
+#else
+    NVIC_SystemReset();
+#endif
+  }
+  else if (command.equals("HELP")) {
+    Serial.println(F("Idle commands: RUN [n], RELOAD, SELECT n, LIST, REINDEX, STATUS, TIMING, BOOT, HEALTH, DIAG, REBOOT, HELP"));
+  }
+  else {
+    Serial.print(F("Unknown idle command: "));
+    Serial.println(command);
+  }
+}
+
+// Returns true once per debounced press of the idle button
+bool idleButtonPressed() {
+  static bool lastState = HIGH;
+  static unsigned long lastChangeTime = 0;
+  static bool reported = false;
+  
+  if (config.buttonPin < 0) {
+    return false;
+  }
+  
+  bool state = digitalRead(config.buttonPin);
+  
+  // Still held from aborting the run: not a press until it is let go
+  if (engineButtonStillHeld) {
+    engineButtonStillHeld = (state == LOW);
+    lastState = state;
+    lastChangeTime = millis();
+    reported = true;
+    return false;
+  }
+  if (state != lastState) {
+    lastState = state;
+    lastChangeTime = millis();
+    reported = false;
+    return false;
+  }
+  
+  // Button is active low (INPUT_PULLUP)
+  if (state == LOW && !reported && millis() - lastChangeTime >= BUTTON_DEBOUNCE_MS) {
+    reported = true;
+    return true;
+  }
+  return false;
+}
+
+// Poll the serial port and idle button; called from loop()
+void handleIdleCommands() {
+  static String commandBuffer = "";
+  
+  while (Serial.available() > 0) {
+    char c = Serial.read();
+    if (c == '\n' || c == '\r') {
+      String command = commandBuffer;
+      commandBuffer = "";
+      processIdleCommand(command);
+    } else if (commandBuffer.length() < 32) {
+      commandBuffer += c;
+    }
+  }
+  
+  // Count presses; once the sequence ends, n >= 2 presses select catalog
+  // entry n and a single press keeps the current selection
+  static int buttonPressCount = 0;
+  static unsigned long lastPressTime = 0;
+  if (idleButtonPressed()) {
+    buttonPressCount++;
+    lastPressTime = millis();
+  }
+  if (buttonPressCount > 0 && millis() - lastPressTime > BUTTON_SEQUENCE_MS) {
+    Serial.print(F("Idle button pressed "));
+    Serial.print(buttonPressCount);
+    Serial.println(F(" time(s)"));
+    if (buttonPressCount >= 2 && SD.exists(CATALOG_FILE)) {
+      selectedCatalogEntry = buttonPressCount;
+    }
+    buttonPressCount = 0;
+    reloadAndRunScript();
+  }
+}
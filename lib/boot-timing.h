@@ -0,0 +1,74 @@
+/*
+ * Boot Timing Record for Ghostkey
+ *
+ * Timestamps of the boot phases from reset to the first keystroke. Each
+ * phase records millis() when it ended, so the time a phase took is the
+ * difference to the phase before it. The firmware prints the record as
+ * one line when the boot run ends and on the BOOT serial command:
+ *
+ *   BOOT-TIMING v1 setup=3 serial=1003 flash=1603 keyboard=1603 sd_mount=1610 ...
+ *
+ * Phases that were never reached (autorun off, no payload) print as "-".
+ * tools/boot_timing.py collects these lines over many boots and reports
+ * the distribution of each phase.
+ *
+ * Append phases only at the end and bump BOOT_TIMING_VERSION.
+ */
+
+#ifndef BOOT_TIMING_H
+#define BOOT_TIMING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#define BOOT_TIMING_VERSION 1
+#define BOOT_TIMING_NONE 0xFFFFFFFFUL // Phase not reached
+
+enum BootPhase {
+  BOOT_PHASE_SETUP,         // setup() entered (core and USB init)
+  BOOT_PHASE_SERIAL,        // Wait for the serial monitor
+  BOOT_PHASE_FLASH,         // Startup LED flashes
+  BOOT_PHASE_KEYBOARD,      // HID keyboard started
+  BOOT_PHASE_SD_MOUNT,      // SD card mounted (all attempts and recovery)
+  BOOT_PHASE_DIAGNOSTICS,   // Card type (read-only)
+  BOOT_PHASE_LISTING,       // Directory listing
+  BOOT_PHASE_CONFIG,        // config.txt read
+  BOOT_PHASE_INITIAL_DELAY, // INITIAL_DELAY
+  BOOT_PHASE_SELECT,        // Payload picked (catalog, test files)
+  BOOT_PHASE_PREPARE,       // Checkpoint, estimate, program cache and card health
+  BOOT_PHASE_OPEN,          // Payload opened, start flashes
+  BOOT_PHASE_FIRST_KEY,     // First HID report sent
+  BOOT_PHASE_COUNT
+};
+
+static const char *const BOOT_PHASE_NAMES[BOOT_PHASE_COUNT] = {
+  "setup", "serial", "flash", "keyboard", "sd_mount", "diagnostics", "listing",
+  "config", "initial_delay", "select", "prepare", "open", "first_key"
+};
+
+typedef struct {
+  uint32_t endMs[BOOT_PHASE_COUNT]; // millis() at the end of each phase, or BOOT_TIMING_NONE
+} BootTiming;
+
+inline void bootTimingClear(BootTiming &timing) {
+  for (uint8_t i = 0; i < BOOT_PHASE_COUNT; i++) {
+    timing.endMs[i] = BOOT_TIMING_NONE;
+  }
+}
+
+// The record as one line: "BOOT-TIMING v1 setup=3 serial=1003 ..."
+inline int bootTimingFormat(char *buffer, size_t size, const BootTiming &timing) {
+  int length = snprintf(buffer, size, "BOOT-TIMING v%d", BOOT_TIMING_VERSION);
+  for (uint8_t i = 0; i < BOOT_PHASE_COUNT && length >= 0 && (size_t)length < size; i++) {
+    if (timing.endMs[i] == BOOT_TIMING_NONE) {
+      length += snprintf(buffer + length, size - length, " %s=-", BOOT_PHASE_NAMES[i]);
+    } else {
+      length += snprintf(buffer + length, size - length, " %s=%lu", BOOT_PHASE_NAMES[i],
+                         (unsigned long)timing.endMs[i]);
+    }
+  }
+  return length;
+}
+
+#endif // BOOT_TIMING_H
@@ -0,0 +1,149 @@
+/*
+ * Read-Only Card Health Check for Ghostkey
+ *
+ * The boot health test used to write, read back and delete three files
+ * every boot, which wears the card and says nothing about the data the
+ * device actually needs. This check only reads: the payload range and the
+ * compiled program (lib/ducky-compiler.h), one 512-byte sector at a time.
+ *
+ *   - Every sector read is timed; the mean and the worst read are compared
+ *     with a baseline kept in flash, so a card that is slowing down (retries
+ *     inside the card, a failing controller) is flagged before it fails.
+ *   - The payload is checked against its CRC-32 from the payload catalog,
+ *     the program's code against the CRC-32 its block map recorded when it
+ *     was built.
+ *
+ * The baseline belongs to one payload: selecting another payload, or
+ * changing the selected one (a new catalog CRC), starts a new baseline, as does a faster
+ * measurement than the stored one (the first boots after a card swap).
+ * Both are rare, so the flash row is written rarely.
+ *
+ * The result is printed as one line:
+ *
+ *   Card Health: Good - 24 sectors, 612 us/sector (baseline 598), worst 1020 us (baseline 990), CRC payload/program, 16ms
+ */
+
+#ifndef CARD_HEALTH_H
+#define CARD_HEALTH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#define CARD_HEALTH_MAGIC 0x47434B48UL // "GCKH"
+#define CARD_HEALTH_SECTOR 512
+#define CARD_HEALTH_MAX_SECTORS 256     // Per file; larger files are timed, not CRC-checked, beyond this
+#define CARD_HEALTH_SLOW_FACTOR 2       // Mean read this many times the baseline: degraded
+#define CARD_HEALTH_WORST_FACTOR 4      // Worst read this many times the baseline worst: degraded
+#define CARD_HEALTH_REBASE_PERCENT 80   // A mean at or below this share of the baseline replaces it
+
+enum CardHealthStatus {
+  CARD_HEALTH_GOOD,
+  CARD_HEALTH_NEW_BASELINE, // Nothing to compare with yet
+  CARD_HEALTH_DEGRADED,     // Reads are slower than the baseline
+  CARD_HEALTH_CORRUPT,      // The payload or the program's code did not match its CRC
+  CARD_HEALTH_READ_ERROR    // A file could not be opened or read to its end
+};
+
+static const char *const CARD_HEALTH_NAMES[] = { "Good", "Good (new baseline)", "DEGRADED", "CRC MISMATCH",
+                                                 "Read Error" };
+
+typedef struct {
+  uint32_t magic;     // CARD_HEALTH_MAGIC once written
+  uint32_t payloadId; // Payload the baseline was measured on (as the checkpoint's)
+  uint32_t meanUs;    // Mean sector read
+  uint32_t worstUs;   // Slowest single sector read
+} CardHealthBaseline;
+
+static_assert(sizeof(CardHealthBaseline) == 16, "CardHealthBaseline must stay 16 bytes");
+
+typedef struct {
+  uint8_t status;          // CardHealthStatus
+  bool payloadVerified;    // CRC compared (the catalog knew it)
+  bool programVerified;    // Compiled program present and its CRC compared
+  uint32_t sectors;        // Sectors read and timed
+  uint32_t totalUs;
+  uint32_t worstUs;
+  uint32_t baselineMeanUs; // 0 = no baseline
+  uint32_t baselineWorstUs;
+  uint32_t elapsedMs;      // Whole check, including opening the files
+} CardHealth;
+
+inline void cardHealthStart(CardHealth &health) {
+  health.status = CARD_HEALTH_GOOD;
+  health.payloadVerified = false;
+  health.programVerified = false;
+  health.sectors = 0;
+  health.totalUs = 0;
+  health.worstUs = 0;
+  health.baselineMeanUs = 0;
+  health.baselineWorstUs = 0;
+  health.elapsedMs = 0;
+}
+
+// One sector read took us microseconds
+inline void cardHealthSectorRead(CardHealth &health, uint32_t us) {
+  health.sectors++;
+  health.totalUs += us;
+  if (us > health.worstUs) {
+    health.worstUs = us;
+  }
+}
+
+inline uint32_t cardHealthMeanUs(const CardHealth &health) {
+  return health.sectors > 0 ? health.totalUs / health.sectors : 0;
+}
+
+// Compare the timings with the baseline and decide the status. Returns true
+// if the baseline should be replaced by this measurement.
+inline bool cardHealthJudge(CardHealth &health, const CardHealthBaseline &baseline, uint32_t payloadId) {
+  bool haveBaseline = baseline.magic == CARD_HEALTH_MAGIC && baseline.payloadId == payloadId && baseline.meanUs > 0;
+  if (haveBaseline) {
+    health.baselineMeanUs = baseline.meanUs;
+    health.baselineWorstUs = baseline.worstUs;
+  }
+  if (health.status != CARD_HEALTH_GOOD || health.sectors == 0) {
+    return false; // Failed reads and bad data are no baseline
+  }
+
+  uint32_t mean = cardHealthMeanUs(health);
+  if (!haveBaseline) {
+    health.status = CARD_HEALTH_NEW_BASELINE;
+    return true;
+  }
+  if (mean > baseline.meanUs * CARD_HEALTH_SLOW_FACTOR || health.worstUs > baseline.worstUs * CARD_HEALTH_WORST_FACTOR) {
+    health.status = CARD_HEALTH_DEGRADED;
+    return false;
+  }
+  return mean * 100 <= baseline.meanUs * CARD_HEALTH_REBASE_PERCENT;
+}
+
+inline void cardHealthBaselineFrom(CardHealthBaseline &baseline, const CardHealth &health, uint32_t payloadId) {
+  baseline.magic = CARD_HEALTH_MAGIC;
+  baseline.payloadId = payloadId;
+  baseline.meanUs = cardHealthMeanUs(health);
+  baseline.worstUs = health.worstUs;
+}
+
+// The result as one line: "Card Health: Good - 24 sectors, 612 us/sector ..."
+inline int cardHealthFormat(char *buffer, size_t size, const CardHealth &health) {
+  int length = snprintf(buffer, size, "Card Health: %s - %lu sectors, %lu us/sector", CARD_HEALTH_NAMES[health.status],
+                        (unsigned long)health.sectors, (unsigned long)cardHealthMeanUs(health));
+  if (length >= 0 && (size_t)length < size && health.baselineMeanUs > 0) {
+    length += snprintf(buffer + length, size - length, " (baseline %lu)", (unsigned long)health.baselineMeanUs);
+  }
+  if (length >= 0 && (size_t)length < size) {
+    length += snprintf(buffer + length, size - length, ", worst %lu us", (unsigned long)health.worstUs);
+  }
+  if (length >= 0 && (size_t)length < size && health.baselineMeanUs > 0) {
+    length += snprintf(buffer + length, size - length, " (baseline %lu)", (unsigned long)health.baselineWorstUs);
+  }
+  if (length >= 0 && (size_t)length < size) {
+    length += snprintf(buffer + length, size - length, ", CRC %s/%s, %lums",
+                       health.payloadVerified ? "payload" : "-", health.programVerified ? "program" : "-",
+                       (unsigned long)health.elapsedMs);
+  }
+  return length;
+}
+
+#endif // CARD_HEALTH_H
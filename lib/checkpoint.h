@@ -0,0 +1,144 @@
+/*
+ * Execution Checkpoint Record for Ghostkey
+ * 
+ * Stored in the SAMD21's emulated EEPROM (the FlashStorage library keeps it
+ * in a reserved flash area) so an interrupted run can resume after a USB
+ * reset or brownout instead of replaying the script from line one.
+ *
+ * Every write erases a flash row, and a row is only rated for some 25,000
+ * erases. Checkpoints therefore rotate over CHECKPOINT_ROWS rows of their
+ * own: each record carries a sequence number, a write goes to the row after
+ * the newest one, and reading picks the record with the highest sequence.
+ * checkpoint.ino also keeps CHECKPOINT_MIN_MS between writes.
+ *
+ * The RP2040 core has no FlashStorage library; there the record goes
+ * through its EEPROM library instead, which also keeps it in a flash
+ * sector. Committing it pauses the other core (USB) for the erase/write.
+ * Each store there gets its own slot of the emulated EEPROM
+ * (EEPROM_SLOT_<name> below), so the card health baseline
+ * (lib/card-health.h) can share it. Every commit erases the whole 4 KB
+ * sector whichever slot changed, so rotating would not spread the wear:
+ * there the record keeps one slot and only the minimum interval limits
+ * the erases.
+ */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#define CHECKPOINT_MAGIC 0x33504B47UL // "GKP3"
+#define CHECKPOINT_MIN_MS 30000UL      // Default shortest time between two checkpoint writes
+
+typedef struct {
+  uint32_t magic;        // CHECKPOINT_MAGIC once written
+  uint32_t sequence;     // Increases with every write; the highest is current
+  uint32_t payloadId;    // CRC-32 of the payload the checkpoint belongs to
+  uint32_t offset;       // File offset of the next line to execute
+  uint32_t lineNumber;   // Lines already executed before offset
+  uint32_t repeat;       // Repeat iteration in progress (0-based)
+  uint16_t defaultDelay; // DEFAULT_DELAY in effect at the checkpoint
+  uint16_t typingRate;   // SPEED rate in effect (keystrokes per second, 0 = unpaced)
+  uint8_t typingBurst;   // SPEED burst in effect (0 = not recorded)
+  uint8_t active;        // 1 while a run is in progress, 0 after it completes
+  uint8_t reserved[2];
+  uint8_t held[8];       // KeyReport of the keys held down by HOLD
+} ExecutionCheckpoint;
+
+static_assert(sizeof(ExecutionCheckpoint) == 40, "ExecutionCheckpoint must stay 40 bytes");
+
+#if defined(ARDUINO_ARCH_RP2040)
+#include <EEPROM.h>
+
+#define CHECKPOINT_EEPROM_BYTES 256
+#define CHECKPOINT_EEPROM_SLOT_BYTES 64
+
+// Slot of every FlashStorage() store
+#define EEPROM_SLOT_checkpointStore 0
+#define EEPROM_SLOT_cardHealthStore 1
+
+// Once for all stores: begin() again would drop the others' RAM copy
+inline void checkpointEepromBegin() {
+  static bool begun = false;
+  if (!begun) {
+    EEPROM.begin(CHECKPOINT_EEPROM_BYTES);
+    begun = true;
+  }
+}
+
+// FlashStorage's read()/write() on top of the EEPROM library
+template <typename T>
+class CheckpointEeprom {
+  static_assert(sizeof(T) <= CHECKPOINT_EEPROM_SLOT_BYTES, "Record does not fit its EEPROM slot");
+
+public:
+  explicit CheckpointEeprom(int slot) : _address(slot * CHECKPOINT_EEPROM_SLOT_BYTES) {}
+
+  T read() {
+    checkpointEepromBegin();
+    T value;
+    EEPROM.get(_address, value);
+    return value;
+  }
+
+  void write(const T &value) {
+    checkpointEepromBegin();
+    EEPROM.put(_address, value);
+    EEPROM.commit();
+  }
+
+private:
+  int _address;
+};
+
+#define FlashStorage(name, T) CheckpointEeprom<T> name(EEPROM_SLOT_##name)
+
+#define CHECKPOINT_ROWS 1
+
+inline void checkpointRowRead(uint8_t, ExecutionCheckpoint &record) {
+  checkpointEepromBegin();
+  EEPROM.get(EEPROM_SLOT_checkpointStore * CHECKPOINT_EEPROM_SLOT_BYTES, record);
+}
+
+inline void checkpointRowWrite(uint8_t, const ExecutionCheckpoint &record) {
+  checkpointEepromBegin();
+  EEPROM.put(EEPROM_SLOT_checkpointStore * CHECKPOINT_EEPROM_SLOT_BYTES, record);
+  EEPROM.commit();
+}
+#else
+#include <FlashStorage.h>
+
+#define CHECKPOINT_ROWS 8
+#define CHECKPOINT_ROW_BYTES 256 // NVM row, the unit of erasing
+
+// The rows, reserved in flash the way FlashStorage() reserves its own
+__attribute__((__aligned__(CHECKPOINT_ROW_BYTES))) static const uint8_t checkpointFlashRows[CHECKPOINT_ROWS *
+                                                                                           CHECKPOINT_ROW_BYTES] = {};
+FlashClass checkpointFlash(checkpointFlashRows, sizeof(checkpointFlashRows));
+
+inline void checkpointRowRead(uint8_t row, ExecutionCheckpoint &record) {
+  checkpointFlash.read(checkpointFlashRows + row * CHECKPOINT_ROW_BYTES, &record, sizeof(record));
+}
+
+// Erases only this row
+inline void checkpointRowWrite(uint8_t row, const ExecutionCheckpoint &record) {
+  const uint8_t *address = checkpointFlashRows + row * CHECKPOINT_ROW_BYTES;
+  checkpointFlash.erase(address, CHECKPOINT_ROW_BYTES);
+  checkpointFlash.write(address, &record, sizeof(record));
+}
+#endif
+
+// Newest record in the rows (magic 0 if there is none) and its row
+inline uint8_t checkpointReadNewest(ExecutionCheckpoint &newest) {
+  uint8_t newestRow = 0;
+  memset(&newest, 0, sizeof(newest));
+  for (uint8_t row = 0; row < CHECKPOINT_ROWS; row++) {
+    ExecutionCheckpoint record;
+    checkpointRowRead(row, record);
+    if (record.magic == CHECKPOINT_MAGIC && (newest.magic != CHECKPOINT_MAGIC || record.sequence > newest.sequence)) {
+      newest = record;
+      newestRow = row;
+    }
+  }
+  return newestRow;
+}
+
+#endif // CHECKPOINT_H
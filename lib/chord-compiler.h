@@ -0,0 +1,120 @@
+/*
+ * Chord Compiler for Ghostkey
+ *
+ * Turns a "+" combination such as CTRL+ALT+DELETE or GUI+r into one
+ * keyboard report: all modifiers folded into the modifier byte, up to six
+ * keys in the key array. The chord is then sent as exactly one press
+ * report and one release report (HidKeyboard.pressChord/releaseChord),
+ * instead of pressing and releasing each part with delays in between.
+ *
+ * Parts are modifier names, key names (ENTER, F4, UP, ...) or a single
+ * character. Letters are case-insensitive, so CTRL+C is Ctrl+c; use
+ * SHIFT+ to add Shift. Characters that need Shift or AltGr on the active
+ * layout bring that modifier along.
+ */
+
+#ifndef CHORD_COMPILER_H
+#define CHORD_COMPILER_H
+
+#include "hid-output.h"
+
+typedef struct {
+  const char *name;
+  uint8_t code; // Keyboard_ key code
+} ChordKeyName;
+
+const ChordKeyName CHORD_KEY_NAMES[] = {
+  {"CTRL", KEY_LEFT_CTRL}, {"CONTROL", KEY_LEFT_CTRL},
+  {"SHIFT", KEY_LEFT_SHIFT},
+  {"ALT", KEY_LEFT_ALT},
+  {"GUI", KEY_LEFT_GUI}, {"WINDOWS", KEY_LEFT_GUI}, {"COMMAND", KEY_LEFT_GUI},
+  {"ENTER", KEY_RETURN}, {"RETURN", KEY_RETURN},
+  {"ESC", KEY_ESC}, {"ESCAPE", KEY_ESC},
+  {"BACKSPACE", KEY_BACKSPACE}, {"TAB", KEY_TAB}, {"SPACE", ' '},
+  {"DELETE", KEY_DELETE}, {"DEL", KEY_DELETE}, {"INSERT", KEY_INSERT},
+  {"HOME", KEY_HOME}, {"END", KEY_END},
+  {"PAGEUP", KEY_PAGE_UP}, {"PAGEDOWN", KEY_PAGE_DOWN},
+  {"UP", KEY_UP_ARROW}, {"UPARROW", KEY_UP_ARROW},
+  {"DOWN", KEY_DOWN_ARROW}, {"DOWNARROW", KEY_DOWN_ARROW},
+  {"LEFT", KEY_LEFT_ARROW}, {"LEFTARROW", KEY_LEFT_ARROW},
+  {"RIGHT", KEY_RIGHT_ARROW}, {"RIGHTARROW", KEY_RIGHT_ARROW},
+  {"CAPSLOCK", KEY_CAPS_LOCK}, {"PRINTSCREEN", KEY_PRINT_SCREEN},
+  {"SCROLLLOCK", KEY_SCROLL_LOCK}, {"PAUSE", KEY_PAUSE}, {"BREAK", KEY_PAUSE},
+  {"MENU", KEY_MENU}, {"APP", KEY_MENU},
+  {"F1", KEY_F1}, {"F2", KEY_F2}, {"F3", KEY_F3}, {"F4", KEY_F4},
+  {"F5", KEY_F5}, {"F6", KEY_F6}, {"F7", KEY_F7}, {"F8", KEY_F8},
+  {"F9", KEY_F9}, {"F10", KEY_F10}, {"F11", KEY_F11}, {"F12", KEY_F12},
+};
+
+// Keyboard_ key code for one part of a combination, 0 if unknown
+uint8_t chordKeyCode(String part) {
+  part.trim();
+  if (part.length() == 1) {
+    char c = part[0];
+    if (c >= 'A' && c <= 'Z') {
+      c += 'a' - 'A';
+    }
+    return (uint8_t)c;
+  }
+
+  part.toUpperCase();
+  for (unsigned int i = 0; i < sizeof(CHORD_KEY_NAMES) / sizeof(CHORD_KEY_NAMES[0]); i++) {
+    if (part.equals(CHORD_KEY_NAMES[i].name)) {
+      return CHORD_KEY_NAMES[i].code;
+    }
+  }
+  return 0;
+}
+
+// Compile "A+B+C" into a single report. Returns false (and names the
+// offending part in error) for an unknown key or more than six keys.
+bool compileChord(const String &text, KeyReport &chord, String &error) {
+  memset(&chord, 0, sizeof(chord));
+  uint8_t keyCount = 0;
+  int startIndex = 0;
+
+  while (startIndex <= (int)text.length()) {
+    int plusIndex = text.indexOf('+', startIndex);
+    // A trailing "+" is the plus key itself, e.g. CTRL++
+    if (plusIndex == startIndex && plusIndex == (int)text.length() - 1) {
+      plusIndex = -1;
+    }
+    String part = (plusIndex == -1) ? text.substring(startIndex) : text.substring(startIndex, plusIndex);
+
+    uint8_t usage, modifier;
+    uint8_t code = chordKeyCode(part);
+    if (code == 0 || !HidKeyboard.keyUsage(code, usage, modifier)) {
+      error = part;
+      return false;
+    }
+
+    chord.modifiers |= modifier;
+    if (usage != 0) {
+      bool present = false;
+      for (uint8_t i = 0; i < keyCount; i++) {
+        present = present || (chord.keys[i] == usage);
+      }
+      if (!present) {
+        if (keyCount == 6) {
+          error = part;
+          return false;
+        }
+        chord.keys[keyCount++] = usage;
+      }
+    }
+
+    if (plusIndex == -1) {
+      break;
+    }
+    startIndex = plusIndex + 1;
+  }
+  return true;
+}
+
+// Send a compiled chord: one press report, one release report
+void sendChord(const KeyReport &chord) {
+  HidKeyboard.pressChord(chord);
+  HidKeyboard.releaseChord(chord);
+}
+
+#endif // CHORD_COMPILER_H
@@ -1,23 +1,12 @@
 #ifndef C_INSTRUCTIONS_H
 #define C_INSTRUCTIONS_H
 
-#include <Keyboard.h>
+#include "hid-output.h"
 
-// Define SLOW_TYPING in your project's main.ino to enable slow typing
-#ifdef SLOW_TYPING
+// Typed at the pace set by TYPING_RATE / SPEED (see lib/typing-pacer.h)
 void typeCommand(const String& text) {
-    for (unsigned int i = 0; i < text.length(); i++) {
-        Keyboard.write(text.charAt(i));
-        delay(TYPING_DELAY);
-    }
-    Keyboard.write(KEY_RETURN);
-    delay(100);
+    HidKeyboard.println(text);
 }
-#else
-void typeCommand(const String& text) {
-    Keyboard.println(text);
-}
-#endif
 
 // Notepad
 void openNotepad() {
@@ -0,0 +1,85 @@
+/*
+ * Delay Window Work for Ghostkey
+ *
+ * Payloads spend seconds in DELAY while the CPU waits. Background jobs
+ * (reading ahead in the script, flushing buffers, preparing the next
+ * STRING) register a hook here and get called in small steps while such a
+ * window is open. Each call does one bounded step and returns true if more
+ * work is pending. Steps only start while at least DELAY_WORK_GUARD_US of
+ * the window remains, so the window still ends on time as long as a single
+ * step stays shorter than the guard.
+ */
+
+#ifndef DELAY_WORK_H
+#define DELAY_WORK_H
+
+#include <Arduino.h>
+
+#define DELAY_WORK_MAX_HOOKS 4
+
+// Windows shorter than this are plain waits
+#define DELAY_WORK_MIN_WINDOW_MS 20
+
+// No new step starts this close to the end of the window
+#define DELAY_WORK_GUARD_US 5000UL
+
+typedef bool (*DelayWorkHook)();
+
+DelayWorkHook delayWorkHooks[DELAY_WORK_MAX_HOOKS];
+uint8_t delayWorkHookCount = 0;
+
+// Statistics for the execution summary
+unsigned long delayWorkSteps = 0;
+unsigned long delayWorkMicros = 0;
+
+// Register a hook; returns false if the table is full
+bool registerDelayWork(DelayWorkHook hook) {
+  for (uint8_t i = 0; i < delayWorkHookCount; i++) {
+    if (delayWorkHooks[i] == hook) {
+      return true;
+    }
+  }
+  if (delayWorkHookCount >= DELAY_WORK_MAX_HOOKS) {
+    return false;
+  }
+  delayWorkHooks[delayWorkHookCount++] = hook;
+  return true;
+}
+
+void unregisterDelayWork(DelayWorkHook hook) {
+  for (uint8_t i = 0; i < delayWorkHookCount; i++) {
+    if (delayWorkHooks[i] == hook) {
+      delayWorkHooks[i] = delayWorkHooks[--delayWorkHookCount];
+      return;
+    }
+  }
+}
+
+// Run hooks round-robin inside a window of windowMicros that opened at
+// startMicros, until none has work left, the window nears its end or stop
+// becomes true. yield() runs between steps so control inputs stay live.
+void runDelayWork(unsigned long startMicros, unsigned long windowMicros, const volatile bool &stop) {
+  if (windowMicros < DELAY_WORK_GUARD_US) {
+    return;
+  }
+  unsigned long lastStart = windowMicros - DELAY_WORK_GUARD_US;
+
+  bool pending = true;
+  while (pending && !stop) {
+    pending = false;
+    for (uint8_t i = 0; i < delayWorkHookCount && !stop; i++) {
+      unsigned long stepStart = micros();
+      if (stepStart - startMicros >= lastStart) {
+        return;
+      }
+      if (delayWorkHooks[i]()) {
+        pending = true;
+      }
+      delayWorkSteps++;
+      delayWorkMicros += micros() - stepStart;
+      yield();
+    }
+  }
+}
+
+#endif // DELAY_WORK_H
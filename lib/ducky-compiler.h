@@ -0,0 +1,439 @@
+/*
+ * Ducky Script Compiler Format for Ghostkey
+ *
+ * Payloads are compiled once into a compact op stream (the program) that
+ * is cached on the SD card next to the source, so later boots execute it
+ * without parsing. The source is cut into line blocks; each block is
+ * hashed and compiled on its own, and a block map records where every
+ * block's code lives. After an edit only blocks whose hash changed are
+ * compiled again; the others are copied from the previous program and
+ * relinked (given their new source offset and line number).
+ *
+ * Block boundaries are content-defined: a block ends after a line whose
+ * hash matches a pattern (or when the block gets too long), so inserting
+ * or deleting a line only changes the block around it instead of shifting
+ * every block after it.
+ *
+ * INCLUDE lines are linked into the same program: every included snippet
+ * is compiled once per build into a function, however often it is used,
+ * and INCLUDE becomes a call to it. The runtime only ever reads the code
+ * file.
+ *
+ * STRING text with non-ASCII characters is resolved for the configured
+ * keyboard layout while compiling (see lib/unicode-typing.h) and stored as
+ * OP_TYPE with its typing steps, so it replays without lookups. The layout
+ * is recorded in the block map; a program built for another layout is
+ * rebuilt from scratch.
+ *
+ * Code file layout:
+ *   ProgramCodeHeader
+ *   for each block: OP_BLOCK op (ProgramBlockMarker operand), then the
+ *                   block's ops (the block body)
+ *   for each function: its ops, ending with OP_RETURN
+ *   function table: one ProgramFunction per included snippet
+ * Each op is a ProgramOp followed by op.length operand bytes.
+ *
+ * Block map file layout:
+ *   ProgramMapHeader, then one ProgramBlock per block
+ *
+ * tools/gkimage.cpp compiles payloads with this header too, so it (and the
+ * headers it includes) must not depend on Arduino.
+ */
+
+#ifndef DUCKY_COMPILER_H
+#define DUCKY_COMPILER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "payload-catalog.h"
+#include "unicode-typing.h"
+#include "typing-pacer.h"
+
+#define PROGRAM_VERSION 6
+
+// Included snippets per program, and how deeply they may include each other
+#define PROGRAM_MAX_FUNCTIONS 16
+#define PROGRAM_MAX_CALL_DEPTH 4
+#define PROGRAM_PATH_LENGTH 48
+
+// Function flags
+#define PROGRAM_FUNCTION_MISSING 0x01 // Snippet file was not on the card
+
+// Block boundary rule (lines are counted per block)
+#define PROGRAM_BLOCK_MIN_LINES 8
+#define PROGRAM_BLOCK_MAX_LINES 64
+#define PROGRAM_BLOCK_MAX_BYTES 8192
+#define PROGRAM_BLOCK_HASH_MASK 0x0F // 1 in 16 lines ends a block
+
+enum ProgramOpcode {
+  OP_BLOCK = 1,      // Start of a block (ProgramBlockMarker)
+  OP_LINE,           // Source line run through the interpreter (text)
+  OP_DELAY,          // DELAY (uint32 ms)
+  OP_DEFAULT_DELAY,  // DEFAULT_DELAY / DEFAULTDELAY (uint32 ms)
+  OP_STRING,         // STRING (text)
+  OP_STRINGLN,       // STRINGLN (text)
+  OP_CHORD,          // "+" combination resolved to a KeyReport (8 bytes)
+  OP_CHECKPOINT,     // CHECKPOINT
+  OP_CALL,           // INCLUDE (snippet path, run the function compiled from it)
+  OP_RETURN,         // End of a function
+  OP_TYPE,           // STRING with non-ASCII text (uint16 text length, text, TypingSteps)
+  OP_TYPELN,         // STRINGLN with non-ASCII text (same operand)
+  OP_SPEED,          // SPEED (uint32 typingSpeedValue() or TYPING_SPEED_DEFAULT)
+  OP_HOLD,           // HOLD combination (KeyReport, 8 bytes)
+  OP_RELEASE         // RELEASE combination (KeyReport; all zero = everything held)
+};
+
+typedef struct {
+  uint8_t opcode;   // ProgramOpcode
+  uint8_t line;     // Line within the block (0-based)
+  uint16_t length;  // Operand bytes that follow
+  uint32_t srcEnd;  // Source offset after this line, relative to the block
+} ProgramOp;
+
+typedef struct {
+  uint32_t srcOffset; // Block start, relative to the start of the source range
+  uint32_t firstLine; // Lines before the block
+} ProgramBlockMarker;
+
+typedef struct {
+  char magic[4];          // "GKBC"
+  uint16_t version;       // PROGRAM_VERSION
+  uint16_t functionCount; // Entries in the function table
+  uint32_t generation;    // Matches the block map that describes this code
+  uint32_t blocksEnd;     // End of the block code (the functions follow)
+  uint32_t functionTable; // Offset of the function table
+} ProgramCodeHeader;
+
+typedef struct {
+  char path[PROGRAM_PATH_LENGTH]; // Snippet path as used by INCLUDE, NUL padded
+  uint32_t codeOffset;            // First op of the function
+  uint32_t srcSize;               // Snippet size and CRC-32 when compiled
+  uint32_t srcCrc;
+  uint8_t flags;                  // PROGRAM_FUNCTION_*
+  uint8_t reserved[3];
+} ProgramFunction;
+
+typedef struct {
+  char magic[4];        // "GKBM"
+  uint16_t version;     // PROGRAM_VERSION
+  uint16_t typingId;    // Keyboard layout and Unicode input the steps were resolved for
+  uint32_t generation;  // Increases with every build
+  uint32_t rangeOffset; // Source range the program was compiled from
+  uint32_t rangeLength;
+  uint32_t blockCount;
+  uint32_t lineCount;
+  uint32_t codeSize;    // Size of the code file
+  uint32_t codeCrc;     // CRC-32 of the code file, for the card health check
+} ProgramMapHeader;
+
+typedef struct {
+  uint32_t srcOffset;  // Relative to the start of the source range
+  uint32_t srcLength;
+  uint32_t hash;       // CRC-32 of the block's source bytes
+  uint32_t codeOffset; // Block body (after its OP_BLOCK op) in the code file
+  uint32_t codeLength;
+  uint32_t firstLine;
+} ProgramBlock;
+
+static_assert(sizeof(ProgramOp) == 8, "ProgramOp must stay 8 bytes");
+static_assert(sizeof(ProgramBlockMarker) == 8, "ProgramBlockMarker must stay 8 bytes");
+static_assert(sizeof(ProgramCodeHeader) == 20, "ProgramCodeHeader must stay 20 bytes");
+static_assert(sizeof(ProgramFunction) == 64, "ProgramFunction must stay 64 bytes");
+static_assert(sizeof(ProgramMapHeader) == 36, "ProgramMapHeader must stay 36 bytes");
+static_assert(sizeof(ProgramBlock) == 24, "ProgramBlock must stay 24 bytes");
+
+inline void programInitMapHeader(ProgramMapHeader &header) {
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, "GKBM", 4);
+  header.version = PROGRAM_VERSION;
+}
+
+inline bool programMapHeaderValid(const ProgramMapHeader &header) {
+  return memcmp(header.magic, "GKBM", 4) == 0 && header.version == PROGRAM_VERSION;
+}
+
+inline void programInitCodeHeader(ProgramCodeHeader &header, uint32_t generation) {
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, "GKBC", 4);
+  header.version = PROGRAM_VERSION;
+  header.generation = generation;
+}
+
+inline bool programCodeHeaderValid(const ProgramCodeHeader &header, uint32_t generation) {
+  return memcmp(header.magic, "GKBC", 4) == 0 && header.version == PROGRAM_VERSION &&
+         header.generation == generation;
+}
+
+// ---- Call table ----
+
+// A function as the runtime keeps it in RAM while a program runs, so an
+// INCLUDE call is a table lookup instead of a scan of the function table
+// at the end of the code file. Only a hash hit reads the table, to check
+// the path (programPathMatches()).
+typedef struct {
+  uint32_t pathHash;   // programPathHash() of the snippet path
+  uint32_t codeOffset; // First op of the function
+  uint8_t flags;       // PROGRAM_FUNCTION_*
+} ProgramCallTarget;
+
+// CRC-32 of a snippet path, ignoring case like the INCLUDE lookup on FAT
+inline uint32_t programPathHash(const char *path, size_t length) {
+  uint32_t crc = 0;
+  for (size_t i = 0; i < length && path[i] != '\0'; i++) {
+    uint8_t c = (path[i] >= 'a' && path[i] <= 'z') ? path[i] - 'a' + 'A' : path[i];
+    crc = crc32Update(crc, &c, 1);
+  }
+  return crc;
+}
+
+// True if an INCLUDE path names the snippet of a function table entry
+// (NUL padded), ignoring case like programPathHash()
+inline bool programPathMatches(const char *stored, const char *path, size_t length) {
+  if (length >= PROGRAM_PATH_LENGTH) {
+    return false;
+  }
+  for (size_t i = 0; i < length; i++) {
+    uint8_t a = (stored[i] >= 'a' && stored[i] <= 'z') ? stored[i] - 'a' + 'A' : stored[i];
+    uint8_t b = (path[i] >= 'a' && path[i] <= 'z') ? path[i] - 'a' + 'A' : path[i];
+    if (a != b) {
+      return false;
+    }
+  }
+  return stored[length] == '\0';
+}
+
+// ---- Block scanner ----
+
+// Cuts the source into blocks while it is read byte by byte
+typedef struct {
+  uint32_t position;   // Bytes consumed
+  uint32_t lineCount;  // Complete lines consumed
+  uint32_t lineHash;   // FNV-1a of the current line
+  ProgramBlock block;  // Block in progress (codeOffset/codeLength unused)
+} ProgramBlockScanner;
+
+inline void programScannerStartBlock(ProgramBlockScanner &scanner) {
+  memset(&scanner.block, 0, sizeof(scanner.block));
+  scanner.block.srcOffset = scanner.position;
+  scanner.block.firstLine = scanner.lineCount;
+}
+
+inline void programScannerInit(ProgramBlockScanner &scanner) {
+  scanner.position = 0;
+  scanner.lineCount = 0;
+  scanner.lineHash = 2166136261UL;
+  programScannerStartBlock(scanner);
+}
+
+// Consume one source byte. Returns true when a block ends after it; the
+// finished block is then in scanner.block until programScannerStartBlock().
+inline bool programScannerFeed(ProgramBlockScanner &scanner, uint8_t c) {
+  scanner.position++;
+  scanner.block.srcLength++;
+  scanner.block.hash = crc32Update(scanner.block.hash, &c, 1);
+  if (c != '\n') {
+    scanner.lineHash = (scanner.lineHash ^ c) * 16777619UL;
+    return false;
+  }
+
+  scanner.lineCount++;
+  uint32_t lines = scanner.lineCount - scanner.block.firstLine;
+  bool boundary = (lines >= PROGRAM_BLOCK_MIN_LINES && (scanner.lineHash & PROGRAM_BLOCK_HASH_MASK) == 0) ||
+                  lines >= PROGRAM_BLOCK_MAX_LINES ||
+                  scanner.block.srcLength >= PROGRAM_BLOCK_MAX_BYTES;
+  scanner.lineHash = 2166136261UL;
+  return boundary;
+}
+
+// At the end of the source: true if a last (partial) block is pending
+inline bool programScannerFinish(ProgramBlockScanner &scanner) {
+  if (scanner.block.srcLength == 0) {
+    return false;
+  }
+  if (scanner.position > 0 && scanner.lineHash != 2166136261UL) {
+    scanner.lineCount++; // Last line without a newline
+  }
+  return true;
+}
+
+// ---- Line compiler ----
+
+// Resolves a "+" combination into an 8-byte KeyReport; false if it can't
+typedef bool (*ProgramChordResolver)(const char *text, size_t length, uint8_t report[8]);
+
+typedef struct {
+  uint8_t opcode;        // 0 = nothing to emit (blank line or comment)
+  const char *text;      // Text operand (points into the source line)
+  size_t textLength;
+  uint32_t value;        // Numeric operand
+  uint8_t chord[8];      // OP_CHORD operand
+} CompiledLine;
+
+inline bool programIsSpace(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v';
+}
+
+inline bool programStartsWith(const char *text, size_t length, const char *prefix) {
+  size_t prefixLength = strlen(prefix);
+  return length >= prefixLength && memcmp(text, prefix, prefixLength) == 0;
+}
+
+inline bool programEquals(const char *text, size_t length, const char *word) {
+  return strlen(word) == length && memcmp(text, word, length) == 0;
+}
+
+// Same result as Arduino's String::toInt() (atol)
+inline uint32_t programParseNumber(const char *text, size_t length) {
+  size_t i = 0;
+  while (i < length && programIsSpace(text[i])) {
+    i++;
+  }
+  bool negative = false;
+  if (i < length && (text[i] == '-' || text[i] == '+')) {
+    negative = (text[i] == '-');
+    i++;
+  }
+  int32_t value = 0;
+  while (i < length && text[i] >= '0' && text[i] <= '9') {
+    value = value * 10 + (text[i] - '0');
+    i++;
+  }
+  return (uint32_t)(negative ? -value : value);
+}
+
+// Compile one source line the way the direct ASCII interpreter reads it:
+// trimmed, blank lines and //, # and REM comments skipped, command and
+// parameters split at the first space and trimmed.
+inline void compileDuckyLine(const char *line, size_t length, CompiledLine &out, ProgramChordResolver resolver) {
+  memset(&out, 0, sizeof(out));
+  while (length > 0 && programIsSpace(*line)) {
+    line++;
+    length--;
+  }
+  while (length > 0 && programIsSpace(line[length - 1])) {
+    length--;
+  }
+  if (length == 0 || programStartsWith(line, length, "//") || programStartsWith(line, length, "#") ||
+      programStartsWith(line, length, "REM")) {
+    return;
+  }
+
+  size_t commandLength = 0;
+  while (commandLength < length && line[commandLength] != ' ') {
+    commandLength++;
+  }
+  const char *params = line + commandLength;
+  size_t paramsLength = length - commandLength;
+  while (paramsLength > 0 && programIsSpace(*params)) {
+    params++;
+    paramsLength--;
+  }
+  while (commandLength > 0 && programIsSpace(line[commandLength - 1])) {
+    commandLength--;
+  }
+
+  if (programEquals(line, commandLength, "DELAY")) {
+    out.opcode = OP_DELAY;
+    out.value = programParseNumber(params, paramsLength);
+  } else if (programEquals(line, commandLength, "DEFAULT_DELAY") || programEquals(line, commandLength, "DEFAULTDELAY")) {
+    out.opcode = OP_DEFAULT_DELAY;
+    out.value = programParseNumber(params, paramsLength);
+  } else if (programEquals(line, commandLength, "SPEED") && typingParseSpeed(params, paramsLength, out.value)) {
+    out.opcode = OP_SPEED; // Invalid parameters stay OP_LINE, the interpreter reports them
+  } else if (programEquals(line, commandLength, "HOLD") && paramsLength > 0 && resolver != NULL &&
+             resolver(params, paramsLength, out.chord)) {
+    out.opcode = OP_HOLD;
+  } else if (programEquals(line, commandLength, "RELEASE") &&
+             (paramsLength == 0 || programEquals(params, paramsLength, "ALL") ||
+              (resolver != NULL && resolver(params, paramsLength, out.chord)))) {
+    out.opcode = OP_RELEASE;
+  } else if (programEquals(line, commandLength, "STRING")) {
+    out.opcode = OP_STRING;
+    out.text = params;
+    out.textLength = paramsLength;
+  } else if (programEquals(line, commandLength, "STRINGLN")) {
+    out.opcode = OP_STRINGLN;
+    out.text = params;
+    out.textLength = paramsLength;
+  } else if (programEquals(line, commandLength, "CHECKPOINT")) {
+    out.opcode = OP_CHECKPOINT;
+  } else if (programEquals(line, commandLength, "INCLUDE")) {
+    out.opcode = OP_CALL;
+    out.text = params;
+    out.textLength = paramsLength;
+  } else if (memchr(line, '+', commandLength) != NULL && resolver != NULL &&
+             resolver(line, commandLength, out.chord)) {
+    out.opcode = OP_CHORD;
+  } else {
+    // Everything else keeps its source text and runs through the interpreter
+    out.opcode = OP_LINE;
+    out.text = line;
+    out.textLength = length;
+  }
+}
+
+// True if STRING text has to be compiled to OP_TYPE (any non-ASCII byte)
+inline bool programNeedsTyping(const char *text, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    if ((uint8_t)text[i] >= 0x80) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Typing steps OP_TYPE stores for text; characters that cannot be typed
+// take one silent step each and are counted in untypable
+inline uint32_t programTypingStepCount(const TypingLayout &layout, uint8_t unicodeInput,
+                                       const char *text, size_t length, uint32_t &untypable) {
+  uint32_t count = 0;
+  untypable = 0;
+  TypingStep steps[TYPING_MAX_STEPS];
+  for (size_t i = 0; i < length;) {
+    size_t charSteps = resolveTypingChar(layout, unicodeInput, utf8Next(text, length, i), steps);
+    if (charSteps == 0) {
+      untypable++;
+      charSteps = 1;
+    }
+    count += charSteps;
+  }
+  return count;
+}
+
+// Operand bytes compileDuckyLine() output needs
+inline uint16_t compiledOperandLength(const CompiledLine &compiled) {
+  switch (compiled.opcode) {
+    case OP_DELAY:
+    case OP_DEFAULT_DELAY:
+    case OP_SPEED:
+      return sizeof(uint32_t);
+    case OP_CHORD:
+    case OP_HOLD:
+    case OP_RELEASE:
+      return sizeof(compiled.chord);
+    case OP_CHECKPOINT:
+    case OP_RETURN:
+      return 0;
+    default:
+      return (uint16_t)compiled.textLength;
+  }
+}
+
+// Pointer to the operand bytes of compileDuckyLine() output
+inline const uint8_t *compiledOperand(const CompiledLine &compiled) {
+  switch (compiled.opcode) {
+    case OP_DELAY:
+    case OP_DEFAULT_DELAY:
+    case OP_SPEED:
+      return (const uint8_t *)&compiled.value;
+    case OP_CHORD:
+    case OP_HOLD:
+    case OP_RELEASE:
+      return compiled.chord;
+    default:
+      return (const uint8_t *)compiled.text;
+  }
+}
+
+#endif // DUCKY_COMPILER_H
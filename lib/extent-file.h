@@ -0,0 +1,367 @@
+/*
+ * Extent-Mapped File Reader for Ghostkey
+ *
+ * The SD library seeks by following the file's FAT cluster chain, one FAT
+ * entry per cluster: from the current cluster when the target lies ahead,
+ * from the first cluster when it lies behind. Every resume, catalog range
+ * and INCLUDE return in a large file pays for that walk again.
+ *
+ * SdExtentFile walks the chain once, when the file is opened, and keeps it
+ * in RAM as extents: runs of consecutive clusters (start cluster, length).
+ * A seek is then a lookup in that list, and the next read fetches the one
+ * sector it lands in straight from the card with Sd2Card::readBlock().
+ * Files written by tools/gkimage are contiguous, so they map to a single
+ * extent and the lookup is plain arithmetic.
+ *
+ * With a spare sector buffer set (setReadAhead()), readAhead() reads the
+ * sector after the current one ahead of time, e.g. as delay work
+ * (lib/delay-work.h); the read that reaches it then takes it from RAM.
+ *
+ * The file is found through the SdFat classes the SD library is built on:
+ * SdVolume::sdCard() is the card SD.begin() set up, and SdFile gives the
+ * first cluster and the directory entry. firstCluster(), writeDate() and
+ * writeTime() keep the latter after open(), so a caller can tell an
+ * unchanged file without reading it (payload_catalog.ino). Reads bypass the SD library's block cache, so a file must
+ * not be written through SD while it is open here. A file that cannot be
+ * mapped (FAT12, more than EXTENT_FILE_MAX_EXTENTS fragments, card not
+ * mounted) is read through an ordinary SD File instead, so callers never
+ * need a second code path.
+ *
+ * Those classes are internals of the SD library the SAMD cores ship. The
+ * RP2040 core's SD library wraps SdFat 2 and has none of them, so outside
+ * ARDUINO_ARCH_SAMD every file is read through File and firstCluster()
+ * stays 0. The soak harness's SD library (tools/soak/host/SD.h) models the
+ * SAMD one and defines SD_LEGACY_SDFAT_CLASSES.
+ */
+
+#ifndef EXTENT_FILE_H
+#define EXTENT_FILE_H
+
+#include <SPI.h>
+#include <SD.h>
+
+#if defined(ARDUINO_ARCH_SAMD) || defined(SD_LEGACY_SDFAT_CLASSES)
+#define EXTENT_FILE_MAPPING 1
+#else
+#define EXTENT_FILE_MAPPING 0
+#endif
+
+#define EXTENT_FILE_MAX_EXTENTS 16
+#define EXTENT_FILE_SECTOR 512
+#define EXTENT_FILE_NO_BLOCK 0xFFFFFFFFUL
+
+typedef struct {
+  uint32_t fileCluster; // Index of the extent's first cluster within the file
+  uint32_t cluster;     // Its cluster number on the volume
+  uint32_t count;       // Consecutive clusters
+} FileExtent;
+
+class SdExtentFile {
+public:
+  SdExtentFile()
+      : _mapped(false), _extentCount(0), _blocksPerCluster(0), _dataStartBlock(0), _size(0), _position(0),
+        _block(EXTENT_FILE_NO_BLOCK), _blockPosition(0), _firstCluster(0), _writeDate(0), _writeTime(0),
+        _spare(NULL), _spareBlock(EXTENT_FILE_NO_BLOCK), _sparePosition(0) {}
+
+  // Open path for reading; false if it does not exist
+  bool open(const char *path) {
+    close();
+    if (mapFile(path)) {
+      _mapped = true;
+      return true;
+    }
+    _file = SD.open(path);
+    return (bool)_file;
+  }
+  bool open(const String &path) { return open(path.c_str()); }
+
+  void close() {
+    _file.close();
+    _mapped = false;
+    _extentCount = 0;
+    _size = 0;
+    _position = 0;
+    _block = EXTENT_FILE_NO_BLOCK;
+    _firstCluster = 0;
+    _writeDate = 0;
+    _writeTime = 0;
+    _spare = NULL;
+    _spareBlock = EXTENT_FILE_NO_BLOCK;
+  }
+
+  // EXTENT_FILE_SECTOR bytes for readAhead(), until close()
+  void setReadAhead(uint8_t *spare) {
+    _spare = spare;
+    _spareBlock = EXTENT_FILE_NO_BLOCK;
+  }
+
+  // Read the next sector the file needs into the spare buffer: the one at
+  // the position if it is not loaded, otherwise the one after it. One card
+  // read at most, so no work is left pending (always false, as a delay
+  // work hook).
+  bool readAhead() {
+#if EXTENT_FILE_MAPPING
+    if (!_mapped || _spare == NULL) {
+      return false;
+    }
+    uint32_t next = _position - _position % EXTENT_FILE_SECTOR;
+    if (_block != EXTENT_FILE_NO_BLOCK && _blockPosition == next) {
+      next += EXTENT_FILE_SECTOR;
+    }
+    if (next >= _size || (_spareBlock != EXTENT_FILE_NO_BLOCK && _sparePosition == next)) {
+      return false;
+    }
+    uint32_t block = blockOf(next);
+    if (!_card->readBlock(block, _spare)) {
+      _spareBlock = EXTENT_FILE_NO_BLOCK;
+      return false;
+    }
+    _spareBlock = block;
+    _sparePosition = next;
+#endif
+    return false;
+  }
+
+  operator bool() { return _mapped || _file; }
+  bool mapped() const { return _mapped; }
+  uint8_t extentCount() const { return _extentCount; }
+
+  // From the directory entry; 0 if it could not be read (or the file is empty)
+  uint32_t firstCluster() const { return _firstCluster; }
+  uint16_t writeDate() const { return _writeDate; }
+  uint16_t writeTime() const { return _writeTime; }
+
+  uint32_t size() { return _mapped ? _size : _file.size(); }
+  uint32_t position() { return _mapped ? _position : _file.position(); }
+  int available() {
+    if (!_mapped) {
+      return _file.available();
+    }
+    return (int)(_size - _position);
+  }
+
+  // No card access: the sector is read when the data is
+  bool seek(uint32_t position) {
+    if (!_mapped) {
+      return _file.seek(position);
+    }
+    if (position > _size) {
+      return false;
+    }
+    _position = position;
+    return true;
+  }
+
+  // Bytes read, 0 at the end of the file, -1 if the card failed first
+  int read(void *buffer, uint16_t size) {
+    if (!_mapped) {
+      return _file.read(buffer, size);
+    }
+    uint8_t *out = (uint8_t *)buffer;
+    uint16_t done = 0;
+    while (done < size && _position < _size) {
+      if (!loadSector()) {
+        return done > 0 ? done : -1;
+      }
+      uint32_t offset = _position - _blockPosition;
+      uint32_t chunk = EXTENT_FILE_SECTOR - offset;
+      if (chunk > (uint32_t)(size - done)) {
+        chunk = size - done;
+      }
+      if (chunk > _size - _position) {
+        chunk = _size - _position;
+      }
+      memcpy(out + done, _sector + offset, chunk);
+      done += chunk;
+      _position += chunk;
+    }
+    return done;
+  }
+  int read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+  int peek() {
+    if (!_mapped) {
+      return _file.peek();
+    }
+    return (_position < _size && loadSector()) ? _sector[_position - _blockPosition] : -1;
+  }
+
+  // Like Stream::readStringUntil(), without waiting for more data at the end
+  String readStringUntil(char terminator) {
+    if (!_mapped) {
+      return _file.readStringUntil(terminator);
+    }
+    String text = "";
+    int c;
+    while ((c = read()) >= 0 && c != terminator) {
+      text += (char)c;
+    }
+    return text;
+  }
+
+private:
+#if EXTENT_FILE_MAPPING
+  // Find path one directory level at a time, keep its directory entry and
+  // map its cluster chain
+  bool mapFile(const char *path) {
+    Sd2Card *card = SdVolume::sdCard();
+    SdVolume volume;
+    if (card == NULL || !volume.init(card) || (volume.fatType() != 16 && volume.fatType() != 32)) {
+      return false;
+    }
+    SdFile entries[2];
+    int current = 0;
+    if (!entries[current].openRoot(&volume)) {
+      return false;
+    }
+    char name[13];
+    while (*path != '\0') {
+      if (*path == '/') {
+        path++;
+        continue;
+      }
+      size_t length = 0;
+      while (path[length] != '\0' && path[length] != '/') {
+        length++;
+      }
+      if (length >= sizeof(name)) {
+        entries[current].close();
+        return false; // Not an 8.3 name
+      }
+      memcpy(name, path, length);
+      name[length] = '\0';
+      path += length;
+      bool found = entries[1 - current].open(&entries[current], name, O_READ);
+      entries[current].close();
+      if (!found) {
+        return false;
+      }
+      current = 1 - current;
+    }
+    SdFile &file = entries[current];
+    dir_t entry;
+    if (!file.isDir() && file.dirEntry(&entry)) {
+      _firstCluster = file.firstCluster();
+      _writeDate = entry.lastWriteDate;
+      _writeTime = entry.lastWriteTime;
+    }
+    bool mapped = !file.isDir() && mapChain(card, volume, file.firstCluster(), file.fileSize());
+    file.close();
+    return mapped;
+  }
+
+  // Follow the chain through the FAT once, merging consecutive clusters
+  bool mapChain(Sd2Card *card, SdVolume &volume, uint32_t cluster, uint32_t size) {
+    _card = card;
+    _size = size;
+    _dataStartBlock = volume.dataStartBlock();
+    _blocksPerCluster = volume.blocksPerCluster();
+    _extentCount = 0;
+    bool fat32 = volume.fatType() == 32;
+    uint32_t clusterBytes = (uint32_t)_blocksPerCluster * EXTENT_FILE_SECTOR;
+    uint32_t clusters = (size + clusterBytes - 1) / clusterBytes;
+    uint32_t fatBlock = EXTENT_FILE_NO_BLOCK;
+
+    for (uint32_t i = 0; i < clusters; i++) {
+      if (cluster < 2 || cluster >= (fat32 ? 0x0FFFFFF8UL : 0xFFF8UL)) {
+        return false; // The chain ends before the file does
+      }
+      FileExtent *last = (_extentCount > 0) ? &_extents[_extentCount - 1] : NULL;
+      if (last != NULL && last->cluster + last->count == cluster) {
+        last->count++;
+      } else if (_extentCount < EXTENT_FILE_MAX_EXTENTS) {
+        _extents[_extentCount].fileCluster = i;
+        _extents[_extentCount].cluster = cluster;
+        _extents[_extentCount].count = 1;
+        _extentCount++;
+      } else {
+        return false; // Too fragmented to keep in RAM
+      }
+      if (i + 1 == clusters) {
+        break;
+      }
+
+      uint32_t offset = cluster * (fat32 ? 4 : 2);
+      uint32_t block = volume.fatStartBlock() + offset / EXTENT_FILE_SECTOR;
+      if (block != fatBlock) {
+        if (!card->readBlock(block, _sector)) {
+          return false;
+        }
+        fatBlock = block;
+      }
+      const uint8_t *entry = _sector + offset % EXTENT_FILE_SECTOR;
+      cluster = (uint32_t)entry[0] | ((uint32_t)entry[1] << 8);
+      if (fat32) {
+        cluster |= ((uint32_t)entry[2] << 16) | ((uint32_t)(entry[3] & 0x0F) << 24);
+      }
+    }
+    _block = EXTENT_FILE_NO_BLOCK; // The buffer holds FAT data
+    return true;
+  }
+
+  // Card block holding file offset position
+  uint32_t blockOf(uint32_t position) {
+    uint32_t clusterBytes = (uint32_t)_blocksPerCluster * EXTENT_FILE_SECTOR;
+    uint32_t index = position / clusterBytes;
+    const FileExtent *extent = &_extents[0];
+    for (uint8_t i = 1; i < _extentCount && _extents[i].fileCluster <= index; i++) {
+      extent = &_extents[i]; // A contiguous file never enters the loop
+    }
+    uint32_t cluster = extent->cluster + (index - extent->fileCluster);
+    return _dataStartBlock + (cluster - 2) * _blocksPerCluster + (position % clusterBytes) / EXTENT_FILE_SECTOR;
+  }
+
+  // Have the sector holding _position in the buffer
+  bool loadSector() {
+    if (_block != EXTENT_FILE_NO_BLOCK && _position >= _blockPosition &&
+        _position - _blockPosition < EXTENT_FILE_SECTOR) {
+      return true;
+    }
+    uint32_t blockPosition = _position - _position % EXTENT_FILE_SECTOR;
+    if (_spareBlock != EXTENT_FILE_NO_BLOCK && _sparePosition == blockPosition) {
+      memcpy(_sector, _spare, EXTENT_FILE_SECTOR); // Read ahead
+      _block = _spareBlock;
+      _blockPosition = blockPosition;
+      _spareBlock = EXTENT_FILE_NO_BLOCK;
+      return true;
+    }
+    uint32_t block = blockOf(_position);
+    if (!_card->readBlock(block, _sector)) {
+      _block = EXTENT_FILE_NO_BLOCK;
+      return false;
+    }
+    _block = block;
+    _blockPosition = blockPosition;
+    return true;
+  }
+
+#else
+  bool mapFile(const char *) { return false; }
+  bool loadSector() { return false; }
+#endif
+
+  File _file; // Used instead when the file could not be mapped
+  bool _mapped;
+  uint8_t _extentCount;
+  uint8_t _blocksPerCluster;
+  uint32_t _dataStartBlock;
+  uint32_t _size;
+  uint32_t _position;
+  uint32_t _block;         // Card block in _sector
+  uint32_t _blockPosition; // File offset of its first byte
+  uint32_t _firstCluster;
+  uint16_t _writeDate;
+  uint16_t _writeTime;
+  uint8_t *_spare;         // Read-ahead buffer, if set
+  uint32_t _spareBlock;    // Card block in _spare
+  uint32_t _sparePosition; // File offset of its first byte
+#if EXTENT_FILE_MAPPING
+  Sd2Card *_card = NULL;
+#endif
+  FileExtent _extents[EXTENT_FILE_MAX_EXTENTS];
+  uint8_t _sector[EXTENT_FILE_SECTOR];
+};
+
+#endif // EXTENT_FILE_H
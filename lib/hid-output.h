@@ -0,0 +1,381 @@
+/*
+ * HID Keyboard Output for Ghostkey
+ *
+ * Builds the keyboard report itself and hands it to the USB HID core,
+ * instead of going through the Keyboard_ object. Key handling mirrors
+ * Keyboard_ (same key codes, same layout tables), but every report passes
+ * through a gate first, so the sketch can pause or drop output (abort)
+ * before it reaches the host. Typed characters (write()) also wait for the
+ * pacer, which spaces keystrokes out (see lib/typing-pacer.h).
+ *
+ * Every report sent is timestamped and handed to an observer, together
+ * with what it was part of: the first report of a typed keystroke (the
+ * one after pace()), the rest of that keystroke up to the report that lets
+ * go of everything but the held keys, or anything else.
+ *
+ * Keys pressed with hold() stay down until unhold(): release(),
+ * releaseChord() and releaseAll() leave them in the report, so a held
+ * modifier applies to everything typed in between without being pressed
+ * again for every key.
+ *
+ * Keyboard.begin() is still called so the Keyboard library registers its
+ * HID report descriptor; the reports use the same report ID.
+ *
+ * On the RP2040 the engine runs on core 1 and USB belongs to core 0
+ * (usb_core.ino), so reports are queued on hidReportFifo instead of being
+ * sent here (GHOSTKEY_REPORT_FIFO, see lib/report-fifo.h). The observer
+ * then gets the time the report was queued; core 0 sends it on the next
+ * free USB frame, at most REPORT_FIFO_DEPTH frames later.
+ */
+
+#ifndef HID_OUTPUT_H
+#define HID_OUTPUT_H
+
+#include <Keyboard.h>
+
+#if defined(ARDUINO_ARCH_RP2040) && !defined(GHOSTKEY_REPORT_FIFO)
+#define GHOSTKEY_REPORT_FIFO
+#endif
+
+#ifdef GHOSTKEY_REPORT_FIFO
+#include "report-fifo.h"
+#endif
+
+#define HID_KEYBOARD_REPORT_ID 2
+
+// Layout table flags (see KeyboardLayout.h in the Keyboard library)
+#define HID_LAYOUT_SHIFT 0x80
+#define HID_LAYOUT_ALT_GR 0x40
+#define HID_ISO_KEY 0x64
+#define HID_ISO_REPLACEMENT 0x32
+
+// mapKey() result for characters the layout cannot type
+#define HID_KEY_UNMAPPED 0xFF
+
+// Called before each report; return false to drop it
+typedef bool (*HidReportGate)(const KeyReport &report);
+
+// Called before each typed keystroke; returns once it may be sent
+typedef void (*HidKeystrokePacer)();
+
+// What a report was part of, for the report observer
+#define HID_REPORT_KEYS 0       // Named keys, combinations, releases
+#define HID_REPORT_KEYSTROKE 1  // First report of a typed keystroke
+#define HID_REPORT_TYPED 2      // Rest of a typed keystroke
+
+// Called after each report with the micros() it was sent at
+typedef void (*HidReportObserver)(unsigned long sentMicros, uint8_t kind);
+
+#ifdef GHOSTKEY_REPORT_FIFO
+// Reports on their way from the engine core to the USB core
+ReportFifo<KeyReport, REPORT_FIFO_DEPTH> hidReportFifo;
+#endif
+
+class HidKeyboard_ : public Print {
+public:
+  HidKeyboard_()
+      : _asciimap(KeyboardLayout_en_US), _gate(NULL), _pacer(NULL), _observer(NULL), _sendMicros(0),
+        _reportKind(HID_REPORT_KEYS) {
+    memset(&_report, 0, sizeof(_report));
+    memset(&_held, 0, sizeof(_held));
+  }
+
+  void begin(const uint8_t *layout = KeyboardLayout_en_US) {
+    Keyboard.begin(layout);
+    _asciimap = layout;
+    memset(&_report, 0, sizeof(_report));
+    memset(&_held, 0, sizeof(_held));
+  }
+
+  void setGate(HidReportGate gate) {
+    _gate = gate;
+  }
+
+  void setPacer(HidKeystrokePacer pacer) {
+    _pacer = pacer;
+  }
+
+  void setObserver(HidReportObserver observer) {
+    _observer = observer;
+  }
+
+  // Wait for the pacer, for keystrokes typed without write()
+  void pace() {
+    if (_pacer != NULL) {
+      _pacer();
+    }
+    _reportKind = HID_REPORT_KEYSTROKE;
+  }
+
+  // Current key state as last built (may not have reached the host)
+  const KeyReport &report() const {
+    return _report;
+  }
+
+  // Send a report to the host directly, bypassing the gate
+  void sendRawReport(const KeyReport &report) {
+    unsigned long start = micros();
+#ifdef GHOSTKEY_REPORT_FIFO
+    // A full ring means USB is behind; wait for core 0 to send one
+    while (!hidReportFifo.push(report)) {
+      yield();
+    }
+#else
+    HID().SendReport(HID_KEYBOARD_REPORT_ID, &report, sizeof(KeyReport));
+#endif
+    _sendMicros += micros() - start;
+    if (_observer != NULL) {
+      _observer(start, _reportKind);
+    }
+    if (memcmp(&report, &_held, sizeof(KeyReport)) == 0) {
+      _reportKind = HID_REPORT_KEYS; // Keystroke complete
+    } else if (_reportKind == HID_REPORT_KEYSTROKE) {
+      _reportKind = HID_REPORT_TYPED;
+    }
+  }
+
+  // Microseconds spent handing reports to the USB core since boot (wraps)
+  uint32_t sendMicros() const {
+    return _sendMicros;
+  }
+
+  // Tell the host nothing is held, without changing the tracked state
+  void releaseOnHost() {
+    KeyReport empty;
+    memset(&empty, 0, sizeof(empty));
+    sendRawReport(empty);
+  }
+
+  size_t press(uint8_t k) {
+    uint8_t modifier;
+    k = mapKey(k, modifier);
+    if (k == HID_KEY_UNMAPPED) {
+      setWriteError();
+      return 0;
+    }
+    _report.modifiers |= modifier;
+
+    // Add k to the report only if it's not already present and there's an empty slot
+    if (_report.keys[0] != k && _report.keys[1] != k && _report.keys[2] != k &&
+        _report.keys[3] != k && _report.keys[4] != k && _report.keys[5] != k) {
+      uint8_t i;
+      for (i = 0; i < 6; i++) {
+        if (_report.keys[i] == 0x00) {
+          _report.keys[i] = k;
+          break;
+        }
+      }
+      if (i == 6) {
+        setWriteError();
+        return 0;
+      }
+    }
+    sendReport();
+    return 1;
+  }
+
+  size_t release(uint8_t k) {
+    uint8_t modifier;
+    k = mapKey(k, modifier);
+    if (k == HID_KEY_UNMAPPED) {
+      return 0;
+    }
+    _report.modifiers &= ~(modifier & ~_held.modifiers);
+
+    for (uint8_t i = 0; i < 6; i++) {
+      if (0 != k && _report.keys[i] == k && !isHeld(k)) {
+        _report.keys[i] = 0x00;
+      }
+    }
+    sendReport();
+    return 1;
+  }
+
+  // Release everything except the held keys
+  void releaseAll() {
+    _report = _held;
+    sendReport();
+  }
+
+  // Press a chord and keep it down across later presses and releases
+  size_t hold(const KeyReport &chord) {
+    _held.modifiers |= chord.modifiers;
+    for (uint8_t c = 0; c < 6; c++) {
+      if (chord.keys[c] != 0 && !isHeld(chord.keys[c])) {
+        for (uint8_t i = 0; i < 6; i++) {
+          if (_held.keys[i] == 0x00) {
+            _held.keys[i] = chord.keys[c];
+            break;
+          }
+        }
+      }
+    }
+    return pressChord(chord);
+  }
+
+  // Stop holding a chord and release it with one report
+  void unhold(const KeyReport &chord) {
+    _held.modifiers &= ~chord.modifiers;
+    for (uint8_t c = 0; c < 6; c++) {
+      for (uint8_t i = 0; i < 6; i++) {
+        if (chord.keys[c] != 0 && _held.keys[i] == chord.keys[c]) {
+          _held.keys[i] = 0x00;
+        }
+      }
+    }
+    releaseChord(chord);
+  }
+
+  // Stop holding and release everything hold() pressed
+  void unholdAll() {
+    KeyReport held = _held;
+    unhold(held);
+  }
+
+  // Keys and modifiers currently held by hold()
+  const KeyReport &held() const {
+    return _held;
+  }
+
+  bool holding() const {
+    return _held.modifiers != 0 || _held.keys[0] != 0 || _held.keys[1] != 0 || _held.keys[2] != 0 ||
+           _held.keys[3] != 0 || _held.keys[4] != 0 || _held.keys[5] != 0;
+  }
+
+  // Usage ID and implied modifier bits of a Keyboard_ key code; false if
+  // the layout cannot type it
+  bool keyUsage(uint8_t k, uint8_t &usage, uint8_t &modifier) {
+    usage = mapKey(k, modifier);
+    return usage != HID_KEY_UNMAPPED;
+  }
+
+  // Press all keys and modifiers of a chord with a single report
+  size_t pressChord(const KeyReport &chord) {
+    _report.modifiers |= chord.modifiers;
+    for (uint8_t c = 0; c < 6; c++) {
+      uint8_t k = chord.keys[c];
+      if (k == 0) {
+        continue;
+      }
+      uint8_t free = 6;
+      bool present = false;
+      for (uint8_t i = 0; i < 6; i++) {
+        if (_report.keys[i] == k) {
+          present = true;
+        } else if (_report.keys[i] == 0x00 && free == 6) {
+          free = i;
+        }
+      }
+      if (!present) {
+        if (free == 6) {
+          setWriteError();
+          return 0;
+        }
+        _report.keys[free] = k;
+      }
+    }
+    sendReport();
+    return 1;
+  }
+
+  // Release all keys and modifiers of a chord with a single report (held
+  // keys stay down)
+  void releaseChord(const KeyReport &chord) {
+    _report.modifiers &= ~(chord.modifiers & ~_held.modifiers);
+    for (uint8_t c = 0; c < 6; c++) {
+      for (uint8_t i = 0; i < 6; i++) {
+        if (chord.keys[c] != 0 && _report.keys[i] == chord.keys[c] && !isHeld(chord.keys[c])) {
+          _report.keys[i] = 0x00;
+        }
+      }
+    }
+    sendReport();
+  }
+
+  size_t write(uint8_t c) {
+    pace();
+    uint8_t p = press(c);
+    release(c);
+    return p;
+  }
+
+  size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+      if (*buffer != '\r') {
+        if (write(*buffer)) {
+          n++;
+        } else {
+          break;
+        }
+      }
+      buffer++;
+    }
+    return n;
+  }
+
+  using Print::write;
+
+private:
+  KeyReport _report;
+  KeyReport _held;
+  const uint8_t *_asciimap;
+  HidReportGate _gate;
+  HidKeystrokePacer _pacer;
+  HidReportObserver _observer;
+  uint32_t _sendMicros;
+  uint8_t _reportKind; // HID_REPORT_* of the next report
+
+  bool isHeld(uint8_t usage) const {
+    for (uint8_t i = 0; i < 6; i++) {
+      if (_held.keys[i] == usage) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Translate a Keyboard_ key code into a usage ID plus the modifier bits it
+  // implies. Returns 0 for a bare modifier and HID_KEY_UNMAPPED for a
+  // character the layout cannot type.
+  uint8_t mapKey(uint8_t k, uint8_t &modifier) {
+    modifier = 0;
+    if (k >= 136) {
+      // Non-printing key (not a modifier)
+      return k - 136;
+    }
+    if (k >= 128) {
+      // Modifier key
+      modifier = (1 << (k - 128));
+      return 0;
+    }
+
+    // Printing key
+    k = pgm_read_byte(_asciimap + k);
+    if (!k) {
+      return HID_KEY_UNMAPPED;
+    }
+    if ((k & HID_LAYOUT_ALT_GR) == HID_LAYOUT_ALT_GR) {
+      modifier = 0x40; // AltGr = right Alt
+      k &= 0x3F;
+    } else if ((k & HID_LAYOUT_SHIFT) == HID_LAYOUT_SHIFT) {
+      modifier = 0x02; // the left Shift modifier
+      k &= 0x7F;
+    }
+    if (k == HID_ISO_REPLACEMENT) {
+      k = HID_ISO_KEY;
+    }
+    return k;
+  }
+
+  void sendReport() {
+    if (_gate != NULL && !_gate(_report)) {
+      return;
+    }
+    sendRawReport(_report);
+  }
+};
+
+HidKeyboard_ HidKeyboard;
+
+#endif // HID_OUTPUT_H
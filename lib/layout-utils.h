@@ -1,7 +1,136 @@
 #ifndef LAYOUT_UTILS_H
 #define LAYOUT_UTILS_H
 
-#include <Keyboard.h>
+#include "hid-output.h"
+
+#define TYPING_READ_BYTE(address) pgm_read_byte(address)
+#include "unicode-typing.h"
+#include "unicode-layouts.h"
+#include "typing-pacer.h"
+
+// Layouts KEYBOARD_LAYOUT can select; the index is part of the compiled
+// program's identity, so only append to this list
+const TypingLayout TYPING_LAYOUTS[] = {
+  { "en_US", KeyboardLayout_en_US, UNICODE_KEYS_en_US },
+  { "de_DE", KeyboardLayout_de_DE, UNICODE_KEYS_de_DE },
+  { "es_ES", KeyboardLayout_es_ES, UNICODE_KEYS_es_ES },
+  { "fr_FR", KeyboardLayout_fr_FR, UNICODE_KEYS_fr_FR },
+  { "it_IT", KeyboardLayout_it_IT, UNICODE_KEYS_it_IT },
+  { "pt_PT", KeyboardLayout_pt_PT, UNICODE_KEYS_pt_PT },
+  { "sv_SE", KeyboardLayout_sv_SE, UNICODE_KEYS_sv_SE },
+  { "da_DK", KeyboardLayout_da_DK, UNICODE_KEYS_da_DK },
+  { "hu_HU", KeyboardLayout_hu_HU, UNICODE_KEYS_hu_HU },
+};
+#define TYPING_LAYOUT_COUNT (sizeof(TYPING_LAYOUTS) / sizeof(TYPING_LAYOUTS[0]))
+
+uint8_t typingLayoutIndex = 0;                  // Entry of TYPING_LAYOUTS in use
+uint8_t unicodeInputMode = UNICODE_INPUT_NONE;  // Host method for characters the layout lacks
+
+// Keystroke pacing (TYPING_RATE / SPEED); engine_control.ino waits on it
+TypingPacer typingPacer;
+
+// Change the pacing, e.g. for a SPEED section; the bucket starts full
+void setTypingSpeed(uint16_t rate, uint8_t burst) {
+  typingPacer.configure(rate, burst, micros());
+}
+
+// Typing throughput of the current run (see run_history.ino)
+unsigned long typingCharCount = 0;
+unsigned long typingMicrosSpent = 0;
+
+const TypingLayout &typingLayout() {
+  return TYPING_LAYOUTS[typingLayoutIndex];
+}
+
+// Switch to the named layout; false if there is no such layout
+bool selectTypingLayout(const String &name) {
+  for (uint8_t i = 0; i < TYPING_LAYOUT_COUNT; i++) {
+    if (name.equalsIgnoreCase(TYPING_LAYOUTS[i].name)) {
+      typingLayoutIndex = i;
+      HidKeyboard.begin(TYPING_LAYOUTS[i].asciiMap);
+      return true;
+    }
+  }
+  return false;
+}
+
+// Back to the first layout and no Unicode input, as before config.txt sets
+// them (RELOAD reads the file again from the defaults)
+void resetTypingLayout() {
+  selectTypingLayout(TYPING_LAYOUTS[0].name);
+  unicodeInputMode = UNICODE_INPUT_NONE;
+}
+
+// Layout and Unicode input method in one value, stored with compiled
+// programs so a program built for another setup is rebuilt
+uint16_t typingConfigId() {
+  return ((uint16_t)typingLayoutIndex << 8) | unicodeInputMode;
+}
+
+// Send one typing step: press and release the key on top of the held
+// modifiers. Every step that reaches the host is one paced keystroke.
+void sendTypingStep(const TypingStep &step) {
+  KeyReport chord;
+  memset(&chord, 0, sizeof(chord));
+  if (step.flags & TYPING_STEP_RELEASE) {
+    HidKeyboard.pace();
+    chord.modifiers = step.held;
+    HidKeyboard.releaseChord(chord);
+  } else if (!(step.flags & TYPING_STEP_SILENT)) {
+    HidKeyboard.pace();
+    chord.modifiers = step.held | step.modifiers;
+    chord.keys[0] = step.usage;
+    HidKeyboard.pressChord(chord);
+    chord.modifiers = step.modifiers & ~step.held;
+    HidKeyboard.releaseChord(chord);
+  }
+}
+
+// Resolve a character for the current layout; an untypable character
+// resolves to a single silent step
+size_t resolveTypingSteps(uint32_t codepoint, TypingStep *steps) {
+  size_t count = resolveTypingChar(typingLayout(), unicodeInputMode, codepoint, steps);
+  if (count == 0) {
+    typingSilentStep(steps[0]);
+    count = 1;
+  }
+  return count;
+}
+
+// Type a non-ASCII character, one paced keystroke per key of its sequence
+void typeUnicodeChar(uint32_t codepoint) {
+  TypingStep steps[TYPING_MAX_STEPS];
+  size_t count = resolveTypingSteps(codepoint, steps);
+  if (steps[0].flags & TYPING_STEP_SILENT) {
+    Serial.print(F("Cannot type U+"));
+    Serial.print(codepoint, HEX);
+    Serial.print(F(" on layout "));
+    Serial.println(typingLayout().name);
+  }
+  for (size_t i = 0; i < count; i++) {
+    sendTypingStep(steps[i]);
+  }
+}
+
+// Paced keystrokes typeDirectASCII() sends for text
+unsigned long typingKeystrokes(const String &text) {
+  unsigned long keys = 0;
+  for (size_t i = 0; i < text.length();) {
+    uint32_t codepoint = utf8Next(text.c_str(), text.length(), i);
+    if (codepoint < 0x80) {
+      keys++;
+      continue;
+    }
+    TypingStep steps[TYPING_MAX_STEPS];
+    size_t count = resolveTypingSteps(codepoint, steps);
+    for (size_t s = 0; s < count; s++) {
+      if (!(steps[s].flags & TYPING_STEP_SILENT)) {
+        keys++;
+      }
+    }
+  }
+  return keys;
+}
 
 // USB HID keycodes - these are standardized
 #define KEY_A       4  // a and A
@@ -44,20 +173,22 @@
 
 // Function to send raw keycode regardless of keyboard layout
 void pressRawKey(uint8_t keycode, bool withShift = false) {
+  HidKeyboard.pace();
+
   // Press shift first if needed
   if (withShift) {
-    Keyboard.press(KEY_LEFT_SHIFT);
+    HidKeyboard.press(KEY_LEFT_SHIFT);
     delay(250); // Much longer delay to ensure SHIFT is registered properly
   }
   
   // Press the main key
-  Keyboard.press(keycode);
+  HidKeyboard.press(keycode);
   
   // Hold the key(s) for a longer time to ensure they're registered
   delay(250); // Increased substantially for better reliability
   
   // Release all keys at once
-  Keyboard.releaseAll();
+  HidKeyboard.releaseAll();
   
   // Add a small delay after releasing to prevent key repeats/stuck keys
   delay(50); // Increased delay after key release
@@ -67,8 +198,8 @@ void pressRawKey(uint8_t keycode, bool withShift = false) {
 // Use this as a fallback when layout-independent mode is causing issues
 void forceSendASCII(char c) {
   // The Arduino Keyboard library has a write() function that sends ASCII directly
-  Keyboard.write(c);
-  delay(10); // Small delay to prevent key repeats
+  // (paced, see lib/typing-pacer.h)
+  HidKeyboard.write(c);
 }
 
 // Function to type a character using scan codes
@@ -140,36 +271,36 @@ void typeLayoutIndependentChar(char c) {
   }
 }
 
-// Type a string using layout-independent method
+// Type a string using layout-independent method, paced by the typing pacer
 void typeLayoutIndependent(const String &text) {
-  for (unsigned int i = 0; i < text.length(); i++) {
-    typeLayoutIndependentChar(text[i]);
-    delay(20); // Add a small delay between characters
-  }
-}
-
-// Type a string with delay between keystrokes using layout-independent method
-void typeLayoutIndependentWithDelay(const String &text, unsigned long delayMs) {
-  for (unsigned int i = 0; i < text.length(); i++) {
-    typeLayoutIndependentChar(text[i]);
-    delay(delayMs);
+  unsigned long start = micros();
+  for (size_t i = 0; i < text.length();) {
+    uint32_t codepoint = utf8Next(text.c_str(), text.length(), i);
+    if (codepoint < 0x80) {
+      typeLayoutIndependentChar((char)codepoint);
+    } else {
+      typeUnicodeChar(codepoint);
+    }
+    typingCharCount++;
   }
+  typingMicrosSpent += micros() - start;
 }
 
-// Force type using direct ASCII bypass (for when layout-independence fails)
+// Force type using direct ASCII bypass (for when layout-independence fails);
+// UTF-8 sequences are typed through the layout's Unicode table instead of
+// byte by byte
 void typeDirectASCII(const String &text) {
-  for (unsigned int i = 0; i < text.length(); i++) {
-    forceSendASCII(text[i]);
-    delay(20); // Add a small delay between characters
-  }
-}
-
-// Force type with delay using direct ASCII bypass
-void typeDirectASCIIWithDelay(const String &text, unsigned long delayMs) {
-  for (unsigned int i = 0; i < text.length(); i++) {
-    forceSendASCII(text[i]);
-    delay(delayMs);
+  unsigned long start = micros();
+  for (size_t i = 0; i < text.length();) {
+    uint32_t codepoint = utf8Next(text.c_str(), text.length(), i);
+    if (codepoint < 0x80) {
+      forceSendASCII((char)codepoint);
+    } else {
+      typeUnicodeChar(codepoint);
+    }
+    typingCharCount++;
   }
+  typingMicrosSpent += micros() - start;
 }
 
 #endif // LAYOUT_UTILS_H
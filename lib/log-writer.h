@@ -0,0 +1,228 @@
+/*
+ * Preallocated Log Writer for Ghostkey
+ *
+ * Appending to a file with FILE_WRITE and small writes makes the FAT code
+ * allocate clusters and update the directory entry as the file grows, and
+ * every partial sector is read back before it is modified. On a busy card
+ * that costs tens of milliseconds at unpredictable points of a run.
+ *
+ * SdLogWriter instead sizes the file once in begin() (the slow part, done
+ * before a run starts), then only overwrites sectors that already belong
+ * to the file: data is staged in a 512-byte buffer in RAM and written a
+ * whole sector at a time, and the data length in the header sector is
+ * updated on close(). A write therefore costs at most one sector write.
+ *
+ * The SD library cannot ask for contiguous clusters, but a file grown in
+ * one go on a card without much fragmentation gets consecutive clusters.
+ *
+ * File layout:
+ *   sector 0: LogFileHeader, rest zero
+ *   from 512: data (length bytes are valid, the rest is zero)
+ * A log is appended to across runs until it is full; writes after that are
+ * counted as dropped.
+ */
+
+#ifndef LOG_WRITER_H
+#define LOG_WRITER_H
+
+#include <SPI.h>
+#include <SD.h>
+
+#define LOG_SECTOR_SIZE 512
+#define LOG_VERSION 1
+
+// FILE_WRITE appends; sectors are overwritten in place instead
+#define LOG_WRITE_MODE (O_READ | O_WRITE | O_CREAT)
+
+typedef struct {
+  char magic[4];       // "GKLG"
+  uint16_t version;    // LOG_VERSION
+  uint16_t recordSize; // Size of fixed records, 0 for a byte stream
+  uint32_t capacity;   // Data bytes preallocated after the header sector
+  uint32_t length;     // Data bytes written so far
+  uint32_t closeCount; // Times the log was closed (runs that wrote to it)
+} LogFileHeader;
+
+static_assert(sizeof(LogFileHeader) == 20, "LogFileHeader must stay 20 bytes");
+
+class SdLogWriter {
+public:
+  SdLogWriter() : _open(false), _fill(0), _dropped(0), _worstWriteMicros(0) {
+    memset(&_header, 0, sizeof(_header));
+  }
+
+  // Open the log at path with room for capacity data bytes (rounded up to
+  // whole sectors), creating or growing it first. With append the new data
+  // follows what earlier runs wrote, otherwise the log starts empty.
+  bool begin(const char *path, uint32_t capacity, bool append = true, uint16_t recordSize = 0) {
+    close();
+    capacity = (capacity + LOG_SECTOR_SIZE - 1) / LOG_SECTOR_SIZE * LOG_SECTOR_SIZE;
+    _fill = 0;
+    _dropped = 0;
+    _worstWriteMicros = 0;
+
+    _file = SD.open(path, LOG_WRITE_MODE);
+    if (!_file) {
+      return false;
+    }
+
+    bool valid = _file.size() >= LOG_SECTOR_SIZE &&
+                 _file.read((uint8_t *)&_header, sizeof(_header)) == sizeof(_header) &&
+                 memcmp(_header.magic, "GKLG", 4) == 0 && _header.version == LOG_VERSION &&
+                 _header.recordSize == recordSize && _header.length <= _header.capacity;
+    if (!valid) {
+      memset(&_header, 0, sizeof(_header));
+      memcpy(_header.magic, "GKLG", 4);
+      _header.version = LOG_VERSION;
+      _header.recordSize = recordSize;
+    }
+    if (!append) {
+      _header.length = 0;
+    }
+    if (capacity > _header.capacity) {
+      _header.capacity = capacity;
+    }
+
+    // Preallocate: zero every sector the file does not have yet
+    uint32_t fileSize = LOG_SECTOR_SIZE + _header.capacity;
+    uint32_t have = valid ? (_file.size() / LOG_SECTOR_SIZE * LOG_SECTOR_SIZE) : 0;
+    if (have < fileSize) {
+      memset(_sector, 0, sizeof(_sector));
+      if (!_file.seek(have)) {
+        _file.close();
+        return false;
+      }
+      for (uint32_t offset = have; offset < fileSize; offset += LOG_SECTOR_SIZE) {
+        if (_file.write(_sector, LOG_SECTOR_SIZE) != LOG_SECTOR_SIZE) {
+          _file.close();
+          return false;
+        }
+      }
+      if (!writeHeader()) {
+        _file.close();
+        return false;
+      }
+    }
+
+    // Stage the partly filled last sector so it is completed, not skipped
+    uint32_t sectorStart = _header.length / LOG_SECTOR_SIZE * LOG_SECTOR_SIZE;
+    _fill = _header.length - sectorStart;
+    memset(_sector, 0, sizeof(_sector));
+    if (!_file.seek(LOG_SECTOR_SIZE + sectorStart) ||
+        (_fill > 0 && _file.read(_sector, _fill) != (int)_fill) ||
+        !_file.seek(LOG_SECTOR_SIZE + sectorStart)) {
+      _file.close();
+      return false;
+    }
+    _open = true;
+    return true;
+  }
+
+  // Stage data; full sectors go to the card right away. Returns the bytes
+  // accepted (less than length once the log is full or a write failed).
+  size_t write(const uint8_t *data, size_t length) {
+    if (!_open) {
+      return 0;
+    }
+    size_t accepted = 0;
+    while (accepted < length) {
+      uint32_t room = _header.capacity - _header.length;
+      if (room == 0) {
+        break;
+      }
+      size_t chunk = LOG_SECTOR_SIZE - _fill;
+      if (chunk > length - accepted) {
+        chunk = length - accepted;
+      }
+      if (chunk > room) {
+        chunk = room;
+      }
+      memcpy(_sector + _fill, data + accepted, chunk);
+      _fill += chunk;
+      _header.length += chunk;
+      accepted += chunk;
+      if (_fill == LOG_SECTOR_SIZE) {
+        if (!writeSector()) {
+          // Keep what was staged before; close() tries the sector again
+          _fill -= chunk;
+          _header.length -= chunk;
+          accepted -= chunk;
+          break;
+        }
+        _fill = 0;
+        memset(_sector, 0, sizeof(_sector));
+      }
+    }
+    _dropped += length - accepted;
+    return accepted;
+  }
+
+  size_t write(const char *text) {
+    return write((const uint8_t *)text, strlen(text));
+  }
+
+  // Write the staged partial sector and the header, then close the file
+  bool close() {
+    if (!_open) {
+      return true;
+    }
+    _open = false;
+    bool ok = (_fill == 0) || writeSector();
+    _header.closeCount++;
+    ok = writeHeader() && ok;
+    _file.close();
+    return ok;
+  }
+
+  bool isOpen() const {
+    return _open;
+  }
+
+  uint32_t length() const {
+    return _header.length;
+  }
+
+  uint32_t capacity() const {
+    return _header.capacity;
+  }
+
+  // Bytes refused because the log was full or a sector write failed
+  uint32_t dropped() const {
+    return _dropped;
+  }
+
+  // Longest single sector write since begin(), in microseconds
+  unsigned long worstWriteMicros() const {
+    return _worstWriteMicros;
+  }
+
+private:
+  File _file;
+  LogFileHeader _header;
+  uint8_t _sector[LOG_SECTOR_SIZE];
+  bool _open;
+  uint16_t _fill;
+  uint32_t _dropped;
+  unsigned long _worstWriteMicros;
+
+  // Write the staged sector where the file position is; on success the
+  // position moves to the next sector
+  bool writeSector() {
+    unsigned long start = micros();
+    bool ok = _file.write(_sector, LOG_SECTOR_SIZE) == LOG_SECTOR_SIZE;
+    unsigned long elapsed = micros() - start;
+    if (elapsed > _worstWriteMicros) {
+      _worstWriteMicros = elapsed;
+    }
+    return ok;
+  }
+
+  bool writeHeader() {
+    uint8_t sector[LOG_SECTOR_SIZE];
+    memset(sector, 0, sizeof(sector));
+    memcpy(sector, &_header, sizeof(_header));
+    return _file.seek(0) && _file.write(sector, LOG_SECTOR_SIZE) == LOG_SECTOR_SIZE;
+  }
+};
+
+#endif // LOG_WRITER_H
@@ -0,0 +1,161 @@
+/*
+ * Low Power Idle Helpers for Ghostkey
+ * 
+ * Puts the SAMD21 to sleep between events once the script has finished.
+ * While the host keeps the USB bus active, the CPU uses IDLE sleep: clocks
+ * to the core stop, but SysTick, USB and the external interrupt controller
+ * keep running and wake it on the next tick, SOF, CDC packet or button edge.
+ * When the host suspends the bus, the chip drops into STANDBY and wakes on
+ * USB resume, a button edge or the RTC, whichever comes first.
+ *
+ * GCLK0 stops in STANDBY, and with it the EIC the Arduino core clocks from
+ * it, so the button could not wake the chip. lowPowerButtonWake() moves the
+ * EIC to generator LOW_POWER_GCLK, which runs from OSCULP32K in standby too
+ * (as the ArduinoLowPower library does); the RTC counts on the same
+ * generator, so standby also measures how long it lasted.
+ */
+
+#ifndef LOW_POWER_H
+#define LOW_POWER_H
+
+#include <Arduino.h>
+
+#define LOW_POWER_GCLK 6                 // Generator left running in standby
+#define LOW_POWER_RTC_HZ 1024            // OSCULP32K / 32
+#define LOW_POWER_STANDBY_WAKE_MS 5000   // RTC wake from standby
+
+// Sleep accounting, used to report the idle duty cycle
+unsigned long long lowPowerSleepMicros = 0;
+unsigned long lowPowerStandbyCount = 0;
+
+// True if the host has suspended the USB bus (no SOF packets)
+bool usbBusSuspended() {
+#if defined(ARDUINO_ARCH_SAMD)
+  return USB->DEVICE.FSMSTATUS.bit.FSMSTATE == USB_FSMSTATUS_FSMSTATE_SUSPEND_Val;
+#else
+  return false;
+#endif
+}
+
+// Stop the CPU until the next interrupt (SysTick, USB, EIC)
+void sleepUntilInterrupt() {
+#if defined(ARDUINO_ARCH_SAMD)
+  unsigned long sleepStart = micros();
+  SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+  PM->SLEEP.reg = PM_SLEEP_IDLE_APB; // IDLE2: CPU, AHB and APB clocks stopped
+  __DSB();
+  __WFI();
+  lowPowerSleepMicros += micros() - sleepStart;
+#endif
+}
+
+#if defined(ARDUINO_ARCH_SAMD)
+void lowPowerGclkSync() {
+  while (GCLK->STATUS.bit.SYNCBUSY) {
+  }
+}
+
+void lowPowerRtcSync() {
+  while (RTC->MODE0.STATUS.bit.SYNCBUSY) {
+  }
+}
+
+// Route LOW_POWER_GCLK (OSCULP32K, runs in standby) to a peripheral
+void lowPowerClockPeripheral(uint8_t gclkId) {
+  static bool generatorReady = false;
+  if (!generatorReady) {
+    GCLK->GENDIV.reg = GCLK_GENDIV_ID(LOW_POWER_GCLK) | GCLK_GENDIV_DIV(0);
+    lowPowerGclkSync();
+    GCLK->GENCTRL.reg = GCLK_GENCTRL_ID(LOW_POWER_GCLK) | GCLK_GENCTRL_SRC_OSCULP32K | GCLK_GENCTRL_GENEN |
+                        GCLK_GENCTRL_RUNSTDBY;
+    lowPowerGclkSync();
+    // Errata: keep the flash powered in sleep, or the first fetch after a
+    // wake-up can fail
+    NVMCTRL->CTRLB.bit.SLEEPPRM = NVMCTRL_CTRLB_SLEEPPRM_DISABLED_Val;
+    generatorReady = true;
+  }
+  GCLK->CLKCTRL.reg = GCLK_CLKCTRL_ID(gclkId); // Disable the channel before switching it
+  lowPowerGclkSync();
+  GCLK->CLKCTRL.reg = GCLK_CLKCTRL_ID(gclkId) | GCLK_CLKCTRL_GEN(LOW_POWER_GCLK) | GCLK_CLKCTRL_CLKEN;
+  lowPowerGclkSync();
+}
+#endif
+
+// Let the pin's external interrupt wake the chip from standby; call after
+// attachInterrupt(), which clocks the EIC from GCLK0
+void lowPowerButtonWake(int pin) {
+#if defined(ARDUINO_ARCH_SAMD)
+  if (pin < 0 || pin >= (int)PINS_COUNT || g_APinDescription[pin].ulExtInt == EXTERNAL_INT_NONE) {
+    return; // Shifting by EXTERNAL_INT_NONE (-1) is undefined
+  }
+  lowPowerClockPeripheral(EIC_GCLK_ID);
+  EIC->WAKEUP.reg |= 1UL << g_APinDescription[pin].ulExtInt;
+#else
+  (void)pin;
+#endif
+}
+
+// Enter STANDBY until USB resume, an external interrupt (button) or
+// maxMillis on the RTC. SysTick does not run in standby, so millis() pauses
+// while asleep; returns the microseconds spent in standby.
+unsigned long standbyUntilWakeup(unsigned long maxMillis) {
+#if defined(ARDUINO_ARCH_SAMD)
+  uint32_t wakeTicks = (uint32_t)((unsigned long long)maxMillis * LOW_POWER_RTC_HZ / 1000);
+  lowPowerClockPeripheral(RTC_GCLK_ID);
+  PM->APBAMASK.reg |= PM_APBAMASK_RTC;
+  RTC->MODE0.CTRL.reg = 0;
+  lowPowerRtcSync();
+  RTC->MODE0.CTRL.reg = RTC_MODE0_CTRL_MODE_COUNT32 | RTC_MODE0_CTRL_PRESCALER_DIV32;
+  RTC->MODE0.COUNT.reg = 0;
+  lowPowerRtcSync();
+  RTC->MODE0.COMP[0].reg = wakeTicks > 0 ? wakeTicks : 1;
+  lowPowerRtcSync();
+  RTC->MODE0.INTFLAG.reg = RTC_MODE0_INTFLAG_CMP0;
+  RTC->MODE0.INTENSET.reg = RTC_MODE0_INTENSET_CMP0;
+  RTC->MODE0.CTRL.reg |= RTC_MODE0_CTRL_ENABLE;
+  lowPowerRtcSync();
+
+  // Neither the core's USB handler services WAKEUP nor is there an RTC
+  // handler, so keep interrupts masked: a pending interrupt still ends WFI,
+  // and the flags are cleared here before any handler runs
+  __disable_irq();
+  NVIC_EnableIRQ(RTC_IRQn);
+  USB->DEVICE.INTFLAG.reg = USB_DEVICE_INTFLAG_WAKEUP;
+  USB->DEVICE.INTENSET.reg = USB_DEVICE_INTENSET_WAKEUP;
+  SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+  __DSB();
+  __WFI();
+  SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+  USB->DEVICE.INTENCLR.reg = USB_DEVICE_INTENCLR_WAKEUP;
+  USB->DEVICE.INTFLAG.reg = USB_DEVICE_INTFLAG_WAKEUP;
+
+  RTC->MODE0.READREQ.reg = RTC_READREQ_RREQ;
+  lowPowerRtcSync();
+  uint32_t ticks = RTC->MODE0.COUNT.reg;
+  RTC->MODE0.CTRL.reg &= ~RTC_MODE0_CTRL_ENABLE;
+  lowPowerRtcSync();
+  RTC->MODE0.INTENCLR.reg = RTC_MODE0_INTENCLR_CMP0;
+  RTC->MODE0.INTFLAG.reg = RTC_MODE0_INTFLAG_CMP0;
+  NVIC_DisableIRQ(RTC_IRQn);
+  NVIC_ClearPendingIRQ(RTC_IRQn);
+  __enable_irq();
+
+  unsigned long sleptMicros = (unsigned long)((unsigned long long)ticks * 1000000ULL / LOW_POWER_RTC_HZ);
+  lowPowerSleepMicros += sleptMicros;
+  lowPowerStandbyCount++;
+  return sleptMicros;
+#else
+  (void)maxMillis;
+  return 0;
+#endif
+}
+
+// Percentage of the given idle period spent asleep
+float lowPowerSleepPercent(unsigned long long idleMicros) {
+  if (idleMicros == 0) {
+    return 0;
+  }
+  return (float)(lowPowerSleepMicros * 100.0 / idleMicros);
+}
+
+#endif // LOW_POWER_H
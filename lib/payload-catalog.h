@@ -0,0 +1,93 @@
+/*
+ * Payload Catalog Format for Ghostkey
+ * 
+ * The catalog (/catalog.idx) indexes every payload on the SD card so one can
+ * be selected by number without directory scans or SD.exists probes. It is a
+ * fixed-size header followed by fixed-size entries, so entry N is always at
+ * catalogEntryOffset(N) and can be read with a single seek.
+ * 
+ * tools/gkimage.cpp writes the catalog from the same definitions.
+ */
+
+#ifndef PAYLOAD_CATALOG_H
+#define PAYLOAD_CATALOG_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define CATALOG_FILE "/catalog.idx"
+#define CATALOG_VERSION 1
+#define CATALOG_MAX_ENTRIES 64
+#define CATALOG_NAME_LENGTH 40 // Root 8.3 names only: "/" + 12 characters
+#define CATALOG_NO_ENTRY 0xFFFF
+
+// Entry flags
+#define CATALOG_FLAG_COMPILED 0x01  // A compiled cache exists for this payload
+#define CATALOG_FLAG_TEST     0x02  // Diagnostic test file (runs instead of the payload)
+
+typedef struct {
+  char magic[4];         // "GKCT"
+  uint16_t version;      // CATALOG_VERSION
+  uint16_t entryCount;   // Number of entries that follow
+  uint16_t testEntry;    // Index of the test file to run, or CATALOG_NO_ENTRY
+  uint16_t reserved;
+  uint32_t reserved2;
+} CatalogHeader;
+
+// firstCluster, writeDate and writeTime copy the file's directory entry
+// once its bytes have been checked against crc. While the directory entry
+// still matches, the payload is current without reading it; 0 means not
+// recorded yet (written by a host tool, or an older catalog).
+typedef struct {
+  char name[CATALOG_NAME_LENGTH]; // Path on the card, NUL padded
+  uint32_t firstCluster;          // Directory entry: first cluster of the file
+  uint16_t writeDate;             // Directory entry: FAT last write date
+  uint16_t writeTime;             // Directory entry: FAT last write time
+  uint32_t offset;                // Start of the payload within that file
+  uint32_t size;                  // Payload length in bytes
+  uint32_t crc;                   // CRC-32 of the payload bytes
+  uint8_t flags;                  // CATALOG_FLAG_*
+  uint8_t reserved[3];
+} CatalogEntry;
+
+static_assert(sizeof(CatalogHeader) == 16, "CatalogHeader must stay 16 bytes");
+static_assert(sizeof(CatalogEntry) == 64, "CatalogEntry must stay 64 bytes");
+
+// Byte offset of entry number index (0-based) in the catalog file
+inline uint32_t catalogEntryOffset(uint16_t index) {
+  return sizeof(CatalogHeader) + (uint32_t)index * sizeof(CatalogEntry);
+}
+
+inline void catalogInitHeader(CatalogHeader &header) {
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, "GKCT", 4);
+  header.version = CATALOG_VERSION;
+  header.testEntry = CATALOG_NO_ENTRY;
+}
+
+inline bool catalogHeaderValid(const CatalogHeader &header) {
+  return memcmp(header.magic, "GKCT", 4) == 0 &&
+         header.version == CATALOG_VERSION &&
+         header.entryCount <= CATALOG_MAX_ENTRIES;
+}
+
+// CRC-32 (IEEE 802.3) using a 16-entry nibble table to keep flash use small
+// Start with crc = 0 and feed the data in as many chunks as needed
+inline uint32_t crc32Update(uint32_t crc, const uint8_t *data, size_t length) {
+  static const uint32_t nibbleTable[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC,
+    0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C,
+    0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+  };
+  crc = ~crc;
+  while (length--) {
+    crc ^= *data++;
+    crc = (crc >> 4) ^ nibbleTable[crc & 0x0F];
+    crc = (crc >> 4) ^ nibbleTable[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+#endif // PAYLOAD_CATALOG_H
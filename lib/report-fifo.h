@@ -0,0 +1,103 @@
+/*
+ * Inter-Core Report FIFO for Ghostkey
+ *
+ * A lock-free ring of HID reports between two cores: one core (the
+ * producer) runs the engine and queues every report it would have sent,
+ * the other (the consumer) only takes them off the ring and hands them to
+ * the USB stack. Neither side ever blocks the other: push() fails when
+ * the ring is full and pop() fails when it is empty.
+ *
+ * Only one core may push and only one may pop. Each index is written by
+ * one side only; the release store that publishes it orders the slot it
+ * covers, so the other side never sees a half-written report.
+ *
+ * The ring also counts what the dual-core split costs: the deepest it has
+ * been (how far the engine ran ahead of USB) and how often the producer
+ * found it full and had to wait.
+ *
+ * The soak harness (tools/soak) runs the same FIFO between two host threads.
+ */
+
+#ifndef REPORT_FIFO_H
+#define REPORT_FIFO_H
+
+#include <stdint.h>
+#include <atomic>
+
+// Reports queued between the engine and USB; 16 is 16 ms of USB frames
+#define REPORT_FIFO_DEPTH 16
+
+template <typename Report, uint16_t Capacity>
+class ReportFifo {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+  ReportFifo() : _head(0), _tail(0), _highWater(0), _waiting(false), _fullWaits(0) {}
+
+  // Producer: queue a report; false if the ring is full
+  bool push(const Report &report) {
+    uint16_t head = _head.load(std::memory_order_relaxed);
+    uint16_t depth = (uint16_t)(head - _tail.load(std::memory_order_acquire));
+    if (depth >= Capacity) {
+      if (!_waiting) {
+        _waiting = true; // Retries of the same report count once
+        _fullWaits++;
+      }
+      return false;
+    }
+    _waiting = false;
+    _slots[head & (Capacity - 1)] = report;
+    _head.store((uint16_t)(head + 1), std::memory_order_release);
+    if (depth + 1 > _highWater) {
+      _highWater = depth + 1;
+    }
+    return true;
+  }
+
+  // Consumer: copy the oldest report without taking it; false if empty
+  bool peek(Report &report) const {
+    uint16_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire)) {
+      return false;
+    }
+    report = _slots[tail & (Capacity - 1)];
+    return true;
+  }
+
+  // Consumer: drop the report peek() returned
+  void pop() {
+    uint16_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail != _head.load(std::memory_order_acquire)) {
+      _tail.store((uint16_t)(tail + 1), std::memory_order_release);
+    }
+  }
+
+  // Either side: reports queued right now
+  uint16_t depth() const {
+    return (uint16_t)(_head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire));
+  }
+
+  bool empty() const {
+    return depth() == 0;
+  }
+
+  // Producer side statistics: deepest the ring has been, and how many
+  // reports had to wait for a free slot
+  uint16_t highWater() const {
+    return _highWater;
+  }
+
+  uint32_t fullWaits() const {
+    return _fullWaits;
+  }
+
+private:
+  Report _slots[Capacity];
+  std::atomic<uint16_t> _head; // Next slot to fill, written by the producer
+  std::atomic<uint16_t> _tail; // Next slot to send, written by the consumer
+  uint16_t _highWater;
+  bool _waiting;
+  uint32_t _fullWaits; // Reports that found the ring full
+};
+
+#endif // REPORT_FIFO_H
@@ -0,0 +1,127 @@
+/*
+ * Report Timing Histograms for Ghostkey
+ *
+ * Streaming histogram of the intervals between HID reports, so a run can
+ * tell consistent key timing apart from a good average. Intervals are
+ * sorted into log-linear buckets: exact below 16 us, then 16 buckets per
+ * power of two, so a percentile is within 1/32 (about 3%) of the true
+ * value, e.g. +-0.5 ms at a 30 ms keystroke gap. The largest interval is
+ * kept exactly.
+ *
+ * Counts are 16 bit; when a bucket would overflow, every bucket of that
+ * histogram is halved, which keeps the shape (and the percentiles) of a
+ * long run while bounding the memory to REPORT_TIMING_BUCKETS * 2 bytes.
+ */
+
+#ifndef REPORT_TIMING_H
+#define REPORT_TIMING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define REPORT_TIMING_EXACT 16         // Intervals below this get a bucket each
+#define REPORT_TIMING_SUB_BUCKETS 16   // Buckets per power of two above that
+#define REPORT_TIMING_MAX_EXPONENT 24  // Intervals from 2^24 us (16.7 s) share the last bucket
+#define REPORT_TIMING_BUCKETS (REPORT_TIMING_EXACT + (REPORT_TIMING_MAX_EXPONENT - 4) * REPORT_TIMING_SUB_BUCKETS)
+
+typedef struct {
+  uint16_t buckets[REPORT_TIMING_BUCKETS];
+  uint32_t count;      // Intervals recorded (not halved)
+  uint32_t maxMicros;  // Largest interval
+} ReportHistogram;
+
+inline void reportHistogramClear(ReportHistogram &histogram) {
+  memset(&histogram, 0, sizeof(histogram));
+}
+
+// Bucket of an interval
+inline uint16_t reportTimingBucket(uint32_t micros) {
+  if (micros < REPORT_TIMING_EXACT) {
+    return micros;
+  }
+  uint8_t exponent = 4;
+  while (exponent < 31 && (micros >> (exponent + 1)) != 0) {
+    exponent++;
+  }
+  if (exponent >= REPORT_TIMING_MAX_EXPONENT) {
+    return REPORT_TIMING_BUCKETS - 1;
+  }
+  uint8_t sub = (micros >> (exponent - 4)) & (REPORT_TIMING_SUB_BUCKETS - 1);
+  return REPORT_TIMING_EXACT + (exponent - 4) * REPORT_TIMING_SUB_BUCKETS + sub;
+}
+
+// Smallest interval that falls into a bucket
+inline uint32_t reportTimingBucketStart(uint16_t bucket) {
+  if (bucket < REPORT_TIMING_EXACT) {
+    return bucket;
+  }
+  uint8_t exponent = 4 + (bucket - REPORT_TIMING_EXACT) / REPORT_TIMING_SUB_BUCKETS;
+  uint8_t sub = (bucket - REPORT_TIMING_EXACT) % REPORT_TIMING_SUB_BUCKETS;
+  return ((uint32_t)(REPORT_TIMING_SUB_BUCKETS + sub)) << (exponent - 4);
+}
+
+inline void reportHistogramAdd(ReportHistogram &histogram, uint32_t micros) {
+  uint16_t bucket = reportTimingBucket(micros);
+  if (histogram.buckets[bucket] == 0xFFFF) {
+    for (uint16_t i = 0; i < REPORT_TIMING_BUCKETS; i++) {
+      histogram.buckets[i] = (histogram.buckets[i] + 1) / 2;
+    }
+  }
+  histogram.buckets[bucket]++;
+  histogram.count++;
+  if (micros > histogram.maxMicros) {
+    histogram.maxMicros = micros;
+  }
+}
+
+// Interval below which permille/1000 of the recorded intervals fall (the
+// middle of its bucket, never above the largest interval)
+inline uint32_t reportHistogramPercentile(const ReportHistogram &histogram, uint16_t permille) {
+  uint32_t total = 0;
+  for (uint16_t i = 0; i < REPORT_TIMING_BUCKETS; i++) {
+    total += histogram.buckets[i];
+  }
+  if (total == 0) {
+    return 0;
+  }
+  uint32_t rank = (uint32_t)(((uint64_t)total * permille + 999) / 1000);
+  if (rank == 0) {
+    rank = 1;
+  }
+  uint32_t seen = 0;
+  for (uint16_t i = 0; i < REPORT_TIMING_BUCKETS; i++) {
+    seen += histogram.buckets[i];
+    if (seen >= rank) {
+      uint32_t start = reportTimingBucketStart(i);
+      uint32_t width = (i + 1 < REPORT_TIMING_BUCKETS) ? reportTimingBucketStart(i + 1) - start : 0;
+      uint32_t middle = start + width / 2;
+      return (middle > histogram.maxMicros) ? histogram.maxMicros : middle;
+    }
+  }
+  return histogram.maxMicros;
+}
+
+// Column header matching reportHistogramFormat()
+#define REPORT_TIMING_COLUMNS "context       count     p50 ms     p90 ms     p99 ms     max ms"
+
+// One summary line: count and p50/p90/p99/max in ms with two decimals,
+// without floating point printf
+inline int reportHistogramFormat(char *buffer, size_t size, const char *context,
+                                 const ReportHistogram &histogram) {
+  uint32_t values[4] = {
+    reportHistogramPercentile(histogram, 500),
+    reportHistogramPercentile(histogram, 900),
+    reportHistogramPercentile(histogram, 990),
+    histogram.maxMicros
+  };
+  return snprintf(buffer, size, "%-9s %9lu %7lu.%02lu %7lu.%02lu %7lu.%02lu %7lu.%02lu", context,
+                  (unsigned long)histogram.count,
+                  (unsigned long)(values[0] / 1000), (unsigned long)(values[0] / 10 % 100),
+                  (unsigned long)(values[1] / 1000), (unsigned long)(values[1] / 10 % 100),
+                  (unsigned long)(values[2] / 1000), (unsigned long)(values[2] / 10 % 100),
+                  (unsigned long)(values[3] / 1000), (unsigned long)(values[3] / 10 % 100));
+}
+
+#endif // REPORT_TIMING_H
@@ -0,0 +1,77 @@
+/*
+ * Run Time Estimate State for Ghostkey
+ *
+ * The progress pre-pass (progress.ino) estimates every script line with
+ * estimateDuckyLine_DirectASCII(), or every op of the compiled program with
+ * estimateProgramOp(), and carries the interpreter settings that change the
+ * cost of later lines from one line to the next. INCLUDEd snippets are
+ * remembered per run (EstimateCallMemo). It is
+ * declared here rather than in a tab because the sketch's function
+ * prototypes, which use it, come before any tab code.
+ */
+
+#ifndef RUN_ESTIMATE_H
+#define RUN_ESTIMATE_H
+
+#include <stdint.h>
+
+typedef struct {
+  unsigned int defaultDelay; // DEFAULT_DELAY in effect
+  uint32_t typingSpeed;      // SPEED in effect, as typingSpeedValue()
+} EstimateState;
+
+// Snippet estimates kept for one run
+#define ESTIMATE_CALL_MEMO 16
+
+// Expected time of an INCLUDEd snippet entered with a given DEFAULT_DELAY
+// and SPEED, and the settings it leaves behind, so a snippet used on many
+// lines is walked once per run instead of once per INCLUDE
+typedef struct {
+  uint32_t key;        // Code offset of its function, or the path hash when interpreted
+  EstimateState entry;
+  EstimateState exit;
+  unsigned long ms;
+} EstimateCall;
+
+typedef struct {
+  EstimateCall calls[ESTIMATE_CALL_MEMO];
+  uint8_t count;
+  uint8_t next;        // Entry replaced once the memo is full
+} EstimateCallMemo;
+
+inline void estimateCallReset(EstimateCallMemo &memo) {
+  memo.count = 0;
+  memo.next = 0;
+}
+
+// Add a known snippet's time to ms and apply its settings; false if it is
+// not in the memo for this entry state
+inline bool estimateCallLookup(const EstimateCallMemo &memo, uint32_t key, EstimateState &state, unsigned long &ms) {
+  for (uint8_t i = 0; i < memo.count; i++) {
+    const EstimateCall &call = memo.calls[i];
+    if (call.key == key && call.entry.defaultDelay == state.defaultDelay &&
+        call.entry.typingSpeed == state.typingSpeed) {
+      ms += call.ms;
+      state = call.exit;
+      return true;
+    }
+  }
+  return false;
+}
+
+inline void estimateCallStore(EstimateCallMemo &memo, uint32_t key, const EstimateState &entry,
+                              const EstimateState &exit, unsigned long ms) {
+  uint8_t slot = memo.count;
+  if (memo.count < ESTIMATE_CALL_MEMO) {
+    memo.count++;
+  } else {
+    slot = memo.next;
+    memo.next = (memo.next + 1) % ESTIMATE_CALL_MEMO;
+  }
+  memo.calls[slot].key = key;
+  memo.calls[slot].entry = entry;
+  memo.calls[slot].exit = exit;
+  memo.calls[slot].ms = ms;
+}
+
+#endif // RUN_ESTIMATE_H
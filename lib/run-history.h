@@ -0,0 +1,81 @@
+/*
+ * Run History Records for Ghostkey
+ *
+ * After every run the firmware appends one fixed-size RunRecord to
+ * /history.log (an SdLogWriter log, see lib/log-writer.h, with recordSize
+ * set to sizeof(RunRecord)). tools/run_history.py reads these logs from
+ * any number of cards and plots the metrics per firmware version and card
+ * model, so regressions show up across the fleet.
+ *
+ * All times are milliseconds unless noted. Boot timestamps count from
+ * reset, so a re-run from the idle state repeats its boot's values and
+ * only has a later runStartMs.
+ *
+ * Append fields only at the end (replacing padding) and bump
+ * RUN_HISTORY_VERSION; the host tool keys its parser on version.
+ *
+ * tools/gkimage.cpp preallocates the log with this layout.
+ */
+
+#ifndef RUN_HISTORY_H
+#define RUN_HISTORY_H
+
+#include <stdint.h>
+
+#define RUN_HISTORY_VERSION 1
+#define RUN_HISTORY_FIRMWARE_LENGTH 12
+#define RUN_HISTORY_CARD_LENGTH 16
+
+// cacheResult
+#define RUN_CACHE_OFF 0     // COMPILE_CACHE disabled, script interpreted
+#define RUN_CACHE_HIT 1     // Cached program was up to date
+#define RUN_CACHE_REBUILT 2 // Program (re)built; see compiledBlocks/reusedBlocks
+#define RUN_CACHE_FAILED 3  // Build failed, script interpreted
+
+// flags
+#define RUN_FLAG_ABORTED 0x01  // Stopped with the abort control
+#define RUN_FLAG_RESUMED 0x02  // Started from a checkpoint
+#define RUN_FLAG_RERUN 0x04    // Started from the idle state, not at boot
+
+typedef struct {
+  uint16_t version;                          // RUN_HISTORY_VERSION
+  uint16_t size;                             // sizeof(RunRecord)
+  uint32_t sequence;                         // Records before this one in the log
+  char firmware[RUN_HISTORY_FIRMWARE_LENGTH]; // FIRMWARE_VERSION, NUL padded
+  uint32_t buildId;                          // CRC-32 of the build date and time
+  char cardModel[RUN_HISTORY_CARD_LENGTH];   // CARD_MODEL from config.txt, NUL padded
+
+  // Boot phases
+  uint32_t sdMountedMs;    // SD card mounted
+  uint16_t sdMountMs;      // Time spent mounting (all attempts)
+  uint8_t sdAttempts;      // Mount attempts needed (lib/sd-mount.h)
+  uint8_t cacheResult;     // RUN_CACHE_*
+  uint32_t configLoadedMs; // config.txt read
+  uint32_t runStartMs;     // Run started (script selected)
+
+  // Compile cache
+  uint16_t prepareMs;      // Checking / building the program
+  uint16_t compiledBlocks; // Blocks compiled by the build
+  uint16_t reusedBlocks;   // Blocks copied from the previous program
+  uint8_t flags;           // RUN_FLAG_*
+  uint8_t layout;          // KEYBOARD_LAYOUT index
+
+  // Typing
+  uint32_t typedChars;     // Characters typed by STRING and friends
+  uint32_t typingMs;       // Time spent typing them
+
+  // Delays
+  uint32_t delayRequestedMs;       // Sum of DELAY / default delay waits
+  uint32_t delayOvershootMs;       // Sum of the time they ran over
+  uint16_t delayWorstOvershootMs;  // Longest single overrun
+  uint16_t iterations;             // Script iterations run (REPEAT)
+
+  // Totals
+  uint32_t runMs;         // Whole run, as reported on serial
+  uint32_t estimatedMs;   // Up-front estimate (0 = none, e.g. endless repeat)
+  uint32_t delayWorkMs;   // Background work done inside delays
+} RunRecord;
+
+static_assert(sizeof(RunRecord) == 96, "RunRecord must stay 96 bytes");
+
+#endif // RUN_HISTORY_H
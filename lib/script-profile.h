@@ -0,0 +1,69 @@
+/*
+ * Line Profile for Ghostkey
+ *
+ * Per-line counters of a profiled run (PROFILE = true) and the line format
+ * of the annotated copy of the payload the profiler writes afterwards
+ * (payload.prof.txt). Every source line is prefixed with how often it ran,
+ * its cumulative wall time and how that time splits into HID report sends,
+ * waiting (DELAY, keystroke pacing, LED flashes) and everything else
+ * (reading, parsing, serial logging), plus its share of the whole run:
+ *
+ *        calls   total ms     hid ms    wait ms   other ms    share | line | source
+ *            1     1000.0        0.0     1000.0        0.0     1.2% |    1 | DELAY 1000
+ *           12      402.6       24.1      371.3        7.2     0.4% |    4 | STRING notepad
+ */
+
+#ifndef SCRIPT_PROFILE_H
+#define SCRIPT_PROFILE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+typedef struct {
+  uint32_t count;       // Times the line started
+  uint32_t wallMicros;  // Cumulative wall time (saturates)
+  uint32_t hidMicros;   // Part of it spent handing reports to USB
+  uint32_t waitMicros;  // Part of it spent waiting in delays and pacing
+} ProfileLine;
+
+inline uint32_t profileSaturatingAdd(uint32_t a, uint32_t b) {
+  return (a > 0xFFFFFFFFUL - b) ? 0xFFFFFFFFUL : a + b;
+}
+
+// Add one stretch of a line's time. hid and wait are clamped to the wall time.
+inline void profileAccount(ProfileLine &line, uint32_t wall, uint32_t hid, uint32_t wait) {
+  if (hid > wall) {
+    hid = wall;
+  }
+  if (wait > wall - hid) {
+    wait = wall - hid;
+  }
+  line.wallMicros = profileSaturatingAdd(line.wallMicros, wall);
+  line.hidMicros = profileSaturatingAdd(line.hidMicros, hid);
+  line.waitMicros = profileSaturatingAdd(line.waitMicros, wait);
+}
+
+// Column header matching profileFormatLine()
+#define PROFILE_COLUMNS "   calls   total ms     hid ms    wait ms   other ms    share | line | source"
+
+// Format the stats columns of a line (up to the source text) into buffer.
+// Lines that never ran get blank columns. total is the run's wall time.
+inline int profileFormatLine(char *buffer, size_t size, const ProfileLine &line, int lineNumber,
+                             uint32_t total) {
+  if (line.count == 0) {
+    return snprintf(buffer, size, "%61s | %4d | ", "", lineNumber);
+  }
+  uint32_t other = line.wallMicros - line.hidMicros - line.waitMicros;
+  // Tenths of a percent, without floating point printf
+  unsigned long share = (total == 0) ? 0 : (unsigned long)((uint64_t)line.wallMicros * 1000 / total);
+  return snprintf(buffer, size, "%8lu %8lu.%lu %8lu.%lu %8lu.%lu %8lu.%lu %5lu.%lu%% | %4d | ",
+                  (unsigned long)line.count,
+                  (unsigned long)(line.wallMicros / 1000), (unsigned long)(line.wallMicros / 100 % 10),
+                  (unsigned long)(line.hidMicros / 1000), (unsigned long)(line.hidMicros / 100 % 10),
+                  (unsigned long)(line.waitMicros / 1000), (unsigned long)(line.waitMicros / 100 % 10),
+                  (unsigned long)(other / 1000), (unsigned long)(other / 100 % 10),
+                  share / 10, share % 10, lineNumber);
+}
+
+#endif // SCRIPT_PROFILE_H
@@ -0,0 +1,182 @@
+/*
+ * SD Card Mount State Machine for Ghostkey
+ *
+ * Mounting a card is a short sequence of steps with a fixed time budget
+ * instead of blind retries with long sleeps:
+ *
+ *   POWER_UP  at least 74 clocks with CS high, so the card enters SPI
+ *             native mode (80 are sent)
+ *   PROBE     CMD0 (GO_IDLE_STATE); only a card that answers "idle" is
+ *             handed to SD.begin(), which then mounts the file system
+ *   BACKOFF   after a failed attempt: wait, doubling the wait each time
+ *             (SD_MOUNT_FIRST_BACKOFF_MS up to SD_MOUNT_MAX_BACKOFF_MS)
+ *   RESET     after SD_MOUNT_RESET_AFTER failures in a row: restart the
+ *             SPI bus and clock the card again before the next probe
+ *
+ * No attempt starts once the budget (SD_MOUNT_BUDGET_MS) would be used up,
+ * so an empty socket fails in well under two seconds. SD.begin() has
+ * timeouts of its own and may run past the budget on a card that answers
+ * CMD0 but never finishes initialising.
+ *
+ * Every attempt is recorded (start, CMD0 round trip and response,
+ * SD.begin() time, result) and printed as one line:
+ *
+ *   SD-MOUNT v1 mounted total=47ms attempts=2 resets=0 0@0:r1=ff/120us,none 1@4:r1=01/118us,begin=41ms,ok
+ *
+ * The responses tell the likely cause of a failed mount apart: no answer
+ * at all (no card or CS/MISO open), an answer that is not "idle" (bad
+ * wiring or a card stuck mid-command), or an idle card whose file system
+ * cannot be mounted (format).
+ */
+
+#ifndef SD_MOUNT_H
+#define SD_MOUNT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#define SD_MOUNT_VERSION 1
+#define SD_MOUNT_BUDGET_MS 1500       // No attempt starts after this
+#define SD_MOUNT_FIRST_BACKOFF_MS 4   // Wait after the first failed attempt
+#define SD_MOUNT_MAX_BACKOFF_MS 256   // Longest wait between attempts
+#define SD_MOUNT_RESET_AFTER 3        // Failures in a row before the bus is reset
+#define SD_MOUNT_MAX_RECORDS 12       // Attempts kept in the record
+#define SD_MOUNT_INIT_HZ 250000       // SPI clock while probing (the card allows up to 400 kHz)
+#define SD_MOUNT_POWER_UP_BYTES 10    // 80 clocks with CS high
+#define SD_MOUNT_R1_POLLS 8           // Bytes to wait for the CMD0 response
+#define SD_R1_NONE 0xFF               // No response on MISO
+#define SD_R1_IDLE 0x01               // CMD0 accepted, card idle
+
+enum SdMountStep {
+  SD_STEP_POWER_UP,
+  SD_STEP_PROBE,
+  SD_STEP_BACKOFF,
+  SD_STEP_RESET,
+  SD_STEP_MOUNTED,
+  SD_STEP_FAILED
+};
+
+enum SdAttemptResult {
+  SD_ATTEMPT_NO_RESPONSE,  // CMD0 got no answer
+  SD_ATTEMPT_BAD_RESPONSE, // CMD0 answered, but not idle
+  SD_ATTEMPT_BEGIN_FAILED, // Card idle, SD.begin() failed
+  SD_ATTEMPT_MOUNTED
+};
+
+static const char *const SD_ATTEMPT_NAMES[] = { "none", "bad", "fail", "ok" };
+
+// Likely cause of a failed mount, numbered like showSDCardError()'s patterns
+#define SD_DIAGNOSIS_DETECTION 1     // Card not detected
+#define SD_DIAGNOSIS_FORMAT 2        // Card answers, file system not mountable
+#define SD_DIAGNOSIS_COMMUNICATION 3 // Card answers garbage
+
+typedef struct {
+  uint16_t startMs; // Since the mount started
+  uint16_t probeUs; // CMD0 round trip
+  uint16_t beginMs; // SD.begin(), 0 if not reached
+  uint8_t r1;       // CMD0 response, SD_R1_NONE if none
+  uint8_t result;   // SdAttemptResult
+} SdMountAttempt;
+
+typedef struct {
+  uint8_t step;        // SdMountStep
+  uint8_t attempts;    // Attempts made (the first SD_MOUNT_MAX_RECORDS are kept)
+  uint8_t failStreak;  // Failed attempts since the last bus reset
+  uint8_t resets;      // Bus resets
+  uint16_t backoffMs;  // Wait before the next attempt
+  uint32_t startMs;    // millis() when the mount started
+  uint32_t totalMs;    // Time until mounted or given up
+  SdMountAttempt attempt[SD_MOUNT_MAX_RECORDS];
+} SdMount;
+
+inline void sdMountStart(SdMount &mount, uint32_t nowMs) {
+  mount.step = SD_STEP_POWER_UP;
+  mount.attempts = 0;
+  mount.failStreak = 0;
+  mount.resets = 0;
+  mount.backoffMs = SD_MOUNT_FIRST_BACKOFF_MS;
+  mount.startMs = nowMs;
+  mount.totalMs = 0;
+}
+
+// POWER_UP or RESET done: the card has had its clocks
+inline void sdMountClocked(SdMount &mount) {
+  mount.step = SD_STEP_PROBE;
+}
+
+// A PROBE step finished: record it and pick the next step
+inline void sdMountAttempted(SdMount &mount, uint32_t nowMs, uint32_t attemptStartMs, uint32_t probeUs,
+                             uint8_t r1, uint32_t beginMs, uint8_t result) {
+  if (mount.attempts < SD_MOUNT_MAX_RECORDS) {
+    SdMountAttempt &record = mount.attempt[mount.attempts];
+    uint32_t start = attemptStartMs - mount.startMs;
+    record.startMs = start > 0xFFFF ? 0xFFFF : start;
+    record.probeUs = probeUs > 0xFFFF ? 0xFFFF : probeUs;
+    record.beginMs = beginMs > 0xFFFF ? 0xFFFF : beginMs;
+    record.r1 = r1;
+    record.result = result;
+  }
+  if (mount.attempts < 0xFF) {
+    mount.attempts++;
+  }
+
+  uint32_t elapsed = nowMs - mount.startMs;
+  if (result == SD_ATTEMPT_MOUNTED) {
+    mount.step = SD_STEP_MOUNTED;
+    mount.totalMs = elapsed;
+  } else if (elapsed + mount.backoffMs >= SD_MOUNT_BUDGET_MS) {
+    mount.step = SD_STEP_FAILED;
+    mount.totalMs = elapsed;
+  } else {
+    mount.failStreak++;
+    mount.step = SD_STEP_BACKOFF;
+  }
+}
+
+// The BACKOFF wait is over
+inline void sdMountBackedOff(SdMount &mount) {
+  mount.backoffMs = (mount.backoffMs * 2 < SD_MOUNT_MAX_BACKOFF_MS) ? mount.backoffMs * 2 : SD_MOUNT_MAX_BACKOFF_MS;
+  if (mount.failStreak >= SD_MOUNT_RESET_AFTER) {
+    mount.failStreak = 0;
+    mount.resets++;
+    mount.step = SD_STEP_RESET;
+  } else {
+    mount.step = SD_STEP_PROBE;
+  }
+}
+
+// Likely cause of a failed mount (SD_DIAGNOSIS_*), from the best answer seen
+inline int sdMountDiagnosis(const SdMount &mount) {
+  uint8_t kept = mount.attempts < SD_MOUNT_MAX_RECORDS ? mount.attempts : SD_MOUNT_MAX_RECORDS;
+  bool answered = false;
+  for (uint8_t i = 0; i < kept; i++) {
+    if (mount.attempt[i].result == SD_ATTEMPT_BEGIN_FAILED) {
+      return SD_DIAGNOSIS_FORMAT;
+    }
+    answered = answered || mount.attempt[i].result == SD_ATTEMPT_BAD_RESPONSE;
+  }
+  return answered ? SD_DIAGNOSIS_COMMUNICATION : SD_DIAGNOSIS_DETECTION;
+}
+
+// The record as one line: "SD-MOUNT v1 mounted total=47ms attempts=2 ..."
+inline int sdMountFormat(char *buffer, size_t size, const SdMount &mount) {
+  int length = snprintf(buffer, size, "SD-MOUNT v%d %s total=%lums attempts=%u resets=%u", SD_MOUNT_VERSION,
+                        mount.step == SD_STEP_MOUNTED ? "mounted" : "failed", (unsigned long)mount.totalMs,
+                        mount.attempts, mount.resets);
+  uint8_t kept = mount.attempts < SD_MOUNT_MAX_RECORDS ? mount.attempts : SD_MOUNT_MAX_RECORDS;
+  for (uint8_t i = 0; i < kept && length >= 0 && (size_t)length < size; i++) {
+    const SdMountAttempt &record = mount.attempt[i];
+    length += snprintf(buffer + length, size - length, " %u@%u:r1=%02x/%uus", i, record.startMs, record.r1,
+                       record.probeUs);
+    if (length >= 0 && (size_t)length < size && record.result >= SD_ATTEMPT_BEGIN_FAILED) {
+      length += snprintf(buffer + length, size - length, ",begin=%ums", record.beginMs);
+    }
+    if (length >= 0 && (size_t)length < size) {
+      length += snprintf(buffer + length, size - length, ",%s", SD_ATTEMPT_NAMES[record.result]);
+    }
+  }
+  return length;
+}
+
+#endif // SD_MOUNT_H
@@ -0,0 +1,172 @@
+/*
+ * Keystroke Pacing for Ghostkey
+ *
+ * Every typed keystroke takes a token from a token bucket before it is
+ * sent. The bucket holds up to burst tokens and refills at rate tokens per
+ * second, so a short string (up to burst keys) goes out back to back while
+ * longer text settles at rate keys per second. Rate 0 sends keystrokes
+ * unpaced, as fast as USB takes the reports.
+ *
+ * The rate is set by TYPING_RATE / TYPING_BURST in config.txt and changed
+ * per script section with SPEED (see typingParseSpeed()). An ordinary
+ * character is one keystroke; a dead key or a Unicode input sequence
+ * takes one token per key of the sequence.
+ *
+ * Also built into tools/gkimage.cpp, through lib/ducky-compiler.h.
+ */
+
+#ifndef TYPING_PACER_H
+#define TYPING_PACER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define TYPING_RATE_UNLIMITED 0
+#define TYPING_MAX_BURST 255
+
+// Default pacing: one keystroke every 30ms, the gap Ghostkey always typed with
+#define TYPING_DEFAULT_RATE 33
+#define TYPING_DEFAULT_BURST 1
+
+// SPEED DEFAULT: back to the TYPING_RATE / TYPING_BURST from config.txt
+#define TYPING_SPEED_DEFAULT 0xFFFFFFFFUL
+
+// Rough cost of an unpaced keystroke (press and release report), for estimates
+#define TYPING_UNPACED_KEY_MICROS 2000UL
+
+// Pack a rate and burst into one value (compiled SPEED operand)
+inline uint32_t typingSpeedValue(uint16_t rate, uint8_t burst) {
+  return ((uint32_t)burst << 16) | rate;
+}
+
+inline uint16_t typingSpeedRate(uint32_t value) {
+  return (uint16_t)(value & 0xFFFF);
+}
+
+inline uint8_t typingSpeedBurst(uint32_t value) {
+  return (uint8_t)(value >> 16);
+}
+
+// Parse SPEED parameters: "<keys per second> [burst]", "MAX" (unpaced) or
+// "DEFAULT". The burst defaults to 1 and is capped at TYPING_MAX_BURST.
+// Returns false if the parameters are not one of those forms.
+inline bool typingParseSpeed(const char *text, size_t length, uint32_t &value) {
+  size_t i = 0;
+  while (i < length && text[i] == ' ') {
+    i++;
+  }
+  size_t wordLength = length - i;
+  while (wordLength > 0 && (text[i + wordLength - 1] == ' ' || text[i + wordLength - 1] == '\r')) {
+    wordLength--;
+  }
+  if (wordLength == 7 && memcmp(text + i, "DEFAULT", 7) == 0) {
+    value = TYPING_SPEED_DEFAULT;
+    return true;
+  }
+  if (wordLength == 3 && memcmp(text + i, "MAX", 3) == 0) {
+    value = typingSpeedValue(TYPING_RATE_UNLIMITED, 1);
+    return true;
+  }
+
+  uint32_t numbers[2] = { 0, 1 };
+  int count = 0;
+  size_t end = i + wordLength;
+  while (i < end) {
+    if (count == 2 || text[i] < '0' || text[i] > '9') {
+      return false;
+    }
+    uint32_t number = 0;
+    while (i < end && text[i] >= '0' && text[i] <= '9') {
+      if (number < 100000) {
+        number = number * 10 + (text[i] - '0');
+      }
+      i++;
+    }
+    numbers[count++] = number;
+    while (i < end && text[i] == ' ') {
+      i++;
+    }
+  }
+  if (count == 0) {
+    return false;
+  }
+  uint32_t rate = (numbers[0] > 0xFFFF) ? 0xFFFF : numbers[0];
+  uint32_t burst = numbers[1];
+  if (burst < 1) {
+    burst = 1;
+  } else if (burst > TYPING_MAX_BURST) {
+    burst = TYPING_MAX_BURST;
+  }
+  value = typingSpeedValue((uint16_t)rate, (uint8_t)burst);
+  return true;
+}
+
+// Expected milliseconds for keys keystrokes starting with a full bucket
+inline unsigned long typingPaceMillis(unsigned long keys, uint16_t rate, uint8_t burst) {
+  if (rate == TYPING_RATE_UNLIMITED) {
+    return keys * TYPING_UNPACED_KEY_MICROS / 1000;
+  }
+  // The first burst - 1 keys find tokens waiting; the rest are paced
+  unsigned long paced = (keys + 1 > burst) ? keys + 1 - burst : 0;
+  return paced * 1000UL / rate;
+}
+
+class TypingPacer {
+public:
+  TypingPacer() : _rate(TYPING_DEFAULT_RATE), _burst(TYPING_DEFAULT_BURST), _credit(0), _last(0) {
+    _interval = 1000000UL / _rate;
+  }
+
+  // Set the pacing and fill the bucket; now in microseconds
+  void configure(uint16_t rate, uint8_t burst, uint32_t now) {
+    _rate = rate;
+    _burst = (burst < 1) ? 1 : burst;
+    _interval = (rate == TYPING_RATE_UNLIMITED) ? 0 : 1000000UL / rate;
+    _credit = capacity();
+    _last = now;
+  }
+
+  uint16_t rate() const {
+    return _rate;
+  }
+
+  uint8_t burst() const {
+    return _burst;
+  }
+
+  // Take the token for one keystroke at now (microseconds). Returns how
+  // many microseconds to wait before sending it; the token is spent either way.
+  uint32_t take(uint32_t now) {
+    if (_rate == TYPING_RATE_UNLIMITED) {
+      return 0;
+    }
+    if ((int32_t)(now - _last) > 0) {
+      uint32_t elapsed = now - _last;
+      uint32_t room = capacity() - _credit;
+      _credit += (elapsed < room) ? elapsed : room;
+      _last = now;
+    }
+    if (_credit >= _interval) {
+      _credit -= _interval;
+      return 0;
+    }
+    uint32_t wait = _interval - _credit;
+    _credit = 0;
+    _last = now + wait;
+    return wait;
+  }
+
+private:
+  uint16_t _rate;     // Tokens (keystrokes) per second, 0 = unpaced
+  uint8_t _burst;     // Bucket size in tokens
+  uint32_t _interval; // Microseconds per token
+  uint32_t _credit;   // Bucket contents in microseconds (one token = _interval)
+  uint32_t _last;     // When _credit was last brought up to date
+
+  uint32_t capacity() const {
+    return _interval * _burst;
+  }
+};
+
+#endif // TYPING_PACER_H
@@ -0,0 +1,3430 @@
+/*
+ * Unicode Key Tables for Ghostkey
+ *
+ * Non-ASCII characters each keyboard layout can type directly, either as
+ * a key with Shift/AltGr or as a dead key followed by a second key. ASCII
+ * comes from the Keyboard library's layout tables. Entries are sorted by
+ * code point (they are binary searched).
+ *
+ * Usage IDs are the physical keys of a US keyboard, as in the Keyboard
+ * library's KeyboardLayout_*.cpp files.
+ *
+ * Generated by tools/xkb_layouts.py from the XKB keymaps - do not edit.
+ * Check it against the installed XKB data with --verify.
+ */
+
+#ifndef UNICODE_LAYOUTS_H
+#define UNICODE_LAYOUTS_H
+
+#include "unicode-typing.h"
+
+#define UK_PLAIN 0x00
+#define UK_SHIFT TYPING_MOD_SHIFT
+#define UK_ALT_GR TYPING_MOD_ALT_GR
+#define UK_SHIFT_ALT_GR (TYPING_MOD_SHIFT | TYPING_MOD_ALT_GR)
+
+// Plain key, and key after a dead key
+#define UK_KEY(codepoint, modifiers, usage) { codepoint, 0, 0, modifiers, usage }
+#define UK_DEAD(codepoint, deadModifiers, deadUsage, modifiers, usage) \
+  { codepoint, deadModifiers, deadUsage, modifiers, usage }
+
+#define UNICODE_KEY_COUNT(table) ((uint16_t)(sizeof(table) / sizeof(table[0])))
+
+// UNICODE_KEYS_<layout> expands to the table and its length (NULL, 0 if
+// the layout types nothing beyond ASCII)
+
+// en_US (XKB "us"): ASCII only
+#define UNICODE_KEYS_en_US NULL, 0
+
+// de_DE (XKB "de"): 404 characters, 325 of them after a dead key
+static const UnicodeKeyEntry UnicodeKeys_de_DE[] = {
+  UK_KEY(0x00A1, UK_SHIFT_ALT_GR, 0x1E),               // ¡
+  UK_KEY(0x00A2, UK_ALT_GR, 0x06),                     // ¢
+  UK_KEY(0x00A3, UK_SHIFT_ALT_GR, 0x20),               // £
+  UK_KEY(0x00A4, UK_SHIFT_ALT_GR, 0x21),               // ¤
+  UK_KEY(0x00A5, UK_SHIFT_ALT_GR, 0x1C),               // ¥
+  UK_KEY(0x00A7, UK_SHIFT, 0x20),                      // §
+  UK_KEY(0x00A9, UK_SHIFT_ALT_GR, 0x06),               // ©
+  UK_KEY(0x00AA, UK_SHIFT_ALT_GR, 0x09),               // ª
+  UK_KEY(0x00AB, UK_ALT_GR, 0x1B),                     // «
+  UK_KEY(0x00AC, UK_ALT_GR, 0x23),                     // ¬
+  UK_KEY(0x00AE, UK_SHIFT_ALT_GR, 0x15),               // ®
+  UK_KEY(0x00AF, UK_SHIFT_ALT_GR, 0x30),               // ¯
+  UK_KEY(0x00B0, UK_SHIFT, 0x35),                      // °
+  UK_KEY(0x00B1, UK_SHIFT_ALT_GR, 0x26),               // ±
+  UK_KEY(0x00B2, UK_ALT_GR, 0x1F),                     // ²
+  UK_KEY(0x00B3, UK_ALT_GR, 0x20),                     // ³
+  UK_KEY(0x00B5, UK_ALT_GR, 0x10),                     // µ
+  UK_KEY(0x00B6, UK_ALT_GR, 0x15),                     // ¶
+  UK_KEY(0x00B7, UK_ALT_GR, 0x36),                     // ·
+  UK_DEAD(0x00B8, UK_ALT_GR, 0x2E, UK_PLAIN, 0x2C),    // ¸
+  UK_KEY(0x00B9, UK_ALT_GR, 0x1E),                     // ¹
+  UK_KEY(0x00BA, UK_SHIFT_ALT_GR, 0x10),               // º
+  UK_KEY(0x00BB, UK_ALT_GR, 0x1D),                     // »
+  UK_KEY(0x00BC, UK_ALT_GR, 0x21),                     // ¼
+  UK_KEY(0x00BD, UK_ALT_GR, 0x22),                     // ½
+  UK_KEY(0x00BF, UK_SHIFT_ALT_GR, 0x2D),               // ¿
+  UK_DEAD(0x00C0, UK_SHIFT, 0x2E, UK_SHIFT, 0x04),     // À
+  UK_DEAD(0x00C1, UK_PLAIN, 0x2E, UK_SHIFT, 0x04),     // Á
+  UK_DEAD(0x00C2, UK_PLAIN, 0x35, UK_SHIFT, 0x04),     // Â
+  UK_KEY(0x00C4, UK_SHIFT, 0x34),                      // Ä
+  UK_DEAD(0x00C5, UK_SHIFT_ALT_GR, 0x2F, UK_SHIFT, 0x04), // Å
+  UK_KEY(0x00C6, UK_SHIFT_ALT_GR, 0x04),               // Æ
+  UK_DEAD(0x00C7, UK_ALT_GR, 0x2E, UK_SHIFT, 0x06),    // Ç
+  UK_DEAD(0x00C8, UK_SHIFT, 0x2E, UK_SHIFT, 0x08),     // È
+  UK_DEAD(0x00C9, UK_PLAIN, 0x2E, UK_SHIFT, 0x08),     // É
+  UK_DEAD(0x00CA, UK_PLAIN, 0x35, UK_SHIFT, 0x08),     // Ê
+  UK_DEAD(0x00CB, UK_ALT_GR, 0x2F, UK_SHIFT, 0x08),    // Ë
+  UK_DEAD(0x00CC, UK_SHIFT, 0x2E, UK_SHIFT, 0x0C),     // Ì
+  UK_DEAD(0x00CD, UK_PLAIN, 0x2E, UK_SHIFT, 0x0C),     // Í
+  UK_DEAD(0x00CE, UK_PLAIN, 0x35, UK_SHIFT, 0x0C),     // Î
+  UK_DEAD(0x00CF, UK_ALT_GR, 0x2F, UK_SHIFT, 0x0C),    // Ï
+  UK_KEY(0x00D0, UK_SHIFT_ALT_GR, 0x07),               // Ð
+  UK_DEAD(0x00D2, UK_SHIFT, 0x2E, UK_SHIFT, 0x12),     // Ò
+  UK_DEAD(0x00D3, UK_PLAIN, 0x2E, UK_SHIFT, 0x12),     // Ó
+  UK_DEAD(0x00D4, UK_PLAIN, 0x35, UK_SHIFT, 0x12),     // Ô
+  UK_KEY(0x00D6, UK_SHIFT, 0x33),                      // Ö
+  UK_KEY(0x00D7, UK_SHIFT_ALT_GR, 0x36),               // ×
+  UK_KEY(0x00D8, UK_SHIFT_ALT_GR, 0x12),               // Ø
+  UK_DEAD(0x00D9, UK_SHIFT, 0x2E, UK_SHIFT, 0x18),     // Ù
+  UK_DEAD(0x00DA, UK_PLAIN, 0x2E, UK_SHIFT, 0x18),     // Ú
+  UK_DEAD(0x00DB, UK_PLAIN, 0x35, UK_SHIFT, 0x18),     // Û
+  UK_KEY(0x00DC, UK_SHIFT, 0x2F),                      // Ü
+  UK_DEAD(0x00DD, UK_PLAIN, 0x2E, UK_SHIFT, 0x1D),     // Ý
+  UK_KEY(0x00DE, UK_SHIFT_ALT_GR, 0x13),               // Þ
+  UK_KEY(0x00DF, UK_PLAIN, 0x2D),                      // ß
+  UK_DEAD(0x00E0, UK_SHIFT, 0x2E, UK_PLAIN, 0x04),     // à
+  UK_DEAD(0x00E1, UK_PLAIN, 0x2E, UK_PLAIN, 0x04),     // á
+  UK_DEAD(0x00E2, UK_PLAIN, 0x35, UK_PLAIN, 0x04),     // â
+  UK_KEY(0x00E4, UK_PLAIN, 0x34),                      // ä
+  UK_DEAD(0x00E5, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x04), // å
+  UK_KEY(0x00E6, UK_ALT_GR, 0x04),                     // æ
+  UK_DEAD(0x00E7, UK_ALT_GR, 0x2E, UK_PLAIN, 0x06),    // ç
+  UK_DEAD(0x00E8, UK_SHIFT, 0x2E, UK_PLAIN, 0x08),     // è
+  UK_DEAD(0x00E9, UK_PLAIN, 0x2E, UK_PLAIN, 0x08),     // é
+  UK_DEAD(0x00EA, UK_PLAIN, 0x35, UK_PLAIN, 0x08),     // ê
+  UK_DEAD(0x00EB, UK_ALT_GR, 0x2F, UK_PLAIN, 0x08),    // ë
+  UK_DEAD(0x00EC, UK_SHIFT, 0x2E, UK_PLAIN, 0x0C),     // ì
+  UK_DEAD(0x00ED, UK_PLAIN, 0x2E, UK_PLAIN, 0x0C),     // í
+  UK_DEAD(0x00EE, UK_PLAIN, 0x35, UK_PLAIN, 0x0C),     // î
+  UK_DEAD(0x00EF, UK_ALT_GR, 0x2F, UK_PLAIN, 0x0C),    // ï
+  UK_KEY(0x00F0, UK_ALT_GR, 0x07),                     // ð
+  UK_DEAD(0x00F2, UK_SHIFT, 0x2E, UK_PLAIN, 0x12),     // ò
+  UK_DEAD(0x00F3, UK_PLAIN, 0x2E, UK_PLAIN, 0x12),     // ó
+  UK_DEAD(0x00F4, UK_PLAIN, 0x35, UK_PLAIN, 0x12),     // ô
+  UK_KEY(0x00F6, UK_PLAIN, 0x33),                      // ö
+  UK_KEY(0x00F7, UK_SHIFT_ALT_GR, 0x37),               // ÷
+  UK_KEY(0x00F8, UK_ALT_GR, 0x12),                     // ø
+  UK_DEAD(0x00F9, UK_SHIFT, 0x2E, UK_PLAIN, 0x18),     // ù
+  UK_DEAD(0x00FA, UK_PLAIN, 0x2E, UK_PLAIN, 0x18),     // ú
+  UK_DEAD(0x00FB, UK_PLAIN, 0x35, UK_PLAIN, 0x18),     // û
+  UK_KEY(0x00FC, UK_PLAIN, 0x2F),                      // ü
+  UK_DEAD(0x00FD, UK_PLAIN, 0x2E, UK_PLAIN, 0x1D),     // ý
+  UK_KEY(0x00FE, UK_ALT_GR, 0x13),                     // þ
+  UK_DEAD(0x00FF, UK_ALT_GR, 0x2F, UK_PLAIN, 0x1D),    // ÿ
+  UK_DEAD(0x0102, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x04), // Ă
+  UK_DEAD(0x0103, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x04), // ă
+  UK_DEAD(0x0104, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x04), // Ą
+  UK_DEAD(0x0105, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x04), // ą
+  UK_DEAD(0x0106, UK_PLAIN, 0x2E, UK_SHIFT, 0x06),     // Ć
+  UK_DEAD(0x0107, UK_PLAIN, 0x2E, UK_PLAIN, 0x06),     // ć
+  UK_DEAD(0x0108, UK_PLAIN, 0x35, UK_SHIFT, 0x06),     // Ĉ
+  UK_DEAD(0x0109, UK_PLAIN, 0x35, UK_PLAIN, 0x06),     // ĉ
+  UK_DEAD(0x010A, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x06), // Ċ
+  UK_DEAD(0x010B, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x06), // ċ
+  UK_DEAD(0x010C, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x06), // Č
+  UK_DEAD(0x010D, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x06), // č
+  UK_DEAD(0x010E, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x07), // Ď
+  UK_DEAD(0x010F, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x07), // ď
+  UK_KEY(0x0111, UK_ALT_GR, 0x09),                     // đ
+  UK_DEAD(0x0114, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x08), // Ĕ
+  UK_DEAD(0x0115, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x08), // ĕ
+  UK_DEAD(0x0116, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x08), // Ė
+  UK_DEAD(0x0117, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x08), // ė
+  UK_DEAD(0x0118, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x08), // Ę
+  UK_DEAD(0x0119, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x08), // ę
+  UK_DEAD(0x011A, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x08), // Ě
+  UK_DEAD(0x011B, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x08), // ě
+  UK_DEAD(0x011C, UK_PLAIN, 0x35, UK_SHIFT, 0x0A),     // Ĝ
+  UK_DEAD(0x011D, UK_PLAIN, 0x35, UK_PLAIN, 0x0A),     // ĝ
+  UK_DEAD(0x011E, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x0A), // Ğ
+  UK_DEAD(0x011F, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x0A), // ğ
+  UK_DEAD(0x0120, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x0A), // Ġ
+  UK_DEAD(0x0121, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x0A), // ġ
+  UK_DEAD(0x0122, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0A),    // Ģ
+  UK_DEAD(0x0123, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0A),    // ģ
+  UK_DEAD(0x0124, UK_PLAIN, 0x35, UK_SHIFT, 0x0B),     // Ĥ
+  UK_DEAD(0x0125, UK_PLAIN, 0x35, UK_PLAIN, 0x0B),     // ĥ
+  UK_KEY(0x0126, UK_SHIFT_ALT_GR, 0x0B),               // Ħ
+  UK_KEY(0x0127, UK_ALT_GR, 0x0B),                     // ħ
+  UK_DEAD(0x012C, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x0C), // Ĭ
+  UK_DEAD(0x012D, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x0C), // ĭ
+  UK_DEAD(0x012E, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x0C), // Į
+  UK_DEAD(0x012F, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x0C), // į
+  UK_DEAD(0x0130, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x0C), // İ
+  UK_KEY(0x0131, UK_SHIFT_ALT_GR, 0x0C),               // ı
+  UK_DEAD(0x0134, UK_PLAIN, 0x35, UK_SHIFT, 0x0D),     // Ĵ
+  UK_DEAD(0x0135, UK_PLAIN, 0x35, UK_PLAIN, 0x0D),     // ĵ
+  UK_DEAD(0x0136, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0E),    // Ķ
+  UK_DEAD(0x0137, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0E),    // ķ
+  UK_KEY(0x0138, UK_ALT_GR, 0x0E),                     // ĸ
+  UK_DEAD(0x0139, UK_PLAIN, 0x2E, UK_SHIFT, 0x0F),     // Ĺ
+  UK_DEAD(0x013A, UK_PLAIN, 0x2E, UK_PLAIN, 0x0F),     // ĺ
+  UK_DEAD(0x013B, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0F),    // Ļ
+  UK_DEAD(0x013C, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0F),    // ļ
+  UK_DEAD(0x013D, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0F), // Ľ
+  UK_DEAD(0x013E, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0F), // ľ
+  UK_DEAD(0x013F, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x0F), // Ŀ
+  UK_DEAD(0x0140, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x0F), // ŀ
+  UK_KEY(0x0141, UK_SHIFT_ALT_GR, 0x0F),               // Ł
+  UK_KEY(0x0142, UK_ALT_GR, 0x0F),                     // ł
+  UK_DEAD(0x0143, UK_PLAIN, 0x2E, UK_SHIFT, 0x11),     // Ń
+  UK_DEAD(0x0144, UK_PLAIN, 0x2E, UK_PLAIN, 0x11),     // ń
+  UK_DEAD(0x0145, UK_ALT_GR, 0x2E, UK_SHIFT, 0x11),    // Ņ
+  UK_DEAD(0x0146, UK_ALT_GR, 0x2E, UK_PLAIN, 0x11),    // ņ
+  UK_DEAD(0x0147, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x11), // Ň
+  UK_DEAD(0x0148, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x11), // ň
+  UK_KEY(0x014A, UK_SHIFT_ALT_GR, 0x0A),               // Ŋ
+  UK_KEY(0x014B, UK_ALT_GR, 0x0A),                     // ŋ
+  UK_DEAD(0x014E, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x12), // Ŏ
+  UK_DEAD(0x014F, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x12), // ŏ
+  UK_DEAD(0x0150, UK_ALT_GR, 0x33, UK_SHIFT, 0x12),    // Ő
+  UK_DEAD(0x0151, UK_ALT_GR, 0x33, UK_PLAIN, 0x12),    // ő
+  UK_DEAD(0x0154, UK_PLAIN, 0x2E, UK_SHIFT, 0x15),     // Ŕ
+  UK_DEAD(0x0155, UK_PLAIN, 0x2E, UK_PLAIN, 0x15),     // ŕ
+  UK_DEAD(0x0156, UK_ALT_GR, 0x2E, UK_SHIFT, 0x15),    // Ŗ
+  UK_DEAD(0x0157, UK_ALT_GR, 0x2E, UK_PLAIN, 0x15),    // ŗ
+  UK_DEAD(0x0158, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x15), // Ř
+  UK_DEAD(0x0159, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x15), // ř
+  UK_DEAD(0x015A, UK_PLAIN, 0x2E, UK_SHIFT, 0x16),     // Ś
+  UK_DEAD(0x015B, UK_PLAIN, 0x2E, UK_PLAIN, 0x16),     // ś
+  UK_DEAD(0x015C, UK_PLAIN, 0x35, UK_SHIFT, 0x16),     // Ŝ
+  UK_DEAD(0x015D, UK_PLAIN, 0x35, UK_PLAIN, 0x16),     // ŝ
+  UK_DEAD(0x015E, UK_ALT_GR, 0x2E, UK_SHIFT, 0x16),    // Ş
+  UK_DEAD(0x015F, UK_ALT_GR, 0x2E, UK_PLAIN, 0x16),    // ş
+  UK_DEAD(0x0160, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x16), // Š
+  UK_DEAD(0x0161, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x16), // š
+  UK_DEAD(0x0162, UK_ALT_GR, 0x2E, UK_SHIFT, 0x17),    // Ţ
+  UK_DEAD(0x0163, UK_ALT_GR, 0x2E, UK_PLAIN, 0x17),    // ţ
+  UK_DEAD(0x0164, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x17), // Ť
+  UK_DEAD(0x0165, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x17), // ť
+  UK_KEY(0x0166, UK_SHIFT_ALT_GR, 0x17),               // Ŧ
+  UK_KEY(0x0167, UK_ALT_GR, 0x17),                     // ŧ
+  UK_DEAD(0x016C, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x18), // Ŭ
+  UK_DEAD(0x016D, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x18), // ŭ
+  UK_DEAD(0x016E, UK_SHIFT_ALT_GR, 0x2F, UK_SHIFT, 0x18), // Ů
+  UK_DEAD(0x016F, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x18), // ů
+  UK_DEAD(0x0170, UK_ALT_GR, 0x33, UK_SHIFT, 0x18),    // Ű
+  UK_DEAD(0x0171, UK_ALT_GR, 0x33, UK_PLAIN, 0x18),    // ű
+  UK_DEAD(0x0172, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x18), // Ų
+  UK_DEAD(0x0173, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x18), // ų
+  UK_DEAD(0x0174, UK_PLAIN, 0x35, UK_SHIFT, 0x1A),     // Ŵ
+  UK_DEAD(0x0175, UK_PLAIN, 0x35, UK_PLAIN, 0x1A),     // ŵ
+  UK_DEAD(0x0176, UK_PLAIN, 0x35, UK_SHIFT, 0x1D),     // Ŷ
+  UK_DEAD(0x0177, UK_PLAIN, 0x35, UK_PLAIN, 0x1D),     // ŷ
+  UK_DEAD(0x0178, UK_ALT_GR, 0x2F, UK_SHIFT, 0x1D),    // Ÿ
+  UK_DEAD(0x0179, UK_PLAIN, 0x2E, UK_SHIFT, 0x1C),     // Ź
+  UK_DEAD(0x017A, UK_PLAIN, 0x2E, UK_PLAIN, 0x1C),     // ź
+  UK_DEAD(0x017B, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x1C), // Ż
+  UK_DEAD(0x017C, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x1C), // ż
+  UK_DEAD(0x017D, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x1C), // Ž
+  UK_DEAD(0x017E, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x1C), // ž
+  UK_KEY(0x017F, UK_ALT_GR, 0x1A),                     // ſ
+  UK_DEAD(0x01CD, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x04), // Ǎ
+  UK_DEAD(0x01CE, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x04), // ǎ
+  UK_DEAD(0x01CF, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0C), // Ǐ
+  UK_DEAD(0x01D0, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0C), // ǐ
+  UK_DEAD(0x01D1, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x12), // Ǒ
+  UK_DEAD(0x01D2, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x12), // ǒ
+  UK_DEAD(0x01D3, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x18), // Ǔ
+  UK_DEAD(0x01D4, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x18), // ǔ
+  UK_DEAD(0x01D7, UK_PLAIN, 0x2E, UK_SHIFT, 0x2F),     // Ǘ
+  UK_DEAD(0x01D8, UK_PLAIN, 0x2E, UK_PLAIN, 0x2F),     // ǘ
+  UK_DEAD(0x01D9, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x2F), // Ǚ
+  UK_DEAD(0x01DA, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x2F), // ǚ
+  UK_DEAD(0x01DB, UK_SHIFT, 0x2E, UK_SHIFT, 0x2F),     // Ǜ
+  UK_DEAD(0x01DC, UK_SHIFT, 0x2E, UK_PLAIN, 0x2F),     // ǜ
+  UK_DEAD(0x01E6, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0A), // Ǧ
+  UK_DEAD(0x01E7, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0A), // ǧ
+  UK_DEAD(0x01E8, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0E), // Ǩ
+  UK_DEAD(0x01E9, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0E), // ǩ
+  UK_DEAD(0x01EA, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x12), // Ǫ
+  UK_DEAD(0x01EB, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x12), // ǫ
+  UK_DEAD(0x01F0, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0D), // ǰ
+  UK_DEAD(0x01F4, UK_PLAIN, 0x2E, UK_SHIFT, 0x0A),     // Ǵ
+  UK_DEAD(0x01F5, UK_PLAIN, 0x2E, UK_PLAIN, 0x0A),     // ǵ
+  UK_DEAD(0x01F8, UK_SHIFT, 0x2E, UK_SHIFT, 0x11),     // Ǹ
+  UK_DEAD(0x01F9, UK_SHIFT, 0x2E, UK_PLAIN, 0x11),     // ǹ
+  UK_DEAD(0x01FC, UK_PLAIN, 0x2E, UK_SHIFT_ALT_GR, 0x04), // Ǽ
+  UK_DEAD(0x01FD, UK_PLAIN, 0x2E, UK_ALT_GR, 0x04),    // ǽ
+  UK_DEAD(0x01FE, UK_PLAIN, 0x2E, UK_SHIFT_ALT_GR, 0x12), // Ǿ
+  UK_DEAD(0x01FF, UK_PLAIN, 0x2E, UK_ALT_GR, 0x12),    // ǿ
+  UK_DEAD(0x021E, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0B), // Ȟ
+  UK_DEAD(0x021F, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0B), // ȟ
+  UK_DEAD(0x0226, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x04), // Ȧ
+  UK_DEAD(0x0227, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x04), // ȧ
+  UK_DEAD(0x0228, UK_ALT_GR, 0x2E, UK_SHIFT, 0x08),    // Ȩ
+  UK_DEAD(0x0229, UK_ALT_GR, 0x2E, UK_PLAIN, 0x08),    // ȩ
+  UK_DEAD(0x022E, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x12), // Ȯ
+  UK_DEAD(0x022F, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x12), // ȯ
+  UK_DEAD(0x0237, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x0D), // ȷ
+  UK_DEAD(0x02C7, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x2C), // ˇ
+  UK_DEAD(0x02D8, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x2C), // ˘
+  UK_DEAD(0x02D9, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x2C), // ˙
+  UK_DEAD(0x02DB, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x2C), // ˛
+  UK_DEAD(0x02DD, UK_ALT_GR, 0x33, UK_PLAIN, 0x2C),    // ˝
+  UK_DEAD(0x0323, UK_ALT_GR, 0x0D, UK_PLAIN, 0x2C),    // ̣
+  UK_DEAD(0x0344, UK_ALT_GR, 0x2F, UK_SHIFT, 0x31),    // ̈́
+  UK_DEAD(0x038F, UK_PLAIN, 0x2E, UK_SHIFT_ALT_GR, 0x14), // Ώ
+  UK_KEY(0x03A9, UK_SHIFT_ALT_GR, 0x14),               // Ω
+  UK_DEAD(0x1E02, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x05), // Ḃ
+  UK_DEAD(0x1E03, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x05), // ḃ
+  UK_DEAD(0x1E04, UK_ALT_GR, 0x0D, UK_SHIFT, 0x05),    // Ḅ
+  UK_DEAD(0x1E05, UK_ALT_GR, 0x0D, UK_PLAIN, 0x05),    // ḅ
+  UK_DEAD(0x1E06, UK_SHIFT_ALT_GR, 0x64, UK_SHIFT, 0x05), // Ḇ
+  UK_DEAD(0x1E07, UK_SHIFT_ALT_GR, 0x64, UK_PLAIN, 0x05), // ḇ
+  UK_DEAD(0x1E0A, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x07), // Ḋ
+  UK_DEAD(0x1E0B, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x07), // ḋ
+  UK_DEAD(0x1E0C, UK_ALT_GR, 0x0D, UK_SHIFT, 0x07),    // Ḍ
+  UK_DEAD(0x1E0D, UK_ALT_GR, 0x0D, UK_PLAIN, 0x07),    // ḍ
+  UK_DEAD(0x1E0E, UK_SHIFT_ALT_GR, 0x64, UK_SHIFT, 0x07), // Ḏ
+  UK_DEAD(0x1E0F, UK_SHIFT_ALT_GR, 0x64, UK_PLAIN, 0x07), // ḏ
+  UK_DEAD(0x1E10, UK_ALT_GR, 0x2E, UK_SHIFT, 0x07),    // Ḑ
+  UK_DEAD(0x1E11, UK_ALT_GR, 0x2E, UK_PLAIN, 0x07),    // ḑ
+  UK_DEAD(0x1E1E, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x09), // Ḟ
+  UK_DEAD(0x1E1F, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x09), // ḟ
+  UK_DEAD(0x1E22, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x0B), // Ḣ
+  UK_DEAD(0x1E23, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x0B), // ḣ
+  UK_DEAD(0x1E24, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0B),    // Ḥ
+  UK_DEAD(0x1E25, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0B),    // ḥ
+  UK_DEAD(0x1E26, UK_ALT_GR, 0x2F, UK_SHIFT, 0x0B),    // Ḧ
+  UK_DEAD(0x1E27, UK_ALT_GR, 0x2F, UK_PLAIN, 0x0B),    // ḧ
+  UK_DEAD(0x1E28, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0B),    // Ḩ
+  UK_DEAD(0x1E29, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0B),    // ḩ
+  UK_DEAD(0x1E30, UK_PLAIN, 0x2E, UK_SHIFT, 0x0E),     // Ḱ
+  UK_DEAD(0x1E31, UK_PLAIN, 0x2E, UK_PLAIN, 0x0E),     // ḱ
+  UK_DEAD(0x1E32, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0E),    // Ḳ
+  UK_DEAD(0x1E33, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0E),    // ḳ
+  UK_DEAD(0x1E34, UK_SHIFT_ALT_GR, 0x64, UK_SHIFT, 0x0E), // Ḵ
+  UK_DEAD(0x1E35, UK_SHIFT_ALT_GR, 0x64, UK_PLAIN, 0x0E), // ḵ
+  UK_DEAD(0x1E36, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0F),    // Ḷ
+  UK_DEAD(0x1E37, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0F),    // ḷ
+  UK_DEAD(0x1E3A, UK_SHIFT_ALT_GR, 0x64, UK_SHIFT, 0x0F), // Ḻ
+  UK_DEAD(0x1E3B, UK_SHIFT_ALT_GR, 0x64, UK_PLAIN, 0x0F), // ḻ
+  UK_DEAD(0x1E3E, UK_PLAIN, 0x2E, UK_SHIFT, 0x10),     // Ḿ
+  UK_DEAD(0x1E3F, UK_PLAIN, 0x2E, UK_PLAIN, 0x10),     // ḿ
+  UK_DEAD(0x1E40, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x10), // Ṁ
+  UK_DEAD(0x1E41, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x10), // ṁ
+  UK_DEAD(0x1E42, UK_ALT_GR, 0x0D, UK_SHIFT, 0x10),    // Ṃ
+  UK_DEAD(0x1E43, UK_ALT_GR, 0x0D, UK_PLAIN, 0x10),    // ṃ
+  UK_DEAD(0x1E44, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x11), // Ṅ
+  UK_DEAD(0x1E45, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x11), // ṅ
+  UK_DEAD(0x1E46, UK_ALT_GR, 0x0D, UK_SHIFT, 0x11),    // Ṇ
+  UK_DEAD(0x1E47, UK_ALT_GR, 0x0D, UK_PLAIN, 0x11),    // ṇ
+  UK_DEAD(0x1E48, UK_SHIFT_ALT_GR, 0x64, UK_SHIFT, 0x11), // Ṉ
+  UK_DEAD(0x1E49, UK_SHIFT_ALT_GR, 0x64, UK_PLAIN, 0x11), // ṉ
+  UK_DEAD(0x1E54, UK_PLAIN, 0x2E, UK_SHIFT, 0x13),     // Ṕ
+  UK_DEAD(0x1E55, UK_PLAIN, 0x2E, UK_PLAIN, 0x13),     // ṕ
+  UK_DEAD(0x1E56, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x13), // Ṗ
+  UK_DEAD(0x1E57, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x13), // ṗ
+  UK_DEAD(0x1E58, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x15), // Ṙ
+  UK_DEAD(0x1E59, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x15), // ṙ
+  UK_DEAD(0x1E5A, UK_ALT_GR, 0x0D, UK_SHIFT, 0x15),    // Ṛ
+  UK_DEAD(0x1E5B, UK_ALT_GR, 0x0D, UK_PLAIN, 0x15),    // ṛ
+  UK_DEAD(0x1E5E, UK_SHIFT_ALT_GR, 0x64, UK_SHIFT, 0x15), // Ṟ
+  UK_DEAD(0x1E5F, UK_SHIFT_ALT_GR, 0x64, UK_PLAIN, 0x15), // ṟ
+  UK_DEAD(0x1E60, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x16), // Ṡ
+  UK_DEAD(0x1E61, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x16), // ṡ
+  UK_DEAD(0x1E62, UK_ALT_GR, 0x0D, UK_SHIFT, 0x16),    // Ṣ
+  UK_DEAD(0x1E63, UK_ALT_GR, 0x0D, UK_PLAIN, 0x16),    // ṣ
+  UK_DEAD(0x1E6A, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x17), // Ṫ
+  UK_DEAD(0x1E6B, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x17), // ṫ
+  UK_DEAD(0x1E6C, UK_ALT_GR, 0x0D, UK_SHIFT, 0x17),    // Ṭ
+  UK_DEAD(0x1E6D, UK_ALT_GR, 0x0D, UK_PLAIN, 0x17),    // ṭ
+  UK_DEAD(0x1E6E, UK_SHIFT_ALT_GR, 0x64, UK_SHIFT, 0x17), // Ṯ
+  UK_DEAD(0x1E6F, UK_SHIFT_ALT_GR, 0x64, UK_PLAIN, 0x17), // ṯ
+  UK_DEAD(0x1E7E, UK_ALT_GR, 0x0D, UK_SHIFT, 0x19),    // Ṿ
+  UK_DEAD(0x1E7F, UK_ALT_GR, 0x0D, UK_PLAIN, 0x19),    // ṿ
+  UK_DEAD(0x1E80, UK_SHIFT, 0x2E, UK_SHIFT, 0x1A),     // Ẁ
+  UK_DEAD(0x1E81, UK_SHIFT, 0x2E, UK_PLAIN, 0x1A),     // ẁ
+  UK_DEAD(0x1E82, UK_PLAIN, 0x2E, UK_SHIFT, 0x1A),     // Ẃ
+  UK_DEAD(0x1E83, UK_PLAIN, 0x2E, UK_PLAIN, 0x1A),     // ẃ
+  UK_DEAD(0x1E84, UK_ALT_GR, 0x2F, UK_SHIFT, 0x1A),    // Ẅ
+  UK_DEAD(0x1E85, UK_ALT_GR, 0x2F, UK_PLAIN, 0x1A),    // ẅ
+  UK_DEAD(0x1E86, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x1A), // Ẇ
+  UK_DEAD(0x1E87, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x1A), // ẇ
+  UK_DEAD(0x1E88, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1A),    // Ẉ
+  UK_DEAD(0x1E89, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1A),    // ẉ
+  UK_DEAD(0x1E8A, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x1B), // Ẋ
+  UK_DEAD(0x1E8B, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x1B), // ẋ
+  UK_DEAD(0x1E8C, UK_ALT_GR, 0x2F, UK_SHIFT, 0x1B),    // Ẍ
+  UK_DEAD(0x1E8D, UK_ALT_GR, 0x2F, UK_PLAIN, 0x1B),    // ẍ
+  UK_DEAD(0x1E8E, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x1D), // Ẏ
+  UK_DEAD(0x1E8F, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x1D), // ẏ
+  UK_DEAD(0x1E90, UK_PLAIN, 0x35, UK_SHIFT, 0x1C),     // Ẑ
+  UK_DEAD(0x1E91, UK_PLAIN, 0x35, UK_PLAIN, 0x1C),     // ẑ
+  UK_DEAD(0x1E92, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1C),    // Ẓ
+  UK_DEAD(0x1E93, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1C),    // ẓ
+  UK_DEAD(0x1E94, UK_SHIFT_ALT_GR, 0x64, UK_SHIFT, 0x1C), // Ẕ
+  UK_DEAD(0x1E95, UK_SHIFT_ALT_GR, 0x64, UK_PLAIN, 0x1C), // ẕ
+  UK_DEAD(0x1E96, UK_SHIFT_ALT_GR, 0x64, UK_PLAIN, 0x0B), // ẖ
+  UK_DEAD(0x1E97, UK_ALT_GR, 0x2F, UK_PLAIN, 0x17),    // ẗ
+  UK_DEAD(0x1E98, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x1A), // ẘ
+  UK_DEAD(0x1E99, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x1D), // ẙ
+  UK_DEAD(0x1E9B, UK_SHIFT_ALT_GR, 0x0D, UK_ALT_GR, 0x1A), // ẛ
+  UK_KEY(0x1E9E, UK_SHIFT_ALT_GR, 0x16),               // ẞ
+  UK_DEAD(0x1EA0, UK_ALT_GR, 0x0D, UK_SHIFT, 0x04),    // Ạ
+  UK_DEAD(0x1EA1, UK_ALT_GR, 0x0D, UK_PLAIN, 0x04),    // ạ
+  UK_DEAD(0x1EB8, UK_ALT_GR, 0x0D, UK_SHIFT, 0x08),    // Ẹ
+  UK_DEAD(0x1EB9, UK_ALT_GR, 0x0D, UK_PLAIN, 0x08),    // ẹ
+  UK_DEAD(0x1ECA, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0C),    // Ị
+  UK_DEAD(0x1ECB, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0C),    // ị
+  UK_DEAD(0x1ECC, UK_ALT_GR, 0x0D, UK_SHIFT, 0x12),    // Ọ
+  UK_DEAD(0x1ECD, UK_ALT_GR, 0x0D, UK_PLAIN, 0x12),    // ọ
+  UK_DEAD(0x1EE4, UK_ALT_GR, 0x0D, UK_SHIFT, 0x18),    // Ụ
+  UK_DEAD(0x1EE5, UK_ALT_GR, 0x0D, UK_PLAIN, 0x18),    // ụ
+  UK_DEAD(0x1EF2, UK_SHIFT, 0x2E, UK_SHIFT, 0x1D),     // Ỳ
+  UK_DEAD(0x1EF3, UK_SHIFT, 0x2E, UK_PLAIN, 0x1D),     // ỳ
+  UK_DEAD(0x1EF4, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1D),    // Ỵ
+  UK_DEAD(0x1EF5, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1D),    // ỵ
+  UK_DEAD(0x1FFA, UK_SHIFT, 0x2E, UK_SHIFT_ALT_GR, 0x14), // Ὼ
+  UK_KEY(0x2013, UK_ALT_GR, 0x38),                     // –
+  UK_KEY(0x2014, UK_SHIFT_ALT_GR, 0x38),               // —
+  UK_KEY(0x2018, UK_SHIFT_ALT_GR, 0x05),               // ‘
+  UK_KEY(0x2019, UK_ALT_GR, 0x31),                     // ’
+  UK_KEY(0x201A, UK_SHIFT_ALT_GR, 0x19),               // ‚
+  UK_KEY(0x201C, UK_ALT_GR, 0x05),                     // “
+  UK_KEY(0x201D, UK_ALT_GR, 0x11),                     // ”
+  UK_KEY(0x201E, UK_ALT_GR, 0x19),                     // „
+  UK_KEY(0x2026, UK_ALT_GR, 0x37),                     // …
+  UK_KEY(0x2032, UK_ALT_GR, 0x35),                     // ′
+  UK_KEY(0x2033, UK_SHIFT_ALT_GR, 0x35),               // ″
+  UK_KEY(0x2039, UK_SHIFT_ALT_GR, 0x1B),               // ‹
+  UK_KEY(0x203A, UK_SHIFT_ALT_GR, 0x1D),               // ›
+  UK_DEAD(0x2070, UK_PLAIN, 0x35, UK_PLAIN, 0x27),     // ⁰
+  UK_DEAD(0x2074, UK_PLAIN, 0x35, UK_PLAIN, 0x21),     // ⁴
+  UK_DEAD(0x2075, UK_PLAIN, 0x35, UK_PLAIN, 0x22),     // ⁵
+  UK_DEAD(0x2076, UK_PLAIN, 0x35, UK_PLAIN, 0x23),     // ⁶
+  UK_DEAD(0x2077, UK_PLAIN, 0x35, UK_PLAIN, 0x24),     // ⁷
+  UK_DEAD(0x2078, UK_PLAIN, 0x35, UK_PLAIN, 0x25),     // ⁸
+  UK_DEAD(0x2079, UK_PLAIN, 0x35, UK_PLAIN, 0x26),     // ⁹
+  UK_DEAD(0x207A, UK_PLAIN, 0x35, UK_PLAIN, 0x30),     // ⁺
+  UK_DEAD(0x207B, UK_PLAIN, 0x35, UK_PLAIN, 0x38),     // ⁻
+  UK_DEAD(0x207C, UK_PLAIN, 0x35, UK_SHIFT, 0x27),     // ⁼
+  UK_DEAD(0x207D, UK_PLAIN, 0x35, UK_SHIFT, 0x25),     // ⁽
+  UK_DEAD(0x207E, UK_PLAIN, 0x35, UK_SHIFT, 0x26),     // ⁾
+  UK_DEAD(0x2080, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x27), // ₀
+  UK_DEAD(0x2081, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x1E), // ₁
+  UK_DEAD(0x2082, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x1F), // ₂
+  UK_DEAD(0x2083, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x20), // ₃
+  UK_DEAD(0x2084, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x21), // ₄
+  UK_DEAD(0x2085, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x22), // ₅
+  UK_DEAD(0x2086, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x23), // ₆
+  UK_DEAD(0x2087, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x24), // ₇
+  UK_DEAD(0x2088, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x25), // ₈
+  UK_DEAD(0x2089, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x26), // ₉
+  UK_DEAD(0x208A, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x30), // ₊
+  UK_DEAD(0x208B, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x38), // ₋
+  UK_DEAD(0x208C, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x27), // ₌
+  UK_DEAD(0x208D, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x25), // ₍
+  UK_DEAD(0x208E, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x26), // ₎
+  UK_KEY(0x20AC, UK_ALT_GR, 0x08),                     // €
+  UK_DEAD(0x20B5, UK_ALT_GR, 0x2E, UK_ALT_GR, 0x06),   // ₵
+  UK_KEY(0x2122, UK_SHIFT_ALT_GR, 0x25),               // ™
+  UK_KEY(0x215B, UK_SHIFT_ALT_GR, 0x1F),               // ⅛
+  UK_KEY(0x215C, UK_SHIFT_ALT_GR, 0x22),               // ⅜
+  UK_KEY(0x215D, UK_SHIFT_ALT_GR, 0x23),               // ⅝
+  UK_KEY(0x215E, UK_SHIFT_ALT_GR, 0x24),               // ⅞
+  UK_KEY(0x2190, UK_ALT_GR, 0x1C),                     // ←
+  UK_KEY(0x2191, UK_SHIFT_ALT_GR, 0x18),               // ↑
+  UK_KEY(0x2192, UK_ALT_GR, 0x0C),                     // →
+  UK_KEY(0x2193, UK_ALT_GR, 0x18),                     // ↓
+  UK_DEAD(0x2A25, UK_ALT_GR, 0x0D, UK_PLAIN, 0x30),    // ⨥
+  UK_DEAD(0x2A2A, UK_ALT_GR, 0x0D, UK_PLAIN, 0x38),    // ⨪
+  UK_DEAD(0x2A66, UK_ALT_GR, 0x0D, UK_SHIFT, 0x27),    // ⩦
+};
+#define UNICODE_KEYS_de_DE UnicodeKeys_de_DE, UNICODE_KEY_COUNT(UnicodeKeys_de_DE)
+
+// es_ES (XKB "es"): 467 characters, 401 of them after a dead key
+static const UnicodeKeyEntry UnicodeKeys_es_ES[] = {
+  UK_KEY(0x00A1, UK_SHIFT_ALT_GR, 0x1E),               // ¡
+  UK_KEY(0x00A2, UK_SHIFT_ALT_GR, 0x08),               // ¢
+  UK_KEY(0x00A3, UK_SHIFT_ALT_GR, 0x20),               // £
+  UK_KEY(0x00A5, UK_SHIFT_ALT_GR, 0x1C),               // ¥
+  UK_KEY(0x00A6, UK_SHIFT_ALT_GR, 0x64),               // ¦
+  UK_KEY(0x00A7, UK_SHIFT_ALT_GR, 0x1A),               // §
+  UK_KEY(0x00A9, UK_SHIFT_ALT_GR, 0x06),               // ©
+  UK_KEY(0x00AA, UK_SHIFT, 0x35),                      // ª
+  UK_KEY(0x00AB, UK_ALT_GR, 0x1D),                     // «
+  UK_KEY(0x00AC, UK_ALT_GR, 0x23),                     // ¬
+  UK_KEY(0x00AE, UK_SHIFT_ALT_GR, 0x15),               // ®
+  UK_DEAD(0x00AF, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x2C), // ¯
+  UK_KEY(0x00B0, UK_SHIFT_ALT_GR, 0x27),               // °
+  UK_KEY(0x00B1, UK_SHIFT_ALT_GR, 0x26),               // ±
+  UK_DEAD(0x00B2, UK_SHIFT, 0x2F, UK_PLAIN, 0x1F),     // ²
+  UK_DEAD(0x00B3, UK_SHIFT, 0x2F, UK_PLAIN, 0x20),     // ³
+  UK_KEY(0x00B5, UK_ALT_GR, 0x10),                     // µ
+  UK_KEY(0x00B6, UK_ALT_GR, 0x15),                     // ¶
+  UK_KEY(0x00B7, UK_SHIFT, 0x20),                      // ·
+  UK_DEAD(0x00B8, UK_ALT_GR, 0x2E, UK_PLAIN, 0x2C),    // ¸
+  UK_DEAD(0x00B9, UK_SHIFT, 0x2F, UK_PLAIN, 0x1E),     // ¹
+  UK_KEY(0x00BA, UK_PLAIN, 0x35),                      // º
+  UK_KEY(0x00BB, UK_ALT_GR, 0x1B),                     // »
+  UK_KEY(0x00BD, UK_ALT_GR, 0x22),                     // ½
+  UK_KEY(0x00BF, UK_SHIFT_ALT_GR, 0x2D),               // ¿
+  UK_DEAD(0x00C0, UK_PLAIN, 0x2F, UK_SHIFT, 0x04),     // À
+  UK_DEAD(0x00C1, UK_PLAIN, 0x34, UK_SHIFT, 0x04),     // Á
+  UK_DEAD(0x00C2, UK_SHIFT, 0x2F, UK_SHIFT, 0x04),     // Â
+  UK_DEAD(0x00C3, UK_ALT_GR, 0x33, UK_SHIFT, 0x04),    // Ã
+  UK_DEAD(0x00C4, UK_SHIFT, 0x34, UK_SHIFT, 0x04),     // Ä
+  UK_DEAD(0x00C5, UK_SHIFT_ALT_GR, 0x2F, UK_SHIFT, 0x04), // Å
+  UK_KEY(0x00C6, UK_SHIFT_ALT_GR, 0x04),               // Æ
+  UK_KEY(0x00C7, UK_SHIFT, 0x31),                      // Ç
+  UK_DEAD(0x00C8, UK_PLAIN, 0x2F, UK_SHIFT, 0x08),     // È
+  UK_DEAD(0x00C9, UK_PLAIN, 0x34, UK_SHIFT, 0x08),     // É
+  UK_DEAD(0x00CA, UK_SHIFT, 0x2F, UK_SHIFT, 0x08),     // Ê
+  UK_DEAD(0x00CB, UK_SHIFT, 0x34, UK_SHIFT, 0x08),     // Ë
+  UK_DEAD(0x00CC, UK_PLAIN, 0x2F, UK_SHIFT, 0x0C),     // Ì
+  UK_DEAD(0x00CD, UK_PLAIN, 0x34, UK_SHIFT, 0x0C),     // Í
+  UK_DEAD(0x00CE, UK_SHIFT, 0x2F, UK_SHIFT, 0x0C),     // Î
+  UK_DEAD(0x00CF, UK_SHIFT, 0x34, UK_SHIFT, 0x0C),     // Ï
+  UK_KEY(0x00D0, UK_SHIFT_ALT_GR, 0x07),               // Ð
+  UK_KEY(0x00D1, UK_SHIFT, 0x33),                      // Ñ
+  UK_DEAD(0x00D2, UK_PLAIN, 0x2F, UK_SHIFT, 0x12),     // Ò
+  UK_DEAD(0x00D3, UK_PLAIN, 0x34, UK_SHIFT, 0x12),     // Ó
+  UK_DEAD(0x00D4, UK_SHIFT, 0x2F, UK_SHIFT, 0x12),     // Ô
+  UK_DEAD(0x00D5, UK_ALT_GR, 0x33, UK_SHIFT, 0x12),    // Õ
+  UK_DEAD(0x00D6, UK_SHIFT, 0x34, UK_SHIFT, 0x12),     // Ö
+  UK_KEY(0x00D7, UK_SHIFT_ALT_GR, 0x36),               // ×
+  UK_KEY(0x00D8, UK_SHIFT_ALT_GR, 0x12),               // Ø
+  UK_DEAD(0x00D9, UK_PLAIN, 0x2F, UK_SHIFT, 0x18),     // Ù
+  UK_DEAD(0x00DA, UK_PLAIN, 0x34, UK_SHIFT, 0x18),     // Ú
+  UK_DEAD(0x00DB, UK_SHIFT, 0x2F, UK_SHIFT, 0x18),     // Û
+  UK_DEAD(0x00DC, UK_SHIFT, 0x34, UK_SHIFT, 0x18),     // Ü
+  UK_DEAD(0x00DD, UK_PLAIN, 0x34, UK_SHIFT, 0x1C),     // Ý
+  UK_KEY(0x00DE, UK_SHIFT_ALT_GR, 0x13),               // Þ
+  UK_KEY(0x00DF, UK_ALT_GR, 0x16),                     // ß
+  UK_DEAD(0x00E0, UK_PLAIN, 0x2F, UK_PLAIN, 0x04),     // à
+  UK_DEAD(0x00E1, UK_PLAIN, 0x34, UK_PLAIN, 0x04),     // á
+  UK_DEAD(0x00E2, UK_SHIFT, 0x2F, UK_PLAIN, 0x04),     // â
+  UK_DEAD(0x00E3, UK_ALT_GR, 0x33, UK_PLAIN, 0x04),    // ã
+  UK_DEAD(0x00E4, UK_SHIFT, 0x34, UK_PLAIN, 0x04),     // ä
+  UK_DEAD(0x00E5, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x04), // å
+  UK_KEY(0x00E6, UK_ALT_GR, 0x04),                     // æ
+  UK_KEY(0x00E7, UK_PLAIN, 0x31),                      // ç
+  UK_DEAD(0x00E8, UK_PLAIN, 0x2F, UK_PLAIN, 0x08),     // è
+  UK_DEAD(0x00E9, UK_PLAIN, 0x34, UK_PLAIN, 0x08),     // é
+  UK_DEAD(0x00EA, UK_SHIFT, 0x2F, UK_PLAIN, 0x08),     // ê
+  UK_DEAD(0x00EB, UK_SHIFT, 0x34, UK_PLAIN, 0x08),     // ë
+  UK_DEAD(0x00EC, UK_PLAIN, 0x2F, UK_PLAIN, 0x0C),     // ì
+  UK_DEAD(0x00ED, UK_PLAIN, 0x34, UK_PLAIN, 0x0C),     // í
+  UK_DEAD(0x00EE, UK_SHIFT, 0x2F, UK_PLAIN, 0x0C),     // î
+  UK_DEAD(0x00EF, UK_SHIFT, 0x34, UK_PLAIN, 0x0C),     // ï
+  UK_KEY(0x00F0, UK_ALT_GR, 0x07),                     // ð
+  UK_KEY(0x00F1, UK_PLAIN, 0x33),                      // ñ
+  UK_DEAD(0x00F2, UK_PLAIN, 0x2F, UK_PLAIN, 0x12),     // ò
+  UK_DEAD(0x00F3, UK_PLAIN, 0x34, UK_PLAIN, 0x12),     // ó
+  UK_DEAD(0x00F4, UK_SHIFT, 0x2F, UK_PLAIN, 0x12),     // ô
+  UK_DEAD(0x00F5, UK_ALT_GR, 0x33, UK_PLAIN, 0x12),    // õ
+  UK_DEAD(0x00F6, UK_SHIFT, 0x34, UK_PLAIN, 0x12),     // ö
+  UK_KEY(0x00F7, UK_SHIFT_ALT_GR, 0x37),               // ÷
+  UK_KEY(0x00F8, UK_ALT_GR, 0x12),                     // ø
+  UK_DEAD(0x00F9, UK_PLAIN, 0x2F, UK_PLAIN, 0x18),     // ù
+  UK_DEAD(0x00FA, UK_PLAIN, 0x34, UK_PLAIN, 0x18),     // ú
+  UK_DEAD(0x00FB, UK_SHIFT, 0x2F, UK_PLAIN, 0x18),     // û
+  UK_DEAD(0x00FC, UK_SHIFT, 0x34, UK_PLAIN, 0x18),     // ü
+  UK_DEAD(0x00FD, UK_PLAIN, 0x34, UK_PLAIN, 0x1C),     // ý
+  UK_KEY(0x00FE, UK_ALT_GR, 0x13),                     // þ
+  UK_DEAD(0x00FF, UK_SHIFT, 0x34, UK_PLAIN, 0x1C),     // ÿ
+  UK_DEAD(0x0100, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x04), // Ā
+  UK_DEAD(0x0101, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x04), // ā
+  UK_DEAD(0x0102, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x04), // Ă
+  UK_DEAD(0x0103, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x04), // ă
+  UK_DEAD(0x0104, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x04), // Ą
+  UK_DEAD(0x0105, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x04), // ą
+  UK_DEAD(0x0106, UK_PLAIN, 0x34, UK_SHIFT, 0x06),     // Ć
+  UK_DEAD(0x0107, UK_PLAIN, 0x34, UK_PLAIN, 0x06),     // ć
+  UK_DEAD(0x0108, UK_SHIFT, 0x2F, UK_SHIFT, 0x06),     // Ĉ
+  UK_DEAD(0x0109, UK_SHIFT, 0x2F, UK_PLAIN, 0x06),     // ĉ
+  UK_DEAD(0x010A, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x06), // Ċ
+  UK_DEAD(0x010B, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x06), // ċ
+  UK_DEAD(0x010C, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x06), // Č
+  UK_DEAD(0x010D, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x06), // č
+  UK_DEAD(0x010E, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x07), // Ď
+  UK_DEAD(0x010F, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x07), // ď
+  UK_KEY(0x0111, UK_ALT_GR, 0x09),                     // đ
+  UK_DEAD(0x0112, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x08), // Ē
+  UK_DEAD(0x0113, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x08), // ē
+  UK_DEAD(0x0114, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x08), // Ĕ
+  UK_DEAD(0x0115, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x08), // ĕ
+  UK_DEAD(0x0116, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x08), // Ė
+  UK_DEAD(0x0117, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x08), // ė
+  UK_DEAD(0x0118, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x08), // Ę
+  UK_DEAD(0x0119, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x08), // ę
+  UK_DEAD(0x011A, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x08), // Ě
+  UK_DEAD(0x011B, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x08), // ě
+  UK_DEAD(0x011C, UK_SHIFT, 0x2F, UK_SHIFT, 0x0A),     // Ĝ
+  UK_DEAD(0x011D, UK_SHIFT, 0x2F, UK_PLAIN, 0x0A),     // ĝ
+  UK_DEAD(0x011E, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x0A), // Ğ
+  UK_DEAD(0x011F, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x0A), // ğ
+  UK_DEAD(0x0120, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x0A), // Ġ
+  UK_DEAD(0x0121, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x0A), // ġ
+  UK_DEAD(0x0122, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0A),    // Ģ
+  UK_DEAD(0x0123, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0A),    // ģ
+  UK_DEAD(0x0124, UK_SHIFT, 0x2F, UK_SHIFT, 0x0B),     // Ĥ
+  UK_DEAD(0x0125, UK_SHIFT, 0x2F, UK_PLAIN, 0x0B),     // ĥ
+  UK_KEY(0x0126, UK_SHIFT_ALT_GR, 0x0B),               // Ħ
+  UK_KEY(0x0127, UK_ALT_GR, 0x0B),                     // ħ
+  UK_DEAD(0x0128, UK_ALT_GR, 0x33, UK_SHIFT, 0x0C),    // Ĩ
+  UK_DEAD(0x0129, UK_ALT_GR, 0x33, UK_PLAIN, 0x0C),    // ĩ
+  UK_DEAD(0x012A, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0C), // Ī
+  UK_DEAD(0x012B, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0C), // ī
+  UK_DEAD(0x012C, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x0C), // Ĭ
+  UK_DEAD(0x012D, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x0C), // ĭ
+  UK_DEAD(0x012E, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x0C), // Į
+  UK_DEAD(0x012F, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x0C), // į
+  UK_DEAD(0x0130, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x0C), // İ
+  UK_KEY(0x0131, UK_SHIFT_ALT_GR, 0x0C),               // ı
+  UK_DEAD(0x0134, UK_SHIFT, 0x2F, UK_SHIFT, 0x0D),     // Ĵ
+  UK_DEAD(0x0135, UK_SHIFT, 0x2F, UK_PLAIN, 0x0D),     // ĵ
+  UK_DEAD(0x0136, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0E),    // Ķ
+  UK_DEAD(0x0137, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0E),    // ķ
+  UK_KEY(0x0138, UK_ALT_GR, 0x0E),                     // ĸ
+  UK_DEAD(0x0139, UK_PLAIN, 0x34, UK_SHIFT, 0x0F),     // Ĺ
+  UK_DEAD(0x013A, UK_PLAIN, 0x34, UK_PLAIN, 0x0F),     // ĺ
+  UK_DEAD(0x013B, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0F),    // Ļ
+  UK_DEAD(0x013C, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0F),    // ļ
+  UK_DEAD(0x013D, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0F), // Ľ
+  UK_DEAD(0x013E, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0F), // ľ
+  UK_DEAD(0x013F, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x0F), // Ŀ
+  UK_DEAD(0x0140, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x0F), // ŀ
+  UK_KEY(0x0141, UK_SHIFT_ALT_GR, 0x0F),               // Ł
+  UK_KEY(0x0142, UK_ALT_GR, 0x0F),                     // ł
+  UK_DEAD(0x0143, UK_PLAIN, 0x34, UK_SHIFT, 0x11),     // Ń
+  UK_DEAD(0x0144, UK_PLAIN, 0x34, UK_PLAIN, 0x11),     // ń
+  UK_DEAD(0x0145, UK_ALT_GR, 0x2E, UK_SHIFT, 0x11),    // Ņ
+  UK_DEAD(0x0146, UK_ALT_GR, 0x2E, UK_PLAIN, 0x11),    // ņ
+  UK_DEAD(0x0147, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x11), // Ň
+  UK_DEAD(0x0148, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x11), // ň
+  UK_KEY(0x014A, UK_SHIFT_ALT_GR, 0x0A),               // Ŋ
+  UK_KEY(0x014B, UK_ALT_GR, 0x0A),                     // ŋ
+  UK_DEAD(0x014C, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x12), // Ō
+  UK_DEAD(0x014D, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x12), // ō
+  UK_DEAD(0x014E, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x12), // Ŏ
+  UK_DEAD(0x014F, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x12), // ŏ
+  UK_DEAD(0x0150, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x12), // Ő
+  UK_DEAD(0x0151, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x12), // ő
+  UK_DEAD(0x0154, UK_PLAIN, 0x34, UK_SHIFT, 0x15),     // Ŕ
+  UK_DEAD(0x0155, UK_PLAIN, 0x34, UK_PLAIN, 0x15),     // ŕ
+  UK_DEAD(0x0156, UK_ALT_GR, 0x2E, UK_SHIFT, 0x15),    // Ŗ
+  UK_DEAD(0x0157, UK_ALT_GR, 0x2E, UK_PLAIN, 0x15),    // ŗ
+  UK_DEAD(0x0158, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x15), // Ř
+  UK_DEAD(0x0159, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x15), // ř
+  UK_DEAD(0x015A, UK_PLAIN, 0x34, UK_SHIFT, 0x16),     // Ś
+  UK_DEAD(0x015B, UK_PLAIN, 0x34, UK_PLAIN, 0x16),     // ś
+  UK_DEAD(0x015C, UK_SHIFT, 0x2F, UK_SHIFT, 0x16),     // Ŝ
+  UK_DEAD(0x015D, UK_SHIFT, 0x2F, UK_PLAIN, 0x16),     // ŝ
+  UK_DEAD(0x015E, UK_ALT_GR, 0x2E, UK_SHIFT, 0x16),    // Ş
+  UK_DEAD(0x015F, UK_ALT_GR, 0x2E, UK_PLAIN, 0x16),    // ş
+  UK_DEAD(0x0160, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x16), // Š
+  UK_DEAD(0x0161, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x16), // š
+  UK_DEAD(0x0162, UK_ALT_GR, 0x2E, UK_SHIFT, 0x17),    // Ţ
+  UK_DEAD(0x0163, UK_ALT_GR, 0x2E, UK_PLAIN, 0x17),    // ţ
+  UK_DEAD(0x0164, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x17), // Ť
+  UK_DEAD(0x0165, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x17), // ť
+  UK_KEY(0x0166, UK_SHIFT_ALT_GR, 0x17),               // Ŧ
+  UK_KEY(0x0167, UK_ALT_GR, 0x17),                     // ŧ
+  UK_DEAD(0x0168, UK_ALT_GR, 0x33, UK_SHIFT, 0x18),    // Ũ
+  UK_DEAD(0x0169, UK_ALT_GR, 0x33, UK_PLAIN, 0x18),    // ũ
+  UK_DEAD(0x016A, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x18), // Ū
+  UK_DEAD(0x016B, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x18), // ū
+  UK_DEAD(0x016C, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x18), // Ŭ
+  UK_DEAD(0x016D, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x18), // ŭ
+  UK_DEAD(0x016E, UK_SHIFT_ALT_GR, 0x2F, UK_SHIFT, 0x18), // Ů
+  UK_DEAD(0x016F, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x18), // ů
+  UK_DEAD(0x0170, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x18), // Ű
+  UK_DEAD(0x0171, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x18), // ű
+  UK_DEAD(0x0172, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x18), // Ų
+  UK_DEAD(0x0173, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x18), // ų
+  UK_DEAD(0x0174, UK_SHIFT, 0x2F, UK_SHIFT, 0x1A),     // Ŵ
+  UK_DEAD(0x0175, UK_SHIFT, 0x2F, UK_PLAIN, 0x1A),     // ŵ
+  UK_DEAD(0x0176, UK_SHIFT, 0x2F, UK_SHIFT, 0x1C),     // Ŷ
+  UK_DEAD(0x0177, UK_SHIFT, 0x2F, UK_PLAIN, 0x1C),     // ŷ
+  UK_DEAD(0x0178, UK_SHIFT, 0x34, UK_SHIFT, 0x1C),     // Ÿ
+  UK_DEAD(0x0179, UK_PLAIN, 0x34, UK_SHIFT, 0x1D),     // Ź
+  UK_DEAD(0x017A, UK_PLAIN, 0x34, UK_PLAIN, 0x1D),     // ź
+  UK_DEAD(0x017B, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x1D), // Ż
+  UK_DEAD(0x017C, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x1D), // ż
+  UK_DEAD(0x017D, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x1D), // Ž
+  UK_DEAD(0x017E, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x1D), // ž
+  UK_KEY(0x017F, UK_ALT_GR, 0x1A),                     // ſ
+  UK_DEAD(0x0181, UK_ALT_GR, 0x0D, UK_SHIFT, 0x05),    // Ɓ
+  UK_DEAD(0x0187, UK_ALT_GR, 0x0D, UK_SHIFT, 0x06),    // Ƈ
+  UK_DEAD(0x0188, UK_ALT_GR, 0x0D, UK_PLAIN, 0x06),    // ƈ
+  UK_DEAD(0x018A, UK_ALT_GR, 0x0D, UK_SHIFT, 0x07),    // Ɗ
+  UK_DEAD(0x0191, UK_ALT_GR, 0x0D, UK_SHIFT, 0x09),    // Ƒ
+  UK_DEAD(0x0192, UK_ALT_GR, 0x0D, UK_PLAIN, 0x09),    // ƒ
+  UK_DEAD(0x0193, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0A),    // Ɠ
+  UK_DEAD(0x0198, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0E),    // Ƙ
+  UK_DEAD(0x0199, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0E),    // ƙ
+  UK_DEAD(0x019D, UK_ALT_GR, 0x0D, UK_SHIFT, 0x11),    // Ɲ
+  UK_DEAD(0x01A0, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x12), // Ơ
+  UK_DEAD(0x01A1, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x12), // ơ
+  UK_DEAD(0x01A4, UK_ALT_GR, 0x0D, UK_SHIFT, 0x13),    // Ƥ
+  UK_DEAD(0x01A5, UK_ALT_GR, 0x0D, UK_PLAIN, 0x13),    // ƥ
+  UK_DEAD(0x01AC, UK_ALT_GR, 0x0D, UK_SHIFT, 0x17),    // Ƭ
+  UK_DEAD(0x01AD, UK_ALT_GR, 0x0D, UK_PLAIN, 0x17),    // ƭ
+  UK_DEAD(0x01AF, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x18), // Ư
+  UK_DEAD(0x01B0, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x18), // ư
+  UK_DEAD(0x01B2, UK_ALT_GR, 0x0D, UK_SHIFT, 0x19),    // Ʋ
+  UK_DEAD(0x01CD, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x04), // Ǎ
+  UK_DEAD(0x01CE, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x04), // ǎ
+  UK_DEAD(0x01CF, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0C), // Ǐ
+  UK_DEAD(0x01D0, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0C), // ǐ
+  UK_DEAD(0x01D1, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x12), // Ǒ
+  UK_DEAD(0x01D2, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x12), // ǒ
+  UK_DEAD(0x01D3, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x18), // Ǔ
+  UK_DEAD(0x01D4, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x18), // ǔ
+  UK_DEAD(0x01D5, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x19), // Ǖ
+  UK_DEAD(0x01D6, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x19), // ǖ
+  UK_DEAD(0x01D7, UK_PLAIN, 0x34, UK_SHIFT, 0x19),     // Ǘ
+  UK_DEAD(0x01D8, UK_PLAIN, 0x34, UK_PLAIN, 0x19),     // ǘ
+  UK_DEAD(0x01D9, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x19), // Ǚ
+  UK_DEAD(0x01DA, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x19), // ǚ
+  UK_DEAD(0x01DB, UK_PLAIN, 0x2F, UK_SHIFT, 0x19),     // Ǜ
+  UK_DEAD(0x01DC, UK_PLAIN, 0x2F, UK_PLAIN, 0x19),     // ǜ
+  UK_DEAD(0x01E2, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT_ALT_GR, 0x04), // Ǣ
+  UK_DEAD(0x01E3, UK_SHIFT_ALT_GR, 0x30, UK_ALT_GR, 0x04), // ǣ
+  UK_DEAD(0x01E6, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0A), // Ǧ
+  UK_DEAD(0x01E7, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0A), // ǧ
+  UK_DEAD(0x01E8, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0E), // Ǩ
+  UK_DEAD(0x01E9, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0E), // ǩ
+  UK_DEAD(0x01EA, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x12), // Ǫ
+  UK_DEAD(0x01EB, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x12), // ǫ
+  UK_DEAD(0x01F0, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0D), // ǰ
+  UK_DEAD(0x01F4, UK_PLAIN, 0x34, UK_SHIFT, 0x0A),     // Ǵ
+  UK_DEAD(0x01F5, UK_PLAIN, 0x34, UK_PLAIN, 0x0A),     // ǵ
+  UK_DEAD(0x01F8, UK_PLAIN, 0x2F, UK_SHIFT, 0x11),     // Ǹ
+  UK_DEAD(0x01F9, UK_PLAIN, 0x2F, UK_PLAIN, 0x11),     // ǹ
+  UK_DEAD(0x01FC, UK_PLAIN, 0x34, UK_SHIFT_ALT_GR, 0x04), // Ǽ
+  UK_DEAD(0x01FD, UK_PLAIN, 0x34, UK_ALT_GR, 0x04),    // ǽ
+  UK_DEAD(0x01FE, UK_PLAIN, 0x34, UK_SHIFT_ALT_GR, 0x12), // Ǿ
+  UK_DEAD(0x01FF, UK_PLAIN, 0x34, UK_ALT_GR, 0x12),    // ǿ
+  UK_DEAD(0x021E, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0B), // Ȟ
+  UK_DEAD(0x021F, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0B), // ȟ
+  UK_DEAD(0x0224, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1D),    // Ȥ
+  UK_DEAD(0x0225, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1D),    // ȥ
+  UK_DEAD(0x0226, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x04), // Ȧ
+  UK_DEAD(0x0227, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x04), // ȧ
+  UK_DEAD(0x0228, UK_ALT_GR, 0x2E, UK_SHIFT, 0x08),    // Ȩ
+  UK_DEAD(0x0229, UK_ALT_GR, 0x2E, UK_PLAIN, 0x08),    // ȩ
+  UK_DEAD(0x022E, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x12), // Ȯ
+  UK_DEAD(0x022F, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x12), // ȯ
+  UK_DEAD(0x0232, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x1C), // Ȳ
+  UK_DEAD(0x0233, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x1C), // ȳ
+  UK_DEAD(0x0237, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x0D), // ȷ
+  UK_DEAD(0x0253, UK_ALT_GR, 0x0D, UK_PLAIN, 0x05),    // ɓ
+  UK_DEAD(0x0257, UK_ALT_GR, 0x0D, UK_PLAIN, 0x07),    // ɗ
+  UK_DEAD(0x0260, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0A),    // ɠ
+  UK_DEAD(0x0266, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0B),    // ɦ
+  UK_DEAD(0x0271, UK_ALT_GR, 0x0D, UK_PLAIN, 0x10),    // ɱ
+  UK_DEAD(0x0272, UK_ALT_GR, 0x0D, UK_PLAIN, 0x11),    // ɲ
+  UK_DEAD(0x027C, UK_ALT_GR, 0x0D, UK_PLAIN, 0x15),    // ɼ
+  UK_DEAD(0x0282, UK_ALT_GR, 0x0D, UK_PLAIN, 0x16),    // ʂ
+  UK_DEAD(0x028B, UK_ALT_GR, 0x0D, UK_PLAIN, 0x19),    // ʋ
+  UK_DEAD(0x02A0, UK_ALT_GR, 0x0D, UK_PLAIN, 0x14),    // ʠ
+  UK_DEAD(0x02C7, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x2C), // ˇ
+  UK_DEAD(0x02D8, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x2C), // ˘
+  UK_DEAD(0x02D9, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x2C), // ˙
+  UK_DEAD(0x02DB, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x2C), // ˛
+  UK_DEAD(0x02DD, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x2C), // ˝
+  UK_DEAD(0x0309, UK_ALT_GR, 0x0D, UK_PLAIN, 0x2C),    // ̉
+  UK_DEAD(0x031B, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x2C), // ̛
+  UK_DEAD(0x0323, UK_ALT_GR, 0x38, UK_PLAIN, 0x2C),    // ̣
+  UK_DEAD(0x0344, UK_SHIFT, 0x34, UK_PLAIN, 0x2D),     // ̈́
+  UK_DEAD(0x038F, UK_PLAIN, 0x34, UK_SHIFT_ALT_GR, 0x14), // Ώ
+  UK_KEY(0x03A9, UK_SHIFT_ALT_GR, 0x14),               // Ω
+  UK_DEAD(0x1E02, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x05), // Ḃ
+  UK_DEAD(0x1E03, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x05), // ḃ
+  UK_DEAD(0x1E04, UK_ALT_GR, 0x38, UK_SHIFT, 0x05),    // Ḅ
+  UK_DEAD(0x1E05, UK_ALT_GR, 0x38, UK_PLAIN, 0x05),    // ḅ
+  UK_DEAD(0x1E08, UK_PLAIN, 0x34, UK_SHIFT, 0x31),     // Ḉ
+  UK_DEAD(0x1E09, UK_PLAIN, 0x34, UK_PLAIN, 0x31),     // ḉ
+  UK_DEAD(0x1E0A, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x07), // Ḋ
+  UK_DEAD(0x1E0B, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x07), // ḋ
+  UK_DEAD(0x1E0C, UK_ALT_GR, 0x38, UK_SHIFT, 0x07),    // Ḍ
+  UK_DEAD(0x1E0D, UK_ALT_GR, 0x38, UK_PLAIN, 0x07),    // ḍ
+  UK_DEAD(0x1E10, UK_ALT_GR, 0x2E, UK_SHIFT, 0x07),    // Ḑ
+  UK_DEAD(0x1E11, UK_ALT_GR, 0x2E, UK_PLAIN, 0x07),    // ḑ
+  UK_DEAD(0x1E1E, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x09), // Ḟ
+  UK_DEAD(0x1E1F, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x09), // ḟ
+  UK_DEAD(0x1E20, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0A), // Ḡ
+  UK_DEAD(0x1E21, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0A), // ḡ
+  UK_DEAD(0x1E22, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x0B), // Ḣ
+  UK_DEAD(0x1E23, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x0B), // ḣ
+  UK_DEAD(0x1E24, UK_ALT_GR, 0x38, UK_SHIFT, 0x0B),    // Ḥ
+  UK_DEAD(0x1E25, UK_ALT_GR, 0x38, UK_PLAIN, 0x0B),    // ḥ
+  UK_DEAD(0x1E26, UK_SHIFT, 0x34, UK_SHIFT, 0x0B),     // Ḧ
+  UK_DEAD(0x1E27, UK_SHIFT, 0x34, UK_PLAIN, 0x0B),     // ḧ
+  UK_DEAD(0x1E28, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0B),    // Ḩ
+  UK_DEAD(0x1E29, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0B),    // ḩ
+  UK_DEAD(0x1E30, UK_PLAIN, 0x34, UK_SHIFT, 0x0E),     // Ḱ
+  UK_DEAD(0x1E31, UK_PLAIN, 0x34, UK_PLAIN, 0x0E),     // ḱ
+  UK_DEAD(0x1E32, UK_ALT_GR, 0x38, UK_SHIFT, 0x0E),    // Ḳ
+  UK_DEAD(0x1E33, UK_ALT_GR, 0x38, UK_PLAIN, 0x0E),    // ḳ
+  UK_DEAD(0x1E36, UK_ALT_GR, 0x38, UK_SHIFT, 0x0F),    // Ḷ
+  UK_DEAD(0x1E37, UK_ALT_GR, 0x38, UK_PLAIN, 0x0F),    // ḷ
+  UK_DEAD(0x1E3E, UK_PLAIN, 0x34, UK_SHIFT, 0x10),     // Ḿ
+  UK_DEAD(0x1E3F, UK_PLAIN, 0x34, UK_PLAIN, 0x10),     // ḿ
+  UK_DEAD(0x1E40, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x10), // Ṁ
+  UK_DEAD(0x1E41, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x10), // ṁ
+  UK_DEAD(0x1E42, UK_ALT_GR, 0x38, UK_SHIFT, 0x10),    // Ṃ
+  UK_DEAD(0x1E43, UK_ALT_GR, 0x38, UK_PLAIN, 0x10),    // ṃ
+  UK_DEAD(0x1E44, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x11), // Ṅ
+  UK_DEAD(0x1E45, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x11), // ṅ
+  UK_DEAD(0x1E46, UK_ALT_GR, 0x38, UK_SHIFT, 0x11),    // Ṇ
+  UK_DEAD(0x1E47, UK_ALT_GR, 0x38, UK_PLAIN, 0x11),    // ṇ
+  UK_DEAD(0x1E54, UK_PLAIN, 0x34, UK_SHIFT, 0x13),     // Ṕ
+  UK_DEAD(0x1E55, UK_PLAIN, 0x34, UK_PLAIN, 0x13),     // ṕ
+  UK_DEAD(0x1E56, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x13), // Ṗ
+  UK_DEAD(0x1E57, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x13), // ṗ
+  UK_DEAD(0x1E58, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x15), // Ṙ
+  UK_DEAD(0x1E59, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x15), // ṙ
+  UK_DEAD(0x1E5A, UK_ALT_GR, 0x38, UK_SHIFT, 0x15),    // Ṛ
+  UK_DEAD(0x1E5B, UK_ALT_GR, 0x38, UK_PLAIN, 0x15),    // ṛ
+  UK_DEAD(0x1E60, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x16), // Ṡ
+  UK_DEAD(0x1E61, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x16), // ṡ
+  UK_DEAD(0x1E62, UK_ALT_GR, 0x38, UK_SHIFT, 0x16),    // Ṣ
+  UK_DEAD(0x1E63, UK_ALT_GR, 0x38, UK_PLAIN, 0x16),    // ṣ
+  UK_DEAD(0x1E6A, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x17), // Ṫ
+  UK_DEAD(0x1E6B, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x17), // ṫ
+  UK_DEAD(0x1E6C, UK_ALT_GR, 0x38, UK_SHIFT, 0x17),    // Ṭ
+  UK_DEAD(0x1E6D, UK_ALT_GR, 0x38, UK_PLAIN, 0x17),    // ṭ
+  UK_DEAD(0x1E7C, UK_ALT_GR, 0x33, UK_SHIFT, 0x19),    // Ṽ
+  UK_DEAD(0x1E7D, UK_ALT_GR, 0x33, UK_PLAIN, 0x19),    // ṽ
+  UK_DEAD(0x1E7E, UK_ALT_GR, 0x38, UK_SHIFT, 0x19),    // Ṿ
+  UK_DEAD(0x1E7F, UK_ALT_GR, 0x38, UK_PLAIN, 0x19),    // ṿ
+  UK_DEAD(0x1E80, UK_PLAIN, 0x2F, UK_SHIFT, 0x1A),     // Ẁ
+  UK_DEAD(0x1E81, UK_PLAIN, 0x2F, UK_PLAIN, 0x1A),     // ẁ
+  UK_DEAD(0x1E82, UK_PLAIN, 0x34, UK_SHIFT, 0x1A),     // Ẃ
+  UK_DEAD(0x1E83, UK_PLAIN, 0x34, UK_PLAIN, 0x1A),     // ẃ
+  UK_DEAD(0x1E84, UK_SHIFT, 0x34, UK_SHIFT, 0x1A),     // Ẅ
+  UK_DEAD(0x1E85, UK_SHIFT, 0x34, UK_PLAIN, 0x1A),     // ẅ
+  UK_DEAD(0x1E86, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x1A), // Ẇ
+  UK_DEAD(0x1E87, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x1A), // ẇ
+  UK_DEAD(0x1E88, UK_ALT_GR, 0x38, UK_SHIFT, 0x1A),    // Ẉ
+  UK_DEAD(0x1E89, UK_ALT_GR, 0x38, UK_PLAIN, 0x1A),    // ẉ
+  UK_DEAD(0x1E8A, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x1B), // Ẋ
+  UK_DEAD(0x1E8B, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x1B), // ẋ
+  UK_DEAD(0x1E8C, UK_SHIFT, 0x34, UK_SHIFT, 0x1B),     // Ẍ
+  UK_DEAD(0x1E8D, UK_SHIFT, 0x34, UK_PLAIN, 0x1B),     // ẍ
+  UK_DEAD(0x1E8E, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x1C), // Ẏ
+  UK_DEAD(0x1E8F, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x1C), // ẏ
+  UK_DEAD(0x1E90, UK_SHIFT, 0x2F, UK_SHIFT, 0x1D),     // Ẑ
+  UK_DEAD(0x1E91, UK_SHIFT, 0x2F, UK_PLAIN, 0x1D),     // ẑ
+  UK_DEAD(0x1E92, UK_ALT_GR, 0x38, UK_SHIFT, 0x1D),    // Ẓ
+  UK_DEAD(0x1E93, UK_ALT_GR, 0x38, UK_PLAIN, 0x1D),    // ẓ
+  UK_DEAD(0x1E97, UK_SHIFT, 0x34, UK_PLAIN, 0x17),     // ẗ
+  UK_DEAD(0x1E98, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x1A), // ẘ
+  UK_DEAD(0x1E99, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x1C), // ẙ
+  UK_DEAD(0x1E9B, UK_SHIFT_ALT_GR, 0x38, UK_ALT_GR, 0x1A), // ẛ
+  UK_KEY(0x1E9E, UK_SHIFT_ALT_GR, 0x16),               // ẞ
+  UK_DEAD(0x1EA0, UK_ALT_GR, 0x38, UK_SHIFT, 0x04),    // Ạ
+  UK_DEAD(0x1EA1, UK_ALT_GR, 0x38, UK_PLAIN, 0x04),    // ạ
+  UK_DEAD(0x1EA2, UK_ALT_GR, 0x0D, UK_SHIFT, 0x04),    // Ả
+  UK_DEAD(0x1EA3, UK_ALT_GR, 0x0D, UK_PLAIN, 0x04),    // ả
+  UK_DEAD(0x1EB8, UK_ALT_GR, 0x38, UK_SHIFT, 0x08),    // Ẹ
+  UK_DEAD(0x1EB9, UK_ALT_GR, 0x38, UK_PLAIN, 0x08),    // ẹ
+  UK_DEAD(0x1EBA, UK_ALT_GR, 0x0D, UK_SHIFT, 0x08),    // Ẻ
+  UK_DEAD(0x1EBB, UK_ALT_GR, 0x0D, UK_PLAIN, 0x08),    // ẻ
+  UK_DEAD(0x1EBC, UK_ALT_GR, 0x33, UK_SHIFT, 0x08),    // Ẽ
+  UK_DEAD(0x1EBD, UK_ALT_GR, 0x33, UK_PLAIN, 0x08),    // ẽ
+  UK_DEAD(0x1EC8, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0C),    // Ỉ
+  UK_DEAD(0x1EC9, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0C),    // ỉ
+  UK_DEAD(0x1ECA, UK_ALT_GR, 0x38, UK_SHIFT, 0x0C),    // Ị
+  UK_DEAD(0x1ECB, UK_ALT_GR, 0x38, UK_PLAIN, 0x0C),    // ị
+  UK_DEAD(0x1ECC, UK_ALT_GR, 0x38, UK_SHIFT, 0x12),    // Ọ
+  UK_DEAD(0x1ECD, UK_ALT_GR, 0x38, UK_PLAIN, 0x12),    // ọ
+  UK_DEAD(0x1ECE, UK_ALT_GR, 0x0D, UK_SHIFT, 0x12),    // Ỏ
+  UK_DEAD(0x1ECF, UK_ALT_GR, 0x0D, UK_PLAIN, 0x12),    // ỏ
+  UK_DEAD(0x1EE4, UK_ALT_GR, 0x38, UK_SHIFT, 0x18),    // Ụ
+  UK_DEAD(0x1EE5, UK_ALT_GR, 0x38, UK_PLAIN, 0x18),    // ụ
+  UK_DEAD(0x1EE6, UK_ALT_GR, 0x0D, UK_SHIFT, 0x18),    // Ủ
+  UK_DEAD(0x1EE7, UK_ALT_GR, 0x0D, UK_PLAIN, 0x18),    // ủ
+  UK_DEAD(0x1EF2, UK_PLAIN, 0x2F, UK_SHIFT, 0x1C),     // Ỳ
+  UK_DEAD(0x1EF3, UK_PLAIN, 0x2F, UK_PLAIN, 0x1C),     // ỳ
+  UK_DEAD(0x1EF4, UK_ALT_GR, 0x38, UK_SHIFT, 0x1C),    // Ỵ
+  UK_DEAD(0x1EF5, UK_ALT_GR, 0x38, UK_PLAIN, 0x1C),    // ỵ
+  UK_DEAD(0x1EF6, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1C),    // Ỷ
+  UK_DEAD(0x1EF7, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1C),    // ỷ
+  UK_DEAD(0x1EF8, UK_ALT_GR, 0x33, UK_SHIFT, 0x1C),    // Ỹ
+  UK_DEAD(0x1EF9, UK_ALT_GR, 0x33, UK_PLAIN, 0x1C),    // ỹ
+  UK_DEAD(0x1FFA, UK_PLAIN, 0x2F, UK_SHIFT_ALT_GR, 0x14), // Ὼ
+  UK_KEY(0x2018, UK_SHIFT_ALT_GR, 0x05),               // ‘
+  UK_KEY(0x2019, UK_SHIFT_ALT_GR, 0x11),               // ’
+  UK_KEY(0x201A, UK_SHIFT_ALT_GR, 0x19),               // ‚
+  UK_KEY(0x201C, UK_ALT_GR, 0x05),                     // “
+  UK_KEY(0x201D, UK_ALT_GR, 0x11),                     // ”
+  UK_KEY(0x201E, UK_ALT_GR, 0x19),                     // „
+  UK_KEY(0x2022, UK_ALT_GR, 0x36),                     // •
+  UK_DEAD(0x2070, UK_SHIFT, 0x2F, UK_PLAIN, 0x27),     // ⁰
+  UK_DEAD(0x2074, UK_SHIFT, 0x2F, UK_PLAIN, 0x21),     // ⁴
+  UK_DEAD(0x2075, UK_SHIFT, 0x2F, UK_PLAIN, 0x22),     // ⁵
+  UK_DEAD(0x2076, UK_SHIFT, 0x2F, UK_PLAIN, 0x23),     // ⁶
+  UK_DEAD(0x2077, UK_SHIFT, 0x2F, UK_PLAIN, 0x24),     // ⁷
+  UK_DEAD(0x2078, UK_SHIFT, 0x2F, UK_PLAIN, 0x25),     // ⁸
+  UK_DEAD(0x2079, UK_SHIFT, 0x2F, UK_PLAIN, 0x26),     // ⁹
+  UK_DEAD(0x207A, UK_SHIFT, 0x2F, UK_PLAIN, 0x30),     // ⁺
+  UK_DEAD(0x207B, UK_SHIFT, 0x2F, UK_PLAIN, 0x38),     // ⁻
+  UK_DEAD(0x207C, UK_SHIFT, 0x2F, UK_SHIFT, 0x27),     // ⁼
+  UK_DEAD(0x207D, UK_SHIFT, 0x2F, UK_SHIFT, 0x25),     // ⁽
+  UK_DEAD(0x207E, UK_SHIFT, 0x2F, UK_SHIFT, 0x26),     // ⁾
+  UK_DEAD(0x2080, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x27), // ₀
+  UK_DEAD(0x2081, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x1E), // ₁
+  UK_DEAD(0x2082, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x1F), // ₂
+  UK_DEAD(0x2083, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x20), // ₃
+  UK_DEAD(0x2084, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x21), // ₄
+  UK_DEAD(0x2085, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x22), // ₅
+  UK_DEAD(0x2086, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x23), // ₆
+  UK_DEAD(0x2087, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x24), // ₇
+  UK_DEAD(0x2088, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x25), // ₈
+  UK_DEAD(0x2089, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x26), // ₉
+  UK_DEAD(0x208A, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x30), // ₊
+  UK_DEAD(0x208B, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x38), // ₋
+  UK_DEAD(0x208C, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x27), // ₌
+  UK_DEAD(0x208D, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x25), // ₍
+  UK_DEAD(0x208E, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x26), // ₎
+  UK_KEY(0x20AC, UK_ALT_GR, 0x08),                     // €
+  UK_DEAD(0x20B5, UK_ALT_GR, 0x2E, UK_SHIFT_ALT_GR, 0x08), // ₵
+  UK_KEY(0x2122, UK_SHIFT_ALT_GR, 0x25),               // ™
+  UK_KEY(0x215B, UK_SHIFT_ALT_GR, 0x1F),               // ⅛
+  UK_KEY(0x215C, UK_SHIFT_ALT_GR, 0x22),               // ⅜
+  UK_KEY(0x215D, UK_SHIFT_ALT_GR, 0x23),               // ⅝
+  UK_KEY(0x215E, UK_SHIFT_ALT_GR, 0x24),               // ⅞
+  UK_KEY(0x2190, UK_ALT_GR, 0x1C),                     // ←
+  UK_KEY(0x2191, UK_SHIFT_ALT_GR, 0x18),               // ↑
+  UK_KEY(0x2192, UK_ALT_GR, 0x0C),                     // →
+  UK_KEY(0x2193, UK_ALT_GR, 0x18),                     // ↓
+  UK_DEAD(0x2243, UK_ALT_GR, 0x33, UK_SHIFT, 0x27),    // ≃
+  UK_DEAD(0x2272, UK_ALT_GR, 0x33, UK_PLAIN, 0x64),    // ≲
+  UK_DEAD(0x2273, UK_ALT_GR, 0x33, UK_SHIFT, 0x64),    // ≳
+  UK_DEAD(0x2A25, UK_ALT_GR, 0x38, UK_PLAIN, 0x30),    // ⨥
+  UK_DEAD(0x2A2A, UK_ALT_GR, 0x38, UK_PLAIN, 0x38),    // ⨪
+  UK_DEAD(0x2A66, UK_ALT_GR, 0x38, UK_SHIFT, 0x27),    // ⩦
+  UK_DEAD(0x2C6E, UK_ALT_GR, 0x0D, UK_SHIFT, 0x10),    // Ɱ
+  UK_DEAD(0x2C72, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1A),    // Ⱳ
+  UK_DEAD(0x2C73, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1A),    // ⱳ
+};
+#define UNICODE_KEYS_es_ES UnicodeKeys_es_ES, UNICODE_KEY_COUNT(UnicodeKeys_es_ES)
+
+// fr_FR (XKB "fr"): 429 characters, 361 of them after a dead key
+static const UnicodeKeyEntry UnicodeKeys_fr_FR[] = {
+  UK_KEY(0x00A1, UK_SHIFT_ALT_GR, 0x1E),               // ¡
+  UK_KEY(0x00A2, UK_SHIFT_ALT_GR, 0x08),               // ¢
+  UK_KEY(0x00A3, UK_SHIFT_ALT_GR, 0x20),               // £
+  UK_KEY(0x00A4, UK_ALT_GR, 0x30),                     // ¤
+  UK_KEY(0x00A5, UK_SHIFT_ALT_GR, 0x1C),               // ¥
+  UK_KEY(0x00A6, UK_SHIFT_ALT_GR, 0x64),               // ¦
+  UK_KEY(0x00A7, UK_SHIFT, 0x38),                      // §
+  UK_KEY(0x00A9, UK_SHIFT_ALT_GR, 0x06),               // ©
+  UK_KEY(0x00AA, UK_SHIFT_ALT_GR, 0x09),               // ª
+  UK_KEY(0x00AB, UK_ALT_GR, 0x1A),                     // «
+  UK_KEY(0x00AC, UK_ALT_GR, 0x35),                     // ¬
+  UK_KEY(0x00AE, UK_SHIFT_ALT_GR, 0x15),               // ®
+  UK_DEAD(0x00AF, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x2C), // ¯
+  UK_KEY(0x00B0, UK_SHIFT_ALT_GR, 0x27),               // °
+  UK_KEY(0x00B1, UK_SHIFT_ALT_GR, 0x26),               // ±
+  UK_KEY(0x00B2, UK_PLAIN, 0x35),                      // ²
+  UK_DEAD(0x00B3, UK_PLAIN, 0x2F, UK_SHIFT, 0x20),     // ³
+  UK_KEY(0x00B5, UK_SHIFT, 0x31),                      // µ
+  UK_KEY(0x00B6, UK_ALT_GR, 0x15),                     // ¶
+  UK_KEY(0x00B7, UK_ALT_GR, 0x37),                     // ·
+  UK_KEY(0x00B9, UK_ALT_GR, 0x1E),                     // ¹
+  UK_KEY(0x00BA, UK_SHIFT_ALT_GR, 0x33),               // º
+  UK_KEY(0x00BB, UK_ALT_GR, 0x1B),                     // »
+  UK_KEY(0x00BF, UK_SHIFT_ALT_GR, 0x2D),               // ¿
+  UK_DEAD(0x00C0, UK_ALT_GR, 0x31, UK_SHIFT, 0x14),    // À
+  UK_DEAD(0x00C1, UK_ALT_GR, 0x10, UK_SHIFT, 0x14),    // Á
+  UK_DEAD(0x00C2, UK_PLAIN, 0x2F, UK_SHIFT, 0x14),     // Â
+  UK_DEAD(0x00C4, UK_SHIFT, 0x2F, UK_SHIFT, 0x14),     // Ä
+  UK_DEAD(0x00C5, UK_SHIFT_ALT_GR, 0x2F, UK_SHIFT, 0x14), // Å
+  UK_KEY(0x00C6, UK_SHIFT_ALT_GR, 0x14),               // Æ
+  UK_DEAD(0x00C8, UK_ALT_GR, 0x31, UK_SHIFT, 0x08),    // È
+  UK_DEAD(0x00C9, UK_ALT_GR, 0x10, UK_SHIFT, 0x08),    // É
+  UK_DEAD(0x00CA, UK_PLAIN, 0x2F, UK_SHIFT, 0x08),     // Ê
+  UK_DEAD(0x00CB, UK_SHIFT, 0x2F, UK_SHIFT, 0x08),     // Ë
+  UK_DEAD(0x00CC, UK_ALT_GR, 0x31, UK_SHIFT, 0x0C),    // Ì
+  UK_DEAD(0x00CD, UK_ALT_GR, 0x10, UK_SHIFT, 0x0C),    // Í
+  UK_DEAD(0x00CE, UK_PLAIN, 0x2F, UK_SHIFT, 0x0C),     // Î
+  UK_DEAD(0x00CF, UK_SHIFT, 0x2F, UK_SHIFT, 0x0C),     // Ï
+  UK_KEY(0x00D0, UK_SHIFT_ALT_GR, 0x07),               // Ð
+  UK_DEAD(0x00D2, UK_ALT_GR, 0x31, UK_SHIFT, 0x12),    // Ò
+  UK_DEAD(0x00D3, UK_ALT_GR, 0x10, UK_SHIFT, 0x12),    // Ó
+  UK_DEAD(0x00D4, UK_PLAIN, 0x2F, UK_SHIFT, 0x12),     // Ô
+  UK_DEAD(0x00D6, UK_SHIFT, 0x2F, UK_SHIFT, 0x12),     // Ö
+  UK_KEY(0x00D7, UK_SHIFT_ALT_GR, 0x36),               // ×
+  UK_KEY(0x00D8, UK_SHIFT_ALT_GR, 0x12),               // Ø
+  UK_DEAD(0x00D9, UK_ALT_GR, 0x31, UK_SHIFT, 0x18),    // Ù
+  UK_DEAD(0x00DA, UK_ALT_GR, 0x10, UK_SHIFT, 0x18),    // Ú
+  UK_DEAD(0x00DB, UK_PLAIN, 0x2F, UK_SHIFT, 0x18),     // Û
+  UK_DEAD(0x00DC, UK_SHIFT, 0x2F, UK_SHIFT, 0x18),     // Ü
+  UK_DEAD(0x00DD, UK_ALT_GR, 0x10, UK_SHIFT, 0x1C),    // Ý
+  UK_KEY(0x00DE, UK_SHIFT_ALT_GR, 0x13),               // Þ
+  UK_KEY(0x00DF, UK_ALT_GR, 0x16),                     // ß
+  UK_KEY(0x00E0, UK_PLAIN, 0x27),                      // à
+  UK_DEAD(0x00E1, UK_ALT_GR, 0x10, UK_PLAIN, 0x14),    // á
+  UK_DEAD(0x00E2, UK_PLAIN, 0x2F, UK_PLAIN, 0x14),     // â
+  UK_DEAD(0x00E4, UK_SHIFT, 0x2F, UK_PLAIN, 0x14),     // ä
+  UK_DEAD(0x00E5, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x14), // å
+  UK_KEY(0x00E6, UK_ALT_GR, 0x14),                     // æ
+  UK_KEY(0x00E7, UK_PLAIN, 0x26),                      // ç
+  UK_KEY(0x00E8, UK_PLAIN, 0x24),                      // è
+  UK_KEY(0x00E9, UK_PLAIN, 0x1F),                      // é
+  UK_DEAD(0x00EA, UK_PLAIN, 0x2F, UK_PLAIN, 0x08),     // ê
+  UK_DEAD(0x00EB, UK_SHIFT, 0x2F, UK_PLAIN, 0x08),     // ë
+  UK_DEAD(0x00EC, UK_ALT_GR, 0x31, UK_PLAIN, 0x0C),    // ì
+  UK_DEAD(0x00ED, UK_ALT_GR, 0x10, UK_PLAIN, 0x0C),    // í
+  UK_DEAD(0x00EE, UK_PLAIN, 0x2F, UK_PLAIN, 0x0C),     // î
+  UK_DEAD(0x00EF, UK_SHIFT, 0x2F, UK_PLAIN, 0x0C),     // ï
+  UK_KEY(0x00F0, UK_ALT_GR, 0x07),                     // ð
+  UK_DEAD(0x00F2, UK_ALT_GR, 0x31, UK_PLAIN, 0x12),    // ò
+  UK_DEAD(0x00F3, UK_ALT_GR, 0x10, UK_PLAIN, 0x12),    // ó
+  UK_DEAD(0x00F4, UK_PLAIN, 0x2F, UK_PLAIN, 0x12),     // ô
+  UK_DEAD(0x00F6, UK_SHIFT, 0x2F, UK_PLAIN, 0x12),     // ö
+  UK_KEY(0x00F7, UK_SHIFT_ALT_GR, 0x37),               // ÷
+  UK_KEY(0x00F8, UK_ALT_GR, 0x12),                     // ø
+  UK_KEY(0x00F9, UK_PLAIN, 0x34),                      // ù
+  UK_DEAD(0x00FA, UK_ALT_GR, 0x10, UK_PLAIN, 0x18),    // ú
+  UK_DEAD(0x00FB, UK_PLAIN, 0x2F, UK_PLAIN, 0x18),     // û
+  UK_DEAD(0x00FC, UK_SHIFT, 0x2F, UK_PLAIN, 0x18),     // ü
+  UK_DEAD(0x00FD, UK_ALT_GR, 0x10, UK_PLAIN, 0x1C),    // ý
+  UK_KEY(0x00FE, UK_ALT_GR, 0x13),                     // þ
+  UK_DEAD(0x00FF, UK_SHIFT, 0x2F, UK_PLAIN, 0x1C),     // ÿ
+  UK_DEAD(0x0100, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x14), // Ā
+  UK_DEAD(0x0101, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x14), // ā
+  UK_DEAD(0x0102, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x14), // Ă
+  UK_DEAD(0x0103, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x14), // ă
+  UK_DEAD(0x0104, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x14), // Ą
+  UK_DEAD(0x0105, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x14), // ą
+  UK_DEAD(0x0106, UK_ALT_GR, 0x10, UK_SHIFT, 0x06),    // Ć
+  UK_DEAD(0x0107, UK_ALT_GR, 0x10, UK_PLAIN, 0x06),    // ć
+  UK_DEAD(0x0108, UK_PLAIN, 0x2F, UK_SHIFT, 0x06),     // Ĉ
+  UK_DEAD(0x0109, UK_PLAIN, 0x2F, UK_PLAIN, 0x06),     // ĉ
+  UK_DEAD(0x010A, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x06), // Ċ
+  UK_DEAD(0x010B, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x06), // ċ
+  UK_DEAD(0x010C, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x06), // Č
+  UK_DEAD(0x010D, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x06), // č
+  UK_DEAD(0x010E, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x07), // Ď
+  UK_DEAD(0x010F, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x07), // ď
+  UK_KEY(0x0111, UK_ALT_GR, 0x09),                     // đ
+  UK_DEAD(0x0112, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x08), // Ē
+  UK_DEAD(0x0113, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x08), // ē
+  UK_DEAD(0x0114, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x08), // Ĕ
+  UK_DEAD(0x0115, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x08), // ĕ
+  UK_DEAD(0x0116, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x08), // Ė
+  UK_DEAD(0x0117, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x08), // ė
+  UK_DEAD(0x0118, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x08), // Ę
+  UK_DEAD(0x0119, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x08), // ę
+  UK_DEAD(0x011A, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x08), // Ě
+  UK_DEAD(0x011B, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x08), // ě
+  UK_DEAD(0x011C, UK_PLAIN, 0x2F, UK_SHIFT, 0x0A),     // Ĝ
+  UK_DEAD(0x011D, UK_PLAIN, 0x2F, UK_PLAIN, 0x0A),     // ĝ
+  UK_DEAD(0x011E, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x0A), // Ğ
+  UK_DEAD(0x011F, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x0A), // ğ
+  UK_DEAD(0x0120, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x0A), // Ġ
+  UK_DEAD(0x0121, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x0A), // ġ
+  UK_DEAD(0x0124, UK_PLAIN, 0x2F, UK_SHIFT, 0x0B),     // Ĥ
+  UK_DEAD(0x0125, UK_PLAIN, 0x2F, UK_PLAIN, 0x0B),     // ĥ
+  UK_KEY(0x0126, UK_SHIFT_ALT_GR, 0x0B),               // Ħ
+  UK_KEY(0x0127, UK_ALT_GR, 0x0B),                     // ħ
+  UK_DEAD(0x012A, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0C), // Ī
+  UK_DEAD(0x012B, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0C), // ī
+  UK_DEAD(0x012C, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x0C), // Ĭ
+  UK_DEAD(0x012D, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x0C), // ĭ
+  UK_DEAD(0x012E, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x0C), // Į
+  UK_DEAD(0x012F, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x0C), // į
+  UK_DEAD(0x0130, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x0C), // İ
+  UK_KEY(0x0131, UK_SHIFT_ALT_GR, 0x0C),               // ı
+  UK_DEAD(0x0134, UK_PLAIN, 0x2F, UK_SHIFT, 0x0D),     // Ĵ
+  UK_DEAD(0x0135, UK_PLAIN, 0x2F, UK_PLAIN, 0x0D),     // ĵ
+  UK_KEY(0x0138, UK_ALT_GR, 0x0E),                     // ĸ
+  UK_DEAD(0x0139, UK_ALT_GR, 0x10, UK_SHIFT, 0x0F),    // Ĺ
+  UK_DEAD(0x013A, UK_ALT_GR, 0x10, UK_PLAIN, 0x0F),    // ĺ
+  UK_DEAD(0x013D, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0F), // Ľ
+  UK_DEAD(0x013E, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0F), // ľ
+  UK_DEAD(0x013F, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x0F), // Ŀ
+  UK_DEAD(0x0140, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x0F), // ŀ
+  UK_KEY(0x0141, UK_SHIFT_ALT_GR, 0x0F),               // Ł
+  UK_KEY(0x0142, UK_ALT_GR, 0x0F),                     // ł
+  UK_DEAD(0x0143, UK_ALT_GR, 0x10, UK_SHIFT, 0x11),    // Ń
+  UK_DEAD(0x0144, UK_ALT_GR, 0x10, UK_PLAIN, 0x11),    // ń
+  UK_DEAD(0x0147, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x11), // Ň
+  UK_DEAD(0x0148, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x11), // ň
+  UK_KEY(0x014A, UK_SHIFT_ALT_GR, 0x0A),               // Ŋ
+  UK_KEY(0x014B, UK_ALT_GR, 0x0A),                     // ŋ
+  UK_DEAD(0x014C, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x12), // Ō
+  UK_DEAD(0x014D, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x12), // ō
+  UK_DEAD(0x014E, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x12), // Ŏ
+  UK_DEAD(0x014F, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x12), // ŏ
+  UK_DEAD(0x0150, UK_SHIFT_ALT_GR, 0x10, UK_SHIFT, 0x12), // Ő
+  UK_DEAD(0x0151, UK_SHIFT_ALT_GR, 0x10, UK_PLAIN, 0x12), // ő
+  UK_DEAD(0x0154, UK_ALT_GR, 0x10, UK_SHIFT, 0x15),    // Ŕ
+  UK_DEAD(0x0155, UK_ALT_GR, 0x10, UK_PLAIN, 0x15),    // ŕ
+  UK_DEAD(0x0158, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x15), // Ř
+  UK_DEAD(0x0159, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x15), // ř
+  UK_DEAD(0x015A, UK_ALT_GR, 0x10, UK_SHIFT, 0x16),    // Ś
+  UK_DEAD(0x015B, UK_ALT_GR, 0x10, UK_PLAIN, 0x16),    // ś
+  UK_DEAD(0x015C, UK_PLAIN, 0x2F, UK_SHIFT, 0x16),     // Ŝ
+  UK_DEAD(0x015D, UK_PLAIN, 0x2F, UK_PLAIN, 0x16),     // ŝ
+  UK_DEAD(0x0160, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x16), // Š
+  UK_DEAD(0x0161, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x16), // š
+  UK_DEAD(0x0164, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x17), // Ť
+  UK_DEAD(0x0165, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x17), // ť
+  UK_KEY(0x0166, UK_SHIFT_ALT_GR, 0x17),               // Ŧ
+  UK_KEY(0x0167, UK_ALT_GR, 0x17),                     // ŧ
+  UK_DEAD(0x016A, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x18), // Ū
+  UK_DEAD(0x016B, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x18), // ū
+  UK_DEAD(0x016C, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x18), // Ŭ
+  UK_DEAD(0x016D, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x18), // ŭ
+  UK_DEAD(0x016E, UK_SHIFT_ALT_GR, 0x2F, UK_SHIFT, 0x18), // Ů
+  UK_DEAD(0x016F, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x18), // ů
+  UK_DEAD(0x0170, UK_SHIFT_ALT_GR, 0x10, UK_SHIFT, 0x18), // Ű
+  UK_DEAD(0x0171, UK_SHIFT_ALT_GR, 0x10, UK_PLAIN, 0x18), // ű
+  UK_DEAD(0x0172, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x18), // Ų
+  UK_DEAD(0x0173, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x18), // ų
+  UK_DEAD(0x0174, UK_PLAIN, 0x2F, UK_SHIFT, 0x1D),     // Ŵ
+  UK_DEAD(0x0175, UK_PLAIN, 0x2F, UK_PLAIN, 0x1D),     // ŵ
+  UK_DEAD(0x0176, UK_PLAIN, 0x2F, UK_SHIFT, 0x1C),     // Ŷ
+  UK_DEAD(0x0177, UK_PLAIN, 0x2F, UK_PLAIN, 0x1C),     // ŷ
+  UK_DEAD(0x0178, UK_SHIFT, 0x2F, UK_SHIFT, 0x1C),     // Ÿ
+  UK_DEAD(0x0179, UK_ALT_GR, 0x10, UK_SHIFT, 0x1A),    // Ź
+  UK_DEAD(0x017A, UK_ALT_GR, 0x10, UK_PLAIN, 0x1A),    // ź
+  UK_DEAD(0x017B, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x1A), // Ż
+  UK_DEAD(0x017C, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x1A), // ż
+  UK_DEAD(0x017D, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x1A), // Ž
+  UK_DEAD(0x017E, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x1A), // ž
+  UK_DEAD(0x0181, UK_ALT_GR, 0x0D, UK_SHIFT, 0x05),    // Ɓ
+  UK_DEAD(0x0187, UK_ALT_GR, 0x0D, UK_SHIFT, 0x06),    // Ƈ
+  UK_DEAD(0x0188, UK_ALT_GR, 0x0D, UK_PLAIN, 0x06),    // ƈ
+  UK_DEAD(0x018A, UK_ALT_GR, 0x0D, UK_SHIFT, 0x07),    // Ɗ
+  UK_DEAD(0x0191, UK_ALT_GR, 0x0D, UK_SHIFT, 0x09),    // Ƒ
+  UK_DEAD(0x0192, UK_ALT_GR, 0x0D, UK_PLAIN, 0x09),    // ƒ
+  UK_DEAD(0x0193, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0A),    // Ɠ
+  UK_DEAD(0x0198, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0E),    // Ƙ
+  UK_DEAD(0x0199, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0E),    // ƙ
+  UK_DEAD(0x019D, UK_ALT_GR, 0x0D, UK_SHIFT, 0x11),    // Ɲ
+  UK_DEAD(0x01A0, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x12), // Ơ
+  UK_DEAD(0x01A1, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x12), // ơ
+  UK_DEAD(0x01A4, UK_ALT_GR, 0x0D, UK_SHIFT, 0x13),    // Ƥ
+  UK_DEAD(0x01A5, UK_ALT_GR, 0x0D, UK_PLAIN, 0x13),    // ƥ
+  UK_DEAD(0x01AC, UK_ALT_GR, 0x0D, UK_SHIFT, 0x17),    // Ƭ
+  UK_DEAD(0x01AD, UK_ALT_GR, 0x0D, UK_PLAIN, 0x17),    // ƭ
+  UK_DEAD(0x01AF, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x18), // Ư
+  UK_DEAD(0x01B0, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x18), // ư
+  UK_DEAD(0x01B2, UK_ALT_GR, 0x0D, UK_SHIFT, 0x19),    // Ʋ
+  UK_DEAD(0x01CD, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x14), // Ǎ
+  UK_DEAD(0x01CE, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x14), // ǎ
+  UK_DEAD(0x01CF, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0C), // Ǐ
+  UK_DEAD(0x01D0, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0C), // ǐ
+  UK_DEAD(0x01D1, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x12), // Ǒ
+  UK_DEAD(0x01D2, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x12), // ǒ
+  UK_DEAD(0x01D3, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x18), // Ǔ
+  UK_DEAD(0x01D4, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x18), // ǔ
+  UK_DEAD(0x01D5, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x19), // Ǖ
+  UK_DEAD(0x01D6, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x19), // ǖ
+  UK_DEAD(0x01D7, UK_ALT_GR, 0x10, UK_SHIFT, 0x19),    // Ǘ
+  UK_DEAD(0x01D8, UK_ALT_GR, 0x10, UK_PLAIN, 0x19),    // ǘ
+  UK_DEAD(0x01D9, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x19), // Ǚ
+  UK_DEAD(0x01DA, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x19), // ǚ
+  UK_DEAD(0x01DB, UK_ALT_GR, 0x31, UK_SHIFT, 0x19),    // Ǜ
+  UK_DEAD(0x01DC, UK_SHIFT, 0x2F, UK_PLAIN, 0x34),     // ǜ
+  UK_DEAD(0x01E2, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT_ALT_GR, 0x14), // Ǣ
+  UK_DEAD(0x01E3, UK_SHIFT_ALT_GR, 0x30, UK_ALT_GR, 0x14), // ǣ
+  UK_DEAD(0x01E6, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0A), // Ǧ
+  UK_DEAD(0x01E7, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0A), // ǧ
+  UK_DEAD(0x01E8, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0E), // Ǩ
+  UK_DEAD(0x01E9, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0E), // ǩ
+  UK_DEAD(0x01EA, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x12), // Ǫ
+  UK_DEAD(0x01EB, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x12), // ǫ
+  UK_DEAD(0x01F0, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0D), // ǰ
+  UK_DEAD(0x01F4, UK_ALT_GR, 0x10, UK_SHIFT, 0x0A),    // Ǵ
+  UK_DEAD(0x01F5, UK_ALT_GR, 0x10, UK_PLAIN, 0x0A),    // ǵ
+  UK_DEAD(0x01F8, UK_ALT_GR, 0x31, UK_SHIFT, 0x11),    // Ǹ
+  UK_DEAD(0x01F9, UK_ALT_GR, 0x31, UK_PLAIN, 0x11),    // ǹ
+  UK_DEAD(0x01FC, UK_ALT_GR, 0x10, UK_SHIFT_ALT_GR, 0x14), // Ǽ
+  UK_DEAD(0x01FD, UK_ALT_GR, 0x10, UK_ALT_GR, 0x14),   // ǽ
+  UK_DEAD(0x01FE, UK_ALT_GR, 0x10, UK_SHIFT_ALT_GR, 0x12), // Ǿ
+  UK_DEAD(0x01FF, UK_ALT_GR, 0x10, UK_ALT_GR, 0x12),   // ǿ
+  UK_DEAD(0x021E, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0B), // Ȟ
+  UK_DEAD(0x021F, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0B), // ȟ
+  UK_DEAD(0x0224, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1A),    // Ȥ
+  UK_DEAD(0x0225, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1A),    // ȥ
+  UK_DEAD(0x0226, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x14), // Ȧ
+  UK_DEAD(0x0227, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x14), // ȧ
+  UK_DEAD(0x022E, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x12), // Ȯ
+  UK_DEAD(0x022F, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x12), // ȯ
+  UK_DEAD(0x0232, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x1C), // Ȳ
+  UK_DEAD(0x0233, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x1C), // ȳ
+  UK_DEAD(0x0237, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x0D), // ȷ
+  UK_DEAD(0x0253, UK_ALT_GR, 0x0D, UK_PLAIN, 0x05),    // ɓ
+  UK_DEAD(0x0257, UK_ALT_GR, 0x0D, UK_PLAIN, 0x07),    // ɗ
+  UK_DEAD(0x0260, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0A),    // ɠ
+  UK_DEAD(0x0266, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0B),    // ɦ
+  UK_DEAD(0x0271, UK_ALT_GR, 0x0D, UK_PLAIN, 0x33),    // ɱ
+  UK_DEAD(0x0272, UK_ALT_GR, 0x0D, UK_PLAIN, 0x11),    // ɲ
+  UK_DEAD(0x027C, UK_ALT_GR, 0x0D, UK_PLAIN, 0x15),    // ɼ
+  UK_DEAD(0x0282, UK_ALT_GR, 0x0D, UK_PLAIN, 0x16),    // ʂ
+  UK_DEAD(0x028B, UK_ALT_GR, 0x0D, UK_PLAIN, 0x19),    // ʋ
+  UK_DEAD(0x02A0, UK_ALT_GR, 0x0D, UK_PLAIN, 0x04),    // ʠ
+  UK_DEAD(0x02C7, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x2C), // ˇ
+  UK_DEAD(0x02D8, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x2C), // ˘
+  UK_DEAD(0x02D9, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x2C), // ˙
+  UK_DEAD(0x02DB, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x2C), // ˛
+  UK_DEAD(0x02DD, UK_SHIFT_ALT_GR, 0x10, UK_PLAIN, 0x2C), // ˝
+  UK_DEAD(0x0309, UK_ALT_GR, 0x0D, UK_PLAIN, 0x2C),    // ̉
+  UK_DEAD(0x031B, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x2C), // ̛
+  UK_DEAD(0x0323, UK_ALT_GR, 0x38, UK_PLAIN, 0x2C),    // ̣
+  UK_DEAD(0x0344, UK_SHIFT, 0x2F, UK_PLAIN, 0x21),     // ̈́
+  UK_DEAD(0x038F, UK_ALT_GR, 0x10, UK_SHIFT_ALT_GR, 0x04), // Ώ
+  UK_KEY(0x03A9, UK_SHIFT_ALT_GR, 0x04),               // Ω
+  UK_DEAD(0x1E02, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x05), // Ḃ
+  UK_DEAD(0x1E03, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x05), // ḃ
+  UK_DEAD(0x1E04, UK_ALT_GR, 0x38, UK_SHIFT, 0x05),    // Ḅ
+  UK_DEAD(0x1E05, UK_ALT_GR, 0x38, UK_PLAIN, 0x05),    // ḅ
+  UK_DEAD(0x1E09, UK_ALT_GR, 0x10, UK_PLAIN, 0x26),    // ḉ
+  UK_DEAD(0x1E0A, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x07), // Ḋ
+  UK_DEAD(0x1E0B, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x07), // ḋ
+  UK_DEAD(0x1E0C, UK_ALT_GR, 0x38, UK_SHIFT, 0x07),    // Ḍ
+  UK_DEAD(0x1E0D, UK_ALT_GR, 0x38, UK_PLAIN, 0x07),    // ḍ
+  UK_DEAD(0x1E15, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x24), // ḕ
+  UK_DEAD(0x1E17, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x1F), // ḗ
+  UK_DEAD(0x1E1E, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x09), // Ḟ
+  UK_DEAD(0x1E1F, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x09), // ḟ
+  UK_DEAD(0x1E20, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0A), // Ḡ
+  UK_DEAD(0x1E21, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0A), // ḡ
+  UK_DEAD(0x1E22, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x0B), // Ḣ
+  UK_DEAD(0x1E23, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x0B), // ḣ
+  UK_DEAD(0x1E24, UK_ALT_GR, 0x38, UK_SHIFT, 0x0B),    // Ḥ
+  UK_DEAD(0x1E25, UK_ALT_GR, 0x38, UK_PLAIN, 0x0B),    // ḥ
+  UK_DEAD(0x1E26, UK_SHIFT, 0x2F, UK_SHIFT, 0x0B),     // Ḧ
+  UK_DEAD(0x1E27, UK_SHIFT, 0x2F, UK_PLAIN, 0x0B),     // ḧ
+  UK_DEAD(0x1E30, UK_ALT_GR, 0x10, UK_SHIFT, 0x0E),    // Ḱ
+  UK_DEAD(0x1E31, UK_ALT_GR, 0x10, UK_PLAIN, 0x0E),    // ḱ
+  UK_DEAD(0x1E32, UK_ALT_GR, 0x38, UK_SHIFT, 0x0E),    // Ḳ
+  UK_DEAD(0x1E33, UK_ALT_GR, 0x38, UK_PLAIN, 0x0E),    // ḳ
+  UK_DEAD(0x1E36, UK_ALT_GR, 0x38, UK_SHIFT, 0x0F),    // Ḷ
+  UK_DEAD(0x1E37, UK_ALT_GR, 0x38, UK_PLAIN, 0x0F),    // ḷ
+  UK_DEAD(0x1E3E, UK_ALT_GR, 0x10, UK_SHIFT, 0x33),    // Ḿ
+  UK_DEAD(0x1E3F, UK_ALT_GR, 0x10, UK_PLAIN, 0x33),    // ḿ
+  UK_DEAD(0x1E40, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x33), // Ṁ
+  UK_DEAD(0x1E41, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x33), // ṁ
+  UK_DEAD(0x1E42, UK_ALT_GR, 0x38, UK_SHIFT, 0x33),    // Ṃ
+  UK_DEAD(0x1E43, UK_ALT_GR, 0x38, UK_PLAIN, 0x33),    // ṃ
+  UK_DEAD(0x1E44, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x11), // Ṅ
+  UK_DEAD(0x1E45, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x11), // ṅ
+  UK_DEAD(0x1E46, UK_ALT_GR, 0x38, UK_SHIFT, 0x11),    // Ṇ
+  UK_DEAD(0x1E47, UK_ALT_GR, 0x38, UK_PLAIN, 0x11),    // ṇ
+  UK_DEAD(0x1E54, UK_ALT_GR, 0x10, UK_SHIFT, 0x13),    // Ṕ
+  UK_DEAD(0x1E55, UK_ALT_GR, 0x10, UK_PLAIN, 0x13),    // ṕ
+  UK_DEAD(0x1E56, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x13), // Ṗ
+  UK_DEAD(0x1E57, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x13), // ṗ
+  UK_DEAD(0x1E58, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x15), // Ṙ
+  UK_DEAD(0x1E59, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x15), // ṙ
+  UK_DEAD(0x1E5A, UK_ALT_GR, 0x38, UK_SHIFT, 0x15),    // Ṛ
+  UK_DEAD(0x1E5B, UK_ALT_GR, 0x38, UK_PLAIN, 0x15),    // ṛ
+  UK_DEAD(0x1E60, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x16), // Ṡ
+  UK_DEAD(0x1E61, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x16), // ṡ
+  UK_DEAD(0x1E62, UK_ALT_GR, 0x38, UK_SHIFT, 0x16),    // Ṣ
+  UK_DEAD(0x1E63, UK_ALT_GR, 0x38, UK_PLAIN, 0x16),    // ṣ
+  UK_DEAD(0x1E6A, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x17), // Ṫ
+  UK_DEAD(0x1E6B, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x17), // ṫ
+  UK_DEAD(0x1E6C, UK_ALT_GR, 0x38, UK_SHIFT, 0x17),    // Ṭ
+  UK_DEAD(0x1E6D, UK_ALT_GR, 0x38, UK_PLAIN, 0x17),    // ṭ
+  UK_DEAD(0x1E7E, UK_ALT_GR, 0x38, UK_SHIFT, 0x19),    // Ṿ
+  UK_DEAD(0x1E7F, UK_ALT_GR, 0x38, UK_PLAIN, 0x19),    // ṿ
+  UK_DEAD(0x1E80, UK_ALT_GR, 0x31, UK_SHIFT, 0x1D),    // Ẁ
+  UK_DEAD(0x1E81, UK_ALT_GR, 0x31, UK_PLAIN, 0x1D),    // ẁ
+  UK_DEAD(0x1E82, UK_ALT_GR, 0x10, UK_SHIFT, 0x1D),    // Ẃ
+  UK_DEAD(0x1E83, UK_ALT_GR, 0x10, UK_PLAIN, 0x1D),    // ẃ
+  UK_DEAD(0x1E84, UK_SHIFT, 0x2F, UK_SHIFT, 0x1D),     // Ẅ
+  UK_DEAD(0x1E85, UK_SHIFT, 0x2F, UK_PLAIN, 0x1D),     // ẅ
+  UK_DEAD(0x1E86, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x1D), // Ẇ
+  UK_DEAD(0x1E87, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x1D), // ẇ
+  UK_DEAD(0x1E88, UK_ALT_GR, 0x38, UK_SHIFT, 0x1D),    // Ẉ
+  UK_DEAD(0x1E89, UK_ALT_GR, 0x38, UK_PLAIN, 0x1D),    // ẉ
+  UK_DEAD(0x1E8A, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x1B), // Ẋ
+  UK_DEAD(0x1E8B, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x1B), // ẋ
+  UK_DEAD(0x1E8C, UK_SHIFT, 0x2F, UK_SHIFT, 0x1B),     // Ẍ
+  UK_DEAD(0x1E8D, UK_SHIFT, 0x2F, UK_PLAIN, 0x1B),     // ẍ
+  UK_DEAD(0x1E8E, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x1C), // Ẏ
+  UK_DEAD(0x1E8F, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x1C), // ẏ
+  UK_DEAD(0x1E90, UK_PLAIN, 0x2F, UK_SHIFT, 0x1A),     // Ẑ
+  UK_DEAD(0x1E91, UK_PLAIN, 0x2F, UK_PLAIN, 0x1A),     // ẑ
+  UK_DEAD(0x1E92, UK_ALT_GR, 0x38, UK_SHIFT, 0x1A),    // Ẓ
+  UK_DEAD(0x1E93, UK_ALT_GR, 0x38, UK_PLAIN, 0x1A),    // ẓ
+  UK_DEAD(0x1E97, UK_SHIFT, 0x2F, UK_PLAIN, 0x17),     // ẗ
+  UK_DEAD(0x1E98, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x1D), // ẘ
+  UK_DEAD(0x1E99, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x1C), // ẙ
+  UK_KEY(0x1E9E, UK_SHIFT_ALT_GR, 0x16),               // ẞ
+  UK_DEAD(0x1EA0, UK_ALT_GR, 0x38, UK_SHIFT, 0x14),    // Ạ
+  UK_DEAD(0x1EA1, UK_ALT_GR, 0x38, UK_PLAIN, 0x14),    // ạ
+  UK_DEAD(0x1EA2, UK_ALT_GR, 0x0D, UK_SHIFT, 0x14),    // Ả
+  UK_DEAD(0x1EA3, UK_ALT_GR, 0x0D, UK_PLAIN, 0x14),    // ả
+  UK_DEAD(0x1EA7, UK_PLAIN, 0x2F, UK_PLAIN, 0x27),     // ầ
+  UK_DEAD(0x1EB1, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x27), // ằ
+  UK_DEAD(0x1EB8, UK_ALT_GR, 0x38, UK_SHIFT, 0x08),    // Ẹ
+  UK_DEAD(0x1EB9, UK_ALT_GR, 0x38, UK_PLAIN, 0x08),    // ẹ
+  UK_DEAD(0x1EBA, UK_ALT_GR, 0x0D, UK_SHIFT, 0x08),    // Ẻ
+  UK_DEAD(0x1EBB, UK_ALT_GR, 0x0D, UK_PLAIN, 0x08),    // ẻ
+  UK_DEAD(0x1EBF, UK_PLAIN, 0x2F, UK_PLAIN, 0x1F),     // ế
+  UK_DEAD(0x1EC1, UK_PLAIN, 0x2F, UK_PLAIN, 0x24),     // ề
+  UK_DEAD(0x1EC8, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0C),    // Ỉ
+  UK_DEAD(0x1EC9, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0C),    // ỉ
+  UK_DEAD(0x1ECA, UK_ALT_GR, 0x38, UK_SHIFT, 0x0C),    // Ị
+  UK_DEAD(0x1ECB, UK_ALT_GR, 0x38, UK_PLAIN, 0x0C),    // ị
+  UK_DEAD(0x1ECC, UK_ALT_GR, 0x38, UK_SHIFT, 0x12),    // Ọ
+  UK_DEAD(0x1ECD, UK_ALT_GR, 0x38, UK_PLAIN, 0x12),    // ọ
+  UK_DEAD(0x1ECE, UK_ALT_GR, 0x0D, UK_SHIFT, 0x12),    // Ỏ
+  UK_DEAD(0x1ECF, UK_ALT_GR, 0x0D, UK_PLAIN, 0x12),    // ỏ
+  UK_DEAD(0x1EE4, UK_ALT_GR, 0x38, UK_SHIFT, 0x18),    // Ụ
+  UK_DEAD(0x1EE5, UK_ALT_GR, 0x38, UK_PLAIN, 0x18),    // ụ
+  UK_DEAD(0x1EE6, UK_ALT_GR, 0x0D, UK_SHIFT, 0x18),    // Ủ
+  UK_DEAD(0x1EE7, UK_ALT_GR, 0x0D, UK_PLAIN, 0x18),    // ủ
+  UK_DEAD(0x1EEB, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x34), // ừ
+  UK_DEAD(0x1EF2, UK_ALT_GR, 0x31, UK_SHIFT, 0x1C),    // Ỳ
+  UK_DEAD(0x1EF3, UK_ALT_GR, 0x31, UK_PLAIN, 0x1C),    // ỳ
+  UK_DEAD(0x1EF4, UK_ALT_GR, 0x38, UK_SHIFT, 0x1C),    // Ỵ
+  UK_DEAD(0x1EF5, UK_ALT_GR, 0x38, UK_PLAIN, 0x1C),    // ỵ
+  UK_DEAD(0x1EF6, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1C),    // Ỷ
+  UK_DEAD(0x1EF7, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1C),    // ỷ
+  UK_DEAD(0x1FFA, UK_ALT_GR, 0x31, UK_SHIFT_ALT_GR, 0x04), // Ὼ
+  UK_KEY(0x2018, UK_SHIFT_ALT_GR, 0x05),               // ‘
+  UK_KEY(0x2019, UK_SHIFT_ALT_GR, 0x11),               // ’
+  UK_KEY(0x201A, UK_SHIFT_ALT_GR, 0x19),               // ‚
+  UK_KEY(0x201C, UK_ALT_GR, 0x05),                     // “
+  UK_KEY(0x201D, UK_ALT_GR, 0x11),                     // ”
+  UK_KEY(0x201E, UK_ALT_GR, 0x19),                     // „
+  UK_KEY(0x2022, UK_ALT_GR, 0x36),                     // •
+  UK_DEAD(0x2070, UK_PLAIN, 0x2F, UK_SHIFT, 0x27),     // ⁰
+  UK_DEAD(0x2074, UK_PLAIN, 0x2F, UK_SHIFT, 0x21),     // ⁴
+  UK_DEAD(0x2075, UK_PLAIN, 0x2F, UK_SHIFT, 0x22),     // ⁵
+  UK_DEAD(0x2076, UK_PLAIN, 0x2F, UK_SHIFT, 0x23),     // ⁶
+  UK_DEAD(0x2077, UK_PLAIN, 0x2F, UK_SHIFT, 0x24),     // ⁷
+  UK_DEAD(0x2078, UK_PLAIN, 0x2F, UK_SHIFT, 0x25),     // ⁸
+  UK_DEAD(0x2079, UK_PLAIN, 0x2F, UK_SHIFT, 0x26),     // ⁹
+  UK_DEAD(0x207A, UK_PLAIN, 0x2F, UK_SHIFT, 0x2E),     // ⁺
+  UK_DEAD(0x207B, UK_PLAIN, 0x2F, UK_PLAIN, 0x23),     // ⁻
+  UK_DEAD(0x207C, UK_PLAIN, 0x2F, UK_PLAIN, 0x2E),     // ⁼
+  UK_DEAD(0x207D, UK_PLAIN, 0x2F, UK_PLAIN, 0x22),     // ⁽
+  UK_DEAD(0x207E, UK_PLAIN, 0x2F, UK_PLAIN, 0x2D),     // ⁾
+  UK_DEAD(0x2080, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x27), // ₀
+  UK_DEAD(0x2081, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x1E), // ₁
+  UK_DEAD(0x2082, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x1F), // ₂
+  UK_DEAD(0x2083, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x20), // ₃
+  UK_DEAD(0x2084, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x21), // ₄
+  UK_DEAD(0x2085, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x22), // ₅
+  UK_DEAD(0x2086, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x23), // ₆
+  UK_DEAD(0x2087, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x24), // ₇
+  UK_DEAD(0x2088, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x25), // ₈
+  UK_DEAD(0x2089, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x26), // ₉
+  UK_DEAD(0x208A, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x2E), // ₊
+  UK_DEAD(0x208B, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x23), // ₋
+  UK_DEAD(0x208C, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x2E), // ₌
+  UK_DEAD(0x208D, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x22), // ₍
+  UK_DEAD(0x208E, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x2D), // ₎
+  UK_KEY(0x20AC, UK_ALT_GR, 0x08),                     // €
+  UK_KEY(0x2122, UK_SHIFT_ALT_GR, 0x25),               // ™
+  UK_KEY(0x215B, UK_SHIFT_ALT_GR, 0x1F),               // ⅛
+  UK_KEY(0x215C, UK_SHIFT_ALT_GR, 0x22),               // ⅜
+  UK_KEY(0x215D, UK_SHIFT_ALT_GR, 0x23),               // ⅝
+  UK_KEY(0x215E, UK_SHIFT_ALT_GR, 0x24),               // ⅞
+  UK_KEY(0x2190, UK_ALT_GR, 0x1C),                     // ←
+  UK_KEY(0x2191, UK_SHIFT_ALT_GR, 0x18),               // ↑
+  UK_KEY(0x2192, UK_ALT_GR, 0x0C),                     // →
+  UK_KEY(0x2193, UK_ALT_GR, 0x18),                     // ↓
+  UK_DEAD(0x2A25, UK_ALT_GR, 0x38, UK_SHIFT, 0x2E),    // ⨥
+  UK_DEAD(0x2A2A, UK_ALT_GR, 0x38, UK_PLAIN, 0x23),    // ⨪
+  UK_DEAD(0x2A66, UK_ALT_GR, 0x38, UK_PLAIN, 0x2E),    // ⩦
+  UK_DEAD(0x2C6E, UK_ALT_GR, 0x0D, UK_SHIFT, 0x33),    // Ɱ
+  UK_DEAD(0x2C72, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1D),    // Ⱳ
+  UK_DEAD(0x2C73, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1D),    // ⱳ
+};
+#define UNICODE_KEYS_fr_FR UnicodeKeys_fr_FR, UNICODE_KEY_COUNT(UnicodeKeys_fr_FR)
+
+// it_IT (XKB "it"): 337 characters, 265 of them after a dead key
+static const UnicodeKeyEntry UnicodeKeys_it_IT[] = {
+  UK_KEY(0x00A1, UK_SHIFT_ALT_GR, 0x1E),               // ¡
+  UK_KEY(0x00A2, UK_SHIFT_ALT_GR, 0x08),               // ¢
+  UK_KEY(0x00A3, UK_SHIFT, 0x20),                      // £
+  UK_KEY(0x00A5, UK_SHIFT_ALT_GR, 0x1C),               // ¥
+  UK_KEY(0x00A6, UK_SHIFT_ALT_GR, 0x35),               // ¦
+  UK_KEY(0x00A7, UK_SHIFT_ALT_GR, 0x1A),               // §
+  UK_KEY(0x00A9, UK_SHIFT_ALT_GR, 0x06),               // ©
+  UK_KEY(0x00AA, UK_SHIFT_ALT_GR, 0x09),               // ª
+  UK_KEY(0x00AB, UK_ALT_GR, 0x64),                     // «
+  UK_KEY(0x00AC, UK_ALT_GR, 0x35),                     // ¬
+  UK_KEY(0x00AE, UK_SHIFT_ALT_GR, 0x15),               // ®
+  UK_DEAD(0x00AF, UK_ALT_GR, 0x38, UK_PLAIN, 0x2C),    // ¯
+  UK_KEY(0x00B0, UK_SHIFT, 0x34),                      // °
+  UK_KEY(0x00B1, UK_SHIFT_ALT_GR, 0x26),               // ±
+  UK_KEY(0x00B2, UK_ALT_GR, 0x1F),                     // ²
+  UK_KEY(0x00B3, UK_ALT_GR, 0x20),                     // ³
+  UK_KEY(0x00B5, UK_ALT_GR, 0x10),                     // µ
+  UK_KEY(0x00B6, UK_ALT_GR, 0x15),                     // ¶
+  UK_KEY(0x00B7, UK_ALT_GR, 0x37),                     // ·
+  UK_DEAD(0x00B8, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x2C), // ¸
+  UK_KEY(0x00B9, UK_ALT_GR, 0x1E),                     // ¹
+  UK_KEY(0x00BA, UK_SHIFT_ALT_GR, 0x10),               // º
+  UK_KEY(0x00BB, UK_SHIFT_ALT_GR, 0x64),               // »
+  UK_KEY(0x00BC, UK_ALT_GR, 0x21),                     // ¼
+  UK_KEY(0x00BD, UK_ALT_GR, 0x22),                     // ½
+  UK_KEY(0x00BF, UK_SHIFT_ALT_GR, 0x2D),               // ¿
+  UK_DEAD(0x00C0, UK_ALT_GR, 0x31, UK_SHIFT, 0x04),    // À
+  UK_DEAD(0x00C1, UK_ALT_GR, 0x36, UK_SHIFT, 0x04),    // Á
+  UK_DEAD(0x00C2, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x04), // Â
+  UK_DEAD(0x00C3, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x04), // Ã
+  UK_DEAD(0x00C4, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x04), // Ä
+  UK_DEAD(0x00C5, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x04), // Å
+  UK_KEY(0x00C6, UK_SHIFT_ALT_GR, 0x04),               // Æ
+  UK_DEAD(0x00C7, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x06), // Ç
+  UK_DEAD(0x00C8, UK_ALT_GR, 0x31, UK_SHIFT, 0x08),    // È
+  UK_DEAD(0x00C9, UK_ALT_GR, 0x36, UK_SHIFT, 0x08),    // É
+  UK_DEAD(0x00CA, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x08), // Ê
+  UK_DEAD(0x00CB, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x08), // Ë
+  UK_DEAD(0x00CC, UK_ALT_GR, 0x31, UK_SHIFT, 0x0C),    // Ì
+  UK_DEAD(0x00CD, UK_ALT_GR, 0x36, UK_SHIFT, 0x0C),    // Í
+  UK_DEAD(0x00CE, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x0C), // Î
+  UK_DEAD(0x00CF, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x0C), // Ï
+  UK_KEY(0x00D0, UK_SHIFT_ALT_GR, 0x07),               // Ð
+  UK_KEY(0x00D1, UK_SHIFT_ALT_GR, 0x11),               // Ñ
+  UK_DEAD(0x00D2, UK_ALT_GR, 0x31, UK_SHIFT, 0x12),    // Ò
+  UK_DEAD(0x00D3, UK_ALT_GR, 0x36, UK_SHIFT, 0x12),    // Ó
+  UK_DEAD(0x00D4, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x12), // Ô
+  UK_DEAD(0x00D5, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x12), // Õ
+  UK_DEAD(0x00D6, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x12), // Ö
+  UK_KEY(0x00D7, UK_SHIFT_ALT_GR, 0x36),               // ×
+  UK_KEY(0x00D8, UK_SHIFT_ALT_GR, 0x12),               // Ø
+  UK_DEAD(0x00D9, UK_ALT_GR, 0x31, UK_SHIFT, 0x18),    // Ù
+  UK_DEAD(0x00DA, UK_ALT_GR, 0x36, UK_SHIFT, 0x18),    // Ú
+  UK_DEAD(0x00DB, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x18), // Û
+  UK_DEAD(0x00DC, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x18), // Ü
+  UK_DEAD(0x00DD, UK_ALT_GR, 0x36, UK_SHIFT, 0x1C),    // Ý
+  UK_KEY(0x00DE, UK_SHIFT_ALT_GR, 0x13),               // Þ
+  UK_KEY(0x00DF, UK_ALT_GR, 0x16),                     // ß
+  UK_KEY(0x00E0, UK_PLAIN, 0x34),                      // à
+  UK_DEAD(0x00E1, UK_ALT_GR, 0x36, UK_PLAIN, 0x04),    // á
+  UK_DEAD(0x00E2, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x04), // â
+  UK_DEAD(0x00E3, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x04), // ã
+  UK_DEAD(0x00E4, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x04), // ä
+  UK_DEAD(0x00E5, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x04), // å
+  UK_KEY(0x00E6, UK_ALT_GR, 0x04),                     // æ
+  UK_KEY(0x00E7, UK_SHIFT, 0x33),                      // ç
+  UK_KEY(0x00E8, UK_PLAIN, 0x2F),                      // è
+  UK_KEY(0x00E9, UK_SHIFT, 0x2F),                      // é
+  UK_DEAD(0x00EA, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x08), // ê
+  UK_DEAD(0x00EB, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x08), // ë
+  UK_KEY(0x00EC, UK_PLAIN, 0x2E),                      // ì
+  UK_DEAD(0x00ED, UK_ALT_GR, 0x36, UK_PLAIN, 0x0C),    // í
+  UK_DEAD(0x00EE, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x0C), // î
+  UK_DEAD(0x00EF, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x0C), // ï
+  UK_KEY(0x00F0, UK_ALT_GR, 0x07),                     // ð
+  UK_KEY(0x00F1, UK_ALT_GR, 0x11),                     // ñ
+  UK_KEY(0x00F2, UK_PLAIN, 0x33),                      // ò
+  UK_DEAD(0x00F3, UK_ALT_GR, 0x36, UK_PLAIN, 0x12),    // ó
+  UK_DEAD(0x00F4, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x12), // ô
+  UK_DEAD(0x00F5, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x12), // õ
+  UK_DEAD(0x00F6, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x12), // ö
+  UK_KEY(0x00F7, UK_SHIFT_ALT_GR, 0x38),               // ÷
+  UK_KEY(0x00F8, UK_ALT_GR, 0x12),                     // ø
+  UK_KEY(0x00F9, UK_PLAIN, 0x31),                      // ù
+  UK_DEAD(0x00FA, UK_ALT_GR, 0x36, UK_PLAIN, 0x18),    // ú
+  UK_DEAD(0x00FB, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x18), // û
+  UK_DEAD(0x00FC, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x18), // ü
+  UK_DEAD(0x00FD, UK_ALT_GR, 0x36, UK_PLAIN, 0x1C),    // ý
+  UK_KEY(0x00FE, UK_ALT_GR, 0x13),                     // þ
+  UK_DEAD(0x00FF, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x1C), // ÿ
+  UK_DEAD(0x0100, UK_ALT_GR, 0x38, UK_SHIFT, 0x04),    // Ā
+  UK_DEAD(0x0101, UK_ALT_GR, 0x38, UK_PLAIN, 0x04),    // ā
+  UK_DEAD(0x0102, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x04), // Ă
+  UK_DEAD(0x0103, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x04), // ă
+  UK_DEAD(0x0104, UK_SHIFT_ALT_GR, 0x27, UK_SHIFT, 0x04), // Ą
+  UK_DEAD(0x0105, UK_SHIFT_ALT_GR, 0x27, UK_PLAIN, 0x04), // ą
+  UK_DEAD(0x0106, UK_ALT_GR, 0x36, UK_SHIFT, 0x06),    // Ć
+  UK_DEAD(0x0107, UK_ALT_GR, 0x36, UK_PLAIN, 0x06),    // ć
+  UK_DEAD(0x0108, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x06), // Ĉ
+  UK_DEAD(0x0109, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x06), // ĉ
+  UK_KEY(0x0111, UK_ALT_GR, 0x09),                     // đ
+  UK_DEAD(0x0112, UK_ALT_GR, 0x38, UK_SHIFT, 0x08),    // Ē
+  UK_DEAD(0x0113, UK_ALT_GR, 0x38, UK_PLAIN, 0x08),    // ē
+  UK_DEAD(0x0114, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x08), // Ĕ
+  UK_DEAD(0x0115, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x08), // ĕ
+  UK_DEAD(0x0118, UK_SHIFT_ALT_GR, 0x27, UK_SHIFT, 0x08), // Ę
+  UK_DEAD(0x0119, UK_SHIFT_ALT_GR, 0x27, UK_PLAIN, 0x08), // ę
+  UK_DEAD(0x011C, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x0A), // Ĝ
+  UK_DEAD(0x011D, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x0A), // ĝ
+  UK_DEAD(0x011E, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x0A), // Ğ
+  UK_DEAD(0x011F, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x0A), // ğ
+  UK_DEAD(0x0122, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x0A), // Ģ
+  UK_DEAD(0x0123, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x0A), // ģ
+  UK_DEAD(0x0124, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x0B), // Ĥ
+  UK_DEAD(0x0125, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x0B), // ĥ
+  UK_KEY(0x0126, UK_SHIFT_ALT_GR, 0x0B),               // Ħ
+  UK_KEY(0x0127, UK_ALT_GR, 0x0B),                     // ħ
+  UK_DEAD(0x0128, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x0C), // Ĩ
+  UK_DEAD(0x0129, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x0C), // ĩ
+  UK_DEAD(0x012A, UK_ALT_GR, 0x38, UK_SHIFT, 0x0C),    // Ī
+  UK_DEAD(0x012B, UK_ALT_GR, 0x38, UK_PLAIN, 0x0C),    // ī
+  UK_DEAD(0x012C, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x0C), // Ĭ
+  UK_DEAD(0x012D, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x0C), // ĭ
+  UK_DEAD(0x012E, UK_SHIFT_ALT_GR, 0x27, UK_SHIFT, 0x0C), // Į
+  UK_DEAD(0x012F, UK_SHIFT_ALT_GR, 0x27, UK_PLAIN, 0x0C), // į
+  UK_KEY(0x0131, UK_SHIFT_ALT_GR, 0x0C),               // ı
+  UK_DEAD(0x0134, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x0D), // Ĵ
+  UK_DEAD(0x0135, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x0D), // ĵ
+  UK_DEAD(0x0136, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x0E), // Ķ
+  UK_DEAD(0x0137, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x0E), // ķ
+  UK_KEY(0x0138, UK_ALT_GR, 0x0E),                     // ĸ
+  UK_DEAD(0x0139, UK_ALT_GR, 0x36, UK_SHIFT, 0x0F),    // Ĺ
+  UK_DEAD(0x013A, UK_ALT_GR, 0x36, UK_PLAIN, 0x0F),    // ĺ
+  UK_DEAD(0x013B, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x0F), // Ļ
+  UK_DEAD(0x013C, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x0F), // ļ
+  UK_KEY(0x0141, UK_SHIFT_ALT_GR, 0x0F),               // Ł
+  UK_KEY(0x0142, UK_ALT_GR, 0x0F),                     // ł
+  UK_DEAD(0x0143, UK_ALT_GR, 0x36, UK_SHIFT, 0x11),    // Ń
+  UK_DEAD(0x0144, UK_ALT_GR, 0x36, UK_PLAIN, 0x11),    // ń
+  UK_DEAD(0x0145, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x11), // Ņ
+  UK_DEAD(0x0146, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x11), // ņ
+  UK_KEY(0x014A, UK_SHIFT_ALT_GR, 0x0A),               // Ŋ
+  UK_KEY(0x014B, UK_ALT_GR, 0x0A),                     // ŋ
+  UK_DEAD(0x014C, UK_ALT_GR, 0x38, UK_SHIFT, 0x12),    // Ō
+  UK_DEAD(0x014D, UK_ALT_GR, 0x38, UK_PLAIN, 0x12),    // ō
+  UK_DEAD(0x014E, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x12), // Ŏ
+  UK_DEAD(0x014F, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x12), // ŏ
+  UK_DEAD(0x0150, UK_SHIFT_ALT_GR, 0x1F, UK_SHIFT, 0x12), // Ő
+  UK_DEAD(0x0151, UK_SHIFT_ALT_GR, 0x1F, UK_PLAIN, 0x12), // ő
+  UK_DEAD(0x0154, UK_ALT_GR, 0x36, UK_SHIFT, 0x15),    // Ŕ
+  UK_DEAD(0x0155, UK_ALT_GR, 0x36, UK_PLAIN, 0x15),    // ŕ
+  UK_DEAD(0x0156, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x15), // Ŗ
+  UK_DEAD(0x0157, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x15), // ŗ
+  UK_DEAD(0x015A, UK_ALT_GR, 0x36, UK_SHIFT, 0x16),    // Ś
+  UK_DEAD(0x015B, UK_ALT_GR, 0x36, UK_PLAIN, 0x16),    // ś
+  UK_DEAD(0x015C, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x16), // Ŝ
+  UK_DEAD(0x015D, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x16), // ŝ
+  UK_DEAD(0x015E, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x16), // Ş
+  UK_DEAD(0x015F, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x16), // ş
+  UK_DEAD(0x0162, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x17), // Ţ
+  UK_DEAD(0x0163, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x17), // ţ
+  UK_KEY(0x0166, UK_SHIFT_ALT_GR, 0x17),               // Ŧ
+  UK_KEY(0x0167, UK_ALT_GR, 0x17),                     // ŧ
+  UK_DEAD(0x0168, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x18), // Ũ
+  UK_DEAD(0x0169, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x18), // ũ
+  UK_DEAD(0x016A, UK_ALT_GR, 0x38, UK_SHIFT, 0x18),    // Ū
+  UK_DEAD(0x016B, UK_ALT_GR, 0x38, UK_PLAIN, 0x18),    // ū
+  UK_DEAD(0x016C, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x18), // Ŭ
+  UK_DEAD(0x016D, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x18), // ŭ
+  UK_DEAD(0x016E, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x18), // Ů
+  UK_DEAD(0x016F, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x18), // ů
+  UK_DEAD(0x0170, UK_SHIFT_ALT_GR, 0x1F, UK_SHIFT, 0x18), // Ű
+  UK_DEAD(0x0171, UK_SHIFT_ALT_GR, 0x1F, UK_PLAIN, 0x18), // ű
+  UK_DEAD(0x0172, UK_SHIFT_ALT_GR, 0x27, UK_SHIFT, 0x18), // Ų
+  UK_DEAD(0x0173, UK_SHIFT_ALT_GR, 0x27, UK_PLAIN, 0x18), // ų
+  UK_DEAD(0x0174, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x1A), // Ŵ
+  UK_DEAD(0x0175, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x1A), // ŵ
+  UK_DEAD(0x0176, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x1C), // Ŷ
+  UK_DEAD(0x0177, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x1C), // ŷ
+  UK_DEAD(0x0178, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x1C), // Ÿ
+  UK_DEAD(0x0179, UK_ALT_GR, 0x36, UK_SHIFT, 0x1D),    // Ź
+  UK_DEAD(0x017A, UK_ALT_GR, 0x36, UK_PLAIN, 0x1D),    // ź
+  UK_KEY(0x017F, UK_ALT_GR, 0x1A),                     // ſ
+  UK_DEAD(0x0181, UK_ALT_GR, 0x0D, UK_SHIFT, 0x05),    // Ɓ
+  UK_DEAD(0x0187, UK_ALT_GR, 0x0D, UK_SHIFT, 0x06),    // Ƈ
+  UK_DEAD(0x0188, UK_ALT_GR, 0x0D, UK_PLAIN, 0x06),    // ƈ
+  UK_DEAD(0x018A, UK_ALT_GR, 0x0D, UK_SHIFT, 0x07),    // Ɗ
+  UK_DEAD(0x0191, UK_ALT_GR, 0x0D, UK_SHIFT, 0x09),    // Ƒ
+  UK_DEAD(0x0192, UK_ALT_GR, 0x0D, UK_PLAIN, 0x09),    // ƒ
+  UK_DEAD(0x0193, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0A),    // Ɠ
+  UK_DEAD(0x0198, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0E),    // Ƙ
+  UK_DEAD(0x0199, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0E),    // ƙ
+  UK_DEAD(0x019D, UK_ALT_GR, 0x0D, UK_SHIFT, 0x11),    // Ɲ
+  UK_DEAD(0x01A0, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x12), // Ơ
+  UK_DEAD(0x01A1, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x12), // ơ
+  UK_DEAD(0x01A4, UK_ALT_GR, 0x0D, UK_SHIFT, 0x13),    // Ƥ
+  UK_DEAD(0x01A5, UK_ALT_GR, 0x0D, UK_PLAIN, 0x13),    // ƥ
+  UK_DEAD(0x01AC, UK_ALT_GR, 0x0D, UK_SHIFT, 0x17),    // Ƭ
+  UK_DEAD(0x01AD, UK_ALT_GR, 0x0D, UK_PLAIN, 0x17),    // ƭ
+  UK_DEAD(0x01AF, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x18), // Ư
+  UK_DEAD(0x01B0, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x18), // ư
+  UK_DEAD(0x01B2, UK_ALT_GR, 0x0D, UK_SHIFT, 0x19),    // Ʋ
+  UK_DEAD(0x01D5, UK_ALT_GR, 0x38, UK_SHIFT, 0x19),    // Ǖ
+  UK_DEAD(0x01D6, UK_ALT_GR, 0x38, UK_PLAIN, 0x19),    // ǖ
+  UK_DEAD(0x01D7, UK_ALT_GR, 0x36, UK_SHIFT, 0x19),    // Ǘ
+  UK_DEAD(0x01D8, UK_ALT_GR, 0x36, UK_PLAIN, 0x19),    // ǘ
+  UK_DEAD(0x01DB, UK_ALT_GR, 0x31, UK_SHIFT, 0x19),    // Ǜ
+  UK_DEAD(0x01DC, UK_ALT_GR, 0x31, UK_PLAIN, 0x19),    // ǜ
+  UK_DEAD(0x01E2, UK_ALT_GR, 0x38, UK_SHIFT_ALT_GR, 0x04), // Ǣ
+  UK_DEAD(0x01E3, UK_ALT_GR, 0x38, UK_ALT_GR, 0x04),   // ǣ
+  UK_DEAD(0x01EA, UK_SHIFT_ALT_GR, 0x27, UK_SHIFT, 0x12), // Ǫ
+  UK_DEAD(0x01EB, UK_SHIFT_ALT_GR, 0x27, UK_PLAIN, 0x12), // ǫ
+  UK_DEAD(0x01F4, UK_ALT_GR, 0x36, UK_SHIFT, 0x0A),    // Ǵ
+  UK_DEAD(0x01F5, UK_ALT_GR, 0x36, UK_PLAIN, 0x0A),    // ǵ
+  UK_DEAD(0x01F8, UK_ALT_GR, 0x31, UK_SHIFT, 0x11),    // Ǹ
+  UK_DEAD(0x01F9, UK_ALT_GR, 0x31, UK_PLAIN, 0x11),    // ǹ
+  UK_DEAD(0x01FC, UK_ALT_GR, 0x36, UK_SHIFT_ALT_GR, 0x04), // Ǽ
+  UK_DEAD(0x01FD, UK_ALT_GR, 0x36, UK_ALT_GR, 0x04),   // ǽ
+  UK_DEAD(0x01FE, UK_ALT_GR, 0x36, UK_SHIFT_ALT_GR, 0x12), // Ǿ
+  UK_DEAD(0x01FF, UK_ALT_GR, 0x36, UK_ALT_GR, 0x12),   // ǿ
+  UK_DEAD(0x0224, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1D),    // Ȥ
+  UK_DEAD(0x0225, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1D),    // ȥ
+  UK_DEAD(0x0228, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x08), // Ȩ
+  UK_DEAD(0x0229, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x08), // ȩ
+  UK_DEAD(0x0232, UK_ALT_GR, 0x38, UK_SHIFT, 0x1C),    // Ȳ
+  UK_DEAD(0x0233, UK_ALT_GR, 0x38, UK_PLAIN, 0x1C),    // ȳ
+  UK_DEAD(0x0253, UK_ALT_GR, 0x0D, UK_PLAIN, 0x05),    // ɓ
+  UK_DEAD(0x0257, UK_ALT_GR, 0x0D, UK_PLAIN, 0x07),    // ɗ
+  UK_DEAD(0x0260, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0A),    // ɠ
+  UK_DEAD(0x0266, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0B),    // ɦ
+  UK_DEAD(0x0271, UK_ALT_GR, 0x0D, UK_PLAIN, 0x10),    // ɱ
+  UK_DEAD(0x0272, UK_ALT_GR, 0x0D, UK_PLAIN, 0x11),    // ɲ
+  UK_DEAD(0x027C, UK_ALT_GR, 0x0D, UK_PLAIN, 0x15),    // ɼ
+  UK_DEAD(0x0282, UK_ALT_GR, 0x0D, UK_PLAIN, 0x16),    // ʂ
+  UK_DEAD(0x028B, UK_ALT_GR, 0x0D, UK_PLAIN, 0x19),    // ʋ
+  UK_DEAD(0x02A0, UK_ALT_GR, 0x0D, UK_PLAIN, 0x14),    // ʠ
+  UK_DEAD(0x02D8, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x2C), // ˘
+  UK_DEAD(0x02DB, UK_SHIFT_ALT_GR, 0x27, UK_PLAIN, 0x2C), // ˛
+  UK_DEAD(0x02DD, UK_SHIFT_ALT_GR, 0x1F, UK_PLAIN, 0x2C), // ˝
+  UK_DEAD(0x0309, UK_ALT_GR, 0x0D, UK_PLAIN, 0x2C),    // ̉
+  UK_DEAD(0x031B, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x2C), // ̛
+  UK_DEAD(0x0344, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x2D), // ̈́
+  UK_DEAD(0x038F, UK_ALT_GR, 0x36, UK_SHIFT_ALT_GR, 0x14), // Ώ
+  UK_KEY(0x03A9, UK_SHIFT_ALT_GR, 0x14),               // Ω
+  UK_DEAD(0x1E09, UK_ALT_GR, 0x36, UK_SHIFT, 0x33),    // ḉ
+  UK_DEAD(0x1E10, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x07), // Ḑ
+  UK_DEAD(0x1E11, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x07), // ḑ
+  UK_DEAD(0x1E15, UK_ALT_GR, 0x38, UK_PLAIN, 0x2F),    // ḕ
+  UK_DEAD(0x1E17, UK_ALT_GR, 0x38, UK_SHIFT, 0x2F),    // ḗ
+  UK_DEAD(0x1E20, UK_ALT_GR, 0x38, UK_SHIFT, 0x0A),    // Ḡ
+  UK_DEAD(0x1E21, UK_ALT_GR, 0x38, UK_PLAIN, 0x0A),    // ḡ
+  UK_DEAD(0x1E26, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x0B), // Ḧ
+  UK_DEAD(0x1E27, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x0B), // ḧ
+  UK_DEAD(0x1E28, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x0B), // Ḩ
+  UK_DEAD(0x1E29, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x0B), // ḩ
+  UK_DEAD(0x1E30, UK_ALT_GR, 0x36, UK_SHIFT, 0x0E),    // Ḱ
+  UK_DEAD(0x1E31, UK_ALT_GR, 0x36, UK_PLAIN, 0x0E),    // ḱ
+  UK_DEAD(0x1E3E, UK_ALT_GR, 0x36, UK_SHIFT, 0x10),    // Ḿ
+  UK_DEAD(0x1E3F, UK_ALT_GR, 0x36, UK_PLAIN, 0x10),    // ḿ
+  UK_DEAD(0x1E51, UK_ALT_GR, 0x38, UK_PLAIN, 0x33),    // ṑ
+  UK_DEAD(0x1E54, UK_ALT_GR, 0x36, UK_SHIFT, 0x13),    // Ṕ
+  UK_DEAD(0x1E55, UK_ALT_GR, 0x36, UK_PLAIN, 0x13),    // ṕ
+  UK_DEAD(0x1E7C, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x19), // Ṽ
+  UK_DEAD(0x1E7D, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x19), // ṽ
+  UK_DEAD(0x1E80, UK_ALT_GR, 0x31, UK_SHIFT, 0x1A),    // Ẁ
+  UK_DEAD(0x1E81, UK_ALT_GR, 0x31, UK_PLAIN, 0x1A),    // ẁ
+  UK_DEAD(0x1E82, UK_ALT_GR, 0x36, UK_SHIFT, 0x1A),    // Ẃ
+  UK_DEAD(0x1E83, UK_ALT_GR, 0x36, UK_PLAIN, 0x1A),    // ẃ
+  UK_DEAD(0x1E84, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x1A), // Ẅ
+  UK_DEAD(0x1E85, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x1A), // ẅ
+  UK_DEAD(0x1E8C, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x1B), // Ẍ
+  UK_DEAD(0x1E8D, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x1B), // ẍ
+  UK_DEAD(0x1E90, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x1D), // Ẑ
+  UK_DEAD(0x1E91, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x1D), // ẑ
+  UK_DEAD(0x1E97, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x17), // ẗ
+  UK_DEAD(0x1E98, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x1A), // ẘ
+  UK_DEAD(0x1E99, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x1C), // ẙ
+  UK_KEY(0x1E9E, UK_SHIFT_ALT_GR, 0x16),               // ẞ
+  UK_DEAD(0x1EA2, UK_ALT_GR, 0x0D, UK_SHIFT, 0x04),    // Ả
+  UK_DEAD(0x1EA3, UK_ALT_GR, 0x0D, UK_PLAIN, 0x04),    // ả
+  UK_DEAD(0x1EA7, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x34), // ầ
+  UK_DEAD(0x1EB1, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x34), // ằ
+  UK_DEAD(0x1EBA, UK_ALT_GR, 0x0D, UK_SHIFT, 0x08),    // Ẻ
+  UK_DEAD(0x1EBB, UK_ALT_GR, 0x0D, UK_PLAIN, 0x08),    // ẻ
+  UK_DEAD(0x1EBC, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x08), // Ẽ
+  UK_DEAD(0x1EBD, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x08), // ẽ
+  UK_DEAD(0x1EBF, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x2F), // ế
+  UK_DEAD(0x1EC1, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x2F), // ề
+  UK_DEAD(0x1EC8, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0C),    // Ỉ
+  UK_DEAD(0x1EC9, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0C),    // ỉ
+  UK_DEAD(0x1ECE, UK_ALT_GR, 0x0D, UK_SHIFT, 0x12),    // Ỏ
+  UK_DEAD(0x1ECF, UK_ALT_GR, 0x0D, UK_PLAIN, 0x12),    // ỏ
+  UK_DEAD(0x1ED3, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x33), // ồ
+  UK_DEAD(0x1EDD, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x33), // ờ
+  UK_DEAD(0x1EE6, UK_ALT_GR, 0x0D, UK_SHIFT, 0x18),    // Ủ
+  UK_DEAD(0x1EE7, UK_ALT_GR, 0x0D, UK_PLAIN, 0x18),    // ủ
+  UK_DEAD(0x1EEB, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x31), // ừ
+  UK_DEAD(0x1EF2, UK_ALT_GR, 0x31, UK_SHIFT, 0x1C),    // Ỳ
+  UK_DEAD(0x1EF3, UK_ALT_GR, 0x31, UK_PLAIN, 0x1C),    // ỳ
+  UK_DEAD(0x1EF6, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1C),    // Ỷ
+  UK_DEAD(0x1EF7, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1C),    // ỷ
+  UK_DEAD(0x1EF8, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x1C), // Ỹ
+  UK_DEAD(0x1EF9, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x1C), // ỹ
+  UK_DEAD(0x1FFA, UK_ALT_GR, 0x31, UK_SHIFT_ALT_GR, 0x14), // Ὼ
+  UK_KEY(0x2018, UK_SHIFT_ALT_GR, 0x19),               // ‘
+  UK_KEY(0x2019, UK_SHIFT_ALT_GR, 0x05),               // ’
+  UK_KEY(0x201C, UK_ALT_GR, 0x19),                     // “
+  UK_KEY(0x201D, UK_ALT_GR, 0x05),                     // ”
+  UK_DEAD(0x2070, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x27), // ⁰
+  UK_DEAD(0x2074, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x21), // ⁴
+  UK_DEAD(0x2075, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x22), // ⁵
+  UK_DEAD(0x2076, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x23), // ⁶
+  UK_DEAD(0x2077, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x24), // ⁷
+  UK_DEAD(0x2078, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x25), // ⁸
+  UK_DEAD(0x2079, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x26), // ⁹
+  UK_DEAD(0x207A, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x30), // ⁺
+  UK_DEAD(0x207B, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x38), // ⁻
+  UK_DEAD(0x207C, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x27), // ⁼
+  UK_DEAD(0x207D, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x25), // ⁽
+  UK_DEAD(0x207E, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x26), // ⁾
+  UK_KEY(0x20AC, UK_ALT_GR, 0x08),                     // €
+  UK_DEAD(0x20B5, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT_ALT_GR, 0x08), // ₵
+  UK_KEY(0x2122, UK_SHIFT_ALT_GR, 0x25),               // ™
+  UK_KEY(0x215B, UK_SHIFT_ALT_GR, 0x21),               // ⅛
+  UK_KEY(0x215C, UK_SHIFT_ALT_GR, 0x22),               // ⅜
+  UK_KEY(0x215D, UK_SHIFT_ALT_GR, 0x23),               // ⅝
+  UK_KEY(0x215E, UK_SHIFT_ALT_GR, 0x24),               // ⅞
+  UK_KEY(0x2190, UK_ALT_GR, 0x1C),                     // ←
+  UK_KEY(0x2191, UK_SHIFT_ALT_GR, 0x18),               // ↑
+  UK_KEY(0x2192, UK_ALT_GR, 0x0C),                     // →
+  UK_KEY(0x2193, UK_ALT_GR, 0x18),                     // ↓
+  UK_DEAD(0x2243, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x27), // ≃
+  UK_DEAD(0x2272, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x64), // ≲
+  UK_DEAD(0x2273, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x64), // ≳
+  UK_DEAD(0x2C6E, UK_ALT_GR, 0x0D, UK_SHIFT, 0x10),    // Ɱ
+  UK_DEAD(0x2C72, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1A),    // Ⱳ
+  UK_DEAD(0x2C73, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1A),    // ⱳ
+};
+#define UNICODE_KEYS_it_IT UnicodeKeys_it_IT, UNICODE_KEY_COUNT(UnicodeKeys_it_IT)
+
+// pt_PT (XKB "pt"): 466 characters, 402 of them after a dead key
+static const UnicodeKeyEntry UnicodeKeys_pt_PT[] = {
+  UK_KEY(0x00A1, UK_SHIFT_ALT_GR, 0x1E),               // ¡
+  UK_KEY(0x00A2, UK_SHIFT_ALT_GR, 0x08),               // ¢
+  UK_KEY(0x00A3, UK_ALT_GR, 0x20),                     // £
+  UK_KEY(0x00A5, UK_SHIFT_ALT_GR, 0x1C),               // ¥
+  UK_KEY(0x00A7, UK_ALT_GR, 0x21),                     // §
+  UK_KEY(0x00A9, UK_SHIFT_ALT_GR, 0x06),               // ©
+  UK_KEY(0x00AA, UK_SHIFT_ALT_GR, 0x09),               // ª
+  UK_KEY(0x00AB, UK_PLAIN, 0x2E),                      // «
+  UK_KEY(0x00AC, UK_ALT_GR, 0x35),                     // ¬
+  UK_KEY(0x00AE, UK_SHIFT_ALT_GR, 0x15),               // ®
+  UK_DEAD(0x00AF, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x2C), // ¯
+  UK_KEY(0x00B0, UK_SHIFT_ALT_GR, 0x27),               // °
+  UK_KEY(0x00B1, UK_SHIFT_ALT_GR, 0x26),               // ±
+  UK_DEAD(0x00B2, UK_SHIFT, 0x31, UK_PLAIN, 0x1F),     // ²
+  UK_DEAD(0x00B3, UK_SHIFT, 0x31, UK_PLAIN, 0x20),     // ³
+  UK_KEY(0x00B5, UK_ALT_GR, 0x10),                     // µ
+  UK_KEY(0x00B6, UK_ALT_GR, 0x15),                     // ¶
+  UK_KEY(0x00B7, UK_ALT_GR, 0x37),                     // ·
+  UK_DEAD(0x00B8, UK_ALT_GR, 0x2E, UK_PLAIN, 0x2C),    // ¸
+  UK_KEY(0x00B9, UK_ALT_GR, 0x1E),                     // ¹
+  UK_KEY(0x00BA, UK_PLAIN, 0x34),                      // º
+  UK_KEY(0x00BB, UK_SHIFT, 0x2E),                      // »
+  UK_KEY(0x00BD, UK_ALT_GR, 0x22),                     // ½
+  UK_KEY(0x00BF, UK_SHIFT_ALT_GR, 0x2D),               // ¿
+  UK_DEAD(0x00C0, UK_SHIFT, 0x30, UK_SHIFT, 0x04),     // À
+  UK_DEAD(0x00C1, UK_PLAIN, 0x30, UK_SHIFT, 0x04),     // Á
+  UK_DEAD(0x00C2, UK_SHIFT, 0x31, UK_SHIFT, 0x04),     // Â
+  UK_DEAD(0x00C3, UK_ALT_GR, 0x30, UK_SHIFT, 0x04),    // Ã
+  UK_DEAD(0x00C4, UK_ALT_GR, 0x2F, UK_SHIFT, 0x04),    // Ä
+  UK_DEAD(0x00C5, UK_SHIFT_ALT_GR, 0x2F, UK_SHIFT, 0x04), // Å
+  UK_KEY(0x00C6, UK_SHIFT_ALT_GR, 0x04),               // Æ
+  UK_KEY(0x00C7, UK_SHIFT, 0x33),                      // Ç
+  UK_DEAD(0x00C8, UK_SHIFT, 0x30, UK_SHIFT, 0x08),     // È
+  UK_DEAD(0x00C9, UK_PLAIN, 0x30, UK_SHIFT, 0x08),     // É
+  UK_DEAD(0x00CA, UK_SHIFT, 0x31, UK_SHIFT, 0x08),     // Ê
+  UK_DEAD(0x00CB, UK_ALT_GR, 0x2F, UK_SHIFT, 0x08),    // Ë
+  UK_DEAD(0x00CC, UK_SHIFT, 0x30, UK_SHIFT, 0x0C),     // Ì
+  UK_DEAD(0x00CD, UK_PLAIN, 0x30, UK_SHIFT, 0x0C),     // Í
+  UK_DEAD(0x00CE, UK_SHIFT, 0x31, UK_SHIFT, 0x0C),     // Î
+  UK_DEAD(0x00CF, UK_ALT_GR, 0x2F, UK_SHIFT, 0x0C),    // Ï
+  UK_KEY(0x00D0, UK_SHIFT_ALT_GR, 0x07),               // Ð
+  UK_DEAD(0x00D1, UK_ALT_GR, 0x30, UK_SHIFT, 0x11),    // Ñ
+  UK_DEAD(0x00D2, UK_SHIFT, 0x30, UK_SHIFT, 0x12),     // Ò
+  UK_DEAD(0x00D3, UK_PLAIN, 0x30, UK_SHIFT, 0x12),     // Ó
+  UK_DEAD(0x00D4, UK_SHIFT, 0x31, UK_SHIFT, 0x12),     // Ô
+  UK_DEAD(0x00D5, UK_ALT_GR, 0x30, UK_SHIFT, 0x12),    // Õ
+  UK_DEAD(0x00D6, UK_ALT_GR, 0x2F, UK_SHIFT, 0x12),    // Ö
+  UK_KEY(0x00D7, UK_SHIFT_ALT_GR, 0x36),               // ×
+  UK_KEY(0x00D8, UK_SHIFT_ALT_GR, 0x12),               // Ø
+  UK_DEAD(0x00D9, UK_SHIFT, 0x30, UK_SHIFT, 0x18),     // Ù
+  UK_DEAD(0x00DA, UK_PLAIN, 0x30, UK_SHIFT, 0x18),     // Ú
+  UK_DEAD(0x00DB, UK_SHIFT, 0x31, UK_SHIFT, 0x18),     // Û
+  UK_DEAD(0x00DC, UK_ALT_GR, 0x2F, UK_SHIFT, 0x18),    // Ü
+  UK_DEAD(0x00DD, UK_PLAIN, 0x30, UK_SHIFT, 0x1C),     // Ý
+  UK_KEY(0x00DE, UK_SHIFT_ALT_GR, 0x13),               // Þ
+  UK_KEY(0x00DF, UK_ALT_GR, 0x16),                     // ß
+  UK_DEAD(0x00E0, UK_SHIFT, 0x30, UK_PLAIN, 0x04),     // à
+  UK_DEAD(0x00E1, UK_PLAIN, 0x30, UK_PLAIN, 0x04),     // á
+  UK_DEAD(0x00E2, UK_SHIFT, 0x31, UK_PLAIN, 0x04),     // â
+  UK_DEAD(0x00E3, UK_ALT_GR, 0x30, UK_PLAIN, 0x04),    // ã
+  UK_DEAD(0x00E4, UK_ALT_GR, 0x2F, UK_PLAIN, 0x04),    // ä
+  UK_DEAD(0x00E5, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x04), // å
+  UK_KEY(0x00E6, UK_ALT_GR, 0x04),                     // æ
+  UK_KEY(0x00E7, UK_PLAIN, 0x33),                      // ç
+  UK_DEAD(0x00E8, UK_SHIFT, 0x30, UK_PLAIN, 0x08),     // è
+  UK_DEAD(0x00E9, UK_PLAIN, 0x30, UK_PLAIN, 0x08),     // é
+  UK_DEAD(0x00EA, UK_SHIFT, 0x31, UK_PLAIN, 0x08),     // ê
+  UK_DEAD(0x00EB, UK_ALT_GR, 0x2F, UK_PLAIN, 0x08),    // ë
+  UK_DEAD(0x00EC, UK_SHIFT, 0x30, UK_PLAIN, 0x0C),     // ì
+  UK_DEAD(0x00ED, UK_PLAIN, 0x30, UK_PLAIN, 0x0C),     // í
+  UK_DEAD(0x00EE, UK_SHIFT, 0x31, UK_PLAIN, 0x0C),     // î
+  UK_DEAD(0x00EF, UK_ALT_GR, 0x2F, UK_PLAIN, 0x0C),    // ï
+  UK_KEY(0x00F0, UK_ALT_GR, 0x07),                     // ð
+  UK_DEAD(0x00F1, UK_ALT_GR, 0x30, UK_PLAIN, 0x11),    // ñ
+  UK_DEAD(0x00F2, UK_SHIFT, 0x30, UK_PLAIN, 0x12),     // ò
+  UK_DEAD(0x00F3, UK_PLAIN, 0x30, UK_PLAIN, 0x12),     // ó
+  UK_DEAD(0x00F4, UK_SHIFT, 0x31, UK_PLAIN, 0x12),     // ô
+  UK_DEAD(0x00F5, UK_ALT_GR, 0x30, UK_PLAIN, 0x12),    // õ
+  UK_DEAD(0x00F6, UK_ALT_GR, 0x2F, UK_PLAIN, 0x12),    // ö
+  UK_KEY(0x00F7, UK_SHIFT_ALT_GR, 0x37),               // ÷
+  UK_KEY(0x00F8, UK_ALT_GR, 0x12),                     // ø
+  UK_DEAD(0x00F9, UK_SHIFT, 0x30, UK_PLAIN, 0x18),     // ù
+  UK_DEAD(0x00FA, UK_PLAIN, 0x30, UK_PLAIN, 0x18),     // ú
+  UK_DEAD(0x00FB, UK_SHIFT, 0x31, UK_PLAIN, 0x18),     // û
+  UK_DEAD(0x00FC, UK_ALT_GR, 0x2F, UK_PLAIN, 0x18),    // ü
+  UK_DEAD(0x00FD, UK_PLAIN, 0x30, UK_PLAIN, 0x1C),     // ý
+  UK_KEY(0x00FE, UK_ALT_GR, 0x13),                     // þ
+  UK_DEAD(0x00FF, UK_ALT_GR, 0x2F, UK_PLAIN, 0x1C),    // ÿ
+  UK_DEAD(0x0100, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x04), // Ā
+  UK_DEAD(0x0101, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x04), // ā
+  UK_DEAD(0x0102, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x04), // Ă
+  UK_DEAD(0x0103, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x04), // ă
+  UK_DEAD(0x0104, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x04), // Ą
+  UK_DEAD(0x0105, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x04), // ą
+  UK_DEAD(0x0106, UK_PLAIN, 0x30, UK_SHIFT, 0x06),     // Ć
+  UK_DEAD(0x0107, UK_PLAIN, 0x30, UK_PLAIN, 0x06),     // ć
+  UK_DEAD(0x0108, UK_SHIFT, 0x31, UK_SHIFT, 0x06),     // Ĉ
+  UK_DEAD(0x0109, UK_SHIFT, 0x31, UK_PLAIN, 0x06),     // ĉ
+  UK_DEAD(0x010A, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x06), // Ċ
+  UK_DEAD(0x010B, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x06), // ċ
+  UK_DEAD(0x010C, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x06), // Č
+  UK_DEAD(0x010D, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x06), // č
+  UK_DEAD(0x010E, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x07), // Ď
+  UK_DEAD(0x010F, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x07), // ď
+  UK_KEY(0x0111, UK_ALT_GR, 0x09),                     // đ
+  UK_DEAD(0x0112, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x08), // Ē
+  UK_DEAD(0x0113, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x08), // ē
+  UK_DEAD(0x0114, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x08), // Ĕ
+  UK_DEAD(0x0115, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x08), // ĕ
+  UK_DEAD(0x0116, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x08), // Ė
+  UK_DEAD(0x0117, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x08), // ė
+  UK_DEAD(0x0118, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x08), // Ę
+  UK_DEAD(0x0119, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x08), // ę
+  UK_DEAD(0x011A, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x08), // Ě
+  UK_DEAD(0x011B, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x08), // ě
+  UK_DEAD(0x011C, UK_SHIFT, 0x31, UK_SHIFT, 0x0A),     // Ĝ
+  UK_DEAD(0x011D, UK_SHIFT, 0x31, UK_PLAIN, 0x0A),     // ĝ
+  UK_DEAD(0x011E, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x0A), // Ğ
+  UK_DEAD(0x011F, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x0A), // ğ
+  UK_DEAD(0x0120, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x0A), // Ġ
+  UK_DEAD(0x0121, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x0A), // ġ
+  UK_DEAD(0x0122, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0A),    // Ģ
+  UK_DEAD(0x0123, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0A),    // ģ
+  UK_DEAD(0x0124, UK_SHIFT, 0x31, UK_SHIFT, 0x0B),     // Ĥ
+  UK_DEAD(0x0125, UK_SHIFT, 0x31, UK_PLAIN, 0x0B),     // ĥ
+  UK_KEY(0x0126, UK_SHIFT_ALT_GR, 0x0B),               // Ħ
+  UK_KEY(0x0127, UK_ALT_GR, 0x0B),                     // ħ
+  UK_DEAD(0x0128, UK_ALT_GR, 0x30, UK_SHIFT, 0x0C),    // Ĩ
+  UK_DEAD(0x0129, UK_ALT_GR, 0x30, UK_PLAIN, 0x0C),    // ĩ
+  UK_DEAD(0x012A, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0C), // Ī
+  UK_DEAD(0x012B, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0C), // ī
+  UK_DEAD(0x012C, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x0C), // Ĭ
+  UK_DEAD(0x012D, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x0C), // ĭ
+  UK_DEAD(0x012E, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x0C), // Į
+  UK_DEAD(0x012F, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x0C), // į
+  UK_DEAD(0x0130, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x0C), // İ
+  UK_KEY(0x0131, UK_SHIFT_ALT_GR, 0x0C),               // ı
+  UK_DEAD(0x0134, UK_SHIFT, 0x31, UK_SHIFT, 0x0D),     // Ĵ
+  UK_DEAD(0x0135, UK_SHIFT, 0x31, UK_PLAIN, 0x0D),     // ĵ
+  UK_DEAD(0x0136, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0E),    // Ķ
+  UK_DEAD(0x0137, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0E),    // ķ
+  UK_KEY(0x0138, UK_ALT_GR, 0x0E),                     // ĸ
+  UK_DEAD(0x0139, UK_PLAIN, 0x30, UK_SHIFT, 0x0F),     // Ĺ
+  UK_DEAD(0x013A, UK_PLAIN, 0x30, UK_PLAIN, 0x0F),     // ĺ
+  UK_DEAD(0x013B, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0F),    // Ļ
+  UK_DEAD(0x013C, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0F),    // ļ
+  UK_DEAD(0x013D, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0F), // Ľ
+  UK_DEAD(0x013E, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0F), // ľ
+  UK_DEAD(0x013F, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x0F), // Ŀ
+  UK_DEAD(0x0140, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x0F), // ŀ
+  UK_KEY(0x0141, UK_SHIFT_ALT_GR, 0x0F),               // Ł
+  UK_KEY(0x0142, UK_ALT_GR, 0x0F),                     // ł
+  UK_DEAD(0x0143, UK_PLAIN, 0x30, UK_SHIFT, 0x11),     // Ń
+  UK_DEAD(0x0144, UK_PLAIN, 0x30, UK_PLAIN, 0x11),     // ń
+  UK_DEAD(0x0145, UK_ALT_GR, 0x2E, UK_SHIFT, 0x11),    // Ņ
+  UK_DEAD(0x0146, UK_ALT_GR, 0x2E, UK_PLAIN, 0x11),    // ņ
+  UK_DEAD(0x0147, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x11), // Ň
+  UK_DEAD(0x0148, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x11), // ň
+  UK_KEY(0x014A, UK_SHIFT_ALT_GR, 0x0A),               // Ŋ
+  UK_KEY(0x014B, UK_ALT_GR, 0x0A),                     // ŋ
+  UK_DEAD(0x014C, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x12), // Ō
+  UK_DEAD(0x014D, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x12), // ō
+  UK_DEAD(0x014E, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x12), // Ŏ
+  UK_DEAD(0x014F, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x12), // ŏ
+  UK_DEAD(0x0150, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x12), // Ő
+  UK_DEAD(0x0151, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x12), // ő
+  UK_DEAD(0x0154, UK_PLAIN, 0x30, UK_SHIFT, 0x15),     // Ŕ
+  UK_DEAD(0x0155, UK_PLAIN, 0x30, UK_PLAIN, 0x15),     // ŕ
+  UK_DEAD(0x0156, UK_ALT_GR, 0x2E, UK_SHIFT, 0x15),    // Ŗ
+  UK_DEAD(0x0157, UK_ALT_GR, 0x2E, UK_PLAIN, 0x15),    // ŗ
+  UK_DEAD(0x0158, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x15), // Ř
+  UK_DEAD(0x0159, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x15), // ř
+  UK_DEAD(0x015A, UK_PLAIN, 0x30, UK_SHIFT, 0x16),     // Ś
+  UK_DEAD(0x015B, UK_PLAIN, 0x30, UK_PLAIN, 0x16),     // ś
+  UK_DEAD(0x015C, UK_SHIFT, 0x31, UK_SHIFT, 0x16),     // Ŝ
+  UK_DEAD(0x015D, UK_SHIFT, 0x31, UK_PLAIN, 0x16),     // ŝ
+  UK_DEAD(0x015E, UK_ALT_GR, 0x2E, UK_SHIFT, 0x16),    // Ş
+  UK_DEAD(0x015F, UK_ALT_GR, 0x2E, UK_PLAIN, 0x16),    // ş
+  UK_DEAD(0x0160, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x16), // Š
+  UK_DEAD(0x0161, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x16), // š
+  UK_DEAD(0x0162, UK_ALT_GR, 0x2E, UK_SHIFT, 0x17),    // Ţ
+  UK_DEAD(0x0163, UK_ALT_GR, 0x2E, UK_PLAIN, 0x17),    // ţ
+  UK_DEAD(0x0164, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x17), // Ť
+  UK_DEAD(0x0165, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x17), // ť
+  UK_KEY(0x0166, UK_SHIFT_ALT_GR, 0x17),               // Ŧ
+  UK_KEY(0x0167, UK_ALT_GR, 0x17),                     // ŧ
+  UK_DEAD(0x0168, UK_ALT_GR, 0x30, UK_SHIFT, 0x18),    // Ũ
+  UK_DEAD(0x0169, UK_ALT_GR, 0x30, UK_PLAIN, 0x18),    // ũ
+  UK_DEAD(0x016A, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x18), // Ū
+  UK_DEAD(0x016B, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x18), // ū
+  UK_DEAD(0x016C, UK_SHIFT_ALT_GR, 0x31, UK_SHIFT, 0x18), // Ŭ
+  UK_DEAD(0x016D, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x18), // ŭ
+  UK_DEAD(0x016E, UK_SHIFT_ALT_GR, 0x2F, UK_SHIFT, 0x18), // Ů
+  UK_DEAD(0x016F, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x18), // ů
+  UK_DEAD(0x0170, UK_SHIFT_ALT_GR, 0x33, UK_SHIFT, 0x18), // Ű
+  UK_DEAD(0x0171, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x18), // ű
+  UK_DEAD(0x0172, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x18), // Ų
+  UK_DEAD(0x0173, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x18), // ų
+  UK_DEAD(0x0174, UK_SHIFT, 0x31, UK_SHIFT, 0x1A),     // Ŵ
+  UK_DEAD(0x0175, UK_SHIFT, 0x31, UK_PLAIN, 0x1A),     // ŵ
+  UK_DEAD(0x0176, UK_SHIFT, 0x31, UK_SHIFT, 0x1C),     // Ŷ
+  UK_DEAD(0x0177, UK_SHIFT, 0x31, UK_PLAIN, 0x1C),     // ŷ
+  UK_DEAD(0x0178, UK_ALT_GR, 0x2F, UK_SHIFT, 0x1C),    // Ÿ
+  UK_DEAD(0x0179, UK_PLAIN, 0x30, UK_SHIFT, 0x1D),     // Ź
+  UK_DEAD(0x017A, UK_PLAIN, 0x30, UK_PLAIN, 0x1D),     // ź
+  UK_DEAD(0x017B, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x1D), // Ż
+  UK_DEAD(0x017C, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x1D), // ż
+  UK_DEAD(0x017D, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x1D), // Ž
+  UK_DEAD(0x017E, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x1D), // ž
+  UK_KEY(0x017F, UK_ALT_GR, 0x1A),                     // ſ
+  UK_DEAD(0x0181, UK_ALT_GR, 0x0D, UK_SHIFT, 0x05),    // Ɓ
+  UK_DEAD(0x0187, UK_ALT_GR, 0x0D, UK_SHIFT, 0x06),    // Ƈ
+  UK_DEAD(0x0188, UK_ALT_GR, 0x0D, UK_PLAIN, 0x06),    // ƈ
+  UK_DEAD(0x018A, UK_ALT_GR, 0x0D, UK_SHIFT, 0x07),    // Ɗ
+  UK_DEAD(0x0191, UK_ALT_GR, 0x0D, UK_SHIFT, 0x09),    // Ƒ
+  UK_DEAD(0x0192, UK_ALT_GR, 0x0D, UK_PLAIN, 0x09),    // ƒ
+  UK_DEAD(0x0193, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0A),    // Ɠ
+  UK_DEAD(0x0198, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0E),    // Ƙ
+  UK_DEAD(0x0199, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0E),    // ƙ
+  UK_DEAD(0x019D, UK_ALT_GR, 0x0D, UK_SHIFT, 0x11),    // Ɲ
+  UK_DEAD(0x01A0, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x12), // Ơ
+  UK_DEAD(0x01A1, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x12), // ơ
+  UK_DEAD(0x01A4, UK_ALT_GR, 0x0D, UK_SHIFT, 0x13),    // Ƥ
+  UK_DEAD(0x01A5, UK_ALT_GR, 0x0D, UK_PLAIN, 0x13),    // ƥ
+  UK_DEAD(0x01AC, UK_ALT_GR, 0x0D, UK_SHIFT, 0x17),    // Ƭ
+  UK_DEAD(0x01AD, UK_ALT_GR, 0x0D, UK_PLAIN, 0x17),    // ƭ
+  UK_DEAD(0x01AF, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x18), // Ư
+  UK_DEAD(0x01B0, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x18), // ư
+  UK_DEAD(0x01B2, UK_ALT_GR, 0x0D, UK_SHIFT, 0x19),    // Ʋ
+  UK_DEAD(0x01CD, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x04), // Ǎ
+  UK_DEAD(0x01CE, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x04), // ǎ
+  UK_DEAD(0x01CF, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0C), // Ǐ
+  UK_DEAD(0x01D0, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0C), // ǐ
+  UK_DEAD(0x01D1, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x12), // Ǒ
+  UK_DEAD(0x01D2, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x12), // ǒ
+  UK_DEAD(0x01D3, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x18), // Ǔ
+  UK_DEAD(0x01D4, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x18), // ǔ
+  UK_DEAD(0x01D5, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x19), // Ǖ
+  UK_DEAD(0x01D6, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x19), // ǖ
+  UK_DEAD(0x01D7, UK_PLAIN, 0x30, UK_SHIFT, 0x19),     // Ǘ
+  UK_DEAD(0x01D8, UK_PLAIN, 0x30, UK_PLAIN, 0x19),     // ǘ
+  UK_DEAD(0x01D9, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x19), // Ǚ
+  UK_DEAD(0x01DA, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x19), // ǚ
+  UK_DEAD(0x01DB, UK_SHIFT, 0x30, UK_SHIFT, 0x19),     // Ǜ
+  UK_DEAD(0x01DC, UK_SHIFT, 0x30, UK_PLAIN, 0x19),     // ǜ
+  UK_DEAD(0x01E2, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT_ALT_GR, 0x04), // Ǣ
+  UK_DEAD(0x01E3, UK_SHIFT_ALT_GR, 0x30, UK_ALT_GR, 0x04), // ǣ
+  UK_DEAD(0x01E6, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0A), // Ǧ
+  UK_DEAD(0x01E7, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0A), // ǧ
+  UK_DEAD(0x01E8, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0E), // Ǩ
+  UK_DEAD(0x01E9, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0E), // ǩ
+  UK_DEAD(0x01EA, UK_SHIFT_ALT_GR, 0x2E, UK_SHIFT, 0x12), // Ǫ
+  UK_DEAD(0x01EB, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x12), // ǫ
+  UK_DEAD(0x01F0, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0D), // ǰ
+  UK_DEAD(0x01F4, UK_PLAIN, 0x30, UK_SHIFT, 0x0A),     // Ǵ
+  UK_DEAD(0x01F5, UK_PLAIN, 0x30, UK_PLAIN, 0x0A),     // ǵ
+  UK_DEAD(0x01F8, UK_SHIFT, 0x30, UK_SHIFT, 0x11),     // Ǹ
+  UK_DEAD(0x01F9, UK_SHIFT, 0x30, UK_PLAIN, 0x11),     // ǹ
+  UK_DEAD(0x01FC, UK_PLAIN, 0x30, UK_SHIFT_ALT_GR, 0x04), // Ǽ
+  UK_DEAD(0x01FD, UK_PLAIN, 0x30, UK_ALT_GR, 0x04),    // ǽ
+  UK_DEAD(0x01FE, UK_PLAIN, 0x30, UK_SHIFT_ALT_GR, 0x12), // Ǿ
+  UK_DEAD(0x01FF, UK_PLAIN, 0x30, UK_ALT_GR, 0x12),    // ǿ
+  UK_DEAD(0x021E, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x0B), // Ȟ
+  UK_DEAD(0x021F, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x0B), // ȟ
+  UK_DEAD(0x0224, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1D),    // Ȥ
+  UK_DEAD(0x0225, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1D),    // ȥ
+  UK_DEAD(0x0226, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x04), // Ȧ
+  UK_DEAD(0x0227, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x04), // ȧ
+  UK_DEAD(0x0228, UK_ALT_GR, 0x2E, UK_SHIFT, 0x08),    // Ȩ
+  UK_DEAD(0x0229, UK_ALT_GR, 0x2E, UK_PLAIN, 0x08),    // ȩ
+  UK_DEAD(0x022E, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x12), // Ȯ
+  UK_DEAD(0x022F, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x12), // ȯ
+  UK_DEAD(0x0232, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x1C), // Ȳ
+  UK_DEAD(0x0233, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x1C), // ȳ
+  UK_DEAD(0x0237, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x0D), // ȷ
+  UK_DEAD(0x0253, UK_ALT_GR, 0x0D, UK_PLAIN, 0x05),    // ɓ
+  UK_DEAD(0x0257, UK_ALT_GR, 0x0D, UK_PLAIN, 0x07),    // ɗ
+  UK_DEAD(0x0260, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0A),    // ɠ
+  UK_DEAD(0x0266, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0B),    // ɦ
+  UK_DEAD(0x0271, UK_ALT_GR, 0x0D, UK_PLAIN, 0x10),    // ɱ
+  UK_DEAD(0x0272, UK_ALT_GR, 0x0D, UK_PLAIN, 0x11),    // ɲ
+  UK_DEAD(0x027C, UK_ALT_GR, 0x0D, UK_PLAIN, 0x15),    // ɼ
+  UK_DEAD(0x0282, UK_ALT_GR, 0x0D, UK_PLAIN, 0x16),    // ʂ
+  UK_DEAD(0x028B, UK_ALT_GR, 0x0D, UK_PLAIN, 0x19),    // ʋ
+  UK_DEAD(0x02A0, UK_ALT_GR, 0x0D, UK_PLAIN, 0x14),    // ʠ
+  UK_DEAD(0x02C7, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x2C), // ˇ
+  UK_DEAD(0x02D8, UK_SHIFT_ALT_GR, 0x31, UK_PLAIN, 0x2C), // ˘
+  UK_DEAD(0x02D9, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x2C), // ˙
+  UK_DEAD(0x02DB, UK_SHIFT_ALT_GR, 0x2E, UK_PLAIN, 0x2C), // ˛
+  UK_DEAD(0x02DD, UK_SHIFT_ALT_GR, 0x33, UK_PLAIN, 0x2C), // ˝
+  UK_DEAD(0x0309, UK_ALT_GR, 0x0D, UK_PLAIN, 0x2C),    // ̉
+  UK_DEAD(0x031B, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x2C), // ̛
+  UK_DEAD(0x0323, UK_ALT_GR, 0x38, UK_PLAIN, 0x2C),    // ̣
+  UK_DEAD(0x0344, UK_ALT_GR, 0x2F, UK_PLAIN, 0x2D),    // ̈́
+  UK_DEAD(0x038F, UK_PLAIN, 0x30, UK_SHIFT_ALT_GR, 0x14), // Ώ
+  UK_KEY(0x03A9, UK_SHIFT_ALT_GR, 0x14),               // Ω
+  UK_DEAD(0x1E02, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x05), // Ḃ
+  UK_DEAD(0x1E03, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x05), // ḃ
+  UK_DEAD(0x1E04, UK_ALT_GR, 0x38, UK_SHIFT, 0x05),    // Ḅ
+  UK_DEAD(0x1E05, UK_ALT_GR, 0x38, UK_PLAIN, 0x05),    // ḅ
+  UK_DEAD(0x1E08, UK_PLAIN, 0x30, UK_SHIFT, 0x33),     // Ḉ
+  UK_DEAD(0x1E09, UK_PLAIN, 0x30, UK_PLAIN, 0x33),     // ḉ
+  UK_DEAD(0x1E0A, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x07), // Ḋ
+  UK_DEAD(0x1E0B, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x07), // ḋ
+  UK_DEAD(0x1E0C, UK_ALT_GR, 0x38, UK_SHIFT, 0x07),    // Ḍ
+  UK_DEAD(0x1E0D, UK_ALT_GR, 0x38, UK_PLAIN, 0x07),    // ḍ
+  UK_DEAD(0x1E10, UK_ALT_GR, 0x2E, UK_SHIFT, 0x07),    // Ḑ
+  UK_DEAD(0x1E11, UK_ALT_GR, 0x2E, UK_PLAIN, 0x07),    // ḑ
+  UK_DEAD(0x1E1E, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x09), // Ḟ
+  UK_DEAD(0x1E1F, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x09), // ḟ
+  UK_DEAD(0x1E20, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0A), // Ḡ
+  UK_DEAD(0x1E21, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0A), // ḡ
+  UK_DEAD(0x1E22, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x0B), // Ḣ
+  UK_DEAD(0x1E23, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x0B), // ḣ
+  UK_DEAD(0x1E24, UK_ALT_GR, 0x38, UK_SHIFT, 0x0B),    // Ḥ
+  UK_DEAD(0x1E25, UK_ALT_GR, 0x38, UK_PLAIN, 0x0B),    // ḥ
+  UK_DEAD(0x1E26, UK_ALT_GR, 0x2F, UK_SHIFT, 0x0B),    // Ḧ
+  UK_DEAD(0x1E27, UK_ALT_GR, 0x2F, UK_PLAIN, 0x0B),    // ḧ
+  UK_DEAD(0x1E28, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0B),    // Ḩ
+  UK_DEAD(0x1E29, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0B),    // ḩ
+  UK_DEAD(0x1E30, UK_PLAIN, 0x30, UK_SHIFT, 0x0E),     // Ḱ
+  UK_DEAD(0x1E31, UK_PLAIN, 0x30, UK_PLAIN, 0x0E),     // ḱ
+  UK_DEAD(0x1E32, UK_ALT_GR, 0x38, UK_SHIFT, 0x0E),    // Ḳ
+  UK_DEAD(0x1E33, UK_ALT_GR, 0x38, UK_PLAIN, 0x0E),    // ḳ
+  UK_DEAD(0x1E36, UK_ALT_GR, 0x38, UK_SHIFT, 0x0F),    // Ḷ
+  UK_DEAD(0x1E37, UK_ALT_GR, 0x38, UK_PLAIN, 0x0F),    // ḷ
+  UK_DEAD(0x1E3E, UK_PLAIN, 0x30, UK_SHIFT, 0x10),     // Ḿ
+  UK_DEAD(0x1E3F, UK_PLAIN, 0x30, UK_PLAIN, 0x10),     // ḿ
+  UK_DEAD(0x1E40, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x10), // Ṁ
+  UK_DEAD(0x1E41, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x10), // ṁ
+  UK_DEAD(0x1E42, UK_ALT_GR, 0x38, UK_SHIFT, 0x10),    // Ṃ
+  UK_DEAD(0x1E43, UK_ALT_GR, 0x38, UK_PLAIN, 0x10),    // ṃ
+  UK_DEAD(0x1E44, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x11), // Ṅ
+  UK_DEAD(0x1E45, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x11), // ṅ
+  UK_DEAD(0x1E46, UK_ALT_GR, 0x38, UK_SHIFT, 0x11),    // Ṇ
+  UK_DEAD(0x1E47, UK_ALT_GR, 0x38, UK_PLAIN, 0x11),    // ṇ
+  UK_DEAD(0x1E54, UK_PLAIN, 0x30, UK_SHIFT, 0x13),     // Ṕ
+  UK_DEAD(0x1E55, UK_PLAIN, 0x30, UK_PLAIN, 0x13),     // ṕ
+  UK_DEAD(0x1E56, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x13), // Ṗ
+  UK_DEAD(0x1E57, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x13), // ṗ
+  UK_DEAD(0x1E58, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x15), // Ṙ
+  UK_DEAD(0x1E59, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x15), // ṙ
+  UK_DEAD(0x1E5A, UK_ALT_GR, 0x38, UK_SHIFT, 0x15),    // Ṛ
+  UK_DEAD(0x1E5B, UK_ALT_GR, 0x38, UK_PLAIN, 0x15),    // ṛ
+  UK_DEAD(0x1E60, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x16), // Ṡ
+  UK_DEAD(0x1E61, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x16), // ṡ
+  UK_DEAD(0x1E62, UK_ALT_GR, 0x38, UK_SHIFT, 0x16),    // Ṣ
+  UK_DEAD(0x1E63, UK_ALT_GR, 0x38, UK_PLAIN, 0x16),    // ṣ
+  UK_DEAD(0x1E6A, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x17), // Ṫ
+  UK_DEAD(0x1E6B, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x17), // ṫ
+  UK_DEAD(0x1E6C, UK_ALT_GR, 0x38, UK_SHIFT, 0x17),    // Ṭ
+  UK_DEAD(0x1E6D, UK_ALT_GR, 0x38, UK_PLAIN, 0x17),    // ṭ
+  UK_DEAD(0x1E7C, UK_ALT_GR, 0x30, UK_SHIFT, 0x19),    // Ṽ
+  UK_DEAD(0x1E7D, UK_ALT_GR, 0x30, UK_PLAIN, 0x19),    // ṽ
+  UK_DEAD(0x1E7E, UK_ALT_GR, 0x38, UK_SHIFT, 0x19),    // Ṿ
+  UK_DEAD(0x1E7F, UK_ALT_GR, 0x38, UK_PLAIN, 0x19),    // ṿ
+  UK_DEAD(0x1E80, UK_SHIFT, 0x30, UK_SHIFT, 0x1A),     // Ẁ
+  UK_DEAD(0x1E81, UK_SHIFT, 0x30, UK_PLAIN, 0x1A),     // ẁ
+  UK_DEAD(0x1E82, UK_PLAIN, 0x30, UK_SHIFT, 0x1A),     // Ẃ
+  UK_DEAD(0x1E83, UK_PLAIN, 0x30, UK_PLAIN, 0x1A),     // ẃ
+  UK_DEAD(0x1E84, UK_ALT_GR, 0x2F, UK_SHIFT, 0x1A),    // Ẅ
+  UK_DEAD(0x1E85, UK_ALT_GR, 0x2F, UK_PLAIN, 0x1A),    // ẅ
+  UK_DEAD(0x1E86, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x1A), // Ẇ
+  UK_DEAD(0x1E87, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x1A), // ẇ
+  UK_DEAD(0x1E88, UK_ALT_GR, 0x38, UK_SHIFT, 0x1A),    // Ẉ
+  UK_DEAD(0x1E89, UK_ALT_GR, 0x38, UK_PLAIN, 0x1A),    // ẉ
+  UK_DEAD(0x1E8A, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x1B), // Ẋ
+  UK_DEAD(0x1E8B, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x1B), // ẋ
+  UK_DEAD(0x1E8C, UK_ALT_GR, 0x2F, UK_SHIFT, 0x1B),    // Ẍ
+  UK_DEAD(0x1E8D, UK_ALT_GR, 0x2F, UK_PLAIN, 0x1B),    // ẍ
+  UK_DEAD(0x1E8E, UK_SHIFT_ALT_GR, 0x38, UK_SHIFT, 0x1C), // Ẏ
+  UK_DEAD(0x1E8F, UK_SHIFT_ALT_GR, 0x38, UK_PLAIN, 0x1C), // ẏ
+  UK_DEAD(0x1E90, UK_SHIFT, 0x31, UK_SHIFT, 0x1D),     // Ẑ
+  UK_DEAD(0x1E91, UK_SHIFT, 0x31, UK_PLAIN, 0x1D),     // ẑ
+  UK_DEAD(0x1E92, UK_ALT_GR, 0x38, UK_SHIFT, 0x1D),    // Ẓ
+  UK_DEAD(0x1E93, UK_ALT_GR, 0x38, UK_PLAIN, 0x1D),    // ẓ
+  UK_DEAD(0x1E97, UK_ALT_GR, 0x2F, UK_PLAIN, 0x17),    // ẗ
+  UK_DEAD(0x1E98, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x1A), // ẘ
+  UK_DEAD(0x1E99, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x1C), // ẙ
+  UK_DEAD(0x1E9B, UK_SHIFT_ALT_GR, 0x38, UK_ALT_GR, 0x1A), // ẛ
+  UK_KEY(0x1E9E, UK_SHIFT_ALT_GR, 0x16),               // ẞ
+  UK_DEAD(0x1EA0, UK_ALT_GR, 0x38, UK_SHIFT, 0x04),    // Ạ
+  UK_DEAD(0x1EA1, UK_ALT_GR, 0x38, UK_PLAIN, 0x04),    // ạ
+  UK_DEAD(0x1EA2, UK_ALT_GR, 0x0D, UK_SHIFT, 0x04),    // Ả
+  UK_DEAD(0x1EA3, UK_ALT_GR, 0x0D, UK_PLAIN, 0x04),    // ả
+  UK_DEAD(0x1EB8, UK_ALT_GR, 0x38, UK_SHIFT, 0x08),    // Ẹ
+  UK_DEAD(0x1EB9, UK_ALT_GR, 0x38, UK_PLAIN, 0x08),    // ẹ
+  UK_DEAD(0x1EBA, UK_ALT_GR, 0x0D, UK_SHIFT, 0x08),    // Ẻ
+  UK_DEAD(0x1EBB, UK_ALT_GR, 0x0D, UK_PLAIN, 0x08),    // ẻ
+  UK_DEAD(0x1EBC, UK_ALT_GR, 0x30, UK_SHIFT, 0x08),    // Ẽ
+  UK_DEAD(0x1EBD, UK_ALT_GR, 0x30, UK_PLAIN, 0x08),    // ẽ
+  UK_DEAD(0x1EC8, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0C),    // Ỉ
+  UK_DEAD(0x1EC9, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0C),    // ỉ
+  UK_DEAD(0x1ECA, UK_ALT_GR, 0x38, UK_SHIFT, 0x0C),    // Ị
+  UK_DEAD(0x1ECB, UK_ALT_GR, 0x38, UK_PLAIN, 0x0C),    // ị
+  UK_DEAD(0x1ECC, UK_ALT_GR, 0x38, UK_SHIFT, 0x12),    // Ọ
+  UK_DEAD(0x1ECD, UK_ALT_GR, 0x38, UK_PLAIN, 0x12),    // ọ
+  UK_DEAD(0x1ECE, UK_ALT_GR, 0x0D, UK_SHIFT, 0x12),    // Ỏ
+  UK_DEAD(0x1ECF, UK_ALT_GR, 0x0D, UK_PLAIN, 0x12),    // ỏ
+  UK_DEAD(0x1EE4, UK_ALT_GR, 0x38, UK_SHIFT, 0x18),    // Ụ
+  UK_DEAD(0x1EE5, UK_ALT_GR, 0x38, UK_PLAIN, 0x18),    // ụ
+  UK_DEAD(0x1EE6, UK_ALT_GR, 0x0D, UK_SHIFT, 0x18),    // Ủ
+  UK_DEAD(0x1EE7, UK_ALT_GR, 0x0D, UK_PLAIN, 0x18),    // ủ
+  UK_DEAD(0x1EF2, UK_SHIFT, 0x30, UK_SHIFT, 0x1C),     // Ỳ
+  UK_DEAD(0x1EF3, UK_SHIFT, 0x30, UK_PLAIN, 0x1C),     // ỳ
+  UK_DEAD(0x1EF4, UK_ALT_GR, 0x38, UK_SHIFT, 0x1C),    // Ỵ
+  UK_DEAD(0x1EF5, UK_ALT_GR, 0x38, UK_PLAIN, 0x1C),    // ỵ
+  UK_DEAD(0x1EF6, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1C),    // Ỷ
+  UK_DEAD(0x1EF7, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1C),    // ỷ
+  UK_DEAD(0x1EF8, UK_ALT_GR, 0x30, UK_SHIFT, 0x1C),    // Ỹ
+  UK_DEAD(0x1EF9, UK_ALT_GR, 0x30, UK_PLAIN, 0x1C),    // ỹ
+  UK_DEAD(0x1FFA, UK_SHIFT, 0x30, UK_SHIFT_ALT_GR, 0x14), // Ὼ
+  UK_KEY(0x2018, UK_SHIFT_ALT_GR, 0x05),               // ‘
+  UK_KEY(0x2019, UK_SHIFT_ALT_GR, 0x11),               // ’
+  UK_KEY(0x201A, UK_SHIFT_ALT_GR, 0x19),               // ‚
+  UK_KEY(0x201C, UK_ALT_GR, 0x05),                     // “
+  UK_KEY(0x201D, UK_ALT_GR, 0x11),                     // ”
+  UK_KEY(0x201E, UK_ALT_GR, 0x19),                     // „
+  UK_KEY(0x2022, UK_ALT_GR, 0x36),                     // •
+  UK_DEAD(0x2070, UK_SHIFT, 0x31, UK_PLAIN, 0x27),     // ⁰
+  UK_DEAD(0x2074, UK_SHIFT, 0x31, UK_PLAIN, 0x21),     // ⁴
+  UK_DEAD(0x2075, UK_SHIFT, 0x31, UK_PLAIN, 0x22),     // ⁵
+  UK_DEAD(0x2076, UK_SHIFT, 0x31, UK_PLAIN, 0x23),     // ⁶
+  UK_DEAD(0x2077, UK_SHIFT, 0x31, UK_PLAIN, 0x24),     // ⁷
+  UK_DEAD(0x2078, UK_SHIFT, 0x31, UK_PLAIN, 0x25),     // ⁸
+  UK_DEAD(0x2079, UK_SHIFT, 0x31, UK_PLAIN, 0x26),     // ⁹
+  UK_DEAD(0x207A, UK_SHIFT, 0x31, UK_PLAIN, 0x2F),     // ⁺
+  UK_DEAD(0x207B, UK_SHIFT, 0x31, UK_PLAIN, 0x38),     // ⁻
+  UK_DEAD(0x207C, UK_SHIFT, 0x31, UK_SHIFT, 0x27),     // ⁼
+  UK_DEAD(0x207D, UK_SHIFT, 0x31, UK_SHIFT, 0x25),     // ⁽
+  UK_DEAD(0x207E, UK_SHIFT, 0x31, UK_SHIFT, 0x26),     // ⁾
+  UK_DEAD(0x2080, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x27), // ₀
+  UK_DEAD(0x2081, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x1E), // ₁
+  UK_DEAD(0x2082, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x1F), // ₂
+  UK_DEAD(0x2083, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x20), // ₃
+  UK_DEAD(0x2084, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x21), // ₄
+  UK_DEAD(0x2085, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x22), // ₅
+  UK_DEAD(0x2086, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x23), // ₆
+  UK_DEAD(0x2087, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x24), // ₇
+  UK_DEAD(0x2088, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x25), // ₈
+  UK_DEAD(0x2089, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x26), // ₉
+  UK_DEAD(0x208A, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x2F), // ₊
+  UK_DEAD(0x208B, UK_SHIFT_ALT_GR, 0x34, UK_PLAIN, 0x38), // ₋
+  UK_DEAD(0x208C, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x27), // ₌
+  UK_DEAD(0x208D, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x25), // ₍
+  UK_DEAD(0x208E, UK_SHIFT_ALT_GR, 0x34, UK_SHIFT, 0x26), // ₎
+  UK_KEY(0x20AC, UK_ALT_GR, 0x08),                     // €
+  UK_DEAD(0x20B5, UK_ALT_GR, 0x2E, UK_SHIFT_ALT_GR, 0x08), // ₵
+  UK_KEY(0x2122, UK_SHIFT_ALT_GR, 0x25),               // ™
+  UK_KEY(0x215B, UK_SHIFT_ALT_GR, 0x1F),               // ⅛
+  UK_KEY(0x215C, UK_SHIFT_ALT_GR, 0x22),               // ⅜
+  UK_KEY(0x215D, UK_SHIFT_ALT_GR, 0x23),               // ⅝
+  UK_KEY(0x215E, UK_SHIFT_ALT_GR, 0x24),               // ⅞
+  UK_KEY(0x2190, UK_ALT_GR, 0x1C),                     // ←
+  UK_KEY(0x2191, UK_SHIFT_ALT_GR, 0x18),               // ↑
+  UK_KEY(0x2192, UK_ALT_GR, 0x0C),                     // →
+  UK_KEY(0x2193, UK_ALT_GR, 0x18),                     // ↓
+  UK_DEAD(0x2243, UK_ALT_GR, 0x30, UK_SHIFT, 0x27),    // ≃
+  UK_DEAD(0x2272, UK_ALT_GR, 0x30, UK_PLAIN, 0x64),    // ≲
+  UK_DEAD(0x2273, UK_ALT_GR, 0x30, UK_SHIFT, 0x64),    // ≳
+  UK_DEAD(0x2A25, UK_ALT_GR, 0x38, UK_PLAIN, 0x2F),    // ⨥
+  UK_DEAD(0x2A2A, UK_ALT_GR, 0x38, UK_PLAIN, 0x38),    // ⨪
+  UK_DEAD(0x2A66, UK_ALT_GR, 0x38, UK_SHIFT, 0x27),    // ⩦
+  UK_DEAD(0x2C6E, UK_ALT_GR, 0x0D, UK_SHIFT, 0x10),    // Ɱ
+  UK_DEAD(0x2C72, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1A),    // Ⱳ
+  UK_DEAD(0x2C73, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1A),    // ⱳ
+};
+#define UNICODE_KEYS_pt_PT UnicodeKeys_pt_PT, UNICODE_KEY_COUNT(UnicodeKeys_pt_PT)
+
+// sv_SE (XKB "se"): 442 characters, 371 of them after a dead key
+static const UnicodeKeyEntry UnicodeKeys_sv_SE[] = {
+  UK_KEY(0x00A0, UK_SHIFT_ALT_GR, 0x2C),               // U+00A0
+  UK_KEY(0x00A1, UK_ALT_GR, 0x1E),                     // ¡
+  UK_KEY(0x00A2, UK_SHIFT_ALT_GR, 0x22),               // ¢
+  UK_KEY(0x00A3, UK_ALT_GR, 0x20),                     // £
+  UK_KEY(0x00A4, UK_SHIFT, 0x21),                      // ¤
+  UK_KEY(0x00A5, UK_ALT_GR, 0x23),                     // ¥
+  UK_KEY(0x00A6, UK_SHIFT_ALT_GR, 0x64),               // ¦
+  UK_KEY(0x00A7, UK_PLAIN, 0x35),                      // §
+  UK_KEY(0x00A9, UK_ALT_GR, 0x06),                     // ©
+  UK_KEY(0x00AA, UK_ALT_GR, 0x04),                     // ª
+  UK_KEY(0x00AB, UK_SHIFT_ALT_GR, 0x25),               // «
+  UK_KEY(0x00AC, UK_SHIFT_ALT_GR, 0x2E),               // ¬
+  UK_KEY(0x00AE, UK_ALT_GR, 0x15),                     // ®
+  UK_KEY(0x00B0, UK_SHIFT_ALT_GR, 0x27),               // °
+  UK_KEY(0x00B1, UK_ALT_GR, 0x2E),                     // ±
+  UK_KEY(0x00B2, UK_SHIFT_ALT_GR, 0x1F),               // ²
+  UK_KEY(0x00B3, UK_SHIFT_ALT_GR, 0x20),               // ³
+  UK_KEY(0x00B4, UK_ALT_GR, 0x31),                     // ´
+  UK_KEY(0x00B5, UK_ALT_GR, 0x10),                     // µ
+  UK_KEY(0x00B6, UK_ALT_GR, 0x35),                     // ¶
+  UK_KEY(0x00B7, UK_ALT_GR, 0x37),                     // ·
+  UK_DEAD(0x00B8, UK_ALT_GR, 0x36, UK_PLAIN, 0x2C),    // ¸
+  UK_KEY(0x00B9, UK_SHIFT_ALT_GR, 0x1E),               // ¹
+  UK_KEY(0x00BA, UK_SHIFT_ALT_GR, 0x04),               // º
+  UK_KEY(0x00BB, UK_SHIFT_ALT_GR, 0x26),               // »
+  UK_KEY(0x00BC, UK_SHIFT_ALT_GR, 0x21),               // ¼
+  UK_KEY(0x00BD, UK_SHIFT, 0x35),                      // ½
+  UK_KEY(0x00BE, UK_SHIFT_ALT_GR, 0x35),               // ¾
+  UK_KEY(0x00BF, UK_SHIFT_ALT_GR, 0x2D),               // ¿
+  UK_DEAD(0x00C0, UK_SHIFT, 0x2E, UK_SHIFT, 0x04),     // À
+  UK_DEAD(0x00C1, UK_PLAIN, 0x2E, UK_SHIFT, 0x04),     // Á
+  UK_DEAD(0x00C2, UK_SHIFT, 0x30, UK_SHIFT, 0x04),     // Â
+  UK_DEAD(0x00C3, UK_ALT_GR, 0x30, UK_SHIFT, 0x04),    // Ã
+  UK_KEY(0x00C4, UK_SHIFT, 0x34),                      // Ä
+  UK_KEY(0x00C5, UK_SHIFT, 0x2F),                      // Å
+  UK_KEY(0x00C6, UK_SHIFT_ALT_GR, 0x34),               // Æ
+  UK_DEAD(0x00C7, UK_ALT_GR, 0x36, UK_SHIFT, 0x06),    // Ç
+  UK_DEAD(0x00C8, UK_SHIFT, 0x2E, UK_SHIFT, 0x08),     // È
+  UK_DEAD(0x00C9, UK_PLAIN, 0x2E, UK_SHIFT, 0x08),     // É
+  UK_DEAD(0x00CA, UK_SHIFT, 0x30, UK_SHIFT, 0x08),     // Ê
+  UK_DEAD(0x00CB, UK_ALT_GR, 0x2F, UK_SHIFT, 0x08),    // Ë
+  UK_DEAD(0x00CC, UK_SHIFT, 0x2E, UK_SHIFT, 0x0C),     // Ì
+  UK_DEAD(0x00CD, UK_PLAIN, 0x2E, UK_SHIFT, 0x0C),     // Í
+  UK_DEAD(0x00CE, UK_SHIFT, 0x30, UK_SHIFT, 0x0C),     // Î
+  UK_DEAD(0x00CF, UK_ALT_GR, 0x2F, UK_SHIFT, 0x0C),    // Ï
+  UK_KEY(0x00D0, UK_SHIFT_ALT_GR, 0x07),               // Ð
+  UK_DEAD(0x00D1, UK_ALT_GR, 0x30, UK_SHIFT, 0x11),    // Ñ
+  UK_DEAD(0x00D2, UK_SHIFT, 0x2E, UK_SHIFT, 0x12),     // Ò
+  UK_DEAD(0x00D3, UK_PLAIN, 0x2E, UK_SHIFT, 0x12),     // Ó
+  UK_DEAD(0x00D4, UK_SHIFT, 0x30, UK_SHIFT, 0x12),     // Ô
+  UK_DEAD(0x00D5, UK_ALT_GR, 0x30, UK_SHIFT, 0x12),    // Õ
+  UK_KEY(0x00D6, UK_SHIFT, 0x33),                      // Ö
+  UK_KEY(0x00D7, UK_SHIFT_ALT_GR, 0x31),               // ×
+  UK_KEY(0x00D8, UK_SHIFT_ALT_GR, 0x33),               // Ø
+  UK_DEAD(0x00D9, UK_SHIFT, 0x2E, UK_SHIFT, 0x18),     // Ù
+  UK_DEAD(0x00DA, UK_PLAIN, 0x2E, UK_SHIFT, 0x18),     // Ú
+  UK_DEAD(0x00DB, UK_SHIFT, 0x30, UK_SHIFT, 0x18),     // Û
+  UK_DEAD(0x00DC, UK_ALT_GR, 0x2F, UK_SHIFT, 0x18),    // Ü
+  UK_DEAD(0x00DD, UK_PLAIN, 0x2E, UK_SHIFT, 0x1C),     // Ý
+  UK_KEY(0x00DE, UK_SHIFT_ALT_GR, 0x17),               // Þ
+  UK_KEY(0x00DF, UK_ALT_GR, 0x16),                     // ß
+  UK_DEAD(0x00E0, UK_SHIFT, 0x2E, UK_PLAIN, 0x04),     // à
+  UK_DEAD(0x00E1, UK_PLAIN, 0x2E, UK_PLAIN, 0x04),     // á
+  UK_DEAD(0x00E2, UK_SHIFT, 0x30, UK_PLAIN, 0x04),     // â
+  UK_DEAD(0x00E3, UK_ALT_GR, 0x30, UK_PLAIN, 0x04),    // ã
+  UK_KEY(0x00E4, UK_PLAIN, 0x34),                      // ä
+  UK_KEY(0x00E5, UK_PLAIN, 0x2F),                      // å
+  UK_KEY(0x00E6, UK_ALT_GR, 0x34),                     // æ
+  UK_DEAD(0x00E7, UK_ALT_GR, 0x36, UK_PLAIN, 0x06),    // ç
+  UK_DEAD(0x00E8, UK_SHIFT, 0x2E, UK_PLAIN, 0x08),     // è
+  UK_DEAD(0x00E9, UK_PLAIN, 0x2E, UK_PLAIN, 0x08),     // é
+  UK_DEAD(0x00EA, UK_SHIFT, 0x30, UK_PLAIN, 0x08),     // ê
+  UK_DEAD(0x00EB, UK_ALT_GR, 0x2F, UK_PLAIN, 0x08),    // ë
+  UK_DEAD(0x00EC, UK_SHIFT, 0x2E, UK_PLAIN, 0x0C),     // ì
+  UK_DEAD(0x00ED, UK_PLAIN, 0x2E, UK_PLAIN, 0x0C),     // í
+  UK_DEAD(0x00EE, UK_SHIFT, 0x30, UK_PLAIN, 0x0C),     // î
+  UK_DEAD(0x00EF, UK_ALT_GR, 0x2F, UK_PLAIN, 0x0C),    // ï
+  UK_KEY(0x00F0, UK_ALT_GR, 0x07),                     // ð
+  UK_DEAD(0x00F1, UK_ALT_GR, 0x30, UK_PLAIN, 0x11),    // ñ
+  UK_DEAD(0x00F2, UK_SHIFT, 0x2E, UK_PLAIN, 0x12),     // ò
+  UK_DEAD(0x00F3, UK_PLAIN, 0x2E, UK_PLAIN, 0x12),     // ó
+  UK_DEAD(0x00F4, UK_SHIFT, 0x30, UK_PLAIN, 0x12),     // ô
+  UK_DEAD(0x00F5, UK_ALT_GR, 0x30, UK_PLAIN, 0x12),    // õ
+  UK_KEY(0x00F6, UK_PLAIN, 0x33),                      // ö
+  UK_KEY(0x00F7, UK_SHIFT_ALT_GR, 0x24),               // ÷
+  UK_KEY(0x00F8, UK_ALT_GR, 0x33),                     // ø
+  UK_DEAD(0x00F9, UK_SHIFT, 0x2E, UK_PLAIN, 0x18),     // ù
+  UK_DEAD(0x00FA, UK_PLAIN, 0x2E, UK_PLAIN, 0x18),     // ú
+  UK_DEAD(0x00FB, UK_SHIFT, 0x30, UK_PLAIN, 0x18),     // û
+  UK_DEAD(0x00FC, UK_ALT_GR, 0x2F, UK_PLAIN, 0x18),    // ü
+  UK_DEAD(0x00FD, UK_PLAIN, 0x2E, UK_PLAIN, 0x1C),     // ý
+  UK_KEY(0x00FE, UK_ALT_GR, 0x17),                     // þ
+  UK_DEAD(0x00FF, UK_ALT_GR, 0x2F, UK_PLAIN, 0x1C),    // ÿ
+  UK_DEAD(0x0104, UK_SHIFT_ALT_GR, 0x36, UK_SHIFT, 0x04), // Ą
+  UK_DEAD(0x0105, UK_SHIFT_ALT_GR, 0x36, UK_PLAIN, 0x04), // ą
+  UK_DEAD(0x0106, UK_PLAIN, 0x2E, UK_SHIFT, 0x06),     // Ć
+  UK_DEAD(0x0107, UK_PLAIN, 0x2E, UK_PLAIN, 0x06),     // ć
+  UK_DEAD(0x0108, UK_SHIFT, 0x30, UK_SHIFT, 0x06),     // Ĉ
+  UK_DEAD(0x0109, UK_SHIFT, 0x30, UK_PLAIN, 0x06),     // ĉ
+  UK_DEAD(0x010A, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x06), // Ċ
+  UK_DEAD(0x010B, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x06), // ċ
+  UK_DEAD(0x010C, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x06), // Č
+  UK_DEAD(0x010D, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x06), // č
+  UK_DEAD(0x010E, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x07), // Ď
+  UK_DEAD(0x010F, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x07), // ď
+  UK_KEY(0x0111, UK_ALT_GR, 0x09),                     // đ
+  UK_DEAD(0x0116, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x08), // Ė
+  UK_DEAD(0x0117, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x08), // ė
+  UK_DEAD(0x0118, UK_SHIFT_ALT_GR, 0x36, UK_SHIFT, 0x08), // Ę
+  UK_DEAD(0x0119, UK_SHIFT_ALT_GR, 0x36, UK_PLAIN, 0x08), // ę
+  UK_DEAD(0x011A, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x08), // Ě
+  UK_DEAD(0x011B, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x08), // ě
+  UK_DEAD(0x011C, UK_SHIFT, 0x30, UK_SHIFT, 0x0A),     // Ĝ
+  UK_DEAD(0x011D, UK_SHIFT, 0x30, UK_PLAIN, 0x0A),     // ĝ
+  UK_DEAD(0x0120, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x0A), // Ġ
+  UK_DEAD(0x0121, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x0A), // ġ
+  UK_DEAD(0x0122, UK_ALT_GR, 0x36, UK_SHIFT, 0x0A),    // Ģ
+  UK_DEAD(0x0123, UK_ALT_GR, 0x36, UK_PLAIN, 0x0A),    // ģ
+  UK_DEAD(0x0124, UK_SHIFT, 0x30, UK_SHIFT, 0x0B),     // Ĥ
+  UK_DEAD(0x0125, UK_SHIFT, 0x30, UK_PLAIN, 0x0B),     // ĥ
+  UK_KEY(0x0126, UK_SHIFT_ALT_GR, 0x0B),               // Ħ
+  UK_KEY(0x0127, UK_ALT_GR, 0x0B),                     // ħ
+  UK_DEAD(0x0128, UK_ALT_GR, 0x30, UK_SHIFT, 0x0C),    // Ĩ
+  UK_DEAD(0x0129, UK_ALT_GR, 0x30, UK_PLAIN, 0x0C),    // ĩ
+  UK_DEAD(0x012E, UK_SHIFT_ALT_GR, 0x36, UK_SHIFT, 0x0C), // Į
+  UK_DEAD(0x012F, UK_SHIFT_ALT_GR, 0x36, UK_PLAIN, 0x0C), // į
+  UK_DEAD(0x0130, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x0C), // İ
+  UK_KEY(0x0131, UK_SHIFT_ALT_GR, 0x0C),               // ı
+  UK_DEAD(0x0134, UK_SHIFT, 0x30, UK_SHIFT, 0x0D),     // Ĵ
+  UK_DEAD(0x0135, UK_SHIFT, 0x30, UK_PLAIN, 0x0D),     // ĵ
+  UK_DEAD(0x0136, UK_ALT_GR, 0x36, UK_SHIFT, 0x0E),    // Ķ
+  UK_DEAD(0x0137, UK_ALT_GR, 0x36, UK_PLAIN, 0x0E),    // ķ
+  UK_KEY(0x0138, UK_ALT_GR, 0x0E),                     // ĸ
+  UK_DEAD(0x0139, UK_PLAIN, 0x2E, UK_SHIFT, 0x0F),     // Ĺ
+  UK_DEAD(0x013A, UK_PLAIN, 0x2E, UK_PLAIN, 0x0F),     // ĺ
+  UK_DEAD(0x013B, UK_ALT_GR, 0x36, UK_SHIFT, 0x0F),    // Ļ
+  UK_DEAD(0x013C, UK_ALT_GR, 0x36, UK_PLAIN, 0x0F),    // ļ
+  UK_DEAD(0x013D, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0F), // Ľ
+  UK_DEAD(0x013E, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0F), // ľ
+  UK_DEAD(0x013F, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x0F), // Ŀ
+  UK_DEAD(0x0140, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x0F), // ŀ
+  UK_KEY(0x0141, UK_SHIFT_ALT_GR, 0x0F),               // Ł
+  UK_KEY(0x0142, UK_ALT_GR, 0x0F),                     // ł
+  UK_DEAD(0x0143, UK_PLAIN, 0x2E, UK_SHIFT, 0x11),     // Ń
+  UK_DEAD(0x0144, UK_PLAIN, 0x2E, UK_PLAIN, 0x11),     // ń
+  UK_DEAD(0x0145, UK_ALT_GR, 0x36, UK_SHIFT, 0x11),    // Ņ
+  UK_DEAD(0x0146, UK_ALT_GR, 0x36, UK_PLAIN, 0x11),    // ņ
+  UK_DEAD(0x0147, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x11), // Ň
+  UK_DEAD(0x0148, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x11), // ň
+  UK_KEY(0x014A, UK_SHIFT_ALT_GR, 0x0A),               // Ŋ
+  UK_KEY(0x014B, UK_ALT_GR, 0x0A),                     // ŋ
+  UK_KEY(0x0152, UK_SHIFT_ALT_GR, 0x12),               // Œ
+  UK_KEY(0x0153, UK_ALT_GR, 0x12),                     // œ
+  UK_DEAD(0x0154, UK_PLAIN, 0x2E, UK_SHIFT, 0x15),     // Ŕ
+  UK_DEAD(0x0155, UK_PLAIN, 0x2E, UK_PLAIN, 0x15),     // ŕ
+  UK_DEAD(0x0156, UK_ALT_GR, 0x36, UK_SHIFT, 0x15),    // Ŗ
+  UK_DEAD(0x0157, UK_ALT_GR, 0x36, UK_PLAIN, 0x15),    // ŗ
+  UK_DEAD(0x0158, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x15), // Ř
+  UK_DEAD(0x0159, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x15), // ř
+  UK_DEAD(0x015A, UK_PLAIN, 0x2E, UK_SHIFT, 0x16),     // Ś
+  UK_DEAD(0x015B, UK_PLAIN, 0x2E, UK_PLAIN, 0x16),     // ś
+  UK_DEAD(0x015C, UK_SHIFT, 0x30, UK_SHIFT, 0x16),     // Ŝ
+  UK_DEAD(0x015D, UK_SHIFT, 0x30, UK_PLAIN, 0x16),     // ŝ
+  UK_DEAD(0x015E, UK_ALT_GR, 0x36, UK_SHIFT, 0x16),    // Ş
+  UK_DEAD(0x015F, UK_ALT_GR, 0x36, UK_PLAIN, 0x16),    // ş
+  UK_DEAD(0x0160, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x16), // Š
+  UK_DEAD(0x0161, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x16), // š
+  UK_DEAD(0x0162, UK_ALT_GR, 0x36, UK_SHIFT, 0x17),    // Ţ
+  UK_DEAD(0x0163, UK_ALT_GR, 0x36, UK_PLAIN, 0x17),    // ţ
+  UK_DEAD(0x0164, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x17), // Ť
+  UK_DEAD(0x0165, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x17), // ť
+  UK_DEAD(0x0168, UK_ALT_GR, 0x30, UK_SHIFT, 0x18),    // Ũ
+  UK_DEAD(0x0169, UK_ALT_GR, 0x30, UK_PLAIN, 0x18),    // ũ
+  UK_DEAD(0x016E, UK_SHIFT_ALT_GR, 0x2F, UK_SHIFT, 0x18), // Ů
+  UK_DEAD(0x016F, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x18), // ů
+  UK_DEAD(0x0172, UK_SHIFT_ALT_GR, 0x36, UK_SHIFT, 0x18), // Ų
+  UK_DEAD(0x0173, UK_SHIFT_ALT_GR, 0x36, UK_PLAIN, 0x18), // ų
+  UK_DEAD(0x0174, UK_SHIFT, 0x30, UK_SHIFT, 0x1A),     // Ŵ
+  UK_DEAD(0x0175, UK_SHIFT, 0x30, UK_PLAIN, 0x1A),     // ŵ
+  UK_DEAD(0x0176, UK_SHIFT, 0x30, UK_SHIFT, 0x1C),     // Ŷ
+  UK_DEAD(0x0177, UK_SHIFT, 0x30, UK_PLAIN, 0x1C),     // ŷ
+  UK_DEAD(0x0178, UK_ALT_GR, 0x2F, UK_SHIFT, 0x1C),    // Ÿ
+  UK_DEAD(0x0179, UK_PLAIN, 0x2E, UK_SHIFT, 0x1D),     // Ź
+  UK_DEAD(0x017A, UK_PLAIN, 0x2E, UK_PLAIN, 0x1D),     // ź
+  UK_DEAD(0x017B, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x1D), // Ż
+  UK_DEAD(0x017C, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x1D), // ż
+  UK_DEAD(0x017D, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x1D), // Ž
+  UK_DEAD(0x017E, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x1D), // ž
+  UK_KEY(0x017F, UK_ALT_GR, 0x1A),                     // ſ
+  UK_DEAD(0x0181, UK_ALT_GR, 0x0D, UK_SHIFT, 0x05),    // Ɓ
+  UK_DEAD(0x0187, UK_ALT_GR, 0x0D, UK_SHIFT, 0x06),    // Ƈ
+  UK_DEAD(0x0188, UK_ALT_GR, 0x0D, UK_PLAIN, 0x06),    // ƈ
+  UK_DEAD(0x018A, UK_ALT_GR, 0x0D, UK_SHIFT, 0x07),    // Ɗ
+  UK_DEAD(0x0191, UK_ALT_GR, 0x0D, UK_SHIFT, 0x09),    // Ƒ
+  UK_DEAD(0x0192, UK_ALT_GR, 0x0D, UK_PLAIN, 0x09),    // ƒ
+  UK_DEAD(0x0193, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0A),    // Ɠ
+  UK_DEAD(0x0198, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0E),    // Ƙ
+  UK_DEAD(0x0199, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0E),    // ƙ
+  UK_DEAD(0x019D, UK_ALT_GR, 0x0D, UK_SHIFT, 0x11),    // Ɲ
+  UK_DEAD(0x01A0, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x12), // Ơ
+  UK_DEAD(0x01A1, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x12), // ơ
+  UK_DEAD(0x01A4, UK_ALT_GR, 0x0D, UK_SHIFT, 0x13),    // Ƥ
+  UK_DEAD(0x01A5, UK_ALT_GR, 0x0D, UK_PLAIN, 0x13),    // ƥ
+  UK_DEAD(0x01AC, UK_ALT_GR, 0x0D, UK_SHIFT, 0x17),    // Ƭ
+  UK_DEAD(0x01AD, UK_ALT_GR, 0x0D, UK_PLAIN, 0x17),    // ƭ
+  UK_DEAD(0x01AF, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x18), // Ư
+  UK_DEAD(0x01B0, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x18), // ư
+  UK_DEAD(0x01B2, UK_ALT_GR, 0x0D, UK_SHIFT, 0x19),    // Ʋ
+  UK_DEAD(0x01CD, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x04), // Ǎ
+  UK_DEAD(0x01CE, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x04), // ǎ
+  UK_DEAD(0x01CF, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0C), // Ǐ
+  UK_DEAD(0x01D0, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0C), // ǐ
+  UK_DEAD(0x01D1, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x12), // Ǒ
+  UK_DEAD(0x01D2, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x12), // ǒ
+  UK_DEAD(0x01D3, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x18), // Ǔ
+  UK_DEAD(0x01D4, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x18), // ǔ
+  UK_DEAD(0x01D7, UK_PLAIN, 0x2E, UK_SHIFT, 0x19),     // Ǘ
+  UK_DEAD(0x01D8, UK_PLAIN, 0x2E, UK_PLAIN, 0x19),     // ǘ
+  UK_DEAD(0x01D9, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x19), // Ǚ
+  UK_DEAD(0x01DA, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x19), // ǚ
+  UK_DEAD(0x01DB, UK_SHIFT, 0x2E, UK_SHIFT, 0x19),     // Ǜ
+  UK_DEAD(0x01DC, UK_SHIFT, 0x2E, UK_PLAIN, 0x19),     // ǜ
+  UK_DEAD(0x01E6, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0A), // Ǧ
+  UK_DEAD(0x01E7, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0A), // ǧ
+  UK_DEAD(0x01E8, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0E), // Ǩ
+  UK_DEAD(0x01E9, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0E), // ǩ
+  UK_DEAD(0x01EA, UK_SHIFT_ALT_GR, 0x36, UK_SHIFT, 0x12), // Ǫ
+  UK_DEAD(0x01EB, UK_SHIFT_ALT_GR, 0x36, UK_PLAIN, 0x12), // ǫ
+  UK_DEAD(0x01F0, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0D), // ǰ
+  UK_DEAD(0x01F4, UK_PLAIN, 0x2E, UK_SHIFT, 0x0A),     // Ǵ
+  UK_DEAD(0x01F5, UK_PLAIN, 0x2E, UK_PLAIN, 0x0A),     // ǵ
+  UK_DEAD(0x01F8, UK_SHIFT, 0x2E, UK_SHIFT, 0x11),     // Ǹ
+  UK_DEAD(0x01F9, UK_SHIFT, 0x2E, UK_PLAIN, 0x11),     // ǹ
+  UK_DEAD(0x01FA, UK_PLAIN, 0x2E, UK_SHIFT, 0x2F),     // Ǻ
+  UK_DEAD(0x01FB, UK_PLAIN, 0x2E, UK_PLAIN, 0x2F),     // ǻ
+  UK_DEAD(0x01FC, UK_PLAIN, 0x2E, UK_SHIFT_ALT_GR, 0x34), // Ǽ
+  UK_DEAD(0x01FD, UK_PLAIN, 0x2E, UK_ALT_GR, 0x34),    // ǽ
+  UK_DEAD(0x01FE, UK_PLAIN, 0x2E, UK_SHIFT_ALT_GR, 0x33), // Ǿ
+  UK_DEAD(0x01FF, UK_PLAIN, 0x2E, UK_ALT_GR, 0x33),    // ǿ
+  UK_DEAD(0x021E, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0B), // Ȟ
+  UK_DEAD(0x021F, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0B), // ȟ
+  UK_DEAD(0x0224, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1D),    // Ȥ
+  UK_DEAD(0x0225, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1D),    // ȥ
+  UK_DEAD(0x0226, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x04), // Ȧ
+  UK_DEAD(0x0227, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x04), // ȧ
+  UK_DEAD(0x0228, UK_ALT_GR, 0x36, UK_SHIFT, 0x08),    // Ȩ
+  UK_DEAD(0x0229, UK_ALT_GR, 0x36, UK_PLAIN, 0x08),    // ȩ
+  UK_DEAD(0x022E, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x12), // Ȯ
+  UK_DEAD(0x022F, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x12), // ȯ
+  UK_DEAD(0x0237, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x0D), // ȷ
+  UK_DEAD(0x0253, UK_ALT_GR, 0x0D, UK_PLAIN, 0x05),    // ɓ
+  UK_DEAD(0x0257, UK_ALT_GR, 0x0D, UK_PLAIN, 0x07),    // ɗ
+  UK_DEAD(0x0260, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0A),    // ɠ
+  UK_DEAD(0x0266, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0B),    // ɦ
+  UK_DEAD(0x0271, UK_ALT_GR, 0x0D, UK_PLAIN, 0x10),    // ɱ
+  UK_DEAD(0x0272, UK_ALT_GR, 0x0D, UK_PLAIN, 0x11),    // ɲ
+  UK_DEAD(0x027C, UK_ALT_GR, 0x0D, UK_PLAIN, 0x15),    // ɼ
+  UK_DEAD(0x0282, UK_ALT_GR, 0x0D, UK_PLAIN, 0x16),    // ʂ
+  UK_DEAD(0x028B, UK_ALT_GR, 0x0D, UK_PLAIN, 0x19),    // ʋ
+  UK_DEAD(0x02A0, UK_ALT_GR, 0x0D, UK_PLAIN, 0x14),    // ʠ
+  UK_DEAD(0x02C7, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x2C), // ˇ
+  UK_DEAD(0x02D9, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x2C), // ˙
+  UK_DEAD(0x02DB, UK_SHIFT_ALT_GR, 0x36, UK_PLAIN, 0x2C), // ˛
+  UK_DEAD(0x0300, UK_SHIFT, 0x2E, UK_SHIFT_ALT_GR, 0x2C), // ̀
+  UK_DEAD(0x0301, UK_PLAIN, 0x2E, UK_SHIFT_ALT_GR, 0x2C), // ́
+  UK_DEAD(0x0302, UK_SHIFT, 0x30, UK_SHIFT_ALT_GR, 0x2C), // ̂
+  UK_DEAD(0x0303, UK_ALT_GR, 0x30, UK_SHIFT_ALT_GR, 0x2C), // ̃
+  UK_DEAD(0x0307, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT_ALT_GR, 0x2C), // ̇
+  UK_DEAD(0x0308, UK_ALT_GR, 0x2F, UK_SHIFT_ALT_GR, 0x2C), // ̈
+  UK_DEAD(0x0309, UK_ALT_GR, 0x0D, UK_PLAIN, 0x2C),    // ̉
+  UK_DEAD(0x030A, UK_SHIFT_ALT_GR, 0x2F, UK_SHIFT_ALT_GR, 0x2C), // ̊
+  UK_DEAD(0x030C, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT_ALT_GR, 0x2C), // ̌
+  UK_DEAD(0x031B, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x2C), // ̛
+  UK_DEAD(0x0323, UK_ALT_GR, 0x38, UK_PLAIN, 0x2C),    // ̣
+  UK_DEAD(0x0327, UK_ALT_GR, 0x36, UK_SHIFT_ALT_GR, 0x2C), // ̧
+  UK_DEAD(0x0328, UK_SHIFT_ALT_GR, 0x36, UK_SHIFT_ALT_GR, 0x2C), // ̨
+  UK_DEAD(0x0344, UK_ALT_GR, 0x2F, UK_PLAIN, 0x31),    // ̈́
+  UK_DEAD(0x038F, UK_PLAIN, 0x2E, UK_SHIFT_ALT_GR, 0x14), // Ώ
+  UK_KEY(0x03A9, UK_SHIFT_ALT_GR, 0x14),               // Ω
+  UK_DEAD(0x1E02, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x05), // Ḃ
+  UK_DEAD(0x1E03, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x05), // ḃ
+  UK_DEAD(0x1E04, UK_ALT_GR, 0x38, UK_SHIFT, 0x05),    // Ḅ
+  UK_DEAD(0x1E05, UK_ALT_GR, 0x38, UK_PLAIN, 0x05),    // ḅ
+  UK_DEAD(0x1E0A, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x07), // Ḋ
+  UK_DEAD(0x1E0B, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x07), // ḋ
+  UK_DEAD(0x1E0C, UK_ALT_GR, 0x38, UK_SHIFT, 0x07),    // Ḍ
+  UK_DEAD(0x1E0D, UK_ALT_GR, 0x38, UK_PLAIN, 0x07),    // ḍ
+  UK_DEAD(0x1E10, UK_ALT_GR, 0x36, UK_SHIFT, 0x07),    // Ḑ
+  UK_DEAD(0x1E11, UK_ALT_GR, 0x36, UK_PLAIN, 0x07),    // ḑ
+  UK_DEAD(0x1E1E, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x09), // Ḟ
+  UK_DEAD(0x1E1F, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x09), // ḟ
+  UK_DEAD(0x1E22, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x0B), // Ḣ
+  UK_DEAD(0x1E23, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x0B), // ḣ
+  UK_DEAD(0x1E24, UK_ALT_GR, 0x38, UK_SHIFT, 0x0B),    // Ḥ
+  UK_DEAD(0x1E25, UK_ALT_GR, 0x38, UK_PLAIN, 0x0B),    // ḥ
+  UK_DEAD(0x1E26, UK_ALT_GR, 0x2F, UK_SHIFT, 0x0B),    // Ḧ
+  UK_DEAD(0x1E27, UK_ALT_GR, 0x2F, UK_PLAIN, 0x0B),    // ḧ
+  UK_DEAD(0x1E28, UK_ALT_GR, 0x36, UK_SHIFT, 0x0B),    // Ḩ
+  UK_DEAD(0x1E29, UK_ALT_GR, 0x36, UK_PLAIN, 0x0B),    // ḩ
+  UK_DEAD(0x1E30, UK_PLAIN, 0x2E, UK_SHIFT, 0x0E),     // Ḱ
+  UK_DEAD(0x1E31, UK_PLAIN, 0x2E, UK_PLAIN, 0x0E),     // ḱ
+  UK_DEAD(0x1E32, UK_ALT_GR, 0x38, UK_SHIFT, 0x0E),    // Ḳ
+  UK_DEAD(0x1E33, UK_ALT_GR, 0x38, UK_PLAIN, 0x0E),    // ḳ
+  UK_DEAD(0x1E36, UK_ALT_GR, 0x38, UK_SHIFT, 0x0F),    // Ḷ
+  UK_DEAD(0x1E37, UK_ALT_GR, 0x38, UK_PLAIN, 0x0F),    // ḷ
+  UK_DEAD(0x1E3E, UK_PLAIN, 0x2E, UK_SHIFT, 0x10),     // Ḿ
+  UK_DEAD(0x1E3F, UK_PLAIN, 0x2E, UK_PLAIN, 0x10),     // ḿ
+  UK_DEAD(0x1E40, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x10), // Ṁ
+  UK_DEAD(0x1E41, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x10), // ṁ
+  UK_DEAD(0x1E42, UK_ALT_GR, 0x38, UK_SHIFT, 0x10),    // Ṃ
+  UK_DEAD(0x1E43, UK_ALT_GR, 0x38, UK_PLAIN, 0x10),    // ṃ
+  UK_DEAD(0x1E44, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x11), // Ṅ
+  UK_DEAD(0x1E45, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x11), // ṅ
+  UK_DEAD(0x1E46, UK_ALT_GR, 0x38, UK_SHIFT, 0x11),    // Ṇ
+  UK_DEAD(0x1E47, UK_ALT_GR, 0x38, UK_PLAIN, 0x11),    // ṇ
+  UK_DEAD(0x1E4E, UK_ALT_GR, 0x30, UK_SHIFT, 0x33),    // Ṏ
+  UK_DEAD(0x1E4F, UK_ALT_GR, 0x30, UK_PLAIN, 0x33),    // ṏ
+  UK_DEAD(0x1E54, UK_PLAIN, 0x2E, UK_SHIFT, 0x13),     // Ṕ
+  UK_DEAD(0x1E55, UK_PLAIN, 0x2E, UK_PLAIN, 0x13),     // ṕ
+  UK_DEAD(0x1E56, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x13), // Ṗ
+  UK_DEAD(0x1E57, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x13), // ṗ
+  UK_DEAD(0x1E58, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x15), // Ṙ
+  UK_DEAD(0x1E59, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x15), // ṙ
+  UK_DEAD(0x1E5A, UK_ALT_GR, 0x38, UK_SHIFT, 0x15),    // Ṛ
+  UK_DEAD(0x1E5B, UK_ALT_GR, 0x38, UK_PLAIN, 0x15),    // ṛ
+  UK_DEAD(0x1E60, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x16), // Ṡ
+  UK_DEAD(0x1E61, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x16), // ṡ
+  UK_DEAD(0x1E62, UK_ALT_GR, 0x38, UK_SHIFT, 0x16),    // Ṣ
+  UK_DEAD(0x1E63, UK_ALT_GR, 0x38, UK_PLAIN, 0x16),    // ṣ
+  UK_DEAD(0x1E6A, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x17), // Ṫ
+  UK_DEAD(0x1E6B, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x17), // ṫ
+  UK_DEAD(0x1E6C, UK_ALT_GR, 0x38, UK_SHIFT, 0x17),    // Ṭ
+  UK_DEAD(0x1E6D, UK_ALT_GR, 0x38, UK_PLAIN, 0x17),    // ṭ
+  UK_DEAD(0x1E7C, UK_ALT_GR, 0x30, UK_SHIFT, 0x19),    // Ṽ
+  UK_DEAD(0x1E7D, UK_ALT_GR, 0x30, UK_PLAIN, 0x19),    // ṽ
+  UK_DEAD(0x1E7E, UK_ALT_GR, 0x38, UK_SHIFT, 0x19),    // Ṿ
+  UK_DEAD(0x1E7F, UK_ALT_GR, 0x38, UK_PLAIN, 0x19),    // ṿ
+  UK_DEAD(0x1E80, UK_SHIFT, 0x2E, UK_SHIFT, 0x1A),     // Ẁ
+  UK_DEAD(0x1E81, UK_SHIFT, 0x2E, UK_PLAIN, 0x1A),     // ẁ
+  UK_DEAD(0x1E82, UK_PLAIN, 0x2E, UK_SHIFT, 0x1A),     // Ẃ
+  UK_DEAD(0x1E83, UK_PLAIN, 0x2E, UK_PLAIN, 0x1A),     // ẃ
+  UK_DEAD(0x1E84, UK_ALT_GR, 0x2F, UK_SHIFT, 0x1A),    // Ẅ
+  UK_DEAD(0x1E85, UK_ALT_GR, 0x2F, UK_PLAIN, 0x1A),    // ẅ
+  UK_DEAD(0x1E86, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x1A), // Ẇ
+  UK_DEAD(0x1E87, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x1A), // ẇ
+  UK_DEAD(0x1E88, UK_ALT_GR, 0x38, UK_SHIFT, 0x1A),    // Ẉ
+  UK_DEAD(0x1E89, UK_ALT_GR, 0x38, UK_PLAIN, 0x1A),    // ẉ
+  UK_DEAD(0x1E8A, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x1B), // Ẋ
+  UK_DEAD(0x1E8B, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x1B), // ẋ
+  UK_DEAD(0x1E8C, UK_ALT_GR, 0x2F, UK_SHIFT, 0x1B),    // Ẍ
+  UK_DEAD(0x1E8D, UK_ALT_GR, 0x2F, UK_PLAIN, 0x1B),    // ẍ
+  UK_DEAD(0x1E8E, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x1C), // Ẏ
+  UK_DEAD(0x1E8F, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x1C), // ẏ
+  UK_DEAD(0x1E90, UK_SHIFT, 0x30, UK_SHIFT, 0x1D),     // Ẑ
+  UK_DEAD(0x1E91, UK_SHIFT, 0x30, UK_PLAIN, 0x1D),     // ẑ
+  UK_DEAD(0x1E92, UK_ALT_GR, 0x38, UK_SHIFT, 0x1D),    // Ẓ
+  UK_DEAD(0x1E93, UK_ALT_GR, 0x38, UK_PLAIN, 0x1D),    // ẓ
+  UK_DEAD(0x1E97, UK_ALT_GR, 0x2F, UK_PLAIN, 0x17),    // ẗ
+  UK_DEAD(0x1E98, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x1A), // ẘ
+  UK_DEAD(0x1E99, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x1C), // ẙ
+  UK_DEAD(0x1E9B, UK_SHIFT_ALT_GR, 0x37, UK_ALT_GR, 0x1A), // ẛ
+  UK_KEY(0x1E9E, UK_SHIFT_ALT_GR, 0x16),               // ẞ
+  UK_DEAD(0x1EA0, UK_ALT_GR, 0x38, UK_SHIFT, 0x04),    // Ạ
+  UK_DEAD(0x1EA1, UK_ALT_GR, 0x38, UK_PLAIN, 0x04),    // ạ
+  UK_DEAD(0x1EA2, UK_ALT_GR, 0x0D, UK_SHIFT, 0x04),    // Ả
+  UK_DEAD(0x1EA3, UK_ALT_GR, 0x0D, UK_PLAIN, 0x04),    // ả
+  UK_DEAD(0x1EB8, UK_ALT_GR, 0x38, UK_SHIFT, 0x08),    // Ẹ
+  UK_DEAD(0x1EB9, UK_ALT_GR, 0x38, UK_PLAIN, 0x08),    // ẹ
+  UK_DEAD(0x1EBA, UK_ALT_GR, 0x0D, UK_SHIFT, 0x08),    // Ẻ
+  UK_DEAD(0x1EBB, UK_ALT_GR, 0x0D, UK_PLAIN, 0x08),    // ẻ
+  UK_DEAD(0x1EBC, UK_ALT_GR, 0x30, UK_SHIFT, 0x08),    // Ẽ
+  UK_DEAD(0x1EBD, UK_ALT_GR, 0x30, UK_PLAIN, 0x08),    // ẽ
+  UK_DEAD(0x1EC8, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0C),    // Ỉ
+  UK_DEAD(0x1EC9, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0C),    // ỉ
+  UK_DEAD(0x1ECA, UK_ALT_GR, 0x38, UK_SHIFT, 0x0C),    // Ị
+  UK_DEAD(0x1ECB, UK_ALT_GR, 0x38, UK_PLAIN, 0x0C),    // ị
+  UK_DEAD(0x1ECC, UK_ALT_GR, 0x38, UK_SHIFT, 0x12),    // Ọ
+  UK_DEAD(0x1ECD, UK_ALT_GR, 0x38, UK_PLAIN, 0x12),    // ọ
+  UK_DEAD(0x1ECE, UK_ALT_GR, 0x0D, UK_SHIFT, 0x12),    // Ỏ
+  UK_DEAD(0x1ECF, UK_ALT_GR, 0x0D, UK_PLAIN, 0x12),    // ỏ
+  UK_DEAD(0x1EE4, UK_ALT_GR, 0x38, UK_SHIFT, 0x18),    // Ụ
+  UK_DEAD(0x1EE5, UK_ALT_GR, 0x38, UK_PLAIN, 0x18),    // ụ
+  UK_DEAD(0x1EE6, UK_ALT_GR, 0x0D, UK_SHIFT, 0x18),    // Ủ
+  UK_DEAD(0x1EE7, UK_ALT_GR, 0x0D, UK_PLAIN, 0x18),    // ủ
+  UK_DEAD(0x1EF2, UK_SHIFT, 0x2E, UK_SHIFT, 0x1C),     // Ỳ
+  UK_DEAD(0x1EF3, UK_SHIFT, 0x2E, UK_PLAIN, 0x1C),     // ỳ
+  UK_DEAD(0x1EF4, UK_ALT_GR, 0x38, UK_SHIFT, 0x1C),    // Ỵ
+  UK_DEAD(0x1EF5, UK_ALT_GR, 0x38, UK_PLAIN, 0x1C),    // ỵ
+  UK_DEAD(0x1EF6, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1C),    // Ỷ
+  UK_DEAD(0x1EF7, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1C),    // ỷ
+  UK_DEAD(0x1EF8, UK_ALT_GR, 0x30, UK_SHIFT, 0x1C),    // Ỹ
+  UK_DEAD(0x1EF9, UK_ALT_GR, 0x30, UK_PLAIN, 0x1C),    // ỹ
+  UK_DEAD(0x1FFA, UK_SHIFT, 0x2E, UK_SHIFT_ALT_GR, 0x14), // Ὼ
+  UK_KEY(0x2018, UK_SHIFT_ALT_GR, 0x05),               // ‘
+  UK_KEY(0x2019, UK_SHIFT_ALT_GR, 0x11),               // ’
+  UK_KEY(0x201A, UK_SHIFT_ALT_GR, 0x19),               // ‚
+  UK_KEY(0x201C, UK_ALT_GR, 0x05),                     // “
+  UK_KEY(0x201D, UK_ALT_GR, 0x11),                     // ”
+  UK_KEY(0x201E, UK_ALT_GR, 0x19),                     // „
+  UK_DEAD(0x2070, UK_SHIFT, 0x30, UK_PLAIN, 0x27),     // ⁰
+  UK_DEAD(0x2074, UK_SHIFT, 0x30, UK_PLAIN, 0x21),     // ⁴
+  UK_DEAD(0x2075, UK_SHIFT, 0x30, UK_PLAIN, 0x22),     // ⁵
+  UK_DEAD(0x2076, UK_SHIFT, 0x30, UK_PLAIN, 0x23),     // ⁶
+  UK_DEAD(0x2077, UK_SHIFT, 0x30, UK_PLAIN, 0x24),     // ⁷
+  UK_DEAD(0x2078, UK_SHIFT, 0x30, UK_PLAIN, 0x25),     // ⁸
+  UK_DEAD(0x2079, UK_SHIFT, 0x30, UK_PLAIN, 0x26),     // ⁹
+  UK_DEAD(0x207A, UK_SHIFT, 0x30, UK_PLAIN, 0x2D),     // ⁺
+  UK_DEAD(0x207B, UK_SHIFT, 0x30, UK_PLAIN, 0x38),     // ⁻
+  UK_DEAD(0x207C, UK_SHIFT, 0x30, UK_SHIFT, 0x27),     // ⁼
+  UK_DEAD(0x207D, UK_SHIFT, 0x30, UK_SHIFT, 0x25),     // ⁽
+  UK_DEAD(0x207E, UK_SHIFT, 0x30, UK_SHIFT, 0x26),     // ⁾
+  UK_DEAD(0x2080, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x27), // ₀
+  UK_DEAD(0x2081, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x1E), // ₁
+  UK_DEAD(0x2082, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x1F), // ₂
+  UK_DEAD(0x2083, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x20), // ₃
+  UK_DEAD(0x2084, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x21), // ₄
+  UK_DEAD(0x2085, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x22), // ₅
+  UK_DEAD(0x2086, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x23), // ₆
+  UK_DEAD(0x2087, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x24), // ₇
+  UK_DEAD(0x2088, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x25), // ₈
+  UK_DEAD(0x2089, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x26), // ₉
+  UK_DEAD(0x208A, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x2D), // ₊
+  UK_DEAD(0x208B, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x38), // ₋
+  UK_DEAD(0x208C, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x27), // ₌
+  UK_DEAD(0x208D, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x25), // ₍
+  UK_DEAD(0x208E, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x26), // ₎
+  UK_KEY(0x20AC, UK_ALT_GR, 0x22),                     // €
+  UK_DEAD(0x20B5, UK_ALT_GR, 0x36, UK_SHIFT_ALT_GR, 0x22), // ₵
+  UK_KEY(0x215D, UK_SHIFT_ALT_GR, 0x23),               // ⅝
+  UK_KEY(0x2190, UK_ALT_GR, 0x1C),                     // ←
+  UK_KEY(0x2191, UK_SHIFT_ALT_GR, 0x18),               // ↑
+  UK_KEY(0x2192, UK_ALT_GR, 0x0C),                     // →
+  UK_KEY(0x2193, UK_ALT_GR, 0x18),                     // ↓
+  UK_DEAD(0x2243, UK_ALT_GR, 0x30, UK_SHIFT, 0x27),    // ≃
+  UK_DEAD(0x2272, UK_ALT_GR, 0x30, UK_PLAIN, 0x64),    // ≲
+  UK_DEAD(0x2273, UK_ALT_GR, 0x30, UK_SHIFT, 0x64),    // ≳
+  UK_DEAD(0x2A25, UK_ALT_GR, 0x38, UK_PLAIN, 0x2D),    // ⨥
+  UK_DEAD(0x2A2A, UK_ALT_GR, 0x38, UK_PLAIN, 0x38),    // ⨪
+  UK_DEAD(0x2A66, UK_ALT_GR, 0x38, UK_SHIFT, 0x27),    // ⩦
+  UK_DEAD(0x2C6E, UK_ALT_GR, 0x0D, UK_SHIFT, 0x10),    // Ɱ
+  UK_DEAD(0x2C72, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1A),    // Ⱳ
+  UK_DEAD(0x2C73, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1A),    // ⱳ
+};
+#define UNICODE_KEYS_sv_SE UnicodeKeys_sv_SE, UNICODE_KEY_COUNT(UnicodeKeys_sv_SE)
+
+// da_DK (XKB "dk"): 433 characters, 368 of them after a dead key
+static const UnicodeKeyEntry UnicodeKeys_da_DK[] = {
+  UK_KEY(0x00A1, UK_ALT_GR, 0x1E),                     // ¡
+  UK_KEY(0x00A2, UK_SHIFT_ALT_GR, 0x22),               // ¢
+  UK_KEY(0x00A3, UK_ALT_GR, 0x20),                     // £
+  UK_KEY(0x00A4, UK_SHIFT, 0x21),                      // ¤
+  UK_KEY(0x00A5, UK_ALT_GR, 0x23),                     // ¥
+  UK_KEY(0x00A6, UK_SHIFT_ALT_GR, 0x2E),               // ¦
+  UK_KEY(0x00A7, UK_SHIFT, 0x35),                      // §
+  UK_KEY(0x00A9, UK_ALT_GR, 0x06),                     // ©
+  UK_KEY(0x00AA, UK_ALT_GR, 0x04),                     // ª
+  UK_KEY(0x00AB, UK_SHIFT_ALT_GR, 0x25),               // «
+  UK_KEY(0x00AC, UK_SHIFT_ALT_GR, 0x64),               // ¬
+  UK_KEY(0x00AE, UK_ALT_GR, 0x15),                     // ®
+  UK_KEY(0x00B0, UK_SHIFT_ALT_GR, 0x27),               // °
+  UK_KEY(0x00B1, UK_ALT_GR, 0x2D),                     // ±
+  UK_KEY(0x00B2, UK_SHIFT_ALT_GR, 0x1F),               // ²
+  UK_KEY(0x00B3, UK_SHIFT_ALT_GR, 0x20),               // ³
+  UK_KEY(0x00B5, UK_ALT_GR, 0x10),                     // µ
+  UK_KEY(0x00B6, UK_SHIFT_ALT_GR, 0x35),               // ¶
+  UK_KEY(0x00B7, UK_ALT_GR, 0x37),                     // ·
+  UK_DEAD(0x00B8, UK_ALT_GR, 0x36, UK_PLAIN, 0x2C),    // ¸
+  UK_KEY(0x00B9, UK_SHIFT_ALT_GR, 0x1E),               // ¹
+  UK_KEY(0x00BA, UK_SHIFT_ALT_GR, 0x04),               // º
+  UK_KEY(0x00BB, UK_SHIFT_ALT_GR, 0x26),               // »
+  UK_KEY(0x00BC, UK_SHIFT_ALT_GR, 0x21),               // ¼
+  UK_KEY(0x00BD, UK_PLAIN, 0x35),                      // ½
+  UK_KEY(0x00BE, UK_ALT_GR, 0x35),                     // ¾
+  UK_KEY(0x00BF, UK_SHIFT_ALT_GR, 0x2D),               // ¿
+  UK_DEAD(0x00C0, UK_SHIFT, 0x2E, UK_SHIFT, 0x04),     // À
+  UK_DEAD(0x00C1, UK_PLAIN, 0x2E, UK_SHIFT, 0x04),     // Á
+  UK_DEAD(0x00C2, UK_SHIFT, 0x30, UK_SHIFT, 0x04),     // Â
+  UK_DEAD(0x00C3, UK_ALT_GR, 0x30, UK_SHIFT, 0x04),    // Ã
+  UK_DEAD(0x00C4, UK_ALT_GR, 0x2F, UK_SHIFT, 0x04),    // Ä
+  UK_KEY(0x00C5, UK_SHIFT, 0x2F),                      // Å
+  UK_KEY(0x00C6, UK_SHIFT, 0x33),                      // Æ
+  UK_DEAD(0x00C7, UK_ALT_GR, 0x36, UK_SHIFT, 0x06),    // Ç
+  UK_DEAD(0x00C8, UK_SHIFT, 0x2E, UK_SHIFT, 0x08),     // È
+  UK_DEAD(0x00C9, UK_PLAIN, 0x2E, UK_SHIFT, 0x08),     // É
+  UK_DEAD(0x00CA, UK_SHIFT, 0x30, UK_SHIFT, 0x08),     // Ê
+  UK_DEAD(0x00CB, UK_ALT_GR, 0x2F, UK_SHIFT, 0x08),    // Ë
+  UK_DEAD(0x00CC, UK_SHIFT, 0x2E, UK_SHIFT, 0x0C),     // Ì
+  UK_DEAD(0x00CD, UK_PLAIN, 0x2E, UK_SHIFT, 0x0C),     // Í
+  UK_DEAD(0x00CE, UK_SHIFT, 0x30, UK_SHIFT, 0x0C),     // Î
+  UK_DEAD(0x00CF, UK_ALT_GR, 0x2F, UK_SHIFT, 0x0C),    // Ï
+  UK_KEY(0x00D0, UK_SHIFT_ALT_GR, 0x07),               // Ð
+  UK_DEAD(0x00D1, UK_ALT_GR, 0x30, UK_SHIFT, 0x11),    // Ñ
+  UK_DEAD(0x00D2, UK_SHIFT, 0x2E, UK_SHIFT, 0x12),     // Ò
+  UK_DEAD(0x00D3, UK_PLAIN, 0x2E, UK_SHIFT, 0x12),     // Ó
+  UK_DEAD(0x00D4, UK_SHIFT, 0x30, UK_SHIFT, 0x12),     // Ô
+  UK_DEAD(0x00D5, UK_ALT_GR, 0x30, UK_SHIFT, 0x12),    // Õ
+  UK_DEAD(0x00D6, UK_ALT_GR, 0x2F, UK_SHIFT, 0x12),    // Ö
+  UK_KEY(0x00D7, UK_SHIFT_ALT_GR, 0x31),               // ×
+  UK_KEY(0x00D8, UK_SHIFT, 0x34),                      // Ø
+  UK_DEAD(0x00D9, UK_SHIFT, 0x2E, UK_SHIFT, 0x18),     // Ù
+  UK_DEAD(0x00DA, UK_PLAIN, 0x2E, UK_SHIFT, 0x18),     // Ú
+  UK_DEAD(0x00DB, UK_SHIFT, 0x30, UK_SHIFT, 0x18),     // Û
+  UK_DEAD(0x00DC, UK_ALT_GR, 0x2F, UK_SHIFT, 0x18),    // Ü
+  UK_DEAD(0x00DD, UK_PLAIN, 0x2E, UK_SHIFT, 0x1C),     // Ý
+  UK_KEY(0x00DE, UK_SHIFT_ALT_GR, 0x17),               // Þ
+  UK_KEY(0x00DF, UK_ALT_GR, 0x16),                     // ß
+  UK_DEAD(0x00E0, UK_SHIFT, 0x2E, UK_PLAIN, 0x04),     // à
+  UK_DEAD(0x00E1, UK_PLAIN, 0x2E, UK_PLAIN, 0x04),     // á
+  UK_DEAD(0x00E2, UK_SHIFT, 0x30, UK_PLAIN, 0x04),     // â
+  UK_DEAD(0x00E3, UK_ALT_GR, 0x30, UK_PLAIN, 0x04),    // ã
+  UK_DEAD(0x00E4, UK_ALT_GR, 0x2F, UK_PLAIN, 0x04),    // ä
+  UK_KEY(0x00E5, UK_PLAIN, 0x2F),                      // å
+  UK_KEY(0x00E6, UK_PLAIN, 0x33),                      // æ
+  UK_DEAD(0x00E7, UK_ALT_GR, 0x36, UK_PLAIN, 0x06),    // ç
+  UK_DEAD(0x00E8, UK_SHIFT, 0x2E, UK_PLAIN, 0x08),     // è
+  UK_DEAD(0x00E9, UK_PLAIN, 0x2E, UK_PLAIN, 0x08),     // é
+  UK_DEAD(0x00EA, UK_SHIFT, 0x30, UK_PLAIN, 0x08),     // ê
+  UK_DEAD(0x00EB, UK_ALT_GR, 0x2F, UK_PLAIN, 0x08),    // ë
+  UK_DEAD(0x00EC, UK_SHIFT, 0x2E, UK_PLAIN, 0x0C),     // ì
+  UK_DEAD(0x00ED, UK_PLAIN, 0x2E, UK_PLAIN, 0x0C),     // í
+  UK_DEAD(0x00EE, UK_SHIFT, 0x30, UK_PLAIN, 0x0C),     // î
+  UK_DEAD(0x00EF, UK_ALT_GR, 0x2F, UK_PLAIN, 0x0C),    // ï
+  UK_KEY(0x00F0, UK_ALT_GR, 0x07),                     // ð
+  UK_DEAD(0x00F1, UK_ALT_GR, 0x30, UK_PLAIN, 0x11),    // ñ
+  UK_DEAD(0x00F2, UK_SHIFT, 0x2E, UK_PLAIN, 0x12),     // ò
+  UK_DEAD(0x00F3, UK_PLAIN, 0x2E, UK_PLAIN, 0x12),     // ó
+  UK_DEAD(0x00F4, UK_SHIFT, 0x30, UK_PLAIN, 0x12),     // ô
+  UK_DEAD(0x00F5, UK_ALT_GR, 0x30, UK_PLAIN, 0x12),    // õ
+  UK_DEAD(0x00F6, UK_ALT_GR, 0x2F, UK_PLAIN, 0x12),    // ö
+  UK_KEY(0x00F7, UK_SHIFT_ALT_GR, 0x24),               // ÷
+  UK_KEY(0x00F8, UK_PLAIN, 0x34),                      // ø
+  UK_DEAD(0x00F9, UK_SHIFT, 0x2E, UK_PLAIN, 0x18),     // ù
+  UK_DEAD(0x00FA, UK_PLAIN, 0x2E, UK_PLAIN, 0x18),     // ú
+  UK_DEAD(0x00FB, UK_SHIFT, 0x30, UK_PLAIN, 0x18),     // û
+  UK_DEAD(0x00FC, UK_ALT_GR, 0x2F, UK_PLAIN, 0x18),    // ü
+  UK_DEAD(0x00FD, UK_PLAIN, 0x2E, UK_PLAIN, 0x1C),     // ý
+  UK_KEY(0x00FE, UK_ALT_GR, 0x17),                     // þ
+  UK_DEAD(0x00FF, UK_ALT_GR, 0x2F, UK_PLAIN, 0x1C),    // ÿ
+  UK_DEAD(0x0104, UK_SHIFT_ALT_GR, 0x36, UK_SHIFT, 0x04), // Ą
+  UK_DEAD(0x0105, UK_SHIFT_ALT_GR, 0x36, UK_PLAIN, 0x04), // ą
+  UK_DEAD(0x0106, UK_PLAIN, 0x2E, UK_SHIFT, 0x06),     // Ć
+  UK_DEAD(0x0107, UK_PLAIN, 0x2E, UK_PLAIN, 0x06),     // ć
+  UK_DEAD(0x0108, UK_SHIFT, 0x30, UK_SHIFT, 0x06),     // Ĉ
+  UK_DEAD(0x0109, UK_SHIFT, 0x30, UK_PLAIN, 0x06),     // ĉ
+  UK_DEAD(0x010A, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x06), // Ċ
+  UK_DEAD(0x010B, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x06), // ċ
+  UK_DEAD(0x010C, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x06), // Č
+  UK_DEAD(0x010D, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x06), // č
+  UK_DEAD(0x010E, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x07), // Ď
+  UK_DEAD(0x010F, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x07), // ď
+  UK_KEY(0x0111, UK_ALT_GR, 0x09),                     // đ
+  UK_DEAD(0x0116, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x08), // Ė
+  UK_DEAD(0x0117, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x08), // ė
+  UK_DEAD(0x0118, UK_SHIFT_ALT_GR, 0x36, UK_SHIFT, 0x08), // Ę
+  UK_DEAD(0x0119, UK_SHIFT_ALT_GR, 0x36, UK_PLAIN, 0x08), // ę
+  UK_DEAD(0x011A, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x08), // Ě
+  UK_DEAD(0x011B, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x08), // ě
+  UK_DEAD(0x011C, UK_SHIFT, 0x30, UK_SHIFT, 0x0A),     // Ĝ
+  UK_DEAD(0x011D, UK_SHIFT, 0x30, UK_PLAIN, 0x0A),     // ĝ
+  UK_DEAD(0x0120, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x0A), // Ġ
+  UK_DEAD(0x0121, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x0A), // ġ
+  UK_DEAD(0x0122, UK_ALT_GR, 0x36, UK_SHIFT, 0x0A),    // Ģ
+  UK_DEAD(0x0123, UK_ALT_GR, 0x36, UK_PLAIN, 0x0A),    // ģ
+  UK_DEAD(0x0124, UK_SHIFT, 0x30, UK_SHIFT, 0x0B),     // Ĥ
+  UK_DEAD(0x0125, UK_SHIFT, 0x30, UK_PLAIN, 0x0B),     // ĥ
+  UK_KEY(0x0126, UK_SHIFT_ALT_GR, 0x0B),               // Ħ
+  UK_KEY(0x0127, UK_ALT_GR, 0x0B),                     // ħ
+  UK_DEAD(0x0128, UK_ALT_GR, 0x30, UK_SHIFT, 0x0C),    // Ĩ
+  UK_DEAD(0x0129, UK_ALT_GR, 0x30, UK_PLAIN, 0x0C),    // ĩ
+  UK_DEAD(0x012E, UK_SHIFT_ALT_GR, 0x36, UK_SHIFT, 0x0C), // Į
+  UK_DEAD(0x012F, UK_SHIFT_ALT_GR, 0x36, UK_PLAIN, 0x0C), // į
+  UK_DEAD(0x0130, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x0C), // İ
+  UK_KEY(0x0131, UK_SHIFT_ALT_GR, 0x0C),               // ı
+  UK_DEAD(0x0134, UK_SHIFT, 0x30, UK_SHIFT, 0x0D),     // Ĵ
+  UK_DEAD(0x0135, UK_SHIFT, 0x30, UK_PLAIN, 0x0D),     // ĵ
+  UK_DEAD(0x0136, UK_ALT_GR, 0x36, UK_SHIFT, 0x0E),    // Ķ
+  UK_DEAD(0x0137, UK_ALT_GR, 0x36, UK_PLAIN, 0x0E),    // ķ
+  UK_KEY(0x0138, UK_ALT_GR, 0x0E),                     // ĸ
+  UK_DEAD(0x0139, UK_PLAIN, 0x2E, UK_SHIFT, 0x0F),     // Ĺ
+  UK_DEAD(0x013A, UK_PLAIN, 0x2E, UK_PLAIN, 0x0F),     // ĺ
+  UK_DEAD(0x013B, UK_ALT_GR, 0x36, UK_SHIFT, 0x0F),    // Ļ
+  UK_DEAD(0x013C, UK_ALT_GR, 0x36, UK_PLAIN, 0x0F),    // ļ
+  UK_DEAD(0x013D, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0F), // Ľ
+  UK_DEAD(0x013E, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0F), // ľ
+  UK_DEAD(0x013F, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x0F), // Ŀ
+  UK_DEAD(0x0140, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x0F), // ŀ
+  UK_KEY(0x0141, UK_SHIFT_ALT_GR, 0x0F),               // Ł
+  UK_KEY(0x0142, UK_ALT_GR, 0x0F),                     // ł
+  UK_DEAD(0x0143, UK_PLAIN, 0x2E, UK_SHIFT, 0x11),     // Ń
+  UK_DEAD(0x0144, UK_PLAIN, 0x2E, UK_PLAIN, 0x11),     // ń
+  UK_DEAD(0x0145, UK_ALT_GR, 0x36, UK_SHIFT, 0x11),    // Ņ
+  UK_DEAD(0x0146, UK_ALT_GR, 0x36, UK_PLAIN, 0x11),    // ņ
+  UK_DEAD(0x0147, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x11), // Ň
+  UK_DEAD(0x0148, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x11), // ň
+  UK_KEY(0x014A, UK_SHIFT_ALT_GR, 0x0A),               // Ŋ
+  UK_KEY(0x014B, UK_ALT_GR, 0x0A),                     // ŋ
+  UK_DEAD(0x0150, UK_ALT_GR, 0x31, UK_SHIFT, 0x12),    // Ő
+  UK_DEAD(0x0151, UK_ALT_GR, 0x31, UK_PLAIN, 0x12),    // ő
+  UK_KEY(0x0152, UK_SHIFT_ALT_GR, 0x12),               // Œ
+  UK_KEY(0x0153, UK_ALT_GR, 0x12),                     // œ
+  UK_DEAD(0x0154, UK_PLAIN, 0x2E, UK_SHIFT, 0x15),     // Ŕ
+  UK_DEAD(0x0155, UK_PLAIN, 0x2E, UK_PLAIN, 0x15),     // ŕ
+  UK_DEAD(0x0156, UK_ALT_GR, 0x36, UK_SHIFT, 0x15),    // Ŗ
+  UK_DEAD(0x0157, UK_ALT_GR, 0x36, UK_PLAIN, 0x15),    // ŗ
+  UK_DEAD(0x0158, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x15), // Ř
+  UK_DEAD(0x0159, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x15), // ř
+  UK_DEAD(0x015A, UK_PLAIN, 0x2E, UK_SHIFT, 0x16),     // Ś
+  UK_DEAD(0x015B, UK_PLAIN, 0x2E, UK_PLAIN, 0x16),     // ś
+  UK_DEAD(0x015C, UK_SHIFT, 0x30, UK_SHIFT, 0x16),     // Ŝ
+  UK_DEAD(0x015D, UK_SHIFT, 0x30, UK_PLAIN, 0x16),     // ŝ
+  UK_DEAD(0x015E, UK_ALT_GR, 0x36, UK_SHIFT, 0x16),    // Ş
+  UK_DEAD(0x015F, UK_ALT_GR, 0x36, UK_PLAIN, 0x16),    // ş
+  UK_DEAD(0x0160, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x16), // Š
+  UK_DEAD(0x0161, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x16), // š
+  UK_DEAD(0x0162, UK_ALT_GR, 0x36, UK_SHIFT, 0x17),    // Ţ
+  UK_DEAD(0x0163, UK_ALT_GR, 0x36, UK_PLAIN, 0x17),    // ţ
+  UK_DEAD(0x0164, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x17), // Ť
+  UK_DEAD(0x0165, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x17), // ť
+  UK_DEAD(0x0168, UK_ALT_GR, 0x30, UK_SHIFT, 0x18),    // Ũ
+  UK_DEAD(0x0169, UK_ALT_GR, 0x30, UK_PLAIN, 0x18),    // ũ
+  UK_DEAD(0x016E, UK_SHIFT_ALT_GR, 0x2F, UK_SHIFT, 0x18), // Ů
+  UK_DEAD(0x016F, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x18), // ů
+  UK_DEAD(0x0170, UK_ALT_GR, 0x31, UK_SHIFT, 0x18),    // Ű
+  UK_DEAD(0x0171, UK_ALT_GR, 0x31, UK_PLAIN, 0x18),    // ű
+  UK_DEAD(0x0172, UK_SHIFT_ALT_GR, 0x36, UK_SHIFT, 0x18), // Ų
+  UK_DEAD(0x0173, UK_SHIFT_ALT_GR, 0x36, UK_PLAIN, 0x18), // ų
+  UK_DEAD(0x0174, UK_SHIFT, 0x30, UK_SHIFT, 0x1A),     // Ŵ
+  UK_DEAD(0x0175, UK_SHIFT, 0x30, UK_PLAIN, 0x1A),     // ŵ
+  UK_DEAD(0x0176, UK_SHIFT, 0x30, UK_SHIFT, 0x1C),     // Ŷ
+  UK_DEAD(0x0177, UK_SHIFT, 0x30, UK_PLAIN, 0x1C),     // ŷ
+  UK_DEAD(0x0178, UK_ALT_GR, 0x2F, UK_SHIFT, 0x1C),    // Ÿ
+  UK_DEAD(0x0179, UK_PLAIN, 0x2E, UK_SHIFT, 0x1D),     // Ź
+  UK_DEAD(0x017A, UK_PLAIN, 0x2E, UK_PLAIN, 0x1D),     // ź
+  UK_DEAD(0x017B, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x1D), // Ż
+  UK_DEAD(0x017C, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x1D), // ż
+  UK_DEAD(0x017D, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x1D), // Ž
+  UK_DEAD(0x017E, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x1D), // ž
+  UK_KEY(0x017F, UK_ALT_GR, 0x1A),                     // ſ
+  UK_DEAD(0x0181, UK_ALT_GR, 0x0D, UK_SHIFT, 0x05),    // Ɓ
+  UK_DEAD(0x0187, UK_ALT_GR, 0x0D, UK_SHIFT, 0x06),    // Ƈ
+  UK_DEAD(0x0188, UK_ALT_GR, 0x0D, UK_PLAIN, 0x06),    // ƈ
+  UK_DEAD(0x018A, UK_ALT_GR, 0x0D, UK_SHIFT, 0x07),    // Ɗ
+  UK_DEAD(0x0191, UK_ALT_GR, 0x0D, UK_SHIFT, 0x09),    // Ƒ
+  UK_DEAD(0x0192, UK_ALT_GR, 0x0D, UK_PLAIN, 0x09),    // ƒ
+  UK_DEAD(0x0193, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0A),    // Ɠ
+  UK_DEAD(0x0198, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0E),    // Ƙ
+  UK_DEAD(0x0199, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0E),    // ƙ
+  UK_DEAD(0x019D, UK_ALT_GR, 0x0D, UK_SHIFT, 0x11),    // Ɲ
+  UK_DEAD(0x01A0, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x12), // Ơ
+  UK_DEAD(0x01A1, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x12), // ơ
+  UK_DEAD(0x01A4, UK_ALT_GR, 0x0D, UK_SHIFT, 0x13),    // Ƥ
+  UK_DEAD(0x01A5, UK_ALT_GR, 0x0D, UK_PLAIN, 0x13),    // ƥ
+  UK_DEAD(0x01AC, UK_ALT_GR, 0x0D, UK_SHIFT, 0x17),    // Ƭ
+  UK_DEAD(0x01AD, UK_ALT_GR, 0x0D, UK_PLAIN, 0x17),    // ƭ
+  UK_DEAD(0x01AF, UK_SHIFT_ALT_GR, 0x0D, UK_SHIFT, 0x18), // Ư
+  UK_DEAD(0x01B0, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x18), // ư
+  UK_DEAD(0x01B2, UK_ALT_GR, 0x0D, UK_SHIFT, 0x19),    // Ʋ
+  UK_DEAD(0x01CD, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x04), // Ǎ
+  UK_DEAD(0x01CE, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x04), // ǎ
+  UK_DEAD(0x01CF, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0C), // Ǐ
+  UK_DEAD(0x01D0, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0C), // ǐ
+  UK_DEAD(0x01D1, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x12), // Ǒ
+  UK_DEAD(0x01D2, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x12), // ǒ
+  UK_DEAD(0x01D3, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x18), // Ǔ
+  UK_DEAD(0x01D4, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x18), // ǔ
+  UK_DEAD(0x01D7, UK_PLAIN, 0x2E, UK_SHIFT, 0x19),     // Ǘ
+  UK_DEAD(0x01D8, UK_PLAIN, 0x2E, UK_PLAIN, 0x19),     // ǘ
+  UK_DEAD(0x01D9, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x19), // Ǚ
+  UK_DEAD(0x01DA, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x19), // ǚ
+  UK_DEAD(0x01DB, UK_SHIFT, 0x2E, UK_SHIFT, 0x19),     // Ǜ
+  UK_DEAD(0x01DC, UK_SHIFT, 0x2E, UK_PLAIN, 0x19),     // ǜ
+  UK_DEAD(0x01E6, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0A), // Ǧ
+  UK_DEAD(0x01E7, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0A), // ǧ
+  UK_DEAD(0x01E8, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0E), // Ǩ
+  UK_DEAD(0x01E9, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0E), // ǩ
+  UK_DEAD(0x01EA, UK_SHIFT_ALT_GR, 0x36, UK_SHIFT, 0x12), // Ǫ
+  UK_DEAD(0x01EB, UK_SHIFT_ALT_GR, 0x36, UK_PLAIN, 0x12), // ǫ
+  UK_DEAD(0x01F0, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0D), // ǰ
+  UK_DEAD(0x01F4, UK_PLAIN, 0x2E, UK_SHIFT, 0x0A),     // Ǵ
+  UK_DEAD(0x01F5, UK_PLAIN, 0x2E, UK_PLAIN, 0x0A),     // ǵ
+  UK_DEAD(0x01F8, UK_SHIFT, 0x2E, UK_SHIFT, 0x11),     // Ǹ
+  UK_DEAD(0x01F9, UK_SHIFT, 0x2E, UK_PLAIN, 0x11),     // ǹ
+  UK_DEAD(0x01FA, UK_PLAIN, 0x2E, UK_SHIFT, 0x2F),     // Ǻ
+  UK_DEAD(0x01FB, UK_PLAIN, 0x2E, UK_PLAIN, 0x2F),     // ǻ
+  UK_DEAD(0x01FC, UK_PLAIN, 0x2E, UK_SHIFT, 0x33),     // Ǽ
+  UK_DEAD(0x01FD, UK_PLAIN, 0x2E, UK_PLAIN, 0x33),     // ǽ
+  UK_DEAD(0x01FE, UK_PLAIN, 0x2E, UK_SHIFT, 0x34),     // Ǿ
+  UK_DEAD(0x01FF, UK_PLAIN, 0x2E, UK_PLAIN, 0x34),     // ǿ
+  UK_DEAD(0x021E, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0B), // Ȟ
+  UK_DEAD(0x021F, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0B), // ȟ
+  UK_DEAD(0x0224, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1D),    // Ȥ
+  UK_DEAD(0x0225, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1D),    // ȥ
+  UK_DEAD(0x0226, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x04), // Ȧ
+  UK_DEAD(0x0227, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x04), // ȧ
+  UK_DEAD(0x0228, UK_ALT_GR, 0x36, UK_SHIFT, 0x08),    // Ȩ
+  UK_DEAD(0x0229, UK_ALT_GR, 0x36, UK_PLAIN, 0x08),    // ȩ
+  UK_DEAD(0x022E, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x12), // Ȯ
+  UK_DEAD(0x022F, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x12), // ȯ
+  UK_DEAD(0x0237, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x0D), // ȷ
+  UK_DEAD(0x0253, UK_ALT_GR, 0x0D, UK_PLAIN, 0x05),    // ɓ
+  UK_DEAD(0x0257, UK_ALT_GR, 0x0D, UK_PLAIN, 0x07),    // ɗ
+  UK_DEAD(0x0260, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0A),    // ɠ
+  UK_DEAD(0x0266, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0B),    // ɦ
+  UK_DEAD(0x0271, UK_ALT_GR, 0x0D, UK_PLAIN, 0x10),    // ɱ
+  UK_DEAD(0x0272, UK_ALT_GR, 0x0D, UK_PLAIN, 0x11),    // ɲ
+  UK_DEAD(0x027C, UK_ALT_GR, 0x0D, UK_PLAIN, 0x15),    // ɼ
+  UK_DEAD(0x0282, UK_ALT_GR, 0x0D, UK_PLAIN, 0x16),    // ʂ
+  UK_DEAD(0x028B, UK_ALT_GR, 0x0D, UK_PLAIN, 0x19),    // ʋ
+  UK_DEAD(0x02A0, UK_ALT_GR, 0x0D, UK_PLAIN, 0x14),    // ʠ
+  UK_DEAD(0x02C7, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x2C), // ˇ
+  UK_DEAD(0x02D9, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x2C), // ˙
+  UK_DEAD(0x02DB, UK_SHIFT_ALT_GR, 0x36, UK_PLAIN, 0x2C), // ˛
+  UK_DEAD(0x02DD, UK_ALT_GR, 0x31, UK_PLAIN, 0x2C),    // ˝
+  UK_DEAD(0x0309, UK_ALT_GR, 0x0D, UK_PLAIN, 0x2C),    // ̉
+  UK_DEAD(0x031B, UK_SHIFT_ALT_GR, 0x0D, UK_PLAIN, 0x2C), // ̛
+  UK_DEAD(0x0323, UK_ALT_GR, 0x38, UK_PLAIN, 0x2C),    // ̣
+  UK_DEAD(0x0344, UK_ALT_GR, 0x2F, UK_PLAIN, 0x31),    // ̈́
+  UK_DEAD(0x038F, UK_PLAIN, 0x2E, UK_SHIFT_ALT_GR, 0x14), // Ώ
+  UK_KEY(0x03A9, UK_SHIFT_ALT_GR, 0x14),               // Ω
+  UK_DEAD(0x1E02, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x05), // Ḃ
+  UK_DEAD(0x1E03, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x05), // ḃ
+  UK_DEAD(0x1E04, UK_ALT_GR, 0x38, UK_SHIFT, 0x05),    // Ḅ
+  UK_DEAD(0x1E05, UK_ALT_GR, 0x38, UK_PLAIN, 0x05),    // ḅ
+  UK_DEAD(0x1E0A, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x07), // Ḋ
+  UK_DEAD(0x1E0B, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x07), // ḋ
+  UK_DEAD(0x1E0C, UK_ALT_GR, 0x38, UK_SHIFT, 0x07),    // Ḍ
+  UK_DEAD(0x1E0D, UK_ALT_GR, 0x38, UK_PLAIN, 0x07),    // ḍ
+  UK_DEAD(0x1E10, UK_ALT_GR, 0x36, UK_SHIFT, 0x07),    // Ḑ
+  UK_DEAD(0x1E11, UK_ALT_GR, 0x36, UK_PLAIN, 0x07),    // ḑ
+  UK_DEAD(0x1E1E, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x09), // Ḟ
+  UK_DEAD(0x1E1F, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x09), // ḟ
+  UK_DEAD(0x1E22, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x0B), // Ḣ
+  UK_DEAD(0x1E23, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x0B), // ḣ
+  UK_DEAD(0x1E24, UK_ALT_GR, 0x38, UK_SHIFT, 0x0B),    // Ḥ
+  UK_DEAD(0x1E25, UK_ALT_GR, 0x38, UK_PLAIN, 0x0B),    // ḥ
+  UK_DEAD(0x1E26, UK_ALT_GR, 0x2F, UK_SHIFT, 0x0B),    // Ḧ
+  UK_DEAD(0x1E27, UK_ALT_GR, 0x2F, UK_PLAIN, 0x0B),    // ḧ
+  UK_DEAD(0x1E28, UK_ALT_GR, 0x36, UK_SHIFT, 0x0B),    // Ḩ
+  UK_DEAD(0x1E29, UK_ALT_GR, 0x36, UK_PLAIN, 0x0B),    // ḩ
+  UK_DEAD(0x1E30, UK_PLAIN, 0x2E, UK_SHIFT, 0x0E),     // Ḱ
+  UK_DEAD(0x1E31, UK_PLAIN, 0x2E, UK_PLAIN, 0x0E),     // ḱ
+  UK_DEAD(0x1E32, UK_ALT_GR, 0x38, UK_SHIFT, 0x0E),    // Ḳ
+  UK_DEAD(0x1E33, UK_ALT_GR, 0x38, UK_PLAIN, 0x0E),    // ḳ
+  UK_DEAD(0x1E36, UK_ALT_GR, 0x38, UK_SHIFT, 0x0F),    // Ḷ
+  UK_DEAD(0x1E37, UK_ALT_GR, 0x38, UK_PLAIN, 0x0F),    // ḷ
+  UK_DEAD(0x1E3E, UK_PLAIN, 0x2E, UK_SHIFT, 0x10),     // Ḿ
+  UK_DEAD(0x1E3F, UK_PLAIN, 0x2E, UK_PLAIN, 0x10),     // ḿ
+  UK_DEAD(0x1E40, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x10), // Ṁ
+  UK_DEAD(0x1E41, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x10), // ṁ
+  UK_DEAD(0x1E42, UK_ALT_GR, 0x38, UK_SHIFT, 0x10),    // Ṃ
+  UK_DEAD(0x1E43, UK_ALT_GR, 0x38, UK_PLAIN, 0x10),    // ṃ
+  UK_DEAD(0x1E44, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x11), // Ṅ
+  UK_DEAD(0x1E45, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x11), // ṅ
+  UK_DEAD(0x1E46, UK_ALT_GR, 0x38, UK_SHIFT, 0x11),    // Ṇ
+  UK_DEAD(0x1E47, UK_ALT_GR, 0x38, UK_PLAIN, 0x11),    // ṇ
+  UK_DEAD(0x1E54, UK_PLAIN, 0x2E, UK_SHIFT, 0x13),     // Ṕ
+  UK_DEAD(0x1E55, UK_PLAIN, 0x2E, UK_PLAIN, 0x13),     // ṕ
+  UK_DEAD(0x1E56, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x13), // Ṗ
+  UK_DEAD(0x1E57, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x13), // ṗ
+  UK_DEAD(0x1E58, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x15), // Ṙ
+  UK_DEAD(0x1E59, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x15), // ṙ
+  UK_DEAD(0x1E5A, UK_ALT_GR, 0x38, UK_SHIFT, 0x15),    // Ṛ
+  UK_DEAD(0x1E5B, UK_ALT_GR, 0x38, UK_PLAIN, 0x15),    // ṛ
+  UK_DEAD(0x1E60, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x16), // Ṡ
+  UK_DEAD(0x1E61, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x16), // ṡ
+  UK_DEAD(0x1E62, UK_ALT_GR, 0x38, UK_SHIFT, 0x16),    // Ṣ
+  UK_DEAD(0x1E63, UK_ALT_GR, 0x38, UK_PLAIN, 0x16),    // ṣ
+  UK_DEAD(0x1E6A, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x17), // Ṫ
+  UK_DEAD(0x1E6B, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x17), // ṫ
+  UK_DEAD(0x1E6C, UK_ALT_GR, 0x38, UK_SHIFT, 0x17),    // Ṭ
+  UK_DEAD(0x1E6D, UK_ALT_GR, 0x38, UK_PLAIN, 0x17),    // ṭ
+  UK_DEAD(0x1E7C, UK_ALT_GR, 0x30, UK_SHIFT, 0x19),    // Ṽ
+  UK_DEAD(0x1E7D, UK_ALT_GR, 0x30, UK_PLAIN, 0x19),    // ṽ
+  UK_DEAD(0x1E7E, UK_ALT_GR, 0x38, UK_SHIFT, 0x19),    // Ṿ
+  UK_DEAD(0x1E7F, UK_ALT_GR, 0x38, UK_PLAIN, 0x19),    // ṿ
+  UK_DEAD(0x1E80, UK_SHIFT, 0x2E, UK_SHIFT, 0x1A),     // Ẁ
+  UK_DEAD(0x1E81, UK_SHIFT, 0x2E, UK_PLAIN, 0x1A),     // ẁ
+  UK_DEAD(0x1E82, UK_PLAIN, 0x2E, UK_SHIFT, 0x1A),     // Ẃ
+  UK_DEAD(0x1E83, UK_PLAIN, 0x2E, UK_PLAIN, 0x1A),     // ẃ
+  UK_DEAD(0x1E84, UK_ALT_GR, 0x2F, UK_SHIFT, 0x1A),    // Ẅ
+  UK_DEAD(0x1E85, UK_ALT_GR, 0x2F, UK_PLAIN, 0x1A),    // ẅ
+  UK_DEAD(0x1E86, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x1A), // Ẇ
+  UK_DEAD(0x1E87, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x1A), // ẇ
+  UK_DEAD(0x1E88, UK_ALT_GR, 0x38, UK_SHIFT, 0x1A),    // Ẉ
+  UK_DEAD(0x1E89, UK_ALT_GR, 0x38, UK_PLAIN, 0x1A),    // ẉ
+  UK_DEAD(0x1E8A, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x1B), // Ẋ
+  UK_DEAD(0x1E8B, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x1B), // ẋ
+  UK_DEAD(0x1E8C, UK_ALT_GR, 0x2F, UK_SHIFT, 0x1B),    // Ẍ
+  UK_DEAD(0x1E8D, UK_ALT_GR, 0x2F, UK_PLAIN, 0x1B),    // ẍ
+  UK_DEAD(0x1E8E, UK_SHIFT_ALT_GR, 0x37, UK_SHIFT, 0x1C), // Ẏ
+  UK_DEAD(0x1E8F, UK_SHIFT_ALT_GR, 0x37, UK_PLAIN, 0x1C), // ẏ
+  UK_DEAD(0x1E90, UK_SHIFT, 0x30, UK_SHIFT, 0x1D),     // Ẑ
+  UK_DEAD(0x1E91, UK_SHIFT, 0x30, UK_PLAIN, 0x1D),     // ẑ
+  UK_DEAD(0x1E92, UK_ALT_GR, 0x38, UK_SHIFT, 0x1D),    // Ẓ
+  UK_DEAD(0x1E93, UK_ALT_GR, 0x38, UK_PLAIN, 0x1D),    // ẓ
+  UK_DEAD(0x1E97, UK_ALT_GR, 0x2F, UK_PLAIN, 0x17),    // ẗ
+  UK_DEAD(0x1E98, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x1A), // ẘ
+  UK_DEAD(0x1E99, UK_SHIFT_ALT_GR, 0x2F, UK_PLAIN, 0x1C), // ẙ
+  UK_DEAD(0x1E9B, UK_SHIFT_ALT_GR, 0x37, UK_ALT_GR, 0x1A), // ẛ
+  UK_KEY(0x1E9E, UK_SHIFT_ALT_GR, 0x16),               // ẞ
+  UK_DEAD(0x1EA0, UK_ALT_GR, 0x38, UK_SHIFT, 0x04),    // Ạ
+  UK_DEAD(0x1EA1, UK_ALT_GR, 0x38, UK_PLAIN, 0x04),    // ạ
+  UK_DEAD(0x1EA2, UK_ALT_GR, 0x0D, UK_SHIFT, 0x04),    // Ả
+  UK_DEAD(0x1EA3, UK_ALT_GR, 0x0D, UK_PLAIN, 0x04),    // ả
+  UK_DEAD(0x1EB8, UK_ALT_GR, 0x38, UK_SHIFT, 0x08),    // Ẹ
+  UK_DEAD(0x1EB9, UK_ALT_GR, 0x38, UK_PLAIN, 0x08),    // ẹ
+  UK_DEAD(0x1EBA, UK_ALT_GR, 0x0D, UK_SHIFT, 0x08),    // Ẻ
+  UK_DEAD(0x1EBB, UK_ALT_GR, 0x0D, UK_PLAIN, 0x08),    // ẻ
+  UK_DEAD(0x1EBC, UK_ALT_GR, 0x30, UK_SHIFT, 0x08),    // Ẽ
+  UK_DEAD(0x1EBD, UK_ALT_GR, 0x30, UK_PLAIN, 0x08),    // ẽ
+  UK_DEAD(0x1EC8, UK_ALT_GR, 0x0D, UK_SHIFT, 0x0C),    // Ỉ
+  UK_DEAD(0x1EC9, UK_ALT_GR, 0x0D, UK_PLAIN, 0x0C),    // ỉ
+  UK_DEAD(0x1ECA, UK_ALT_GR, 0x38, UK_SHIFT, 0x0C),    // Ị
+  UK_DEAD(0x1ECB, UK_ALT_GR, 0x38, UK_PLAIN, 0x0C),    // ị
+  UK_DEAD(0x1ECC, UK_ALT_GR, 0x38, UK_SHIFT, 0x12),    // Ọ
+  UK_DEAD(0x1ECD, UK_ALT_GR, 0x38, UK_PLAIN, 0x12),    // ọ
+  UK_DEAD(0x1ECE, UK_ALT_GR, 0x0D, UK_SHIFT, 0x12),    // Ỏ
+  UK_DEAD(0x1ECF, UK_ALT_GR, 0x0D, UK_PLAIN, 0x12),    // ỏ
+  UK_DEAD(0x1EE4, UK_ALT_GR, 0x38, UK_SHIFT, 0x18),    // Ụ
+  UK_DEAD(0x1EE5, UK_ALT_GR, 0x38, UK_PLAIN, 0x18),    // ụ
+  UK_DEAD(0x1EE6, UK_ALT_GR, 0x0D, UK_SHIFT, 0x18),    // Ủ
+  UK_DEAD(0x1EE7, UK_ALT_GR, 0x0D, UK_PLAIN, 0x18),    // ủ
+  UK_DEAD(0x1EF2, UK_SHIFT, 0x2E, UK_SHIFT, 0x1C),     // Ỳ
+  UK_DEAD(0x1EF3, UK_SHIFT, 0x2E, UK_PLAIN, 0x1C),     // ỳ
+  UK_DEAD(0x1EF4, UK_ALT_GR, 0x38, UK_SHIFT, 0x1C),    // Ỵ
+  UK_DEAD(0x1EF5, UK_ALT_GR, 0x38, UK_PLAIN, 0x1C),    // ỵ
+  UK_DEAD(0x1EF6, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1C),    // Ỷ
+  UK_DEAD(0x1EF7, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1C),    // ỷ
+  UK_DEAD(0x1EF8, UK_ALT_GR, 0x30, UK_SHIFT, 0x1C),    // Ỹ
+  UK_DEAD(0x1EF9, UK_ALT_GR, 0x30, UK_PLAIN, 0x1C),    // ỹ
+  UK_DEAD(0x1FFA, UK_SHIFT, 0x2E, UK_SHIFT_ALT_GR, 0x14), // Ὼ
+  UK_KEY(0x2018, UK_SHIFT_ALT_GR, 0x05),               // ‘
+  UK_KEY(0x2019, UK_SHIFT_ALT_GR, 0x11),               // ’
+  UK_KEY(0x201A, UK_SHIFT_ALT_GR, 0x19),               // ‚
+  UK_KEY(0x201C, UK_ALT_GR, 0x05),                     // “
+  UK_KEY(0x201D, UK_ALT_GR, 0x11),                     // ”
+  UK_KEY(0x201E, UK_ALT_GR, 0x19),                     // „
+  UK_DEAD(0x2070, UK_SHIFT, 0x30, UK_PLAIN, 0x27),     // ⁰
+  UK_DEAD(0x2074, UK_SHIFT, 0x30, UK_PLAIN, 0x21),     // ⁴
+  UK_DEAD(0x2075, UK_SHIFT, 0x30, UK_PLAIN, 0x22),     // ⁵
+  UK_DEAD(0x2076, UK_SHIFT, 0x30, UK_PLAIN, 0x23),     // ⁶
+  UK_DEAD(0x2077, UK_SHIFT, 0x30, UK_PLAIN, 0x24),     // ⁷
+  UK_DEAD(0x2078, UK_SHIFT, 0x30, UK_PLAIN, 0x25),     // ⁸
+  UK_DEAD(0x2079, UK_SHIFT, 0x30, UK_PLAIN, 0x26),     // ⁹
+  UK_DEAD(0x207A, UK_SHIFT, 0x30, UK_PLAIN, 0x2D),     // ⁺
+  UK_DEAD(0x207B, UK_SHIFT, 0x30, UK_PLAIN, 0x38),     // ⁻
+  UK_DEAD(0x207C, UK_SHIFT, 0x30, UK_SHIFT, 0x27),     // ⁼
+  UK_DEAD(0x207D, UK_SHIFT, 0x30, UK_SHIFT, 0x25),     // ⁽
+  UK_DEAD(0x207E, UK_SHIFT, 0x30, UK_SHIFT, 0x26),     // ⁾
+  UK_DEAD(0x2080, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x27), // ₀
+  UK_DEAD(0x2081, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x1E), // ₁
+  UK_DEAD(0x2082, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x1F), // ₂
+  UK_DEAD(0x2083, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x20), // ₃
+  UK_DEAD(0x2084, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x21), // ₄
+  UK_DEAD(0x2085, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x22), // ₅
+  UK_DEAD(0x2086, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x23), // ₆
+  UK_DEAD(0x2087, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x24), // ₇
+  UK_DEAD(0x2088, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x25), // ₈
+  UK_DEAD(0x2089, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x26), // ₉
+  UK_DEAD(0x208A, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x2D), // ₊
+  UK_DEAD(0x208B, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x38), // ₋
+  UK_DEAD(0x208C, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x27), // ₌
+  UK_DEAD(0x208D, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x25), // ₍
+  UK_DEAD(0x208E, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x26), // ₎
+  UK_KEY(0x20AC, UK_ALT_GR, 0x08),                     // €
+  UK_DEAD(0x20B5, UK_ALT_GR, 0x36, UK_SHIFT_ALT_GR, 0x22), // ₵
+  UK_KEY(0x215D, UK_SHIFT_ALT_GR, 0x23),               // ⅝
+  UK_KEY(0x2190, UK_ALT_GR, 0x1C),                     // ←
+  UK_KEY(0x2191, UK_SHIFT_ALT_GR, 0x18),               // ↑
+  UK_KEY(0x2192, UK_ALT_GR, 0x0C),                     // →
+  UK_KEY(0x2193, UK_ALT_GR, 0x18),                     // ↓
+  UK_DEAD(0x2243, UK_ALT_GR, 0x30, UK_SHIFT, 0x27),    // ≃
+  UK_DEAD(0x2272, UK_ALT_GR, 0x30, UK_PLAIN, 0x64),    // ≲
+  UK_DEAD(0x2273, UK_ALT_GR, 0x30, UK_SHIFT, 0x64),    // ≳
+  UK_DEAD(0x2A25, UK_ALT_GR, 0x38, UK_PLAIN, 0x2D),    // ⨥
+  UK_DEAD(0x2A2A, UK_ALT_GR, 0x38, UK_PLAIN, 0x38),    // ⨪
+  UK_DEAD(0x2A66, UK_ALT_GR, 0x38, UK_SHIFT, 0x27),    // ⩦
+  UK_DEAD(0x2C6E, UK_ALT_GR, 0x0D, UK_SHIFT, 0x10),    // Ɱ
+  UK_DEAD(0x2C72, UK_ALT_GR, 0x0D, UK_SHIFT, 0x1A),    // Ⱳ
+  UK_DEAD(0x2C73, UK_ALT_GR, 0x0D, UK_PLAIN, 0x1A),    // ⱳ
+};
+#define UNICODE_KEYS_da_DK UnicodeKeys_da_DK, UNICODE_KEY_COUNT(UnicodeKeys_da_DK)
+
+// hu_HU (XKB "hu"): 373 characters, 309 of them after a dead key
+static const UnicodeKeyEntry UnicodeKeys_hu_HU[] = {
+  UK_KEY(0x00A2, UK_SHIFT_ALT_GR, 0x33),               // ¢
+  UK_KEY(0x00A4, UK_ALT_GR, 0x31),                     // ¤
+  UK_KEY(0x00A5, UK_SHIFT_ALT_GR, 0x1C),               // ¥
+  UK_KEY(0x00A7, UK_SHIFT, 0x35),                      // §
+  UK_KEY(0x00A8, UK_SHIFT_ALT_GR, 0x2D),               // ¨
+  UK_KEY(0x00A9, UK_SHIFT_ALT_GR, 0x06),               // ©
+  UK_KEY(0x00AA, UK_SHIFT_ALT_GR, 0x09),               // ª
+  UK_KEY(0x00AC, UK_ALT_GR, 0x35),                     // ¬
+  UK_KEY(0x00AE, UK_SHIFT_ALT_GR, 0x15),               // ®
+  UK_DEAD(0x00AF, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x2C), // ¯
+  UK_KEY(0x00B0, UK_SHIFT_ALT_GR, 0x22),               // °
+  UK_DEAD(0x00B2, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x1F), // ²
+  UK_DEAD(0x00B3, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x20), // ³
+  UK_KEY(0x00B4, UK_SHIFT_ALT_GR, 0x26),               // ´
+  UK_KEY(0x00B6, UK_ALT_GR, 0x15),                     // ¶
+  UK_DEAD(0x00B7, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x37), // ·
+  UK_KEY(0x00B8, UK_SHIFT_ALT_GR, 0x2E),               // ¸
+  UK_DEAD(0x00B9, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x1E), // ¹
+  UK_KEY(0x00BA, UK_SHIFT_ALT_GR, 0x10),               // º
+  UK_DEAD(0x00C0, UK_SHIFT_ALT_GR, 0x24, UK_SHIFT, 0x04), // À
+  UK_KEY(0x00C1, UK_SHIFT, 0x34),                      // Á
+  UK_DEAD(0x00C2, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x04), // Â
+  UK_DEAD(0x00C3, UK_SHIFT_ALT_GR, 0x1E, UK_SHIFT, 0x04), // Ã
+  UK_KEY(0x00C4, UK_ALT_GR, 0x08),                     // Ä
+  UK_DEAD(0x00C5, UK_ALT_GR, 0x22, UK_SHIFT, 0x04),    // Å
+  UK_DEAD(0x00C7, UK_ALT_GR, 0x2E, UK_SHIFT, 0x06),    // Ç
+  UK_DEAD(0x00C8, UK_SHIFT_ALT_GR, 0x24, UK_SHIFT, 0x08), // È
+  UK_KEY(0x00C9, UK_SHIFT, 0x33),                      // É
+  UK_DEAD(0x00CA, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x08), // Ê
+  UK_DEAD(0x00CB, UK_ALT_GR, 0x2D, UK_SHIFT, 0x08),    // Ë
+  UK_DEAD(0x00CC, UK_SHIFT_ALT_GR, 0x24, UK_SHIFT, 0x0C), // Ì
+  UK_KEY(0x00CD, UK_ALT_GR, 0x0C),                     // Í
+  UK_DEAD(0x00CE, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x0C), // Î
+  UK_DEAD(0x00CF, UK_ALT_GR, 0x2D, UK_SHIFT, 0x0C),    // Ï
+  UK_KEY(0x00D0, UK_SHIFT_ALT_GR, 0x07),               // Ð
+  UK_DEAD(0x00D1, UK_SHIFT_ALT_GR, 0x1E, UK_SHIFT, 0x11), // Ñ
+  UK_DEAD(0x00D2, UK_SHIFT_ALT_GR, 0x24, UK_SHIFT, 0x12), // Ò
+  UK_KEY(0x00D3, UK_SHIFT, 0x2E),                      // Ó
+  UK_DEAD(0x00D4, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x12), // Ô
+  UK_DEAD(0x00D5, UK_SHIFT_ALT_GR, 0x1E, UK_SHIFT, 0x12), // Õ
+  UK_KEY(0x00D6, UK_SHIFT, 0x27),                      // Ö
+  UK_KEY(0x00D7, UK_ALT_GR, 0x30),                     // ×
+  UK_KEY(0x00D8, UK_SHIFT_ALT_GR, 0x12),               // Ø
+  UK_DEAD(0x00D9, UK_SHIFT_ALT_GR, 0x24, UK_SHIFT, 0x18), // Ù
+  UK_KEY(0x00DA, UK_SHIFT, 0x30),                      // Ú
+  UK_DEAD(0x00DB, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x18), // Û
+  UK_KEY(0x00DC, UK_SHIFT, 0x2D),                      // Ü
+  UK_DEAD(0x00DD, UK_ALT_GR, 0x26, UK_SHIFT, 0x1D),    // Ý
+  UK_KEY(0x00DE, UK_SHIFT_ALT_GR, 0x13),               // Þ
+  UK_KEY(0x00DF, UK_ALT_GR, 0x34),                     // ß
+  UK_DEAD(0x00E0, UK_SHIFT_ALT_GR, 0x24, UK_PLAIN, 0x04), // à
+  UK_KEY(0x00E1, UK_PLAIN, 0x34),                      // á
+  UK_DEAD(0x00E2, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x04), // â
+  UK_DEAD(0x00E3, UK_SHIFT_ALT_GR, 0x1E, UK_PLAIN, 0x04), // ã
+  UK_KEY(0x00E4, UK_ALT_GR, 0x04),                     // ä
+  UK_DEAD(0x00E5, UK_ALT_GR, 0x22, UK_PLAIN, 0x04),    // å
+  UK_DEAD(0x00E7, UK_ALT_GR, 0x2E, UK_PLAIN, 0x06),    // ç
+  UK_DEAD(0x00E8, UK_SHIFT_ALT_GR, 0x24, UK_PLAIN, 0x08), // è
+  UK_KEY(0x00E9, UK_PLAIN, 0x33),                      // é
+  UK_DEAD(0x00EA, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x08), // ê
+  UK_DEAD(0x00EB, UK_ALT_GR, 0x2D, UK_PLAIN, 0x08),    // ë
+  UK_DEAD(0x00EC, UK_SHIFT_ALT_GR, 0x24, UK_PLAIN, 0x0C), // ì
+  UK_KEY(0x00ED, UK_SHIFT_ALT_GR, 0x0C),               // í
+  UK_DEAD(0x00EE, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x0C), // î
+  UK_DEAD(0x00EF, UK_ALT_GR, 0x2D, UK_PLAIN, 0x0C),    // ï
+  UK_DEAD(0x00F1, UK_SHIFT_ALT_GR, 0x1E, UK_PLAIN, 0x11), // ñ
+  UK_DEAD(0x00F2, UK_SHIFT_ALT_GR, 0x24, UK_PLAIN, 0x12), // ò
+  UK_KEY(0x00F3, UK_PLAIN, 0x2E),                      // ó
+  UK_DEAD(0x00F4, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x12), // ô
+  UK_DEAD(0x00F5, UK_SHIFT_ALT_GR, 0x1E, UK_PLAIN, 0x12), // õ
+  UK_KEY(0x00F6, UK_PLAIN, 0x27),                      // ö
+  UK_KEY(0x00F7, UK_ALT_GR, 0x2F),                     // ÷
+  UK_DEAD(0x00F9, UK_SHIFT_ALT_GR, 0x24, UK_PLAIN, 0x18), // ù
+  UK_KEY(0x00FA, UK_PLAIN, 0x30),                      // ú
+  UK_DEAD(0x00FB, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x18), // û
+  UK_KEY(0x00FC, UK_PLAIN, 0x2D),                      // ü
+  UK_DEAD(0x00FD, UK_ALT_GR, 0x26, UK_PLAIN, 0x1D),    // ý
+  UK_DEAD(0x00FF, UK_ALT_GR, 0x2D, UK_PLAIN, 0x1D),    // ÿ
+  UK_DEAD(0x0100, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x04), // Ā
+  UK_DEAD(0x0101, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x04), // ā
+  UK_DEAD(0x0102, UK_ALT_GR, 0x21, UK_SHIFT, 0x04),    // Ă
+  UK_DEAD(0x0103, UK_ALT_GR, 0x21, UK_PLAIN, 0x04),    // ă
+  UK_DEAD(0x0104, UK_ALT_GR, 0x23, UK_SHIFT, 0x04),    // Ą
+  UK_DEAD(0x0105, UK_ALT_GR, 0x23, UK_PLAIN, 0x04),    // ą
+  UK_DEAD(0x0106, UK_ALT_GR, 0x26, UK_SHIFT, 0x06),    // Ć
+  UK_DEAD(0x0107, UK_ALT_GR, 0x26, UK_PLAIN, 0x06),    // ć
+  UK_DEAD(0x0108, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x06), // Ĉ
+  UK_DEAD(0x0109, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x06), // ĉ
+  UK_DEAD(0x010A, UK_ALT_GR, 0x25, UK_SHIFT, 0x06),    // Ċ
+  UK_DEAD(0x010B, UK_ALT_GR, 0x25, UK_PLAIN, 0x06),    // ċ
+  UK_DEAD(0x010C, UK_ALT_GR, 0x1F, UK_SHIFT, 0x06),    // Č
+  UK_DEAD(0x010D, UK_ALT_GR, 0x1F, UK_PLAIN, 0x06),    // č
+  UK_DEAD(0x010E, UK_ALT_GR, 0x1F, UK_SHIFT, 0x07),    // Ď
+  UK_DEAD(0x010F, UK_ALT_GR, 0x1F, UK_PLAIN, 0x07),    // ď
+  UK_KEY(0x0110, UK_ALT_GR, 0x07),                     // Đ
+  UK_KEY(0x0111, UK_ALT_GR, 0x16),                     // đ
+  UK_DEAD(0x0112, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x08), // Ē
+  UK_DEAD(0x0113, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x08), // ē
+  UK_DEAD(0x0114, UK_ALT_GR, 0x21, UK_SHIFT, 0x08),    // Ĕ
+  UK_DEAD(0x0115, UK_ALT_GR, 0x21, UK_PLAIN, 0x08),    // ĕ
+  UK_DEAD(0x0116, UK_ALT_GR, 0x25, UK_SHIFT, 0x08),    // Ė
+  UK_DEAD(0x0117, UK_ALT_GR, 0x25, UK_PLAIN, 0x08),    // ė
+  UK_DEAD(0x0118, UK_ALT_GR, 0x23, UK_SHIFT, 0x08),    // Ę
+  UK_DEAD(0x0119, UK_ALT_GR, 0x23, UK_PLAIN, 0x08),    // ę
+  UK_DEAD(0x011A, UK_ALT_GR, 0x1F, UK_SHIFT, 0x08),    // Ě
+  UK_DEAD(0x011B, UK_ALT_GR, 0x1F, UK_PLAIN, 0x08),    // ě
+  UK_DEAD(0x011C, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x0A), // Ĝ
+  UK_DEAD(0x011D, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x0A), // ĝ
+  UK_DEAD(0x011E, UK_ALT_GR, 0x21, UK_SHIFT, 0x0A),    // Ğ
+  UK_DEAD(0x011F, UK_ALT_GR, 0x21, UK_PLAIN, 0x0A),    // ğ
+  UK_DEAD(0x0120, UK_ALT_GR, 0x25, UK_SHIFT, 0x0A),    // Ġ
+  UK_DEAD(0x0121, UK_ALT_GR, 0x25, UK_PLAIN, 0x0A),    // ġ
+  UK_DEAD(0x0122, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0A),    // Ģ
+  UK_DEAD(0x0123, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0A),    // ģ
+  UK_DEAD(0x0124, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x0B), // Ĥ
+  UK_DEAD(0x0125, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x0B), // ĥ
+  UK_KEY(0x0126, UK_SHIFT_ALT_GR, 0x0B),               // Ħ
+  UK_KEY(0x0127, UK_ALT_GR, 0x0B),                     // ħ
+  UK_DEAD(0x0128, UK_SHIFT_ALT_GR, 0x1E, UK_SHIFT, 0x0C), // Ĩ
+  UK_DEAD(0x0129, UK_SHIFT_ALT_GR, 0x1E, UK_PLAIN, 0x0C), // ĩ
+  UK_DEAD(0x012A, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0C), // Ī
+  UK_DEAD(0x012B, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0C), // ī
+  UK_DEAD(0x012C, UK_ALT_GR, 0x21, UK_SHIFT, 0x0C),    // Ĭ
+  UK_DEAD(0x012D, UK_ALT_GR, 0x21, UK_PLAIN, 0x0C),    // ĭ
+  UK_DEAD(0x012E, UK_ALT_GR, 0x23, UK_SHIFT, 0x0C),    // Į
+  UK_DEAD(0x012F, UK_ALT_GR, 0x23, UK_PLAIN, 0x0C),    // į
+  UK_DEAD(0x0130, UK_ALT_GR, 0x25, UK_SHIFT, 0x0C),    // İ
+  UK_DEAD(0x0131, UK_ALT_GR, 0x25, UK_PLAIN, 0x0C),    // ı
+  UK_DEAD(0x0134, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x0D), // Ĵ
+  UK_DEAD(0x0135, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x0D), // ĵ
+  UK_DEAD(0x0136, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0E),    // Ķ
+  UK_DEAD(0x0137, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0E),    // ķ
+  UK_DEAD(0x0139, UK_ALT_GR, 0x26, UK_SHIFT, 0x0F),    // Ĺ
+  UK_DEAD(0x013A, UK_ALT_GR, 0x26, UK_PLAIN, 0x0F),    // ĺ
+  UK_DEAD(0x013B, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0F),    // Ļ
+  UK_DEAD(0x013C, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0F),    // ļ
+  UK_DEAD(0x013D, UK_ALT_GR, 0x1F, UK_SHIFT, 0x0F),    // Ľ
+  UK_DEAD(0x013E, UK_ALT_GR, 0x1F, UK_PLAIN, 0x0F),    // ľ
+  UK_DEAD(0x013F, UK_ALT_GR, 0x25, UK_SHIFT, 0x0F),    // Ŀ
+  UK_DEAD(0x0140, UK_ALT_GR, 0x25, UK_PLAIN, 0x0F),    // ŀ
+  UK_KEY(0x0141, UK_ALT_GR, 0x0F),                     // Ł
+  UK_KEY(0x0142, UK_ALT_GR, 0x0E),                     // ł
+  UK_DEAD(0x0143, UK_ALT_GR, 0x26, UK_SHIFT, 0x11),    // Ń
+  UK_DEAD(0x0144, UK_ALT_GR, 0x26, UK_PLAIN, 0x11),    // ń
+  UK_DEAD(0x0145, UK_ALT_GR, 0x2E, UK_SHIFT, 0x11),    // Ņ
+  UK_DEAD(0x0146, UK_ALT_GR, 0x2E, UK_PLAIN, 0x11),    // ņ
+  UK_DEAD(0x0147, UK_ALT_GR, 0x1F, UK_SHIFT, 0x11),    // Ň
+  UK_DEAD(0x0148, UK_ALT_GR, 0x1F, UK_PLAIN, 0x11),    // ň
+  UK_KEY(0x014A, UK_SHIFT_ALT_GR, 0x0A),               // Ŋ
+  UK_DEAD(0x014C, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x12), // Ō
+  UK_DEAD(0x014D, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x12), // ō
+  UK_DEAD(0x014E, UK_ALT_GR, 0x21, UK_SHIFT, 0x12),    // Ŏ
+  UK_DEAD(0x014F, UK_ALT_GR, 0x21, UK_PLAIN, 0x12),    // ŏ
+  UK_KEY(0x0150, UK_SHIFT, 0x2F),                      // Ő
+  UK_KEY(0x0151, UK_PLAIN, 0x2F),                      // ő
+  UK_DEAD(0x0154, UK_ALT_GR, 0x26, UK_SHIFT, 0x15),    // Ŕ
+  UK_DEAD(0x0155, UK_ALT_GR, 0x26, UK_PLAIN, 0x15),    // ŕ
+  UK_DEAD(0x0156, UK_ALT_GR, 0x2E, UK_SHIFT, 0x15),    // Ŗ
+  UK_DEAD(0x0157, UK_ALT_GR, 0x2E, UK_PLAIN, 0x15),    // ŗ
+  UK_DEAD(0x0158, UK_ALT_GR, 0x1F, UK_SHIFT, 0x15),    // Ř
+  UK_DEAD(0x0159, UK_ALT_GR, 0x1F, UK_PLAIN, 0x15),    // ř
+  UK_DEAD(0x015A, UK_ALT_GR, 0x26, UK_SHIFT, 0x16),    // Ś
+  UK_DEAD(0x015B, UK_ALT_GR, 0x26, UK_PLAIN, 0x16),    // ś
+  UK_DEAD(0x015C, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x16), // Ŝ
+  UK_DEAD(0x015D, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x16), // ŝ
+  UK_DEAD(0x015E, UK_ALT_GR, 0x2E, UK_SHIFT, 0x16),    // Ş
+  UK_DEAD(0x015F, UK_ALT_GR, 0x2E, UK_PLAIN, 0x16),    // ş
+  UK_DEAD(0x0160, UK_ALT_GR, 0x1F, UK_SHIFT, 0x16),    // Š
+  UK_DEAD(0x0161, UK_ALT_GR, 0x1F, UK_PLAIN, 0x16),    // š
+  UK_DEAD(0x0162, UK_ALT_GR, 0x2E, UK_SHIFT, 0x17),    // Ţ
+  UK_DEAD(0x0163, UK_ALT_GR, 0x2E, UK_PLAIN, 0x17),    // ţ
+  UK_DEAD(0x0164, UK_ALT_GR, 0x1F, UK_SHIFT, 0x17),    // Ť
+  UK_DEAD(0x0165, UK_ALT_GR, 0x1F, UK_PLAIN, 0x17),    // ť
+  UK_KEY(0x0166, UK_SHIFT_ALT_GR, 0x17),               // Ŧ
+  UK_KEY(0x0167, UK_ALT_GR, 0x17),                     // ŧ
+  UK_DEAD(0x0168, UK_SHIFT_ALT_GR, 0x1E, UK_SHIFT, 0x18), // Ũ
+  UK_DEAD(0x0169, UK_SHIFT_ALT_GR, 0x1E, UK_PLAIN, 0x18), // ũ
+  UK_DEAD(0x016A, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x18), // Ū
+  UK_DEAD(0x016B, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x18), // ū
+  UK_DEAD(0x016C, UK_ALT_GR, 0x21, UK_SHIFT, 0x18),    // Ŭ
+  UK_DEAD(0x016D, UK_ALT_GR, 0x21, UK_PLAIN, 0x18),    // ŭ
+  UK_DEAD(0x016E, UK_ALT_GR, 0x22, UK_SHIFT, 0x18),    // Ů
+  UK_DEAD(0x016F, UK_ALT_GR, 0x22, UK_PLAIN, 0x18),    // ů
+  UK_KEY(0x0170, UK_SHIFT, 0x31),                      // Ű
+  UK_KEY(0x0171, UK_PLAIN, 0x31),                      // ű
+  UK_DEAD(0x0172, UK_ALT_GR, 0x23, UK_SHIFT, 0x18),    // Ų
+  UK_DEAD(0x0173, UK_ALT_GR, 0x23, UK_PLAIN, 0x18),    // ų
+  UK_DEAD(0x0174, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x1A), // Ŵ
+  UK_DEAD(0x0175, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x1A), // ŵ
+  UK_DEAD(0x0176, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x1D), // Ŷ
+  UK_DEAD(0x0177, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x1D), // ŷ
+  UK_DEAD(0x0178, UK_ALT_GR, 0x2D, UK_SHIFT, 0x1D),    // Ÿ
+  UK_DEAD(0x0179, UK_ALT_GR, 0x26, UK_SHIFT, 0x1C),    // Ź
+  UK_DEAD(0x017A, UK_ALT_GR, 0x26, UK_PLAIN, 0x1C),    // ź
+  UK_DEAD(0x017B, UK_ALT_GR, 0x25, UK_SHIFT, 0x1C),    // Ż
+  UK_DEAD(0x017C, UK_ALT_GR, 0x25, UK_PLAIN, 0x1C),    // ż
+  UK_DEAD(0x017D, UK_ALT_GR, 0x1F, UK_SHIFT, 0x1C),    // Ž
+  UK_DEAD(0x017E, UK_ALT_GR, 0x1F, UK_PLAIN, 0x1C),    // ž
+  UK_DEAD(0x01CD, UK_ALT_GR, 0x1F, UK_SHIFT, 0x04),    // Ǎ
+  UK_DEAD(0x01CE, UK_ALT_GR, 0x1F, UK_PLAIN, 0x04),    // ǎ
+  UK_DEAD(0x01CF, UK_ALT_GR, 0x1F, UK_SHIFT, 0x0C),    // Ǐ
+  UK_DEAD(0x01D0, UK_ALT_GR, 0x1F, UK_PLAIN, 0x0C),    // ǐ
+  UK_DEAD(0x01D1, UK_ALT_GR, 0x1F, UK_SHIFT, 0x12),    // Ǒ
+  UK_DEAD(0x01D2, UK_ALT_GR, 0x1F, UK_PLAIN, 0x12),    // ǒ
+  UK_DEAD(0x01D3, UK_ALT_GR, 0x1F, UK_SHIFT, 0x18),    // Ǔ
+  UK_DEAD(0x01D4, UK_ALT_GR, 0x1F, UK_PLAIN, 0x18),    // ǔ
+  UK_DEAD(0x01D5, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x2D), // Ǖ
+  UK_DEAD(0x01D6, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x2D), // ǖ
+  UK_DEAD(0x01D7, UK_ALT_GR, 0x26, UK_SHIFT, 0x2D),    // Ǘ
+  UK_DEAD(0x01D8, UK_ALT_GR, 0x26, UK_PLAIN, 0x2D),    // ǘ
+  UK_DEAD(0x01D9, UK_ALT_GR, 0x1F, UK_SHIFT, 0x2D),    // Ǚ
+  UK_DEAD(0x01DA, UK_ALT_GR, 0x1F, UK_PLAIN, 0x2D),    // ǚ
+  UK_DEAD(0x01DB, UK_SHIFT_ALT_GR, 0x24, UK_SHIFT, 0x2D), // Ǜ
+  UK_DEAD(0x01DC, UK_SHIFT_ALT_GR, 0x24, UK_PLAIN, 0x2D), // ǜ
+  UK_DEAD(0x01DE, UK_SHIFT_ALT_GR, 0x30, UK_ALT_GR, 0x08), // Ǟ
+  UK_DEAD(0x01DF, UK_SHIFT_ALT_GR, 0x30, UK_ALT_GR, 0x04), // ǟ
+  UK_DEAD(0x01E6, UK_ALT_GR, 0x1F, UK_SHIFT, 0x0A),    // Ǧ
+  UK_DEAD(0x01E7, UK_ALT_GR, 0x1F, UK_PLAIN, 0x0A),    // ǧ
+  UK_DEAD(0x01E8, UK_ALT_GR, 0x1F, UK_SHIFT, 0x0E),    // Ǩ
+  UK_DEAD(0x01E9, UK_ALT_GR, 0x1F, UK_PLAIN, 0x0E),    // ǩ
+  UK_DEAD(0x01EA, UK_ALT_GR, 0x23, UK_SHIFT, 0x12),    // Ǫ
+  UK_DEAD(0x01EB, UK_ALT_GR, 0x23, UK_PLAIN, 0x12),    // ǫ
+  UK_DEAD(0x01F0, UK_ALT_GR, 0x1F, UK_PLAIN, 0x0D),    // ǰ
+  UK_DEAD(0x01F4, UK_ALT_GR, 0x26, UK_SHIFT, 0x0A),    // Ǵ
+  UK_DEAD(0x01F5, UK_ALT_GR, 0x26, UK_PLAIN, 0x0A),    // ǵ
+  UK_DEAD(0x01F8, UK_SHIFT_ALT_GR, 0x24, UK_SHIFT, 0x11), // Ǹ
+  UK_DEAD(0x01F9, UK_SHIFT_ALT_GR, 0x24, UK_PLAIN, 0x11), // ǹ
+  UK_DEAD(0x01FA, UK_ALT_GR, 0x22, UK_SHIFT, 0x34),    // Ǻ
+  UK_DEAD(0x01FB, UK_ALT_GR, 0x22, UK_PLAIN, 0x34),    // ǻ
+  UK_DEAD(0x01FE, UK_ALT_GR, 0x26, UK_SHIFT_ALT_GR, 0x12), // Ǿ
+  UK_DEAD(0x021E, UK_ALT_GR, 0x1F, UK_SHIFT, 0x0B),    // Ȟ
+  UK_DEAD(0x021F, UK_ALT_GR, 0x1F, UK_PLAIN, 0x0B),    // ȟ
+  UK_DEAD(0x0226, UK_ALT_GR, 0x25, UK_SHIFT, 0x04),    // Ȧ
+  UK_DEAD(0x0227, UK_ALT_GR, 0x25, UK_PLAIN, 0x04),    // ȧ
+  UK_DEAD(0x0228, UK_ALT_GR, 0x2E, UK_SHIFT, 0x08),    // Ȩ
+  UK_DEAD(0x0229, UK_ALT_GR, 0x2E, UK_PLAIN, 0x08),    // ȩ
+  UK_DEAD(0x022A, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x27), // Ȫ
+  UK_DEAD(0x022B, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x27), // ȫ
+  UK_DEAD(0x022E, UK_ALT_GR, 0x25, UK_SHIFT, 0x12),    // Ȯ
+  UK_DEAD(0x022F, UK_ALT_GR, 0x25, UK_PLAIN, 0x12),    // ȯ
+  UK_DEAD(0x0232, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x1D), // Ȳ
+  UK_DEAD(0x0233, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x1D), // ȳ
+  UK_DEAD(0x0237, UK_ALT_GR, 0x25, UK_PLAIN, 0x0D),    // ȷ
+  UK_KEY(0x02C7, UK_SHIFT_ALT_GR, 0x1F),               // ˇ
+  UK_KEY(0x02D8, UK_SHIFT_ALT_GR, 0x21),               // ˘
+  UK_KEY(0x02D9, UK_SHIFT_ALT_GR, 0x25),               // ˙
+  UK_KEY(0x02DB, UK_SHIFT_ALT_GR, 0x23),               // ˛
+  UK_KEY(0x02DD, UK_SHIFT_ALT_GR, 0x27),               // ˝
+  UK_DEAD(0x0344, UK_ALT_GR, 0x2D, UK_SHIFT, 0x1E),    // ̈́
+  UK_DEAD(0x038F, UK_ALT_GR, 0x26, UK_SHIFT_ALT_GR, 0x14), // Ώ
+  UK_KEY(0x03A9, UK_SHIFT_ALT_GR, 0x14),               // Ω
+  UK_DEAD(0x1E02, UK_ALT_GR, 0x25, UK_SHIFT, 0x05),    // Ḃ
+  UK_DEAD(0x1E03, UK_ALT_GR, 0x25, UK_PLAIN, 0x05),    // ḃ
+  UK_DEAD(0x1E0A, UK_ALT_GR, 0x25, UK_SHIFT, 0x07),    // Ḋ
+  UK_DEAD(0x1E0B, UK_ALT_GR, 0x25, UK_PLAIN, 0x07),    // ḋ
+  UK_DEAD(0x1E10, UK_ALT_GR, 0x2E, UK_SHIFT, 0x07),    // Ḑ
+  UK_DEAD(0x1E11, UK_ALT_GR, 0x2E, UK_PLAIN, 0x07),    // ḑ
+  UK_DEAD(0x1E16, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x33), // Ḗ
+  UK_DEAD(0x1E17, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x33), // ḗ
+  UK_DEAD(0x1E1E, UK_ALT_GR, 0x25, UK_SHIFT, 0x09),    // Ḟ
+  UK_DEAD(0x1E1F, UK_ALT_GR, 0x25, UK_PLAIN, 0x09),    // ḟ
+  UK_DEAD(0x1E20, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x0A), // Ḡ
+  UK_DEAD(0x1E21, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x0A), // ḡ
+  UK_DEAD(0x1E22, UK_ALT_GR, 0x25, UK_SHIFT, 0x0B),    // Ḣ
+  UK_DEAD(0x1E23, UK_ALT_GR, 0x25, UK_PLAIN, 0x0B),    // ḣ
+  UK_DEAD(0x1E26, UK_ALT_GR, 0x2D, UK_SHIFT, 0x0B),    // Ḧ
+  UK_DEAD(0x1E27, UK_ALT_GR, 0x2D, UK_PLAIN, 0x0B),    // ḧ
+  UK_DEAD(0x1E28, UK_ALT_GR, 0x2E, UK_SHIFT, 0x0B),    // Ḩ
+  UK_DEAD(0x1E29, UK_ALT_GR, 0x2E, UK_PLAIN, 0x0B),    // ḩ
+  UK_DEAD(0x1E2E, UK_ALT_GR, 0x2D, UK_ALT_GR, 0x0C),   // Ḯ
+  UK_DEAD(0x1E2F, UK_ALT_GR, 0x2D, UK_SHIFT_ALT_GR, 0x0C), // ḯ
+  UK_DEAD(0x1E30, UK_ALT_GR, 0x26, UK_SHIFT, 0x0E),    // Ḱ
+  UK_DEAD(0x1E31, UK_ALT_GR, 0x26, UK_PLAIN, 0x0E),    // ḱ
+  UK_DEAD(0x1E3E, UK_ALT_GR, 0x26, UK_SHIFT, 0x10),    // Ḿ
+  UK_DEAD(0x1E3F, UK_ALT_GR, 0x26, UK_PLAIN, 0x10),    // ḿ
+  UK_DEAD(0x1E40, UK_ALT_GR, 0x25, UK_SHIFT, 0x10),    // Ṁ
+  UK_DEAD(0x1E41, UK_ALT_GR, 0x25, UK_PLAIN, 0x10),    // ṁ
+  UK_DEAD(0x1E44, UK_ALT_GR, 0x25, UK_SHIFT, 0x11),    // Ṅ
+  UK_DEAD(0x1E45, UK_ALT_GR, 0x25, UK_PLAIN, 0x11),    // ṅ
+  UK_DEAD(0x1E4C, UK_SHIFT_ALT_GR, 0x1E, UK_SHIFT, 0x2E), // Ṍ
+  UK_DEAD(0x1E4D, UK_SHIFT_ALT_GR, 0x1E, UK_PLAIN, 0x2E), // ṍ
+  UK_DEAD(0x1E4E, UK_SHIFT_ALT_GR, 0x1E, UK_SHIFT, 0x27), // Ṏ
+  UK_DEAD(0x1E4F, UK_SHIFT_ALT_GR, 0x1E, UK_PLAIN, 0x27), // ṏ
+  UK_DEAD(0x1E52, UK_SHIFT_ALT_GR, 0x30, UK_SHIFT, 0x2E), // Ṓ
+  UK_DEAD(0x1E53, UK_SHIFT_ALT_GR, 0x30, UK_PLAIN, 0x2E), // ṓ
+  UK_DEAD(0x1E54, UK_ALT_GR, 0x26, UK_SHIFT, 0x13),    // Ṕ
+  UK_DEAD(0x1E55, UK_ALT_GR, 0x26, UK_PLAIN, 0x13),    // ṕ
+  UK_DEAD(0x1E56, UK_ALT_GR, 0x25, UK_SHIFT, 0x13),    // Ṗ
+  UK_DEAD(0x1E57, UK_ALT_GR, 0x25, UK_PLAIN, 0x13),    // ṗ
+  UK_DEAD(0x1E58, UK_ALT_GR, 0x25, UK_SHIFT, 0x15),    // Ṙ
+  UK_DEAD(0x1E59, UK_ALT_GR, 0x25, UK_PLAIN, 0x15),    // ṙ
+  UK_DEAD(0x1E60, UK_ALT_GR, 0x25, UK_SHIFT, 0x16),    // Ṡ
+  UK_DEAD(0x1E61, UK_ALT_GR, 0x25, UK_PLAIN, 0x16),    // ṡ
+  UK_DEAD(0x1E6A, UK_ALT_GR, 0x25, UK_SHIFT, 0x17),    // Ṫ
+  UK_DEAD(0x1E6B, UK_ALT_GR, 0x25, UK_PLAIN, 0x17),    // ṫ
+  UK_DEAD(0x1E78, UK_SHIFT_ALT_GR, 0x1E, UK_SHIFT, 0x30), // Ṹ
+  UK_DEAD(0x1E79, UK_SHIFT_ALT_GR, 0x1E, UK_PLAIN, 0x30), // ṹ
+  UK_DEAD(0x1E7C, UK_SHIFT_ALT_GR, 0x1E, UK_SHIFT, 0x19), // Ṽ
+  UK_DEAD(0x1E7D, UK_SHIFT_ALT_GR, 0x1E, UK_PLAIN, 0x19), // ṽ
+  UK_DEAD(0x1E80, UK_SHIFT_ALT_GR, 0x24, UK_SHIFT, 0x1A), // Ẁ
+  UK_DEAD(0x1E81, UK_SHIFT_ALT_GR, 0x24, UK_PLAIN, 0x1A), // ẁ
+  UK_DEAD(0x1E82, UK_ALT_GR, 0x26, UK_SHIFT, 0x1A),    // Ẃ
+  UK_DEAD(0x1E83, UK_ALT_GR, 0x26, UK_PLAIN, 0x1A),    // ẃ
+  UK_DEAD(0x1E84, UK_ALT_GR, 0x2D, UK_SHIFT, 0x1A),    // Ẅ
+  UK_DEAD(0x1E85, UK_ALT_GR, 0x2D, UK_PLAIN, 0x1A),    // ẅ
+  UK_DEAD(0x1E86, UK_ALT_GR, 0x25, UK_SHIFT, 0x1A),    // Ẇ
+  UK_DEAD(0x1E87, UK_ALT_GR, 0x25, UK_PLAIN, 0x1A),    // ẇ
+  UK_DEAD(0x1E8A, UK_ALT_GR, 0x25, UK_SHIFT, 0x1B),    // Ẋ
+  UK_DEAD(0x1E8B, UK_ALT_GR, 0x25, UK_PLAIN, 0x1B),    // ẋ
+  UK_DEAD(0x1E8C, UK_ALT_GR, 0x2D, UK_SHIFT, 0x1B),    // Ẍ
+  UK_DEAD(0x1E8D, UK_ALT_GR, 0x2D, UK_PLAIN, 0x1B),    // ẍ
+  UK_DEAD(0x1E8E, UK_ALT_GR, 0x25, UK_SHIFT, 0x1D),    // Ẏ
+  UK_DEAD(0x1E8F, UK_ALT_GR, 0x25, UK_PLAIN, 0x1D),    // ẏ
+  UK_DEAD(0x1E90, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x1C), // Ẑ
+  UK_DEAD(0x1E91, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x1C), // ẑ
+  UK_DEAD(0x1E97, UK_ALT_GR, 0x2D, UK_PLAIN, 0x17),    // ẗ
+  UK_DEAD(0x1E98, UK_ALT_GR, 0x22, UK_PLAIN, 0x1A),    // ẘ
+  UK_DEAD(0x1E99, UK_ALT_GR, 0x22, UK_PLAIN, 0x1D),    // ẙ
+  UK_KEY(0x1E9E, UK_SHIFT_ALT_GR, 0x16),               // ẞ
+  UK_DEAD(0x1EA4, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x34), // Ấ
+  UK_DEAD(0x1EA5, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x34), // ấ
+  UK_DEAD(0x1EAE, UK_ALT_GR, 0x21, UK_SHIFT, 0x34),    // Ắ
+  UK_DEAD(0x1EAF, UK_ALT_GR, 0x21, UK_PLAIN, 0x34),    // ắ
+  UK_DEAD(0x1EBC, UK_SHIFT_ALT_GR, 0x1E, UK_SHIFT, 0x08), // Ẽ
+  UK_DEAD(0x1EBD, UK_SHIFT_ALT_GR, 0x1E, UK_PLAIN, 0x08), // ẽ
+  UK_DEAD(0x1EBE, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x33), // Ế
+  UK_DEAD(0x1EBF, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x33), // ế
+  UK_DEAD(0x1ED0, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x2E), // Ố
+  UK_DEAD(0x1ED1, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x2E), // ố
+  UK_DEAD(0x1EF2, UK_SHIFT_ALT_GR, 0x24, UK_SHIFT, 0x1D), // Ỳ
+  UK_DEAD(0x1EF3, UK_SHIFT_ALT_GR, 0x24, UK_PLAIN, 0x1D), // ỳ
+  UK_DEAD(0x1EF8, UK_SHIFT_ALT_GR, 0x1E, UK_SHIFT, 0x1D), // Ỹ
+  UK_DEAD(0x1EF9, UK_SHIFT_ALT_GR, 0x1E, UK_PLAIN, 0x1D), // ỹ
+  UK_DEAD(0x1FFA, UK_SHIFT_ALT_GR, 0x24, UK_SHIFT_ALT_GR, 0x14), // Ὼ
+  UK_KEY(0x2013, UK_ALT_GR, 0x1C),                     // –
+  UK_KEY(0x2018, UK_SHIFT_ALT_GR, 0x05),               // ‘
+  UK_KEY(0x2019, UK_SHIFT_ALT_GR, 0x11),               // ’
+  UK_KEY(0x201A, UK_SHIFT_ALT_GR, 0x19),               // ‚
+  UK_KEY(0x201D, UK_ALT_GR, 0x13),                     // ”
+  UK_KEY(0x201E, UK_ALT_GR, 0x12),                     // „
+  UK_DEAD(0x2070, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x35), // ⁰
+  UK_DEAD(0x2074, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x21), // ⁴
+  UK_DEAD(0x2075, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x22), // ⁵
+  UK_DEAD(0x2076, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x23), // ⁶
+  UK_DEAD(0x2077, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x24), // ⁷
+  UK_DEAD(0x2078, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x25), // ⁸
+  UK_DEAD(0x2079, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x26), // ⁹
+  UK_DEAD(0x207A, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x20), // ⁺
+  UK_DEAD(0x207B, UK_SHIFT_ALT_GR, 0x20, UK_PLAIN, 0x38), // ⁻
+  UK_DEAD(0x207C, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x24), // ⁼
+  UK_DEAD(0x207D, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x25), // ⁽
+  UK_DEAD(0x207E, UK_SHIFT_ALT_GR, 0x20, UK_SHIFT, 0x26), // ⁾
+  UK_DEAD(0x2080, UK_ALT_GR, 0x1F, UK_PLAIN, 0x35),    // ₀
+  UK_DEAD(0x2081, UK_ALT_GR, 0x1F, UK_PLAIN, 0x1E),    // ₁
+  UK_DEAD(0x2082, UK_ALT_GR, 0x1F, UK_PLAIN, 0x1F),    // ₂
+  UK_DEAD(0x2083, UK_ALT_GR, 0x1F, UK_PLAIN, 0x20),    // ₃
+  UK_DEAD(0x2084, UK_ALT_GR, 0x1F, UK_PLAIN, 0x21),    // ₄
+  UK_DEAD(0x2085, UK_ALT_GR, 0x1F, UK_PLAIN, 0x22),    // ₅
+  UK_DEAD(0x2086, UK_ALT_GR, 0x1F, UK_PLAIN, 0x23),    // ₆
+  UK_DEAD(0x2087, UK_ALT_GR, 0x1F, UK_PLAIN, 0x24),    // ₇
+  UK_DEAD(0x2088, UK_ALT_GR, 0x1F, UK_PLAIN, 0x25),    // ₈
+  UK_DEAD(0x2089, UK_ALT_GR, 0x1F, UK_PLAIN, 0x26),    // ₉
+  UK_DEAD(0x208A, UK_ALT_GR, 0x1F, UK_SHIFT, 0x20),    // ₊
+  UK_DEAD(0x208B, UK_ALT_GR, 0x1F, UK_PLAIN, 0x38),    // ₋
+  UK_DEAD(0x208C, UK_ALT_GR, 0x1F, UK_SHIFT, 0x24),    // ₌
+  UK_DEAD(0x208D, UK_ALT_GR, 0x1F, UK_SHIFT, 0x25),    // ₍
+  UK_DEAD(0x208E, UK_ALT_GR, 0x1F, UK_SHIFT, 0x26),    // ₎
+  UK_KEY(0x20AC, UK_ALT_GR, 0x18),                     // €
+  UK_DEAD(0x20B5, UK_ALT_GR, 0x2E, UK_SHIFT_ALT_GR, 0x33), // ₵
+  UK_KEY(0x2191, UK_SHIFT_ALT_GR, 0x18),               // ↑
+  UK_DEAD(0x2243, UK_SHIFT_ALT_GR, 0x1E, UK_SHIFT, 0x24), // ≃
+  UK_DEAD(0x2272, UK_SHIFT_ALT_GR, 0x1E, UK_ALT_GR, 0x64), // ≲
+  UK_DEAD(0x2273, UK_SHIFT_ALT_GR, 0x1E, UK_SHIFT_ALT_GR, 0x64), // ≳
+};
+#define UNICODE_KEYS_hu_HU UnicodeKeys_hu_HU, UNICODE_KEY_COUNT(UnicodeKeys_hu_HU)
+
+#endif // UNICODE_LAYOUTS_H
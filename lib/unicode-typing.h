@@ -0,0 +1,258 @@
+/*
+ * UTF-8 Typing for Ghostkey
+ *
+ * Resolves text into typing steps: one step is a key (with its modifiers)
+ * pressed and released. ASCII goes through the layout's ASCII table, the
+ * same one the Keyboard library uses. Other characters use the layout's
+ * Unicode table (AltGr combinations and dead-key pairs, see
+ * lib/unicode-layouts.h); anything still missing can be entered with the
+ * host's Unicode input method:
+ *   UNICODE_INPUT_LINUX   - Ctrl+Shift+U, hex code, Space (GTK / IBus)
+ *   UNICODE_INPUT_WINDOWS - Alt held, numpad +, hex code (needs the
+ *                           EnableHexNumpad registry value)
+ *   UNICODE_INPUT_MAC     - Option held, 4-digit hex code (Unicode Hex
+ *                           Input source selected)
+ *
+ * Steps are plain data, so the compiler resolves STRING text once and the
+ * program replays them without any per-character lookups.
+ *
+ * Also built into tools/gkimage.cpp, through lib/ducky-compiler.h.
+ */
+
+#ifndef UNICODE_TYPING_H
+#define UNICODE_TYPING_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define UNICODE_INPUT_NONE 0
+#define UNICODE_INPUT_LINUX 1
+#define UNICODE_INPUT_WINDOWS 2
+#define UNICODE_INPUT_MAC 3
+
+// Most steps one character can take (macOS surrogate pair + release)
+#define TYPING_MAX_STEPS 10
+
+// Step flags
+#define TYPING_STEP_CHAR_END 0x01 // Last step of a character
+#define TYPING_STEP_SILENT 0x02   // Character the layout cannot type: timing only
+#define TYPING_STEP_RELEASE 0x04  // Let go of the held modifiers
+
+// Modifier bits of the keyboard report
+#define TYPING_MOD_CTRL 0x01
+#define TYPING_MOD_SHIFT 0x02
+#define TYPING_MOD_ALT 0x04
+#define TYPING_MOD_ALT_GR 0x40
+
+#define TYPING_KEYPAD_PLUS 0x57
+#define TYPING_KEYPAD_1 0x59
+#define TYPING_KEYPAD_0 0x62
+
+// Reads a byte of a layout's ASCII table; the firmware maps this to
+// pgm_read_byte() since the Keyboard library keeps the tables in flash
+#ifndef TYPING_READ_BYTE
+#define TYPING_READ_BYTE(address) (*(address))
+#endif
+
+// Report for one step: (held | modifiers) + usage pressed, then released
+// back to held. A TYPING_STEP_RELEASE step only lets go of held.
+typedef struct {
+  uint8_t held;
+  uint8_t modifiers;
+  uint8_t usage;
+  uint8_t flags;
+} TypingStep;
+
+// A character of a layout's Unicode table, optionally after a dead key
+typedef struct {
+  uint16_t codepoint;
+  uint8_t deadModifiers; // Dead key (deadUsage 0 = none)
+  uint8_t deadUsage;
+  uint8_t modifiers;
+  uint8_t usage;
+} UnicodeKeyEntry;
+
+typedef struct {
+  const char *name;
+  const uint8_t *asciiMap;         // Keyboard library layout table (128 entries)
+  const UnicodeKeyEntry *entries;  // Sorted by codepoint
+  uint16_t entryCount;
+} TypingLayout;
+
+static_assert(sizeof(TypingStep) == 4, "TypingStep must stay 4 bytes");
+
+// Decode the character at text[index] and advance index past it.
+// Malformed sequences decode to U+FFFD one byte at a time.
+inline uint32_t utf8Next(const char *text, size_t length, size_t &index) {
+  uint8_t lead = (uint8_t)text[index++];
+  if (lead < 0x80) {
+    return lead;
+  }
+
+  uint8_t extra;
+  uint32_t codepoint;
+  if ((lead & 0xE0) == 0xC0) {
+    extra = 1;
+    codepoint = lead & 0x1F;
+  } else if ((lead & 0xF0) == 0xE0) {
+    extra = 2;
+    codepoint = lead & 0x0F;
+  } else if ((lead & 0xF8) == 0xF0) {
+    extra = 3;
+    codepoint = lead & 0x07;
+  } else {
+    return 0xFFFD;
+  }
+
+  if (index + extra > length) {
+    return 0xFFFD;
+  }
+  for (uint8_t i = 0; i < extra; i++) {
+    uint8_t next = (uint8_t)text[index + i];
+    if ((next & 0xC0) != 0x80) {
+      return 0xFFFD;
+    }
+    codepoint = (codepoint << 6) | (next & 0x3F);
+  }
+  index += extra;
+
+  static const uint32_t minimum[4] = { 0, 0x80, 0x800, 0x10000 };
+  if (codepoint < minimum[extra] || codepoint > 0x10FFFF || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+    return 0xFFFD; // Overlong, out of range or a surrogate
+  }
+  return codepoint;
+}
+
+// Modifiers and usage of an ASCII character on the layout (same decoding
+// as the Keyboard library); false if the layout cannot type it
+inline bool asciiKeyUsage(const uint8_t *asciiMap, uint8_t c, uint8_t &modifiers, uint8_t &usage) {
+  modifiers = 0;
+  usage = (c < 0x80) ? TYPING_READ_BYTE(asciiMap + c) : 0;
+  if (usage == 0) {
+    return false;
+  }
+  if ((usage & 0x40) == 0x40) {
+    modifiers = TYPING_MOD_ALT_GR;
+    usage &= 0x3F;
+  } else if ((usage & 0x80) == 0x80) {
+    modifiers = TYPING_MOD_SHIFT;
+    usage &= 0x7F;
+  }
+  if (usage == 0x32) {
+    usage = 0x64; // ISO key
+  }
+  return true;
+}
+
+inline const UnicodeKeyEntry *findUnicodeKey(const TypingLayout &layout, uint32_t codepoint) {
+  size_t low = 0;
+  size_t high = layout.entryCount;
+  while (low < high) {
+    size_t middle = (low + high) / 2;
+    if (layout.entries[middle].codepoint < codepoint) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return (low < layout.entryCount && layout.entries[low].codepoint == codepoint) ? &layout.entries[low] : NULL;
+}
+
+inline void typingStep(TypingStep &step, uint8_t held, uint8_t modifiers, uint8_t usage) {
+  step.held = held;
+  step.modifiers = modifiers;
+  step.usage = usage;
+  step.flags = 0;
+}
+
+// Append the steps that type hex digits (lowercase) of value; false if the
+// layout cannot type one of them
+inline bool typingHexSteps(const TypingLayout &layout, uint32_t value, uint8_t digits, uint8_t held,
+                           bool keypadDigits, TypingStep *steps, size_t &count) {
+  for (int shift = (digits - 1) * 4; shift >= 0; shift -= 4) {
+    uint8_t nibble = (value >> shift) & 0x0F;
+    uint8_t modifiers, usage;
+    if (keypadDigits && nibble < 10) {
+      modifiers = 0;
+      usage = (nibble == 0) ? TYPING_KEYPAD_0 : TYPING_KEYPAD_1 + nibble - 1;
+    } else if (!asciiKeyUsage(layout.asciiMap, "0123456789abcdef"[nibble], modifiers, usage)) {
+      return false;
+    }
+    typingStep(steps[count++], held, modifiers, usage);
+  }
+  return true;
+}
+
+// Number of hex digits needed for a code point (at least 4)
+inline uint8_t typingHexDigits(uint32_t value) {
+  uint8_t digits = 4;
+  while (digits < 6 && (value >> (digits * 4)) != 0) {
+    digits++;
+  }
+  return digits;
+}
+
+// Resolve one character into steps (at most TYPING_MAX_STEPS). Returns the
+// number of steps, or 0 if neither the layout nor the Unicode input method
+// can type it. The last step is flagged TYPING_STEP_CHAR_END.
+inline size_t resolveTypingChar(const TypingLayout &layout, uint8_t unicodeInput, uint32_t codepoint,
+                                TypingStep *steps) {
+  size_t count = 0;
+  uint8_t modifiers, usage;
+
+  if (codepoint < 0x80) {
+    if (!asciiKeyUsage(layout.asciiMap, (uint8_t)codepoint, modifiers, usage)) {
+      return 0;
+    }
+    typingStep(steps[count++], 0, modifiers, usage);
+  } else if (const UnicodeKeyEntry *entry = findUnicodeKey(layout, codepoint)) {
+    if (entry->deadUsage != 0) {
+      typingStep(steps[count++], 0, entry->deadModifiers, entry->deadUsage);
+    }
+    typingStep(steps[count++], 0, entry->modifiers, entry->usage);
+  } else if (unicodeInput == UNICODE_INPUT_LINUX) {
+    if (!asciiKeyUsage(layout.asciiMap, 'u', modifiers, usage)) {
+      return 0;
+    }
+    typingStep(steps[count++], 0, modifiers | TYPING_MOD_CTRL | TYPING_MOD_SHIFT, usage);
+    if (!typingHexSteps(layout, codepoint, typingHexDigits(codepoint), 0, false, steps, count) ||
+        !asciiKeyUsage(layout.asciiMap, ' ', modifiers, usage)) {
+      return 0;
+    }
+    typingStep(steps[count++], 0, modifiers, usage);
+  } else if (unicodeInput == UNICODE_INPUT_WINDOWS) {
+    typingStep(steps[count++], TYPING_MOD_ALT, 0, TYPING_KEYPAD_PLUS);
+    if (!typingHexSteps(layout, codepoint, typingHexDigits(codepoint), TYPING_MOD_ALT, true, steps, count)) {
+      return 0;
+    }
+    typingStep(steps[count], TYPING_MOD_ALT, 0, 0);
+    steps[count++].flags = TYPING_STEP_RELEASE;
+  } else if (unicodeInput == UNICODE_INPUT_MAC) {
+    // Unicode Hex Input takes UTF-16 code units of 4 digits each
+    if (codepoint > 0xFFFF) {
+      uint32_t offset = codepoint - 0x10000;
+      if (!typingHexSteps(layout, 0xD800 + (offset >> 10), 4, TYPING_MOD_ALT, false, steps, count) ||
+          !typingHexSteps(layout, 0xDC00 + (offset & 0x3FF), 4, TYPING_MOD_ALT, false, steps, count)) {
+        return 0;
+      }
+    } else if (!typingHexSteps(layout, codepoint, 4, TYPING_MOD_ALT, false, steps, count)) {
+      return 0;
+    }
+    typingStep(steps[count], TYPING_MOD_ALT, 0, 0);
+    steps[count++].flags = TYPING_STEP_RELEASE;
+  } else {
+    return 0;
+  }
+
+  steps[count - 1].flags |= TYPING_STEP_CHAR_END;
+  return count;
+}
+
+// Step for a character that cannot be typed: nothing is sent, but the
+// character still takes its time, as it always has for unmapped ASCII
+inline void typingSilentStep(TypingStep &step) {
+  typingStep(step, 0, 0, 0);
+  step.flags = TYPING_STEP_SILENT | TYPING_STEP_CHAR_END;
+}
+
+#endif // UNICODE_TYPING_H
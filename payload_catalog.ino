@@ -0,0 +1,373 @@
+/*
+ * Payload Catalog - Indexed Payload Selection
+ * 
+ * Keeps several payloads on one card selectable by number. The catalog
+ * (/catalog.idx, format in lib/payload-catalog.h) is built once by scanning
+ * the root directory on the first boot without one, or written by a host
+ * tool. After that, selecting a payload costs one seek and one 64-byte read.
+ * 
+ * A payload can be picked by:
+ *   - PAYLOAD_INDEX in config.txt
+ *   - the SELECT n / RUN n serial commands while idle
+ *   - pressing the idle button n times (n >= 2; one press re-runs the
+ *     current selection)
+ * 
+ * Add or remove payloads on the card, then send REINDEX (or delete
+ * catalog.idx) so the catalog picks them up.
+ */
+
+// FILE_WRITE appends, but the header is rewritten in place once the entries
+// are known, so the catalog is opened without O_APPEND
+#define CATALOG_WRITE_MODE (O_READ | O_WRITE | O_CREAT)
+
+// Files in the root directory that are never payloads (line profiles
+// written by profiler.ino end in .prof.txt)
+bool isCatalogExcluded(const String &name) {
+  String lower = name;
+  lower.toLowerCase();
+  return lower == "config.txt" ||
+         lower == "catalog.idx" ||
+         lower.endsWith(".prof.txt");
+}
+
+// Priority of a diagnostic test file (lower wins), or -1 if not a test file
+int catalogTestPriority(const String &name) {
+  if (name.equalsIgnoreCase("test-layout.txt")) return 0;
+  if (name.equalsIgnoreCase("key-combo-test.txt")) return 1;
+  if (name.equalsIgnoreCase("shift-key-test.txt")) return 2;
+  return -1;
+}
+
+// CRC-32 over length bytes of an open file, starting at its current position
+uint32_t crc32File(File &file, unsigned long length) {
+  uint8_t buffer[512];
+  uint32_t crc = 0;
+  while (length > 0) {
+    int chunk = file.read(buffer, length < sizeof(buffer) ? length : sizeof(buffer));
+    if (chunk <= 0) {
+      break;
+    }
+    crc = crc32Update(crc, buffer, chunk);
+    length -= chunk;
+  }
+  return crc;
+}
+
+// The same over an extent-mapped file
+uint32_t crc32File(SdExtentFile &file, unsigned long length) {
+  uint8_t buffer[64];
+  uint32_t crc = 0;
+  while (length > 0) {
+    int chunk = file.read(buffer, length < sizeof(buffer) ? length : sizeof(buffer));
+    if (chunk <= 0) {
+      break;
+    }
+    crc = crc32Update(crc, buffer, chunk);
+    length -= chunk;
+  }
+  return crc;
+}
+
+// Scan the root directory once and write a fresh catalog
+bool buildPayloadCatalog() {
+  unsigned long buildStartTime = millis();
+  Serial.println(F("Building payload catalog..."));
+  
+  File root = SD.open("/");
+  if (!root) {
+    Serial.println(F("Catalog: cannot open root directory"));
+    return false;
+  }
+  
+  SD.remove(CATALOG_FILE);
+  File catalogFile = SD.open(CATALOG_FILE, CATALOG_WRITE_MODE);
+  if (!catalogFile) {
+    Serial.println(F("Catalog: cannot create catalog file"));
+    root.close();
+    return false;
+  }
+  
+  CatalogHeader header;
+  catalogInitHeader(header);
+  catalogFile.write((const uint8_t *)&header, sizeof(header)); // Placeholder
+  
+  int bestTestPriority = 99;
+  while (header.entryCount < CATALOG_MAX_ENTRIES) {
+    File entryFile = root.openNextFile();
+    if (!entryFile) {
+      break;
+    }
+    
+    String name = entryFile.name();
+    if (entryFile.isDirectory() || isCatalogExcluded(name) ||
+        !(name.endsWith(".txt") || name.endsWith(".TXT")) ||
+        name.length() + 1 >= CATALOG_NAME_LENGTH) {
+      entryFile.close();
+      continue;
+    }
+    
+    entryFile.close();
+    
+    CatalogEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    String path = "/" + name;
+    path.toCharArray(entry.name, CATALOG_NAME_LENGTH);
+    SdExtentFile payload;
+    if (!payload.open(path)) {
+      continue;
+    }
+    entry.offset = 0;
+    entry.size = payload.size();
+    entry.crc = crc32File(payload, entry.size);
+    entry.firstCluster = payload.firstCluster();
+    entry.writeDate = payload.writeDate();
+    entry.writeTime = payload.writeTime();
+    payload.close();
+    
+    int testPriority = catalogTestPriority(name);
+    if (testPriority >= 0) {
+      entry.flags |= CATALOG_FLAG_TEST;
+      if (testPriority < bestTestPriority) {
+        bestTestPriority = testPriority;
+        header.testEntry = header.entryCount;
+      }
+    }
+    
+    catalogFile.write((const uint8_t *)&entry, sizeof(entry));
+    header.entryCount++;
+    
+    if (config.debugOutput) {
+      Serial.print(F("  "));
+      Serial.print(header.entryCount);
+      Serial.print(F(": "));
+      Serial.print(entry.name);
+      Serial.print(F(" ("));
+      Serial.print(entry.size);
+      Serial.println(F(" bytes)"));
+    }
+  }
+  root.close();
+  
+  // Now that the counts are known, fill in the real header
+  catalogFile.seek(0);
+  catalogFile.write((const uint8_t *)&header, sizeof(header));
+  catalogFile.close();
+  
+  Serial.print(F("Catalog built with "));
+  Serial.print(header.entryCount);
+  Serial.print(F(" payload(s) in "));
+  Serial.print(millis() - buildStartTime);
+  Serial.println(F("ms"));
+  return true;
+}
+
+// Read the catalog header, building the catalog first if the card has none
+bool loadPayloadCatalog(CatalogHeader &header) {
+  if (!SD.exists(CATALOG_FILE) && !buildPayloadCatalog()) {
+    return false;
+  }
+  
+  File catalogFile = SD.open(CATALOG_FILE);
+  if (!catalogFile) {
+    return false;
+  }
+  int bytesRead = catalogFile.read((uint8_t *)&header, sizeof(header));
+  catalogFile.close();
+  
+  if (bytesRead != sizeof(header) || !catalogHeaderValid(header)) {
+    Serial.println(F("Catalog is invalid - ignoring it (send REINDEX to rebuild)"));
+    return false;
+  }
+  return true;
+}
+
+// Read entry number index (0-based) with a single seek
+bool readCatalogEntry(uint16_t index, CatalogEntry &entry) {
+  File catalogFile = SD.open(CATALOG_FILE);
+  if (!catalogFile) {
+    return false;
+  }
+  bool ok = catalogFile.seek(catalogEntryOffset(index)) &&
+            catalogFile.read((uint8_t *)&entry, sizeof(entry)) == sizeof(entry);
+  catalogFile.close();
+  entry.name[CATALOG_NAME_LENGTH - 1] = '\0';
+  return ok;
+}
+
+// Write the directory entry fields of entry number index back to the catalog
+void stampCatalogEntry(uint16_t index, const CatalogEntry &entry) {
+  File catalogFile = SD.open(CATALOG_FILE, CATALOG_WRITE_MODE);
+  if (!catalogFile) {
+    return;
+  }
+  catalogFile.seek(catalogEntryOffset(index) + offsetof(CatalogEntry, firstCluster));
+  catalogFile.write((const uint8_t *)&entry.firstCluster,
+                    offsetof(CatalogEntry, offset) - offsetof(CatalogEntry, firstCluster));
+  catalogFile.close();
+}
+
+// Resolve a catalog entry to a script file and range; false if it is stale.
+// While the file's directory entry (first cluster, last write) matches the
+// one recorded, nothing else is read: saving an edit on a PC changes the
+// write time, replacing the file its first cluster. Otherwise the range is
+// CRC-checked once, so an edit that keeps the size is caught, and the new
+// directory entry recorded. The health check reads the range again on the
+// first run after boot.
+bool useCatalogEntry(uint16_t index, String &scriptFile) {
+  CatalogEntry entry;
+  if (!readCatalogEntry(index, entry)) {
+    return false;
+  }
+  
+  SdExtentFile payload;
+  if (!payload.open(entry.name)) {
+    Serial.print(F("Catalog entry missing on card: "));
+    Serial.println(entry.name);
+    return false;
+  }
+  unsigned long fileSize = payload.size();
+  bool current = entry.offset + entry.size <= fileSize && (entry.offset != 0 || entry.size == fileSize);
+  bool sameEntry = entry.firstCluster != 0 && entry.firstCluster == payload.firstCluster() &&
+                   entry.writeDate == payload.writeDate() && entry.writeTime == payload.writeTime();
+  bool stamp = false;
+  if (current && !sameEntry) {
+    current = payload.seek(entry.offset) && crc32File(payload, entry.size) == entry.crc;
+    stamp = current && payload.firstCluster() != 0;
+    entry.firstCluster = payload.firstCluster();
+    entry.writeDate = payload.writeDate();
+    entry.writeTime = payload.writeTime();
+  }
+  payload.close();
+  if (stamp) {
+    stampCatalogEntry(index, entry);
+  }
+  
+  if (!current) {
+    Serial.print(F("Catalog entry out of date: "));
+    Serial.println(entry.name);
+    return false;
+  }
+  
+  scriptFile = entry.name;
+  scriptRangeOffset = entry.offset;
+  scriptRangeLength = entry.size;
+  scriptRangeCrc = entry.crc;
+  scriptCatalogIndex = index;
+  
+  Serial.print(F("Catalog entry "));
+  Serial.print(index + 1);
+  Serial.print(F(": "));
+  Serial.println(scriptFile);
+  return true;
+}
+
+// Flag the selected entry once a compiled program is cached for it
+void markCatalogEntryCompiled() {
+  CatalogEntry entry;
+  if (scriptCatalogIndex == CATALOG_NO_ENTRY || !readCatalogEntry(scriptCatalogIndex, entry) ||
+      (entry.flags & CATALOG_FLAG_COMPILED)) {
+    return;
+  }
+  File catalogFile = SD.open(CATALOG_FILE, CATALOG_WRITE_MODE);
+  if (!catalogFile) {
+    return;
+  }
+  entry.flags |= CATALOG_FLAG_COMPILED;
+  catalogFile.seek(catalogEntryOffset(scriptCatalogIndex) + offsetof(CatalogEntry, flags));
+  catalogFile.write(entry.flags);
+  catalogFile.close();
+}
+
+// Entry to run from this header (0-based); false to use the config file paths
+bool selectCatalogIndex(const CatalogHeader &header, uint16_t &index) {
+  int requested = (selectedCatalogEntry > 0) ? selectedCatalogEntry : config.payloadIndex;
+  
+  // Test files take priority over the configured payload, as without a
+  // catalog; an entry picked over serial or with the button overrides them
+  if (header.testEntry != CATALOG_NO_ENTRY && selectedCatalogEntry <= 0) {
+    Serial.println(F("Test file found in catalog - running this instead to diagnose keyboard issues"));
+    index = header.testEntry;
+    return true;
+  }
+  if (requested <= 0) {
+    return false;
+  }
+  if (requested > header.entryCount) {
+    Serial.print(F("Payload index "));
+    Serial.print(requested);
+    Serial.print(F(" out of range (catalog has "));
+    Serial.print(header.entryCount);
+    Serial.println(F(")"));
+    return false;
+  }
+  index = requested - 1;
+  return true;
+}
+
+// Pick the script from the catalog; returns false to use the config file paths
+bool selectFromCatalog(String &scriptFile, bool &catalogPresent) {
+  catalogPresent = false;
+  CatalogHeader header;
+  if (!loadPayloadCatalog(header)) {
+    return false;
+  }
+  catalogPresent = true;
+  
+  uint16_t index;
+  if (!selectCatalogIndex(header, index)) {
+    return false;
+  }
+  if (useCatalogEntry(index, scriptFile)) {
+    return true;
+  }
+  
+  // Card contents changed since the catalog was built - rebuild and retry
+  // once; the rebuilt catalog may have moved the test file or the entries
+  if (buildPayloadCatalog() && loadPayloadCatalog(header) && selectCatalogIndex(header, index)) {
+    return useCatalogEntry(index, scriptFile);
+  }
+  return false;
+}
+
+// Print the catalog over serial
+void listPayloadCatalog() {
+  CatalogHeader header;
+  if (!loadPayloadCatalog(header)) {
+    Serial.println(F("No payload catalog available"));
+    return;
+  }
+  
+  File catalogFile = SD.open(CATALOG_FILE);
+  if (!catalogFile) {
+    return;
+  }
+  catalogFile.seek(catalogEntryOffset(0));
+  
+  Serial.println(F("------ Payload Catalog ------"));
+  for (uint16_t i = 0; i < header.entryCount; i++) {
+    CatalogEntry entry;
+    if (catalogFile.read((uint8_t *)&entry, sizeof(entry)) != sizeof(entry)) {
+      break;
+    }
+    entry.name[CATALOG_NAME_LENGTH - 1] = '\0';
+    Serial.print(i + 1);
+    Serial.print(F(": "));
+    Serial.print(entry.name);
+    Serial.print(F("  "));
+    Serial.print(entry.size);
+    Serial.print(F(" bytes  CRC "));
+    Serial.print(entry.crc, HEX);
+    if (entry.flags & CATALOG_FLAG_COMPILED) {
+      Serial.print(F("  [compiled]"));
+    }
+    if (entry.flags & CATALOG_FLAG_TEST) {
+      Serial.print(F("  [test]"));
+    }
+    if ((int)i + 1 == ((selectedCatalogEntry > 0) ? selectedCatalogEntry : config.payloadIndex)) {
+      Serial.print(F("  <- selected"));
+    }
+    Serial.println();
+  }
+  Serial.println(F("-----------------------------"));
+  catalogFile.close();
+}
@@ -0,0 +1,222 @@
+/*
+ * Line Profiler - Where a Run Spends Its Time
+ *
+ * With PROFILE = true in config.txt, every script line is timed while the
+ * run executes and an annotated copy of the payload is written next to it
+ * when the run ends (/payload.txt -> /payload.prof.txt), in the format of
+ * lib/script-profile.h. A line's time runs from its start to the start of
+ * the next line; the lines of an INCLUDEd snippet count towards the
+ * INCLUDE line.
+ *
+ * The split of each line's time comes from two counters that cost nothing
+ * when profiling is off:
+ *   - HID: time inside HidKeyboard.sendRawReport() (lib/hid-output.h)
+ *   - wait: the wait loops (delay(), engineDelay(), keystroke pacing) call
+ *     yield() continuously; gaps between consecutive yield() calls shorter
+ *     than PROFILE_WAIT_GAP_US are counted as waiting. Time paused counts
+ *     as waiting too.
+ * The rest is reading, parsing and serial logging.
+ *
+ * The annotated file is written after the run so it does not disturb the
+ * timings. A payload that repeats forever never ends and is not profiled.
+ */
+
+#define PROFILE_MAX_LINES 256         // Lines profiled one by one (16 bytes each)
+#define PROFILE_WAIT_GAP_US 2000      // Longer gaps between yield() calls are work, not waiting
+
+ProfileLine *profileLines = NULL;     // PROFILE_MAX_LINES entries while profiling
+ProfileLine profileBetween;           // Time outside the lines: LED flashes, repeat waits
+ProfileLine profileOverflow;          // Lines after PROFILE_MAX_LINES
+bool profileActive = false;
+bool profileCompiled = false;
+int profileLine = 0;                  // Line being timed (0 = between lines)
+int profileFirstRepeat = 0;
+unsigned long profileRunStart = 0;
+unsigned long profileLineStart = 0;
+uint32_t profileLineHid = 0;          // HidKeyboard.sendMicros() when the line started
+uint32_t profileWaitMicros = 0;       // Waiting seen by profileYield() during the run
+uint32_t profileLineWait = 0;         // profileWaitMicros when the line started
+unsigned long profileLastYield = 0;
+
+// Counters of a line number (0 = between lines)
+ProfileLine *profileEntry(int lineNumber) {
+  if (lineNumber <= 0) {
+    return &profileBetween;
+  }
+  if (lineNumber > PROFILE_MAX_LINES) {
+    return &profileOverflow;
+  }
+  return &profileLines[lineNumber - 1];
+}
+
+// Called by runScriptFile() right before the first iteration
+void beginProfile(bool compiled) {
+  if (!config.profile) {
+    return;
+  }
+  profileLines = (ProfileLine *)malloc(PROFILE_MAX_LINES * sizeof(ProfileLine));
+  if (profileLines == NULL) {
+    Serial.println(F("Profile: not enough memory, run not profiled"));
+    return;
+  }
+  memset(profileLines, 0, PROFILE_MAX_LINES * sizeof(ProfileLine));
+  memset(&profileBetween, 0, sizeof(profileBetween));
+  memset(&profileOverflow, 0, sizeof(profileOverflow));
+  profileCompiled = compiled;
+  profileFirstRepeat = currentRepeat;
+  profileWaitMicros = 0;
+  profileLine = 0;
+  profileBetween.count = 1;
+  profileRunStart = micros();
+  profileLineStart = profileRunStart;
+  profileLastYield = profileRunStart;
+  profileLineHid = HidKeyboard.sendMicros();
+  profileLineWait = 0;
+  profileActive = true;
+}
+
+// Charge the time since the current line started to it
+void profileCloseLine(unsigned long now) {
+  uint32_t hid = HidKeyboard.sendMicros();
+  profileAccount(*profileEntry(profileLine), now - profileLineStart, hid - profileLineHid,
+                 profileWaitMicros - profileLineWait);
+  profileLineStart = now;
+  profileLineHid = hid;
+  profileLineWait = profileWaitMicros;
+}
+
+// Called by the executors as each script line starts, and with 0 once the
+// executor returns. Ops of the same line (or of an INCLUDEd snippet) keep
+// the line open instead of counting as another call.
+void profileLineStarted(int lineNumber) {
+  if (!profileActive || lineNumber == profileLine) {
+    return;
+  }
+  profileCloseLine(micros());
+  profileLine = lineNumber;
+  profileEntry(lineNumber)->count++;
+}
+
+// Called from yield(): back-to-back calls mean a wait loop is spinning
+void profileYield() {
+  if (!profileActive) {
+    return;
+  }
+  unsigned long now = micros();
+  if (now - profileLastYield < PROFILE_WAIT_GAP_US) {
+    profileWaitMicros += now - profileLastYield;
+  }
+  profileLastYield = now;
+}
+
+// Annotated copy path: /payload.txt -> /payload.prof.txt
+String profilePath(const String &scriptFile) {
+  int dot = scriptFile.lastIndexOf('.');
+  int slash = scriptFile.lastIndexOf('/');
+  String base = (dot > slash) ? scriptFile.substring(0, dot) : scriptFile;
+  return base + ".prof.txt";
+}
+
+// Write the columns of a bucket that has no source line, as a comment
+void profilePrintBucket(File &out, const ProfileLine &bucket, uint32_t total) {
+  char columns[96];
+  profileFormatLine(columns, sizeof(columns), bucket, 0, total);
+  columns[61] = '\0'; // Without the line number and source
+  out.print(F(";"));
+  out.println(columns + 1);
+}
+
+// Called by runScriptFile() when the run ends: write the annotated payload
+void endProfile(const String &scriptFile) {
+  if (!profileActive) {
+    return;
+  }
+  profileCloseLine(micros());
+  profileActive = false;
+  uint32_t total = profileBetween.wallMicros + profileOverflow.wallMicros;
+  uint32_t hid = profileBetween.hidMicros + profileOverflow.hidMicros;
+  uint32_t wait = profileBetween.waitMicros + profileOverflow.waitMicros;
+  for (int i = 0; i < PROFILE_MAX_LINES; i++) {
+    total = profileSaturatingAdd(total, profileLines[i].wallMicros);
+    hid = profileSaturatingAdd(hid, profileLines[i].hidMicros);
+    wait = profileSaturatingAdd(wait, profileLines[i].waitMicros);
+  }
+
+  unsigned long writeStart = millis();
+  String path = profilePath(scriptFile);
+  SdExtentFile source;
+  source.open(scriptFile);
+  SD.remove(path.c_str());
+  File out = SD.open(path.c_str(), FILE_WRITE);
+  if (!source || !out) {
+    Serial.print(F("Profile: cannot write "));
+    Serial.println(path);
+    if (source) source.close();
+    if (out) out.close();
+    free(profileLines);
+    profileLines = NULL;
+    return;
+  }
+
+  out.print(F("; Ghostkey line profile of "));
+  out.print(scriptFile);
+  out.print(profileCompiled ? F(" (compiled program), ") : F(" (interpreted), "));
+  out.print(currentRepeat - profileFirstRepeat);
+  out.println(F(" iteration(s)"));
+  out.print(F("; Total "));
+  out.print(total / 1000);
+  out.print(F(" ms: HID "));
+  out.print(hid / 1000);
+  out.print(F(" ms, waiting "));
+  out.print(wait / 1000);
+  out.print(F(" ms, parsing/logging "));
+  out.print((total - hid - wait) / 1000);
+  out.println(F(" ms"));
+  out.println(F("; calls = times the line ran; ms columns are cumulative wall time and its split"));
+  out.println(F("; into HID report sends, waiting (DELAY, pacing, flashes) and everything else"));
+  out.println(F(";"));
+  out.println(F(PROFILE_COLUMNS));
+
+  source.seek(scriptRangeOffset);
+  unsigned long end = (scriptRangeLength == 0) ? source.size() : scriptRangeOffset + scriptRangeLength;
+  char columns[96];
+  int lineNumber = 0;
+  while (source.available() && source.position() < end) {
+    String line = source.readStringUntil('\n');
+    if (line.endsWith("\r")) {
+      line.remove(line.length() - 1);
+    }
+    lineNumber++;
+    if (lineNumber <= PROFILE_MAX_LINES) {
+      profileFormatLine(columns, sizeof(columns), profileLines[lineNumber - 1], lineNumber, total);
+    } else {
+      ProfileLine unlisted;
+      memset(&unlisted, 0, sizeof(unlisted));
+      profileFormatLine(columns, sizeof(columns), unlisted, lineNumber, total);
+    }
+    out.print(columns);
+    out.println(line);
+  }
+  source.close();
+
+  out.println(F(";"));
+  out.println(F("; Between lines (file open and completion flashes, repeat waits):"));
+  profilePrintBucket(out, profileBetween, total);
+  if (profileOverflow.count > 0) {
+    out.print(F("; Lines after "));
+    out.print(PROFILE_MAX_LINES);
+    out.println(F(" (not listed one by one):"));
+    profilePrintBucket(out, profileOverflow, total);
+  }
+  out.close();
+  free(profileLines);
+  profileLines = NULL;
+
+  Serial.print(F("Profile written to "));
+  Serial.print(path);
+  Serial.print(F(" ("));
+  Serial.print(lineNumber);
+  Serial.print(F(" lines, took "));
+  Serial.print(millis() - writeStart);
+  Serial.println(F("ms)"));
+}
@@ -0,0 +1,1197 @@
+/*
+ * Program Cache - Compiled Payloads With Incremental Rebuilds
+ *
+ * With COMPILE_CACHE enabled (the default), the selected payload is compiled
+ * into an op stream (format in lib/ducky-compiler.h) before it runs, and the
+ * executor runs the ops instead of parsing script lines. The program is kept
+ * on the card next to the payload, e.g. for /payload.txt:
+ *   /payload.gb0 or /payload.gb1 - the code
+ *   /payload.gm0 or /payload.gm1 - the block map (hash and code range of
+ *                                  every source block)
+ * Two slots are used because the SD library cannot rename: a build writes
+ * the other slot, copying unchanged blocks out of the current one, and the
+ * block map header is written last, so an interrupted build leaves the
+ * previous program in place.
+ *
+ * Every boot hashes the source blocks and compares them with the block map.
+ * If they all match, the cached program runs as is. Otherwise only blocks
+ * whose hash is new are compiled; the rest are copied and relinked, so the
+ * first boot after a small edit costs little more than a cached boot.
+ *
+ * Snippets pulled in with INCLUDE are linked into the same code file: each
+ * one is compiled once per build into a function, and every INCLUDE of it
+ * calls that function. Their sizes and CRCs are kept in the function table,
+ * so editing a snippet also triggers a rebuild. While the program runs the
+ * table is held in RAM, and the code is read through its extent map
+ * (lib/extent-file.h): calls, returns and resuming jump around the code
+ * file, and each jump costs a table lookup and one sector read instead of
+ * a walk along the FAT cluster chain.
+ *
+ * STRING text with non-ASCII characters is resolved into typing steps for
+ * KEYBOARD_LAYOUT / UNICODE_INPUT at build time (OP_TYPE). Changing either
+ * setting invalidates the cached program.
+ */
+
+// Old block hashes held in RAM during a build to find moved blocks
+#define PROGRAM_HASH_TABLE_MAX 256
+
+#define PROGRAM_COPY_CHUNK 256
+
+String programCodeFile = ""; // Code of the program prepared for this run ("" = interpret the source)
+int programSlot = 0;
+uint32_t programGeneration = 0;
+
+// Outcome of the last prepareProgram(), for the run history
+uint8_t programPrepareResult = RUN_CACHE_OFF;
+unsigned long programPrepareMs = 0;
+uint16_t programBuildCompiled = 0;
+uint16_t programBuildReused = 0;
+
+// Snippets INCLUDEd by the program being built, in link order
+String buildFunctionPaths[PROGRAM_MAX_FUNCTIONS];
+int buildFunctionCount = 0;
+
+// Cache file next to the script: kind 'b' = code, 'm' = block map
+String programFileName(const String &scriptFile, char kind, int slot) {
+  int dot = scriptFile.lastIndexOf('.');
+  int slash = scriptFile.lastIndexOf('/');
+  String base = (dot > slash) ? scriptFile.substring(0, dot) : scriptFile;
+  return base + ".g" + kind + slot;
+}
+
+// String from a text operand of the compiler
+String programString(const char *text, size_t length) {
+  String result = "";
+  result.reserve(length);
+  for (size_t i = 0; i < length; i++) {
+    result += text[i];
+  }
+  return result;
+}
+
+// Resolve "+" combinations while compiling (see lib/chord-compiler.h)
+bool resolveProgramChord(const char *text, size_t length, uint8_t report[8]) {
+  String chordText = programString(text, length);
+  KeyReport chord;
+  String badKey;
+  if (!compileChord(chordText, chord, badKey)) {
+    return false; // Left to the interpreter, which reports the bad key
+  }
+  memcpy(report, &chord, sizeof(chord));
+  return true;
+}
+
+// Read a block map header; false if missing, invalid, for a range that
+// starts elsewhere (a changed length is what the block hashes are for) or
+// resolved for another keyboard layout
+bool readProgramMap(const String &mapName, unsigned long rangeOffset, ProgramMapHeader &header) {
+  File mapFile = SD.open(mapName);
+  if (!mapFile) {
+    return false;
+  }
+  int bytesRead = mapFile.read((uint8_t *)&header, sizeof(header));
+  mapFile.close();
+  return bytesRead == sizeof(header) && programMapHeaderValid(header) &&
+         header.rangeOffset == rangeOffset && header.typingId == typingConfigId();
+}
+
+// True if the code file exists and belongs to the block map generation
+bool programCodeValid(const String &codeName, uint32_t generation) {
+  File codeFile = SD.open(codeName);
+  if (!codeFile) {
+    return false;
+  }
+  ProgramCodeHeader header;
+  bool ok = codeFile.read((uint8_t *)&header, sizeof(header)) == sizeof(header) &&
+            programCodeHeaderValid(header, generation);
+  codeFile.close();
+  return ok;
+}
+
+// Hash the source blocks and compare them with the block map in order;
+// true if every block is unchanged
+bool programBlocksUnchanged(File &source, unsigned long rangeOffset, unsigned long rangeLength,
+                            const String &mapName, const ProgramMapHeader &mapHeader) {
+  File mapFile = SD.open(mapName);
+  if (!mapFile) {
+    return false;
+  }
+  mapFile.seek(sizeof(ProgramMapHeader));
+  source.seek(rangeOffset);
+
+  ProgramBlockScanner scanner;
+  programScannerInit(scanner);
+  uint32_t blocksMatched = 0;
+  bool unchanged = true;
+  uint8_t buffer[512];
+  unsigned long remaining = rangeLength;
+
+  while (unchanged && remaining > 0) {
+    int chunk = source.read(buffer, remaining < sizeof(buffer) ? remaining : sizeof(buffer));
+    if (chunk <= 0) {
+      unchanged = false;
+      break;
+    }
+    remaining -= chunk;
+    for (int i = 0; i < chunk && unchanged; i++) {
+      if (!programScannerFeed(scanner, buffer[i])) {
+        continue;
+      }
+      ProgramBlock old;
+      unchanged = blocksMatched < mapHeader.blockCount &&
+                  mapFile.read((uint8_t *)&old, sizeof(old)) == sizeof(old) &&
+                  old.hash == scanner.block.hash && old.srcLength == scanner.block.srcLength;
+      blocksMatched++;
+      programScannerStartBlock(scanner);
+    }
+  }
+
+  if (unchanged && programScannerFinish(scanner)) {
+    ProgramBlock old;
+    unchanged = blocksMatched < mapHeader.blockCount &&
+                mapFile.read((uint8_t *)&old, sizeof(old)) == sizeof(old) &&
+                old.hash == scanner.block.hash && old.srcLength == scanner.block.srcLength;
+    blocksMatched++;
+  }
+  mapFile.close();
+  return unchanged && blocksMatched == mapHeader.blockCount;
+}
+
+// Read one line of at most end - position() bytes, without the newline
+String readProgramSourceLine(File &source, unsigned long end) {
+  String line = "";
+  while (source.position() < end) {
+    int c = source.read();
+    if (c < 0 || c == '\n') {
+      break;
+    }
+    line += (char)c;
+  }
+  return line;
+}
+
+// Append an op and its operand; returns the bytes written (0 on failure)
+uint32_t writeProgramOp(File &codeFile, const ProgramOp &op, const uint8_t *operand) {
+  if (codeFile.write((const uint8_t *)&op, sizeof(op)) != sizeof(op)) {
+    return 0;
+  }
+  if (op.length > 0 && codeFile.write(operand, op.length) != op.length) {
+    return 0;
+  }
+  return sizeof(op) + op.length;
+}
+
+// Link a snippet into the program being built (once, however often it is included)
+void registerProgramInclude(const String &path) {
+  for (int i = 0; i < buildFunctionCount; i++) {
+    if (buildFunctionPaths[i].equalsIgnoreCase(path)) {
+      return;
+    }
+  }
+  if (buildFunctionCount >= PROGRAM_MAX_FUNCTIONS || path.length() >= PROGRAM_PATH_LENGTH) {
+    Serial.print(F("Program cache: cannot link INCLUDE "));
+    Serial.println(path);
+    return;
+  }
+  buildFunctionPaths[buildFunctionCount++] = path;
+}
+
+// Append a STRING with non-ASCII text as OP_TYPE / OP_TYPELN with its
+// typing steps; returns 0 (ok untouched) if the operand does not fit one op
+uint32_t writeTypingOp(File &codeFile, const CompiledLine &compiled, uint8_t line, uint32_t srcEnd, bool &ok) {
+  uint32_t untypable;
+  uint32_t stepCount = programTypingStepCount(typingLayout(), unicodeInputMode, compiled.text,
+                                              compiled.textLength, untypable);
+  uint32_t operandLength = sizeof(uint16_t) + compiled.textLength + stepCount * sizeof(TypingStep);
+  if (operandLength > 0xFFFF) {
+    return 0;
+  }
+  if (untypable > 0) {
+    Serial.print(F("Program cache: "));
+    Serial.print(untypable);
+    Serial.print(F(" character(s) cannot be typed on layout "));
+    Serial.print(typingLayout().name);
+    Serial.print(F(": "));
+    Serial.println(programString(compiled.text, compiled.textLength));
+  }
+
+  ProgramOp op;
+  op.opcode = (compiled.opcode == OP_STRINGLN) ? OP_TYPELN : OP_TYPE;
+  op.line = line;
+  op.length = operandLength;
+  op.srcEnd = srcEnd;
+  uint16_t textLength = compiled.textLength;
+  bool written = codeFile.write((const uint8_t *)&op, sizeof(op)) == sizeof(op) &&
+                 codeFile.write((const uint8_t *)&textLength, sizeof(textLength)) == sizeof(textLength) &&
+                 codeFile.write((const uint8_t *)compiled.text, textLength) == textLength;
+  for (size_t i = 0; written && i < compiled.textLength;) {
+    TypingStep steps[TYPING_MAX_STEPS];
+    size_t count = resolveTypingSteps(utf8Next(compiled.text, compiled.textLength, i), steps);
+    written = codeFile.write((const uint8_t *)steps, count * sizeof(TypingStep)) == count * sizeof(TypingStep);
+  }
+  ok = ok && written;
+  return written ? sizeof(op) + operandLength : 0;
+}
+
+// Append the op for one compiled line; returns the bytes written
+uint32_t writeCompiledLine(File &codeFile, const CompiledLine &compiled, uint8_t line, uint32_t srcEnd, bool &ok) {
+  ProgramOp op;
+  op.opcode = compiled.opcode;
+  op.line = line;
+  op.srcEnd = srcEnd;
+
+  if (compiled.opcode == OP_CALL) {
+    String path = includePath(programString(compiled.text, compiled.textLength));
+    registerProgramInclude(path);
+    op.length = path.length();
+    uint32_t opBytes = writeProgramOp(codeFile, op, (const uint8_t *)path.c_str());
+    ok = ok && (opBytes > 0);
+    return opBytes;
+  }
+
+  if ((compiled.opcode == OP_STRING || compiled.opcode == OP_STRINGLN) &&
+      programNeedsTyping(compiled.text, compiled.textLength)) {
+    uint32_t opBytes = writeTypingOp(codeFile, compiled, line, srcEnd, ok);
+    if (opBytes > 0 || !ok) {
+      return opBytes;
+    }
+    // Too many steps for one op: typed character by character at run time
+  }
+
+  if (compiled.opcode != OP_CHORD && compiled.textLength > 0xFFFF) {
+    ok = false;
+    return 0;
+  }
+  op.length = compiledOperandLength(compiled);
+  uint32_t opBytes = writeProgramOp(codeFile, op, compiledOperand(compiled));
+  ok = ok && (opBytes > 0);
+  return opBytes;
+}
+
+// Compile the lines of one source block; returns the code bytes written
+// (0 with ok = false on a write failure or a line over 64 KB)
+uint32_t compileProgramBlock(File &source, unsigned long rangeOffset, const ProgramBlock &block,
+                             File &codeFile, bool &ok) {
+  unsigned long blockStart = rangeOffset + block.srcOffset;
+  unsigned long blockEnd = blockStart + block.srcLength;
+  source.seek(blockStart);
+
+  uint32_t written = 0;
+  uint8_t lineIndex = 0;
+  while (ok && source.position() < blockEnd) {
+    String line = readProgramSourceLine(source, blockEnd);
+    CompiledLine compiled;
+    compileDuckyLine(line.c_str(), line.length(), compiled, resolveProgramChord);
+    if (compiled.opcode != 0) {
+      written += writeCompiledLine(codeFile, compiled, lineIndex, source.position() - blockStart, ok);
+    }
+    lineIndex++;
+  }
+  return written;
+}
+
+// Copy length bytes of block code from the previous program, op by op so
+// the snippets it INCLUDEs are linked again
+bool copyProgramBlock(SdExtentFile &from, uint32_t offset, uint32_t length, File &to) {
+  uint8_t buffer[PROGRAM_COPY_CHUNK];
+  if (!from.seek(offset)) {
+    return false;
+  }
+  uint32_t end = offset + length;
+  while (from.position() < end) {
+    ProgramOp op;
+    if (from.read((uint8_t *)&op, sizeof(op)) != sizeof(op)) {
+      return false;
+    }
+    if (op.opcode == OP_CALL) {
+      String path = readProgramText(from, op.length);
+      registerProgramInclude(path);
+      if (writeProgramOp(to, op, (const uint8_t *)path.c_str()) == 0) {
+        return false;
+      }
+      continue;
+    }
+
+    if (to.write((const uint8_t *)&op, sizeof(op)) != sizeof(op)) {
+      return false;
+    }
+    uint16_t remaining = op.length;
+    while (remaining > 0) {
+      int chunk = from.read(buffer, remaining < sizeof(buffer) ? remaining : sizeof(buffer));
+      if (chunk <= 0 || to.write(buffer, chunk) != (size_t)chunk) {
+        return false;
+      }
+      remaining -= chunk;
+    }
+  }
+  return true;
+}
+
+// Compile every linked snippet into a function (snippets they include are
+// linked on the way), then append the function table
+bool linkProgramFunctions(File &codeFile, uint32_t &codeSize, ProgramCodeHeader &codeHeader) {
+  ProgramFunction *functions = (ProgramFunction *)calloc(PROGRAM_MAX_FUNCTIONS, sizeof(ProgramFunction));
+  if (functions == NULL) {
+    return false;
+  }
+
+  bool ok = true;
+  for (int i = 0; ok && i < buildFunctionCount; i++) {
+    ProgramFunction &function = functions[i];
+    buildFunctionPaths[i].toCharArray(function.path, PROGRAM_PATH_LENGTH);
+    function.codeOffset = codeSize;
+
+    File snippet = SD.open(buildFunctionPaths[i]);
+    if (snippet) {
+      function.srcSize = snippet.size();
+      function.srcCrc = crc32File(snippet, function.srcSize);
+      snippet.seek(0);
+      while (ok && snippet.position() < function.srcSize) {
+        String line = readProgramSourceLine(snippet, function.srcSize);
+        CompiledLine compiled;
+        compileDuckyLine(line.c_str(), line.length(), compiled, resolveProgramChord);
+        if (compiled.opcode != 0) {
+          codeSize += writeCompiledLine(codeFile, compiled, 0, 0, ok);
+        }
+      }
+      snippet.close();
+    } else {
+      function.flags |= PROGRAM_FUNCTION_MISSING;
+      Serial.print(F("Program cache: INCLUDE file not found: "));
+      Serial.println(buildFunctionPaths[i]);
+    }
+
+    ProgramOp returnOp = { OP_RETURN, 0, 0, 0 };
+    uint32_t opBytes = writeProgramOp(codeFile, returnOp, NULL);
+    ok = ok && (opBytes > 0);
+    codeSize += opBytes;
+  }
+
+  codeHeader.functionTable = codeSize;
+  codeHeader.functionCount = buildFunctionCount;
+  for (int i = 0; ok && i < buildFunctionCount; i++) {
+    ok = codeFile.write((const uint8_t *)&functions[i], sizeof(ProgramFunction)) == sizeof(ProgramFunction);
+    codeSize += sizeof(ProgramFunction);
+  }
+  free(functions);
+  return ok;
+}
+
+// True if every snippet linked into the program is unchanged on the card
+bool programIncludesUnchanged(const String &codeName) {
+  SdExtentFile codeFile;
+  ProgramCodeHeader header;
+  if (!codeFile.open(codeName) || codeFile.read((uint8_t *)&header, sizeof(header)) != sizeof(header) ||
+      !codeFile.seek(header.functionTable)) {
+    codeFile.close();
+    return false;
+  }
+
+  bool unchanged = true;
+  for (uint16_t i = 0; unchanged && i < header.functionCount; i++) {
+    ProgramFunction function;
+    if (codeFile.read((uint8_t *)&function, sizeof(function)) != sizeof(function)) {
+      unchanged = false;
+      break;
+    }
+    function.path[PROGRAM_PATH_LENGTH - 1] = '\0';
+    File snippet = SD.open(function.path);
+    if (!snippet) {
+      unchanged = (function.flags & PROGRAM_FUNCTION_MISSING) != 0;
+      continue;
+    }
+    unchanged = !(function.flags & PROGRAM_FUNCTION_MISSING) && snippet.size() == function.srcSize &&
+                crc32File(snippet, function.srcSize) == function.srcCrc;
+    snippet.close();
+  }
+  codeFile.close();
+  return unchanged;
+}
+
+// Find a block of the previous program with the same source bytes. The
+// block after the last match is tried first, then the hash table.
+bool findPreviousBlock(SdExtentFile &oldMap, uint32_t oldBlockCount, const uint32_t *oldHashes,
+                       uint32_t &hint, const ProgramBlock &block, ProgramBlock &match) {
+  if (!oldMap) {
+    return false;
+  }
+  for (int pass = 0; pass < 2; pass++) {
+    uint32_t first = (pass == 0) ? hint : 0;
+    uint32_t last = (pass == 0) ? hint + 1 : ((oldHashes != NULL) ? oldBlockCount : 0);
+    for (uint32_t i = first; i < last && i < oldBlockCount; i++) {
+      if (pass == 1 && oldHashes[i] != block.hash) {
+        continue;
+      }
+      if (oldMap.seek(sizeof(ProgramMapHeader) + i * sizeof(ProgramBlock)) &&
+          oldMap.read((uint8_t *)&match, sizeof(match)) == sizeof(match) &&
+          match.hash == block.hash && match.srcLength == block.srcLength) {
+        hint = i + 1;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Build the program into slot newSlot, reusing the blocks of the program
+// described by oldMapName/oldCodeName where the source is unchanged
+bool buildProgram(File &source, const String &scriptFile, unsigned long rangeOffset, unsigned long rangeLength,
+                  int newSlot, bool haveOld, const ProgramMapHeader &oldHeader, int oldSlot) {
+  String codeName = programFileName(scriptFile, 'b', newSlot);
+  String mapName = programFileName(scriptFile, 'm', newSlot);
+  SD.remove(codeName);
+  SD.remove(mapName);
+  File codeFile = SD.open(codeName, CATALOG_WRITE_MODE);
+  File mapFile = SD.open(mapName, CATALOG_WRITE_MODE);
+  File lineSource = SD.open(scriptFile);
+  if (!codeFile || !mapFile || !lineSource) {
+    Serial.println(F("Program cache: cannot create cache files"));
+    codeFile.close();
+    mapFile.close();
+    lineSource.close();
+    return false;
+  }
+
+  // Previous program, and its block hashes for finding moved blocks
+  SdExtentFile oldMap, oldCode;
+  uint32_t *oldHashes = NULL;
+  if (haveOld) {
+    oldMap.open(programFileName(scriptFile, 'm', oldSlot));
+    oldCode.open(programFileName(scriptFile, 'b', oldSlot));
+    if (oldMap && oldCode && oldHeader.blockCount <= PROGRAM_HASH_TABLE_MAX) {
+      oldHashes = (uint32_t *)malloc(oldHeader.blockCount * sizeof(uint32_t));
+    }
+    if (oldHashes != NULL) {
+      oldMap.seek(sizeof(ProgramMapHeader));
+      for (uint32_t i = 0; i < oldHeader.blockCount; i++) {
+        ProgramBlock old;
+        oldHashes[i] = (oldMap.read((uint8_t *)&old, sizeof(old)) == sizeof(old)) ? old.hash : 0;
+      }
+    }
+  }
+
+  ProgramMapHeader header;
+  programInitMapHeader(header);
+  header.typingId = typingConfigId();
+  header.generation = haveOld ? oldHeader.generation + 1 : 1;
+  header.rangeOffset = rangeOffset;
+  header.rangeLength = rangeLength;
+
+  ProgramMapHeader placeholder;
+  memset(&placeholder, 0, sizeof(placeholder)); // Invalid until the build completes
+  mapFile.write((const uint8_t *)&placeholder, sizeof(placeholder));
+
+  ProgramCodeHeader codeHeader;
+  programInitCodeHeader(codeHeader, header.generation);
+  bool ok = codeFile.write((const uint8_t *)&codeHeader, sizeof(codeHeader)) == sizeof(codeHeader);
+  uint32_t codeSize = sizeof(codeHeader);
+
+  buildFunctionCount = 0;
+  ProgramBlockScanner scanner;
+  programScannerInit(scanner);
+  uint32_t hint = 0;
+  uint32_t reusedBlocks = 0;
+  uint32_t compiledBlocks = 0;
+  uint8_t buffer[512];
+  unsigned long remaining = rangeLength;
+  source.seek(rangeOffset);
+
+  bool finished = false;
+  while (ok && !finished) {
+    int chunk = 0;
+    if (remaining > 0) {
+      chunk = source.read(buffer, remaining < sizeof(buffer) ? remaining : sizeof(buffer));
+      if (chunk <= 0) {
+        ok = false;
+        break;
+      }
+      remaining -= chunk;
+    }
+
+    for (int i = 0; ok && i <= chunk; i++) {
+      // Past the last byte of the range, flush the final partial block
+      bool blockDone;
+      if (i < chunk) {
+        blockDone = programScannerFeed(scanner, buffer[i]);
+      } else if (remaining == 0) {
+        blockDone = programScannerFinish(scanner);
+        finished = true;
+      } else {
+        break;
+      }
+      if (!blockDone) {
+        continue;
+      }
+
+      // Relink: the marker carries the block's current position
+      ProgramBlock block = scanner.block;
+      ProgramBlockMarker marker = { block.srcOffset, block.firstLine };
+      ProgramOp markerOp = { OP_BLOCK, 0, sizeof(marker), 0 };
+      uint32_t markerBytes = writeProgramOp(codeFile, markerOp, (const uint8_t *)&marker);
+      ok = (markerBytes > 0);
+      codeSize += markerBytes;
+      block.codeOffset = codeSize;
+
+      ProgramBlock previous;
+      if (ok && findPreviousBlock(oldMap, oldHeader.blockCount, oldHashes, hint, block, previous)) {
+        ok = copyProgramBlock(oldCode, previous.codeOffset, previous.codeLength, codeFile);
+        block.codeLength = previous.codeLength;
+        reusedBlocks++;
+      } else if (ok) {
+        block.codeLength = compileProgramBlock(lineSource, rangeOffset, block, codeFile, ok);
+        compiledBlocks++;
+      }
+      codeSize += block.codeLength;
+
+      ok = ok && mapFile.write((const uint8_t *)&block, sizeof(block)) == sizeof(block);
+      header.blockCount++;
+      programScannerStartBlock(scanner);
+    }
+  }
+
+  // Link the INCLUDEd snippets, then complete the code header
+  codeHeader.blocksEnd = codeSize;
+  ok = ok && linkProgramFunctions(codeFile, codeSize, codeHeader);
+  if (ok) {
+    codeFile.seek(0);
+    ok = codeFile.write((const uint8_t *)&codeHeader, sizeof(codeHeader)) == sizeof(codeHeader);
+  }
+  for (int i = 0; i < buildFunctionCount; i++) {
+    buildFunctionPaths[i] = "";
+  }
+
+  header.lineCount = scanner.lineCount;
+  header.codeSize = codeSize;
+  free(oldHashes);
+  oldMap.close();
+  oldCode.close();
+  lineSource.close();
+  codeFile.close();
+
+  // CRC of the finished code, which the card health check verifies
+  if (ok) {
+    File written = SD.open(codeName);
+    ok = written && written.size() == codeSize;
+    if (ok) {
+      header.codeCrc = crc32File(written, codeSize);
+    }
+    written.close();
+  }
+
+  // The block map header goes last; until then the new slot is invalid
+  if (ok) {
+    mapFile.seek(0);
+    ok = mapFile.write((const uint8_t *)&header, sizeof(header)) == sizeof(header);
+  }
+  mapFile.close();
+
+  if (!ok) {
+    Serial.println(F("Program cache: build failed - running the script uncompiled"));
+    SD.remove(codeName);
+    SD.remove(mapName);
+    return false;
+  }
+
+  if (haveOld) {
+    SD.remove(programFileName(scriptFile, 'b', oldSlot));
+    SD.remove(programFileName(scriptFile, 'm', oldSlot));
+  }
+  programCodeFile = codeName;
+  programSlot = newSlot;
+  programGeneration = header.generation;
+
+  programBuildCompiled = compiledBlocks;
+  programBuildReused = reusedBlocks;
+
+  Serial.print(F("Program cache: "));
+  Serial.print(header.blockCount);
+  Serial.print(F(" blocks, "));
+  Serial.print(compiledBlocks);
+  Serial.print(F(" compiled, "));
+  Serial.print(reusedBlocks);
+  Serial.print(F(" reused, "));
+  Serial.print(codeHeader.functionCount);
+  Serial.print(F(" included ("));
+  Serial.print(codeSize);
+  Serial.println(F(" bytes of code)"));
+  return true;
+}
+
+// Make sure an up-to-date program exists for the selected script range.
+// Returns false if the script should be interpreted from source instead.
+bool prepareProgram(const String &scriptFile) {
+  programCodeFile = "";
+  programPrepareResult = RUN_CACHE_OFF;
+  programPrepareMs = 0;
+  programBuildCompiled = 0;
+  programBuildReused = 0;
+  if (!config.compileCache) {
+    return false;
+  }
+
+  unsigned long prepareStart = millis();
+  File source = SD.open(scriptFile);
+  if (!source) {
+    return false;
+  }
+  unsigned long rangeLength = (scriptRangeLength > 0) ? scriptRangeLength : source.size() - scriptRangeOffset;
+
+  // The slot with the newest valid block map is the current program
+  ProgramMapHeader headers[2];
+  bool valid[2];
+  for (int slot = 0; slot < 2; slot++) {
+    valid[slot] = readProgramMap(programFileName(scriptFile, 'm', slot), scriptRangeOffset, headers[slot]) &&
+                  programCodeValid(programFileName(scriptFile, 'b', slot), headers[slot].generation);
+  }
+  int current = -1;
+  if (valid[0] || valid[1]) {
+    current = (valid[0] && (!valid[1] || headers[0].generation > headers[1].generation)) ? 0 : 1;
+  }
+
+  bool ready;
+  if (current >= 0 && programBlocksUnchanged(source, scriptRangeOffset, rangeLength,
+                                             programFileName(scriptFile, 'm', current), headers[current]) &&
+      programIncludesUnchanged(programFileName(scriptFile, 'b', current))) {
+    programCodeFile = programFileName(scriptFile, 'b', current);
+    programSlot = current;
+    programGeneration = headers[current].generation;
+    Serial.print(F("Program cache: up to date ("));
+    Serial.print(headers[current].blockCount);
+    Serial.println(F(" blocks)"));
+    ready = true;
+    programPrepareResult = RUN_CACHE_HIT;
+  } else {
+    int newSlot = (current == 0) ? 1 : 0;
+    ready = buildProgram(source, scriptFile, scriptRangeOffset, rangeLength, newSlot, current >= 0,
+                         headers[current >= 0 ? current : 0], current);
+    if (ready) {
+      markCatalogEntryCompiled();
+    }
+    programPrepareResult = ready ? RUN_CACHE_REBUILT : RUN_CACHE_FAILED;
+  }
+  source.close();
+
+  programPrepareMs = millis() - prepareStart;
+  Serial.print(F("Program cache: prepared in "));
+  Serial.print(programPrepareMs);
+  Serial.println(F("ms"));
+  return ready;
+}
+
+// Card health check of the prepared program (card_health.ino): read its
+// code and compare it with the CRC in the block map. False if it must not run.
+bool checkProgramCodeHealth(const String &scriptFile) {
+  ProgramMapHeader header;
+  if (programCodeFile.length() == 0 ||
+      !readProgramMap(programFileName(scriptFile, 'm', programSlot), scriptRangeOffset, header)) {
+    return true;
+  }
+  SdExtentFile code;
+  uint32_t crc;
+  bool complete;
+  bool usable = true;
+  if (!code.open(programCodeFile) || !cardHealthReadRange(code, 0, header.codeSize, crc, complete)) {
+    cardHealth.status = CARD_HEALTH_READ_ERROR;
+    usable = false;
+  } else if (complete) {
+    cardHealth.programVerified = true;
+    if (crc != header.codeCrc) {
+      cardHealth.status = CARD_HEALTH_CORRUPT;
+      usable = false;
+      Serial.println(F("Card health: program code does not match its CRC - running the script uncompiled"));
+    }
+  }
+  code.close();
+  return usable;
+}
+
+// Code offset of the block that contains startOffset (0 = from the start)
+uint32_t findProgramBlock(const String &scriptFile, unsigned long startOffset) {
+  File mapFile = SD.open(programFileName(scriptFile, 'm', programSlot));
+  if (!mapFile) {
+    return 0;
+  }
+  mapFile.seek(sizeof(ProgramMapHeader));
+
+  uint32_t codeOffset = 0;
+  ProgramBlock block;
+  while (mapFile.read((uint8_t *)&block, sizeof(block)) == sizeof(block)) {
+    if (scriptRangeOffset + block.srcOffset + block.srcLength > startOffset) {
+      // Back up over the block's OP_BLOCK op
+      codeOffset = block.codeOffset - sizeof(ProgramOp) - sizeof(ProgramBlockMarker);
+      break;
+    }
+  }
+  mapFile.close();
+  return codeOffset;
+}
+
+// Read an op's text operand
+String readProgramText(SdExtentFile &codeFile, uint16_t length) {
+  String text = "";
+  text.reserve(length);
+  char buffer[65];
+  while (length > 0) {
+    int chunk = codeFile.read((uint8_t *)buffer, length < 64 ? length : 64);
+    if (chunk <= 0) {
+      break;
+    }
+    buffer[chunk] = '\0';
+    text += buffer;
+    length -= chunk;
+  }
+  return text;
+}
+
+// Source form of an op, for the log
+String programOpText(uint8_t opcode, const String &text, uint32_t value) {
+  switch (opcode) {
+    case OP_DELAY:         return "DELAY " + String(value);
+    case OP_DEFAULT_DELAY: return "DEFAULT_DELAY " + String(value);
+    case OP_SPEED:
+      if (value == TYPING_SPEED_DEFAULT) {
+        return "SPEED DEFAULT";
+      }
+      return "SPEED " + String(typingSpeedRate(value)) + " " + String(typingSpeedBurst(value));
+    case OP_STRING:        return "STRING " + text;
+    case OP_STRINGLN:      return "STRINGLN " + text;
+    case OP_TYPE:          return "STRING " + text;
+    case OP_TYPELN:        return "STRINGLN " + text;
+    case OP_CHORD:         return "+"; // Logged as [chord]
+    case OP_HOLD:          return "HOLD";
+    case OP_RELEASE:       return "RELEASE";
+    case OP_CHECKPOINT:    return "CHECKPOINT";
+    default:               return text;
+  }
+}
+
+// Replay stepCount typing steps of an OP_TYPE operand from the code file
+void typeProgramSteps(SdExtentFile &codeFile, uint32_t stepCount) {
+  unsigned long start = micros();
+  TypingStep steps[16];
+  while (stepCount > 0) {
+    uint32_t chunk = (stepCount < 16) ? stepCount : 16;
+    if (codeFile.read((uint8_t *)steps, chunk * sizeof(TypingStep)) != (int)(chunk * sizeof(TypingStep))) {
+      break;
+    }
+    for (uint32_t i = 0; i < chunk; i++) {
+      sendTypingStep(steps[i]);
+      if (steps[i].flags & TYPING_STEP_CHAR_END) {
+        typingCharCount++;
+      }
+    }
+    stepCount -= chunk;
+  }
+  typingMicrosSpent += micros() - start;
+}
+
+// Run one op; mirrors processDuckyLine_DirectASCII() for the compiled commands.
+// OP_TYPE steps are read from codeFile (value = step count).
+void executeProgramOp(SdExtentFile &codeFile, uint8_t opcode, const String &text, uint32_t value, const uint8_t *chord) {
+  if (opcode == OP_LINE) {
+    processDuckyLine_DirectASCII(text);
+    return;
+  }
+
+  // Flash activity indicator
+  digitalWrite(LED_RX, LOW);
+  delay(25);
+  digitalWrite(LED_RX, HIGH);
+
+  switch (opcode) {
+    case OP_DEFAULT_DELAY:
+      defaultDelay = value;
+      break;
+    case OP_DELAY:
+      engineDelay(value);
+      break;
+    case OP_SPEED:
+      applyTypingSpeed(value);
+      break;
+    case OP_STRING:
+      typeDirectASCII(text);
+      break;
+    case OP_STRINGLN:
+      typeDirectASCII(text);
+      delay(50);
+      HidKeyboard.write(KEY_RETURN);
+      delay(50);
+      break;
+    case OP_TYPE:
+      typeProgramSteps(codeFile, value);
+      break;
+    case OP_TYPELN:
+      typeProgramSteps(codeFile, value);
+      delay(50);
+      HidKeyboard.write(KEY_RETURN);
+      delay(50);
+      break;
+    case OP_CHORD: {
+      KeyReport report;
+      memcpy(&report, chord, sizeof(report));
+      sendChord(report);
+      break;
+    }
+    case OP_HOLD: {
+      KeyReport report;
+      memcpy(&report, chord, sizeof(report));
+      HidKeyboard.hold(report);
+      break;
+    }
+    case OP_RELEASE: {
+      KeyReport report, none;
+      memcpy(&report, chord, sizeof(report));
+      memset(&none, 0, sizeof(none));
+      if (memcmp(&report, &none, sizeof(report)) == 0) {
+        HidKeyboard.unholdAll();
+      } else {
+        HidKeyboard.unhold(report);
+      }
+      break;
+    }
+    case OP_CHECKPOINT:
+      requestCheckpoint();
+      break;
+  }
+
+  // Wait the default delay after each command
+  engineDelay(defaultDelay);
+}
+
+// Expected milliseconds of one op run by executeProgramOp(), as
+// estimateDuckyLine_DirectASCII() has it for the source line. amount is the
+// DELAY, DEFAULT_DELAY or SPEED value, the STRING length or the OP_TYPE step
+// count (a character the layout cannot type counts as a keystroke here).
+// OP_LINE is estimated from its text, OP_CALL by its function.
+unsigned long estimateProgramOp(uint8_t opcode, uint32_t amount, EstimateState &state) {
+  uint16_t rate = typingSpeedRate(state.typingSpeed);
+  uint8_t burst = typingSpeedBurst(state.typingSpeed);
+  unsigned long ms = 25; // Activity LED flash
+  switch (opcode) {
+    case OP_DEFAULT_DELAY:
+      state.defaultDelay = amount;
+      break;
+    case OP_SPEED:
+      state.typingSpeed = (amount == TYPING_SPEED_DEFAULT) ? typingSpeedValue(config.typingRate, config.typingBurst)
+                                                           : amount;
+      break;
+    case OP_DELAY:
+      ms += amount;
+      break;
+    case OP_STRING:
+    case OP_TYPE:
+      ms += typingPaceMillis(amount, rate, burst);
+      break;
+    case OP_STRINGLN:
+    case OP_TYPELN:
+      ms += typingPaceMillis(amount + 1, rate, burst) + 100;
+      break;
+  }
+  return ms + state.defaultDelay;
+}
+
+// Read the function table into RAM (count entries), then go back to the
+// first op after the code header
+uint16_t loadProgramCallTable(SdExtentFile &codeFile, const ProgramCodeHeader &codeHeader, ProgramCallTarget *targets) {
+  uint16_t count = 0;
+  codeFile.seek(codeHeader.functionTable);
+  while (count < codeHeader.functionCount && count < PROGRAM_MAX_FUNCTIONS) {
+    ProgramFunction function;
+    if (codeFile.read((uint8_t *)&function, sizeof(function)) != sizeof(function)) {
+      break;
+    }
+    targets[count].pathHash = programPathHash(function.path, PROGRAM_PATH_LENGTH);
+    targets[count].codeOffset = function.codeOffset;
+    targets[count].flags = function.flags;
+    count++;
+  }
+  codeFile.seek(sizeof(codeHeader));
+  return count;
+}
+
+// Code offset of the function linked for an INCLUDE path (0 = not linked).
+// A hash hit is checked against the path in the function table, so a
+// snippet whose path hash collides never runs in place of another; the
+// code file is left where it was.
+uint32_t findProgramFunction(SdExtentFile &codeFile, const ProgramCodeHeader &codeHeader,
+                             const ProgramCallTarget *targets, uint16_t count, const String &path, bool &missing) {
+  uint32_t hash = programPathHash(path.c_str(), path.length());
+  uint32_t position = codeFile.position();
+  uint32_t function = 0;
+  for (uint16_t i = 0; i < count && function == 0; i++) {
+    ProgramFunction entry;
+    if (targets[i].pathHash == hash &&
+        codeFile.seek(codeHeader.functionTable + i * sizeof(ProgramFunction)) &&
+        codeFile.read((uint8_t *)&entry, sizeof(entry)) == sizeof(entry) &&
+        programPathMatches(entry.path, path.c_str(), path.length())) {
+      missing = (targets[i].flags & PROGRAM_FUNCTION_MISSING) != 0;
+      function = targets[i].codeOffset;
+    }
+  }
+  codeFile.seek(position);
+  return function;
+}
+
+// Add up the expected milliseconds of the ops from the code file's
+// position: the blocks up to blocksEnd at depth 0, skipping the lines that
+// end before startOffset (the source lines from the first op to the last
+// are added to lineCount), or one function up to its OP_RETURN below that
+unsigned long estimateProgramOps(SdExtentFile &codeFile, const ProgramCodeHeader &codeHeader, const ProgramCallTarget *targets,
+                                 uint16_t targetCount, unsigned long startOffset, EstimateState &state,
+                                 int &lineCount, int depth) {
+  unsigned long total = 0;
+  unsigned long blockBase = scriptRangeOffset;
+  uint32_t blockFirstLine = 0;
+  uint32_t firstLine = 0;
+  uint32_t lastLine = 0;
+  ProgramOp op;
+  while ((depth > 0 || codeFile.position() < codeHeader.blocksEnd) &&
+         codeFile.read((uint8_t *)&op, sizeof(op)) == sizeof(op)) {
+    if (op.opcode == OP_BLOCK) {
+      ProgramBlockMarker marker;
+      codeFile.read((uint8_t *)&marker, sizeof(marker));
+      blockBase = scriptRangeOffset + marker.srcOffset;
+      blockFirstLine = marker.firstLine;
+      continue;
+    }
+    if (op.opcode == OP_RETURN) {
+      break;
+    }
+    uint32_t next = codeFile.position() + op.length;
+    if (depth == 0) {
+      if (blockBase + op.srcEnd <= startOffset) {
+        codeFile.seek(next); // Before the resume point
+        continue;
+      }
+      lastLine = blockFirstLine + op.line + 1;
+      if (firstLine == 0) {
+        firstLine = lastLine;
+      }
+    }
+
+    if (op.opcode == OP_LINE) {
+      total += estimateDuckyLine_DirectASCII(readProgramText(codeFile, op.length), state);
+    } else if (op.opcode == OP_CALL) {
+      // The LED flash, the function's own ops, then the default delay that
+      // ends the INCLUDE line, as the executor runs it
+      String path = readProgramText(codeFile, op.length);
+      bool missing = false;
+      uint32_t function = findProgramFunction(codeFile, codeHeader, targets, targetCount, path, missing);
+      total += 25;
+      if (function != 0 && !missing && depth < PROGRAM_MAX_CALL_DEPTH &&
+          !estimateCallLookup(estimateCalls, function, state, total)) {
+        // First call with these settings: walk the linked function once,
+        // then come back to the op after the call
+        EstimateState entry = state;
+        unsigned long functionMs = 0;
+        if (codeFile.seek(function)) {
+          int callLines = 0;
+          functionMs = estimateProgramOps(codeFile, codeHeader, targets, targetCount, 0, state, callLines, depth + 1);
+        }
+        codeFile.seek(next);
+        estimateCallStore(estimateCalls, function, entry, state, functionMs);
+        total += functionMs;
+      }
+      total += state.defaultDelay;
+    } else {
+      uint32_t amount = 0;
+      if (op.opcode == OP_DELAY || op.opcode == OP_DEFAULT_DELAY || op.opcode == OP_SPEED) {
+        codeFile.read((uint8_t *)&amount, sizeof(amount));
+      } else if (op.opcode == OP_TYPE || op.opcode == OP_TYPELN) {
+        uint16_t textLength = 0;
+        codeFile.read((uint8_t *)&textLength, sizeof(textLength));
+        amount = (op.length - sizeof(textLength) - textLength) / sizeof(TypingStep);
+      } else if (op.opcode == OP_STRING || op.opcode == OP_STRINGLN) {
+        amount = op.length; // Plain ASCII, one keystroke per byte
+      }
+      total += estimateProgramOp(op.opcode, amount, state);
+    }
+    if (codeFile.position() != next) {
+      codeFile.seek(next);
+    }
+  }
+  if (firstLine > 0) {
+    lineCount += lastLine - firstLine + 1;
+  }
+  return total;
+}
+
+// Pre-pass over one iteration of the prepared program from the line that
+// starts at startOffset: walks the ops the executor will run, so no source
+// line is read or parsed. False if the code is unreadable (the executor
+// then interprets the source, and the estimate should follow it).
+bool estimateProgramMillis(const String &scriptFile, unsigned long startOffset, EstimateState &state,
+                           int &lineCount, unsigned long &ms) {
+  SdExtentFile codeFile;
+  ProgramCodeHeader codeHeader;
+  if (!codeFile.open(programCodeFile) || codeFile.read((uint8_t *)&codeHeader, sizeof(codeHeader)) != sizeof(codeHeader) ||
+      !programCodeHeaderValid(codeHeader, programGeneration)) {
+    codeFile.close();
+    return false;
+  }
+
+  ProgramCallTarget callTargets[PROGRAM_MAX_FUNCTIONS];
+  uint16_t callTargetCount = loadProgramCallTable(codeFile, codeHeader, callTargets);
+  if (startOffset > scriptRangeOffset) {
+    uint32_t blockStart = findProgramBlock(scriptFile, startOffset);
+    if (blockStart > 0) {
+      codeFile.seek(blockStart);
+    }
+  }
+  ms = estimateProgramOps(codeFile, codeHeader, callTargets, callTargetCount, startOffset, state, lineCount, 0);
+  codeFile.close();
+  return true;
+}
+
+// Code sector read ahead during DELAY windows, so the ops after a delay
+// start without waiting on the card (the compiled counterpart of the
+// source look-ahead in bypass_mode.ino)
+SdExtentFile *programReadAheadFile = NULL;
+uint8_t programReadAheadSector[EXTENT_FILE_SECTOR];
+
+// Delay work hook: fetch the next code sector
+bool readAheadProgramCode() {
+  return programReadAheadFile != NULL && programReadAheadFile->readAhead();
+}
+
+// Execute the prepared program from the line that starts at startOffset
+void executeProgram(const String &scriptFile, unsigned long startOffset) {
+  SdExtentFile codeFile;
+  ProgramCodeHeader codeHeader;
+  if (!codeFile.open(programCodeFile) || codeFile.read((uint8_t *)&codeHeader, sizeof(codeHeader)) != sizeof(codeHeader) ||
+      !programCodeHeaderValid(codeHeader, programGeneration)) {
+    Serial.println(F("Program cache: code unreadable - running the script uncompiled"));
+    codeFile.close();
+    executeScript_DirectASCII(scriptFile, startOffset,
+                              (scriptRangeLength == 0) ? 0 : scriptRangeOffset + scriptRangeLength - startOffset);
+    return;
+  }
+
+  // INCLUDE targets stay in RAM for the whole run
+  ProgramCallTarget callTargets[PROGRAM_MAX_FUNCTIONS];
+  uint16_t callTargetCount = loadProgramCallTable(codeFile, codeHeader, callTargets);
+
+  // Resuming: jump straight to the block that holds the resume point
+  if (startOffset > scriptRangeOffset) {
+    uint32_t blockStart = findProgramBlock(scriptFile, startOffset);
+    if (blockStart > 0) {
+      codeFile.seek(blockStart);
+    }
+  }
+  codeFile.setReadAhead(programReadAheadSector);
+  programReadAheadFile = &codeFile;
+  registerDelayWork(readAheadProgramCode);
+  Serial.println(F("COMPILED PROGRAM: Executing cached program..."));
+
+  unsigned long blockBase = scriptRangeOffset;
+  uint32_t blockFirstLine = 0;
+  unsigned long lineEnd = startOffset;
+  int lineNumber = scriptLineBase;
+  // Where each INCLUDE returns to; the code file is extent mapped, so the
+  // jumps cost one sector read at most
+  uint32_t returnOffsets[PROGRAM_MAX_CALL_DEPTH];
+  int depth = 0;
+  ProgramOp op;
+
+  while ((depth > 0 || codeFile.position() < codeHeader.blocksEnd) &&
+         codeFile.read((uint8_t *)&op, sizeof(op)) == sizeof(op)) {
+    if (op.opcode == OP_BLOCK) {
+      ProgramBlockMarker marker;
+      codeFile.read((uint8_t *)&marker, sizeof(marker));
+      blockBase = scriptRangeOffset + marker.srcOffset;
+      blockFirstLine = marker.firstLine;
+      continue;
+    }
+
+    if (op.opcode == OP_RETURN) {
+      // The INCLUDE line ends here, with the default delay like any other line
+      depth--;
+      codeFile.seek(returnOffsets[depth]);
+      progressIncludeFinished();
+      engineDelay(defaultDelay);
+    } else {
+      // Ops inside an INCLUDE report the line of the INCLUDE
+      if (depth == 0) {
+        lineEnd = blockBase + op.srcEnd;
+        lineNumber = blockFirstLine + op.line + 1;
+        if (lineEnd <= startOffset) {
+          codeFile.seek(codeFile.position() + op.length); // Before the resume point
+          continue;
+        }
+      }
+
+      String text = "";
+      uint32_t value = 0;
+      uint8_t chord[8];
+      if (op.opcode == OP_DELAY || op.opcode == OP_DEFAULT_DELAY || op.opcode == OP_SPEED) {
+        codeFile.read((uint8_t *)&value, sizeof(value));
+      } else if (op.opcode == OP_CHORD || op.opcode == OP_HOLD || op.opcode == OP_RELEASE) {
+        codeFile.read(chord, sizeof(chord));
+      } else if (op.opcode == OP_TYPE || op.opcode == OP_TYPELN) {
+        uint16_t textLength = 0;
+        codeFile.read((uint8_t *)&textLength, sizeof(textLength));
+        text = readProgramText(codeFile, textLength);
+        value = (op.length - sizeof(textLength) - textLength) / sizeof(TypingStep); // Steps follow
+      } else if (op.length > 0) {
+        text = readProgramText(codeFile, op.length);
+      }
+
+      Serial.print(F("Line "));
+      Serial.print(lineNumber);
+      Serial.print(F(": "));
+      if (op.opcode == OP_CALL) {
+        Serial.print(F("INCLUDE "));
+        Serial.println(text);
+        progressIncludeStarted(lineNumber);
+        profileLineStarted(lineNumber);
+        digitalWrite(LED_RX, LOW);
+        delay(25);
+        digitalWrite(LED_RX, HIGH);
+
+        bool missing = false;
+        uint32_t function = findProgramFunction(codeFile, codeHeader, callTargets, callTargetCount, text, missing);
+        if (function != 0 && !missing && depth < PROGRAM_MAX_CALL_DEPTH) {
+          returnOffsets[depth] = codeFile.position();
+          if (codeFile.seek(function)) {
+            depth++;
+            continue;
+          }
+        }
+        if (function == 0 || missing) {
+          Serial.print(F("INCLUDE file not found: "));
+        } else if (depth < PROGRAM_MAX_CALL_DEPTH) {
+          Serial.print(F("INCLUDE could not be read, skipped: "));
+        } else {
+          Serial.print(F("INCLUDE nested too deeply, skipped: "));
+        }
+        Serial.println(text);
+        progressIncludeFinished();
+        engineDelay(defaultDelay);
+      } else {
+        String source = programOpText(op.opcode, text, value);
+        progressOpStarted(op.opcode, text, (op.opcode == OP_STRING || op.opcode == OP_STRINGLN) ? op.length : value,
+                          lineNumber);
+        profileLineStarted(lineNumber);
+        Serial.println((op.opcode == OP_CHORD) ? String(F("[chord]")) : source);
+        executeProgramOp(codeFile, op.opcode, text, value, chord);
+      }
+    }
+
+    // Stop here when aborted; the position is not checkpointed
+    if (engineAbortRequested) {
+      Serial.print(F("COMPILED PROGRAM: Aborted after line "));
+      Serial.println(lineNumber);
+      break;
+    }
+
+    // Checkpoints fall between source lines, never inside an INCLUDE
+    if (depth == 0) {
+      checkpointAfterLine(lineEnd, lineNumber);
+    }
+  }
+
+  unregisterDelayWork(readAheadProgramCode);
+  programReadAheadFile = NULL;
+  codeFile.close();
+  Serial.println(F("COMPILED PROGRAM: Execution complete"));
+}
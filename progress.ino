@@ -0,0 +1,277 @@
+/*
+ * Run Progress - Runtime Estimate, Percent Complete and ETA
+ *
+ * Before a run starts, a pre-pass adds up the expected time of every line
+ * (no typing, no delays): DELAY values, DEFAULT_DELAY, SPEED pacing and the
+ * fixed hold times of each command, plus the per-iteration LED flashes and
+ * repeat waits of runScriptFile(). A compiled run walks the ops of the
+ * cached program (estimateProgramMillis() in program_cache.ino), so its
+ * INCLUDEd snippets are costed from their linked functions; an interpreted
+ * run reads the script range with estimateDuckyLine_DirectASCII() from
+ * bypass_mode.ino. Either way each snippet is walked once per run (and
+ * DEFAULT_DELAY/SPEED it is entered with), however many lines include it.
+ *
+ * During the run the same per-line (or per-op) figures mark how far along
+ * the script is. The progress is published
+ *   - over serial every PROGRESS_INTERVAL ms: "Progress: 42% (line 17) - ETA 12.3 s"
+ *   - on the orange LED: every 2 seconds it blinks once per started quarter
+ *     (1 blink = 0-25%, ... 4 blinks = 75-100%)
+ * so an operator knows when the unit can be unplugged without waiting out
+ * worst-case margins. The summary compares the estimate with the actual run
+ * time; time spent paused is not part of the estimate.
+ */
+
+// Fixed cost of each iteration in runScriptFile(): file-open flash (2 x 400 ms)
+// and the completion flash (1000 ms)
+const unsigned long ESTIMATE_ITERATION_MS = 1800;
+
+// Extra cost of each repetition: the wait (1000 ms) and flash (2 x 200 ms)
+const unsigned long ESTIMATE_REPEAT_MS = 1400;
+
+// Longest run with an ETA: what millis() counts before it wraps (49.7 days)
+const unsigned long long ESTIMATE_MAX_MS = 0xFFFFFFFFUL;
+const unsigned long long ESTIMATE_MAX_LINES = 0x7FFFFFFFUL;
+
+// LED progress pattern
+const unsigned long PROGRESS_LED_CYCLE_MS = 2000;
+const unsigned long PROGRESS_LED_SPACING_MS = 300;
+const unsigned long PROGRESS_LED_BLINK_MS = 120;
+
+bool progressActive = false;
+unsigned long progressTotalMs = 0;     // Estimated run time (0 = no ETA: endless or too long)
+unsigned long progressDoneMs = 0;      // Estimated time of the work already finished
+unsigned long progressSegmentMs = 0;   // Estimated time of the line in progress
+unsigned long progressSegmentStart = 0;
+unsigned long progressRunStart = 0;
+unsigned long progressLastReport = 0;
+EstimateState progressEstimate;       // DEFAULT_DELAY and SPEED as tracked by the estimator
+int progressLine = 0;
+bool progressLedOn = false;
+
+// Pre-pass over one iteration of the script range; returns the expected milliseconds
+unsigned long estimateScriptMillis(const String &scriptFile, unsigned long offset, unsigned long length,
+                                   EstimateState &state, int &lineCount) {
+  SdExtentFile estimateFile;
+  if (!estimateFile.open(scriptFile)) {
+    return 0;
+  }
+
+  estimateFile.seek(offset);
+  unsigned long end = (length == 0) ? estimateFile.size() : offset + length;
+  unsigned long total = 0;
+  while (estimateFile.available() && estimateFile.position() < end) {
+    String line = estimateFile.readStringUntil('\n');
+    total += estimateDuckyLine_DirectASCII(line, state);
+    lineCount++;
+  }
+  estimateFile.close();
+  return total;
+}
+
+// Pre-pass over one iteration, from the program when the run is compiled
+unsigned long estimatePassMillis(bool compiled, const String &scriptFile, unsigned long offset, unsigned long length,
+                                 EstimateState &state, int &lineCount) {
+  unsigned long ms;
+  if (compiled && estimateProgramMillis(scriptFile, offset, state, lineCount, ms)) {
+    return ms;
+  }
+  return estimateScriptMillis(scriptFile, offset, length, state, lineCount);
+}
+
+// Estimate the run and start tracking it. The first iteration covers
+// firstLength bytes from firstOffset (it may resume mid-script); later ones
+// cover the whole range. iterations = 0 means the script repeats forever.
+// compiled: the prepared program will run (see prepareProgram()).
+void beginProgress(const String &scriptFile, unsigned long firstOffset, unsigned long firstLength,
+                   unsigned long rangeOffset, unsigned long rangeLength, int iterations, bool compiled) {
+  unsigned long prepassStart = millis();
+  estimateCallReset(estimateCalls);
+  EstimateState state;
+  state.defaultDelay = defaultDelay;
+  state.typingSpeed = typingSpeedValue(typingPacer.rate(), typingPacer.burst());
+  progressEstimate = state;
+  int lineCount = 0;
+
+  EstimateState firstState = state;
+  unsigned long firstMs = estimatePassMillis(compiled, scriptFile, firstOffset, firstLength, state, lineCount);
+  unsigned long iterationMs = firstMs + ESTIMATE_ITERATION_MS;
+  // 64 bits: two billion repetitions of a long pass overflow 32
+  unsigned long long totalMs = iterationMs;
+  unsigned long long totalLines = lineCount;
+  if (iterations > 1) {
+    // DEFAULT_DELAY and SPEED carry over from one iteration to the next; a
+    // whole first pass that leaves them unchanged is the figure for all
+    int passLines = lineCount;
+    unsigned long passMs = firstMs;
+    if (firstOffset != rangeOffset || state.defaultDelay != firstState.defaultDelay ||
+        state.typingSpeed != firstState.typingSpeed) {
+      passLines = 0;
+      passMs = estimatePassMillis(compiled, scriptFile, rangeOffset, rangeLength, state, passLines);
+    }
+    totalMs += (unsigned long long)(iterations - 1) * ((unsigned long long)passMs + ESTIMATE_ITERATION_MS +
+                                                       ESTIMATE_REPEAT_MS);
+    totalLines += (unsigned long long)(iterations - 1) * passLines;
+  }
+
+  // A run longer than ESTIMATE_MAX_MS gets no ETA, as an endless one
+  Serial.print(F("Estimated run time: "));
+  if (iterations == 0) {
+    Serial.print(iterationMs / 1000.0, 1);
+    Serial.print(F(" seconds per iteration, repeating forever"));
+    progressTotalMs = 0;
+  } else if (totalMs > ESTIMATE_MAX_MS || totalLines > ESTIMATE_MAX_LINES) {
+    Serial.print(iterationMs / 1000.0, 1);
+    Serial.print(F(" seconds per iteration, "));
+    Serial.print(iterations);
+    Serial.print(F(" iterations (too long for an ETA)"));
+    progressTotalMs = 0;
+  } else {
+    progressTotalMs = (unsigned long)totalMs;
+    Serial.print(progressTotalMs / 1000.0, 1);
+    Serial.print(F(" seconds for "));
+    Serial.print((unsigned long)totalLines);
+    Serial.print(F(" lines"));
+  }
+  Serial.print(F(" (pre-pass took "));
+  Serial.print(millis() - prepassStart);
+  Serial.println(F("ms)"));
+
+  progressDoneMs = 0;
+  progressSegmentMs = 0;
+  progressLine = 0;
+  progressRunStart = millis();
+  progressSegmentStart = progressRunStart;
+  progressLastReport = progressRunStart;
+  progressActive = true;
+}
+
+// Account for a stretch of work expected to take ms, starting now
+void progressSegmentStarted(unsigned long ms) {
+  if (!progressActive) {
+    return;
+  }
+  progressDoneMs += progressSegmentMs;
+  progressSegmentMs = ms;
+  progressSegmentStart = millis();
+}
+
+// Called by runScriptFile() as each iteration starts
+void progressIterationStarted(bool repetition) {
+  progressSegmentStarted(ESTIMATE_ITERATION_MS + (repetition ? ESTIMATE_REPEAT_MS : 0));
+}
+
+// Called by the executor as each script line starts
+void progressLineStarted(const String &line, int lineNumber) {
+  if (!progressActive) {
+    return;
+  }
+  progressLine = lineNumber;
+  progressSegmentStarted(estimateDuckyLine_DirectASCII(line, progressEstimate));
+}
+
+// Called by the program executor as each op starts; amount as for
+// estimateProgramOp()
+void progressOpStarted(uint8_t opcode, const String &text, uint32_t amount, int lineNumber) {
+  if (!progressActive) {
+    return;
+  }
+  progressLine = lineNumber;
+  progressSegmentStarted(opcode == OP_LINE ? estimateDuckyLine_DirectASCII(text, progressEstimate)
+                                           : estimateProgramOp(opcode, amount, progressEstimate));
+}
+
+// Called by the program executor when an INCLUDE starts: the call itself
+// costs the LED flash, the snippet's lines then report themselves
+void progressIncludeStarted(int lineNumber) {
+  if (!progressActive) {
+    return;
+  }
+  progressLine = lineNumber;
+  progressSegmentStarted(25);
+}
+
+// Called when an INCLUDE returns: the default delay that ends the line
+void progressIncludeFinished() {
+  progressSegmentStarted(progressEstimate.defaultDelay);
+}
+
+// Estimated milliseconds of the run completed so far
+unsigned long progressCompletedMs() {
+  unsigned long inSegment = millis() - progressSegmentStart;
+  return progressDoneMs + ((inSegment < progressSegmentMs) ? inSegment : progressSegmentMs);
+}
+
+// Percent complete, 0-99 while running (0 if there is no estimate)
+int progressPercent() {
+  if (progressTotalMs == 0) {
+    return 0;
+  }
+  unsigned long long percent = (unsigned long long)progressCompletedMs() * 100 / progressTotalMs;
+  return (percent > 99) ? 99 : (int)percent;
+}
+
+// Print progress and ETA over serial
+void printProgress() {
+  Serial.print(F("Progress: "));
+  if (progressTotalMs == 0) {
+    Serial.print(F("iteration "));
+    Serial.print(currentRepeat + 1);
+    Serial.print(F(", line "));
+    Serial.print(progressLine);
+    Serial.println(F(" - repeating forever, no ETA"));
+    return;
+  }
+
+  unsigned long completed = progressCompletedMs();
+  unsigned long remaining = (completed < progressTotalMs) ? progressTotalMs - completed : 0;
+  Serial.print(progressPercent());
+  Serial.print(F("% (line "));
+  Serial.print(progressLine);
+  Serial.print(F(") - ETA "));
+  Serial.print(remaining / 1000.0, 1);
+  Serial.println(F(" s"));
+}
+
+// Blink the orange LED once per started quarter in each cycle
+void updateProgressLed(unsigned long now) {
+  int blinks = (progressTotalMs == 0) ? 1 : progressPercent() / 25 + 1;
+  unsigned long phase = (now - progressRunStart) % PROGRESS_LED_CYCLE_MS;
+  bool on = (phase < blinks * PROGRESS_LED_SPACING_MS) &&
+            (phase % PROGRESS_LED_SPACING_MS < PROGRESS_LED_BLINK_MS);
+  if (on != progressLedOn) {
+    progressLedOn = on;
+    digitalWrite(LED_USER, on ? LOW : HIGH); // LED on (LOW due to inverted logic)
+  }
+}
+
+// Publish progress; called from yield() throughout the run
+void progressTick() {
+  if (!progressActive) {
+    return;
+  }
+  unsigned long now = millis();
+  updateProgressLed(now);
+
+  if (config.progressInterval > 0 && now - progressLastReport >= config.progressInterval) {
+    progressLastReport = now;
+    printProgress();
+  }
+}
+
+// Stop tracking and report how the estimate compared with the run
+void endProgress() {
+  if (!progressActive) {
+    return;
+  }
+  progressActive = false;
+  progressLedOn = false;
+  digitalWrite(LED_USER, HIGH);
+
+  if (progressTotalMs > 0) {
+    Serial.print(F("Run time: "));
+    Serial.print((millis() - progressRunStart) / 1000.0, 1);
+    Serial.print(F(" seconds (estimated "));
+    Serial.print(progressTotalMs / 1000.0, 1);
+    Serial.println(F(" seconds)"));
+  }
+}
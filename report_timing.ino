@@ -0,0 +1,105 @@
+/*
+ * Report Timing - How Evenly Keys Reach the Host
+ *
+ * Every HID report is timestamped as it is sent (lib/hid-output.h) and the
+ * interval it ends goes into one of three histograms (lib/report-timing.h),
+ * by what the report was part of:
+ *   - typing: from one typed keystroke to the next (press to press) within
+ *     typed text; this is the cadence SPEED paces
+ *   - keys: from the previous report to a named key, a combination or a
+ *     release (ENTER, GUI r, CTRL ALT t, HOLD)
+ *   - delay: the first report after a DELAY or the default delay,
+ *     counted from the moment the delay should have ended. This is the
+ *     drift a wait adds: delay overshoot plus the time to the next report.
+ * Reports around a pause or an abort are not counted.
+ *
+ * The execution summary prints p50/p90/p99/max per context for the run so
+ * far, and the TIMING serial command prints the last run's figures while
+ * idle. Comparing them before and after a pacing change shows whether key
+ * timing became more consistent or only faster on average.
+ */
+
+#define REPORT_CONTEXT_TYPING 0
+#define REPORT_CONTEXT_KEYS 1
+#define REPORT_CONTEXT_DELAY 2
+#define REPORT_CONTEXT_COUNT 3
+
+const char *const REPORT_CONTEXT_NAMES[REPORT_CONTEXT_COUNT] = { "typing", "keys", "delay" };
+
+ReportHistogram reportTiming[REPORT_CONTEXT_COUNT];
+bool reportTimingHasLast = false;        // Whether reportTimingLast starts an interval
+unsigned long reportTimingLast = 0;      // micros() of the previous report
+bool reportTimingHasKeystroke = false;   // Typing in progress: reportTimingKeystroke is valid
+unsigned long reportTimingKeystroke = 0; // micros() of the previous typed keystroke
+bool reportTimingAfterDelay = false;     // The next report is the first after a delay
+unsigned long reportTimingDelayEnd = 0;  // micros() the delay should have ended at
+
+// Called by HidKeyboard after every report
+void reportTimingObserver(unsigned long sentMicros, uint8_t kind) {
+  bootTimingMark(BOOT_PHASE_FIRST_KEY);
+  if (enginePaused || engineAbortRequested) {
+    reportTimingHasLast = false;
+    reportTimingHasKeystroke = false;
+    reportTimingAfterDelay = false;
+    return;
+  }
+  if (reportTimingAfterDelay) {
+    long late = (long)(sentMicros - reportTimingDelayEnd);
+    reportHistogramAdd(reportTiming[REPORT_CONTEXT_DELAY], late > 0 ? late : 0);
+    reportTimingAfterDelay = false;
+  } else if (kind == HID_REPORT_KEYSTROKE && reportTimingHasKeystroke) {
+    reportHistogramAdd(reportTiming[REPORT_CONTEXT_TYPING], sentMicros - reportTimingKeystroke);
+  } else if (kind == HID_REPORT_KEYS && reportTimingHasLast) {
+    reportHistogramAdd(reportTiming[REPORT_CONTEXT_KEYS], sentMicros - reportTimingLast);
+  }
+  // The rest of a typed keystroke (its release) only moves the clocks
+  if (kind == HID_REPORT_KEYSTROKE) {
+    reportTimingKeystroke = sentMicros;
+    reportTimingHasKeystroke = true;
+  } else if (kind == HID_REPORT_KEYS) {
+    reportTimingHasKeystroke = false;
+  }
+  reportTimingLast = sentMicros;
+  reportTimingHasLast = true;
+}
+
+// Called by engineDelay() after a wait that was not cut short
+void reportTimingDelayEnded(unsigned long startMicros, unsigned long ms) {
+  if (ms == 0 || ms >= 3600000UL) {
+    return;
+  }
+  reportTimingDelayEnd = startMicros + ms * 1000UL;
+  reportTimingAfterDelay = true;
+}
+
+// Called by runScriptFile() when a run starts
+void beginReportTiming() {
+  for (uint8_t i = 0; i < REPORT_CONTEXT_COUNT; i++) {
+    reportHistogramClear(reportTiming[i]);
+  }
+  reportTimingHasLast = false;
+  reportTimingHasKeystroke = false;
+  reportTimingAfterDelay = false;
+  HidKeyboard.setObserver(reportTimingObserver);
+}
+
+// Print the histograms' percentiles, one line per context
+void printReportTiming() {
+  char line[80];
+  Serial.println(F("Report intervals:"));
+  Serial.println(F(REPORT_TIMING_COLUMNS));
+  for (uint8_t i = 0; i < REPORT_CONTEXT_COUNT; i++) {
+    reportHistogramFormat(line, sizeof(line), REPORT_CONTEXT_NAMES[i], reportTiming[i]);
+    Serial.println(line);
+  }
+#ifdef GHOSTKEY_REPORT_FIFO
+  // Intervals above are queue times; how far USB fell behind them
+  Serial.print(F("Report FIFO: deepest "));
+  Serial.print(hidReportFifo.highWater());
+  Serial.print(F(" of "));
+  Serial.print(REPORT_FIFO_DEPTH);
+  Serial.print(F(", "));
+  Serial.print(hidReportFifo.fullWaits());
+  Serial.println(F(" reports waited for a free slot"));
+#endif
+}
@@ -0,0 +1,103 @@
+/*
+ * Run History - One Performance Record Per Run
+ *
+ * Collects boot phase times, the compile cache result, typing throughput,
+ * delay drift and the run time while the firmware boots and runs, and
+ * appends them as a RunRecord (lib/run-history.h) to /history.log after
+ * every run. The log is preallocated once (lib/log-writer.h) and holds
+ * RUN_HISTORY_MAX_RECORDS runs; after that new runs are no longer recorded
+ * until the file is collected and deleted.
+ *
+ * Read the logs with tools/run_history.py.
+ */
+
+#define RUN_HISTORY_FILE "/history.log"
+#define RUN_HISTORY_MAX_RECORDS 512
+
+RunRecord runRecord;
+bool runHistoryBooted = false; // A run already happened since reset
+int runHistoryFirstRepeat = 0;
+
+// Copy a string into a fixed, NUL padded record field
+void historyText(char *field, size_t size, const String &text) {
+  memset(field, 0, size);
+  strncpy(field, text.c_str(), size - 1);
+}
+
+// Called by setup() once the SD card is mounted
+void historySdMounted(unsigned long mountMs, int attempts) {
+  runRecord.sdMountedMs = millis();
+  runRecord.sdMountMs = (mountMs > 0xFFFF) ? 0xFFFF : mountMs;
+  runRecord.sdAttempts = attempts;
+}
+
+// Called by setup() once config.txt has been read
+void historyConfigLoaded() {
+  runRecord.configLoadedMs = millis();
+}
+
+// Called when a run starts: clear the per-run counters
+void beginRunHistory(bool resuming) {
+  runRecord.runStartMs = millis();
+  runRecord.flags = (resuming ? RUN_FLAG_RESUMED : 0) | (runHistoryBooted ? RUN_FLAG_RERUN : 0);
+  runHistoryBooted = true;
+  runHistoryFirstRepeat = currentRepeat;
+
+  typingCharCount = 0;
+  typingMicrosSpent = 0;
+  engineDelayRequestedMs = 0;
+  engineDelayOvershootMs = 0;
+  engineDelayWorstOvershootMs = 0;
+}
+
+// Called when a run ends: complete the record and append it to the log
+void endRunHistory() {
+  if (!config.runHistory) {
+    return;
+  }
+
+  runRecord.version = RUN_HISTORY_VERSION;
+  runRecord.size = sizeof(RunRecord);
+  historyText(runRecord.firmware, sizeof(runRecord.firmware), FIRMWARE_VERSION);
+  const char buildStamp[] = __DATE__ " " __TIME__;
+  runRecord.buildId = crc32Update(0, (const uint8_t *)buildStamp, sizeof(buildStamp) - 1);
+  historyText(runRecord.cardModel, sizeof(runRecord.cardModel), config.cardModel);
+
+  runRecord.cacheResult = programPrepareResult;
+  runRecord.prepareMs = (programPrepareMs > 0xFFFF) ? 0xFFFF : programPrepareMs;
+  runRecord.compiledBlocks = programBuildCompiled;
+  runRecord.reusedBlocks = programBuildReused;
+  if (engineAbortRequested) {
+    runRecord.flags |= RUN_FLAG_ABORTED;
+  }
+  runRecord.layout = typingLayoutIndex;
+
+  runRecord.typedChars = typingCharCount;
+  runRecord.typingMs = typingMicrosSpent / 1000;
+  runRecord.delayRequestedMs = engineDelayRequestedMs;
+  runRecord.delayOvershootMs = engineDelayOvershootMs;
+  runRecord.delayWorstOvershootMs = (engineDelayWorstOvershootMs > 0xFFFF) ? 0xFFFF : engineDelayWorstOvershootMs;
+  runRecord.iterations = currentRepeat - runHistoryFirstRepeat;
+
+  runRecord.runMs = millis() - progressRunStart;
+  runRecord.estimatedMs = progressTotalMs;
+  runRecord.delayWorkMs = delayWorkMicros / 1000;
+
+  SdLogWriter history;
+  if (!history.begin(RUN_HISTORY_FILE, RUN_HISTORY_MAX_RECORDS * sizeof(RunRecord), true, sizeof(RunRecord))) {
+    Serial.println(F("Run history: cannot open " RUN_HISTORY_FILE));
+    return;
+  }
+  runRecord.sequence = history.length() / sizeof(RunRecord);
+  bool written = history.write((const uint8_t *)&runRecord, sizeof(runRecord)) == sizeof(runRecord);
+  history.close();
+
+  if (written) {
+    Serial.print(F("Run history: record "));
+    Serial.print(runRecord.sequence + 1);
+    Serial.print(F(" of "));
+    Serial.println(RUN_HISTORY_MAX_RECORDS);
+  } else {
+    Serial.println(F("Run history: " RUN_HISTORY_FILE " is full - collect and delete it"));
+  }
+}
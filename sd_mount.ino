@@ -0,0 +1,103 @@
+/*
+ * SD Mount - Bounded Card Bring-Up
+ *
+ * Runs the mount state machine in lib/sd-mount.h against the real bus:
+ * power-up clocks, a CMD0 probe per attempt, SD.begin() once the card
+ * answers idle, short exponential backoff between failed attempts and a
+ * bus reset after several in a row. setup() calls mountSDCard() once; the
+ * record is printed as one SD-MOUNT line and again with the BOOT serial
+ * command, next to the boot timing. The record itself (sdMount) lives in
+ * the main tab, which reports a failed mount.
+ */
+
+// Clock the card into SPI mode: 80 clocks with CS (and so the card) deselected
+void sdPowerUpClocks() {
+  pinMode(SD_CS_PIN, OUTPUT);
+  digitalWrite(SD_CS_PIN, HIGH);
+  SPI.beginTransaction(SPISettings(SD_MOUNT_INIT_HZ, MSBFIRST, SPI_MODE0));
+  for (uint8_t i = 0; i < SD_MOUNT_POWER_UP_BYTES; i++) {
+    SPI.transfer(0xFF);
+  }
+  SPI.endTransaction();
+}
+
+// Send CMD0 (GO_IDLE_STATE) and return the R1 response, SD_R1_NONE if none
+uint8_t sdProbeCmd0() {
+  static const uint8_t cmd0[6] = { 0x40, 0x00, 0x00, 0x00, 0x00, 0x95 }; // CRC is checked for CMD0
+  SPI.beginTransaction(SPISettings(SD_MOUNT_INIT_HZ, MSBFIRST, SPI_MODE0));
+  digitalWrite(SD_CS_PIN, LOW);
+  SPI.transfer(0xFF);
+  for (uint8_t i = 0; i < sizeof(cmd0); i++) {
+    SPI.transfer(cmd0[i]);
+  }
+  uint8_t r1 = SD_R1_NONE;
+  for (uint8_t i = 0; i < SD_MOUNT_R1_POLLS && (r1 & 0x80); i++) {
+    r1 = SPI.transfer(0xFF);
+  }
+  digitalWrite(SD_CS_PIN, HIGH);
+  SPI.transfer(0xFF); // Let the card release MISO
+  SPI.endTransaction();
+  return r1;
+}
+
+// One PROBE step: CMD0, then SD.begin() if the card is idle
+void sdMountAttempt() {
+  unsigned long attemptStart = millis();
+  unsigned long probeStart = micros();
+  uint8_t r1 = sdProbeCmd0();
+  unsigned long probeUs = micros() - probeStart;
+  unsigned long beginMs = 0;
+  uint8_t result;
+  if (r1 == SD_R1_NONE) {
+    result = SD_ATTEMPT_NO_RESPONSE;
+  } else if (r1 != SD_R1_IDLE) {
+    result = SD_ATTEMPT_BAD_RESPONSE;
+  } else {
+    unsigned long beginStart = millis();
+    result = SD.begin(SD_CS_PIN) ? SD_ATTEMPT_MOUNTED : SD_ATTEMPT_BEGIN_FAILED;
+    beginMs = millis() - beginStart;
+  }
+  sdMountAttempted(sdMount, millis(), attemptStart, probeUs, r1, beginMs, result);
+
+  if (result != SD_ATTEMPT_MOUNTED) {
+    Serial.print(F("SD attempt "));
+    Serial.print(sdMount.attempts);
+    Serial.print(F(" failed (CMD0 response 0x"));
+    Serial.print(r1, HEX);
+    Serial.println(F(")"));
+  }
+}
+
+// Mount the card within SD_MOUNT_BUDGET_MS; true once mounted
+bool mountSDCard() {
+  SPI.begin();
+  sdMountStart(sdMount, millis());
+  while (sdMount.step != SD_STEP_MOUNTED && sdMount.step != SD_STEP_FAILED) {
+    switch (sdMount.step) {
+      case SD_STEP_RESET:
+        SPI.end();
+        SPI.begin();
+        // A reset card needs its clocks again
+        // fall through
+      case SD_STEP_POWER_UP:
+        sdPowerUpClocks();
+        sdMountClocked(sdMount);
+        break;
+      case SD_STEP_PROBE:
+        sdMountAttempt();
+        break;
+      case SD_STEP_BACKOFF:
+        delay(sdMount.backoffMs);
+        sdMountBackedOff(sdMount);
+        break;
+    }
+  }
+  printSdMount();
+  return sdMount.step == SD_STEP_MOUNTED;
+}
+
+void printSdMount() {
+  char line[480];
+  sdMountFormat(line, sizeof(line), sdMount);
+  Serial.println(line);
+}
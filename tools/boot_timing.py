@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+"""
+Measure Ghostkey's reset-to-first-keystroke time over many boots.
+
+The firmware marks the end of every boot phase (lib/boot-timing.h) and
+prints the record as one line when the boot run ends:
+
+    BOOT-TIMING v1 setup=3 serial=1003 flash=1603 ... open=2410 first_key=2415
+
+This tool boots the firmware repeatedly, collects those lines and prints
+the distribution of each phase and of the total:
+
+    tools/boot_timing.py --port /dev/ttyACM0 -n 20     board over USB serial
+    tools/boot_timing.py --exec "./sim" -n 50          any program that prints
+                                                       the firmware's serial output
+    tools/boot_timing.py capture.txt                   lines already captured
+    tools/boot_timing.py --port COM5 --csv boots.csv   also export every boot
+
+With --port the board is reset with the REBOOT serial command, so it must
+be idle (autorun finished or off) when the tool starts. If the line printed
+at the end of the boot run is missed while the port reconnects, the tool
+asks for it again with BOOT once the board is idle. --port needs pyserial.
+
+With --exec the command is run once per boot and its standard output is
+searched for the line, e.g. a host build of the sketch against a simulated
+card.
+"""
+
+import argparse
+import csv
+import shlex
+import statistics
+import subprocess
+import sys
+import time
+
+LINE_PREFIX = "BOOT-TIMING "
+SUPPORTED_VERSIONS = (1,)
+
+# Phases in boot order (lib/boot-timing.h)
+PHASES = [
+    "setup", "serial", "flash", "keyboard", "sd_mount", "diagnostics", "listing",
+    "config", "initial_delay", "select", "prepare", "open", "first_key",
+]
+
+
+def parse_line(line):
+    """Return {phase: end ms or None} for a BOOT-TIMING line, or None."""
+    start = line.find(LINE_PREFIX)
+    if start < 0:
+        return None
+    fields = line[start + len(LINE_PREFIX):].split()
+    if not fields or fields[0][1:] not in [str(v) for v in SUPPORTED_VERSIONS]:
+        print("Skipping boot record with unknown version: %s" % line.strip(), file=sys.stderr)
+        return None
+    boot = dict.fromkeys(PHASES)
+    for field in fields[1:]:
+        name, _, value = field.partition("=")
+        if name in boot and value.isdigit():
+            boot[name] = int(value)
+    return boot
+
+
+def phase_durations(boot):
+    """Time each reached phase took: its end minus the end of the phase before."""
+    durations = {}
+    previous = 0
+    for phase in PHASES:
+        end = boot[phase]
+        if end is not None:
+            durations[phase] = end - previous
+            previous = end
+    return durations
+
+
+def boots_from_text(text):
+    return [b for b in (parse_line(line) for line in text.splitlines()) if b]
+
+
+def run_exec(command, timeout):
+    """Boot once by running command; return the boot record or None."""
+    try:
+        result = subprocess.run(shlex.split(command), stdout=subprocess.PIPE,
+                                stderr=subprocess.DEVNULL, timeout=timeout)
+    except subprocess.TimeoutExpired as error:
+        output = error.stdout or b""
+    else:
+        output = result.stdout
+    boots = boots_from_text(output.decode("utf-8", "replace"))
+    return boots[-1] if boots else None
+
+
+def open_port(serial, device, timeout):
+    """Open the board's port, waiting for it to come back after a reset."""
+    deadline = time.monotonic() + timeout
+    while True:
+        try:
+            return serial.Serial(device, 115200, timeout=0.2)
+        except serial.SerialException:
+            if time.monotonic() > deadline:
+                raise
+            time.sleep(0.2)
+
+
+def run_port(serial, device, timeout):
+    """Reset the board once; return the boot record or None."""
+    port = open_port(serial, device, timeout)
+    try:
+        port.reset_input_buffer()
+        port.write(b"REBOOT\n")
+        port.flush()
+        time.sleep(0.5)  # The board drops off the bus
+    except serial.SerialException:
+        pass
+    finally:
+        port.close()
+
+    deadline = time.monotonic() + timeout
+    port = open_port(serial, device, timeout)
+    try:
+        buffer = b""
+        last_ask = time.monotonic()
+        while time.monotonic() < deadline:
+            buffer += port.read(256)
+            *lines, buffer = buffer.split(b"\n")
+            for line in lines:
+                boot = parse_line(line.decode("utf-8", "replace"))
+                if boot:
+                    return boot
+            # Commands are only read once the boot run is over
+            if time.monotonic() - last_ask > 2.0:
+                port.write(b"BOOT\n")
+                last_ask = time.monotonic()
+    finally:
+        port.close()
+    return None
+
+
+def percentile(values, fraction):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(round(fraction * (len(ordered) - 1))))]
+
+
+def summarize(boots):
+    print("%-14s %5s %8s %8s %8s %8s %8s" % ("phase ms", "boots", "min", "p50", "p90", "max", "mean"))
+    rows = [(phase, [phase_durations(b)[phase] for b in boots if phase in phase_durations(b)])
+            for phase in PHASES]
+    rows.append(("total", [b["first_key"] for b in boots if b["first_key"] is not None]))
+    for name, values in rows:
+        if not values:
+            print("%-14s %5d %8s %8s %8s %8s %8s" % (name, 0, "-", "-", "-", "-", "-"))
+            continue
+        print("%-14s %5d %8d %8d %8d %8d %8.1f" % (
+            name, len(values), min(values), percentile(values, 0.5), percentile(values, 0.9),
+            max(values), statistics.mean(values)))
+    missing = sum(1 for b in boots if b["first_key"] is None)
+    if missing:
+        print("%d of %d boots sent no keystroke (autorun off or no payload)" % (missing, len(boots)))
+
+
+def write_csv(path, boots):
+    with open(path, "w", newline="") as f:
+        writer = csv.writer(f)
+        writer.writerow(["boot"] + PHASES)
+        for index, boot in enumerate(boots, 1):
+            writer.writerow([index] + ["" if boot[p] is None else boot[p] for p in PHASES])
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Measure Ghostkey boot-to-first-keystroke time.")
+    source = parser.add_mutually_exclusive_group()
+    source.add_argument("--port", metavar="DEV", help="reset the board on this serial port")
+    source.add_argument("--exec", metavar="CMD", dest="command",
+                        help="run this command per boot and read its output")
+    parser.add_argument("captures", nargs="*", help="text files with BOOT-TIMING lines")
+    parser.add_argument("-n", "--boots", type=int, default=10, help="boots to measure (default 10)")
+    parser.add_argument("--timeout", type=float, default=60.0,
+                        help="seconds to wait for one boot (default 60)")
+    parser.add_argument("--csv", metavar="FILE", help="also write every boot to a CSV file")
+    args = parser.parse_args()
+
+    boots = []
+    for path in args.captures:
+        try:
+            with open(path, encoding="utf-8", errors="replace") as f:
+                boots.extend(boots_from_text(f.read()))
+        except OSError as error:
+            sys.exit(str(error))
+
+    if args.port or args.command:
+        if args.port:
+            try:
+                import serial
+            except ImportError:
+                sys.exit("--port needs pyserial (pip install pyserial)")
+        for index in range(args.boots):
+            if args.port:
+                boot = run_port(serial, args.port, args.timeout)
+            else:
+                boot = run_exec(args.command, args.timeout)
+            if boot is None:
+                print("boot %d: no BOOT-TIMING line" % (index + 1), file=sys.stderr)
+                continue
+            print("boot %d: first keystroke at %s ms" % (
+                index + 1, "-" if boot["first_key"] is None else boot["first_key"]), file=sys.stderr)
+            boots.append(boot)
+    elif not args.captures:
+        parser.error("give --port, --exec or capture files")
+
+    if not boots:
+        sys.exit("No boots recorded")
+    summarize(boots)
+    if args.csv:
+        write_csv(args.csv, boots)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
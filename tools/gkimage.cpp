@@ -0,0 +1,1163 @@
+/*
+ * Ghostkey SD Image Builder
+ *
+ * Builds ready-to-write SD card images for a fleet of Ghostkey units, one
+ * image per card directory, several cards at a time on all cores:
+ *
+ *     c++ -std=c++17 -O2 -pthread -o gkimage tools/gkimage.cpp
+ *     ./gkimage -o images cards/unit01 cards/unit02
+ *     ./gkimage -j 8 --size 128 --shared common -o images cards/unit*
+ *     ./gkimage --check cards/unit*              validate only, no images
+ *
+ * A card directory holds the files of one card: config.txt, one or more
+ * payloads (payload.txt, ...) and any INCLUDE snippets in subdirectories.
+ * Files in the --shared directory go onto every card (a card's own file
+ * wins). For each card the tool
+ *   - validates it: file names (the firmware only sees 8.3 names),
+ *     config.txt (KEYBOARD_LAYOUT, UNICODE_INPUT, PAYLOAD_INDEX, the
+ *     script file) and every payload line (INCLUDEs and how deeply they
+ *     nest, SPEED and DELAY parameters, characters the layout cannot type)
+ *   - compiles every payload into its program cache (payload.gb0/.gm0,
+ *     format in lib/ducky-compiler.h) for the card's layout settings
+ *   - writes the payload catalog (catalog.idx, lib/payload-catalog.h) with
+ *     the compiled payloads flagged
+ *   - preallocates the run history log the first boot would otherwise
+ *     create (RUN_HISTORY)
+ * and lays it all out on a FAT16 partition with every file in consecutive
+ * clusters, payloads first. The first boot then finds the catalog, an up
+ * to date program and its files in place and goes straight to the run.
+ * Write an image with e.g. dd if=images/unit01.img of=/dev/sdX bs=4M.
+ *
+ * "+" combinations and HOLD/RELEASE of keys, and the typing steps of
+ * non-ASCII STRING text, are resolved with the Keyboard library's layout
+ * tables, which only exist in the Arduino build. The host compiler leaves
+ * those lines to the interpreter and the text as a plain STRING; the
+ * firmware resolves them at run time with the same result and runs the
+ * program as it is (only blocks edited later are recompiled on the card).
+ *
+ * Exit status: 0 if every card was built, 1 if any card has errors
+ * (--strict: or warnings), 2 on bad arguments.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lib/ducky-compiler.h"
+#include "../lib/run-history.h"
+#include "../lib/unicode-layouts.h"
+
+namespace fs = std::filesystem;
+
+// Same order as TYPING_LAYOUTS in lib/layout-utils.h (the index is part of
+// the program's typingId). ASCII tables are Arduino-only, see above.
+static const TypingLayout HOST_LAYOUTS[] = {
+  { "en_US", NULL, UNICODE_KEYS_en_US },
+  { "de_DE", NULL, UNICODE_KEYS_de_DE },
+  { "es_ES", NULL, UNICODE_KEYS_es_ES },
+  { "fr_FR", NULL, UNICODE_KEYS_fr_FR },
+  { "it_IT", NULL, UNICODE_KEYS_it_IT },
+  { "pt_PT", NULL, UNICODE_KEYS_pt_PT },
+  { "sv_SE", NULL, UNICODE_KEYS_sv_SE },
+  { "da_DK", NULL, UNICODE_KEYS_da_DK },
+  { "hu_HU", NULL, UNICODE_KEYS_hu_HU },
+};
+static const int HOST_LAYOUT_COUNT = sizeof(HOST_LAYOUTS) / sizeof(HOST_LAYOUTS[0]);
+
+// Run history log as run_history.ino and lib/log-writer.h create it
+static const char HISTORY_PATH[] = "/HISTORY.LOG";
+static const uint32_t HISTORY_RECORDS = 512; // RUN_HISTORY_MAX_RECORDS
+static const uint32_t HISTORY_RECORD_SIZE = sizeof(RunRecord);
+static const uint32_t LOG_SECTOR = 512;      // Header sector
+
+// FAT16 layout
+static const uint32_t SECTOR = 512;
+static const uint32_t PARTITION_START = 2048;  // 1 MB aligned, like SD Formatter
+static const uint32_t ROOT_ENTRIES = 512;
+static const uint32_t FAT16_MIN_CLUSTERS = 4085;
+static const uint32_t FAT16_MAX_CLUSTERS = 65524;
+
+struct CardFile {
+  std::string path;     // On the card: "/DIR/NAME.EXT", upper case
+  std::string source;   // Where it came from, for messages
+  std::string leaf;     // File name in its original case (FAT case bits)
+  std::vector<uint8_t> data;
+  uint32_t cluster = 0; // First cluster once placed
+};
+
+struct Card {
+  std::string name;
+  fs::path dir;
+  std::map<std::string, CardFile> files; // By path
+  std::vector<std::string> log;
+  int errors = 0;
+  int warnings = 0;
+
+  // config.txt, parsed the way readConfigFile() does
+  int scriptMode = 1;
+  std::string duckyScriptFile = "/payload.txt";
+  std::string customScriptFile = "/instructions.txt";
+  int payloadIndex = 0;
+  bool compileCache = true;
+  bool runHistory = true;
+  uint8_t layout = 0;
+  uint8_t unicodeInput = UNICODE_INPUT_NONE;
+
+  // Results
+  int payloads = 0;
+  int compiled = 0;
+  uint32_t blocks = 0;
+  uint32_t functions = 0;
+  uint32_t usedClusters = 0;
+  uint32_t totalClusters = 0;
+
+  void error(const std::string &text) {
+    log.push_back("  error: " + text);
+    errors++;
+  }
+  void warning(const std::string &text) {
+    log.push_back("  warning: " + text);
+    warnings++;
+  }
+  void note(const std::string &text) {
+    log.push_back("  " + text);
+  }
+};
+
+struct Options {
+  fs::path outputDir = ".";
+  fs::path sharedDir;
+  uint32_t sizeMb = 64;
+  unsigned jobs = 0;
+  bool check = false;
+  bool strict = false;
+};
+
+// ---- Helpers ----
+
+static std::string upper(std::string text) {
+  for (char &c : text) {
+    c = toupper((unsigned char)c);
+  }
+  return text;
+}
+
+static bool equalsIgnoreCase(const std::string &a, const char *b) {
+  return upper(a) == upper(b);
+}
+
+// Arduino String::trim()
+static std::string trim(const std::string &text) {
+  size_t start = 0;
+  size_t end = text.size();
+  while (start < end && isspace((unsigned char)text[start])) {
+    start++;
+  }
+  while (end > start && isspace((unsigned char)text[end - 1])) {
+    end--;
+  }
+  return text.substr(start, end - start);
+}
+
+static bool endsWith(const std::string &text, const std::string &suffix) {
+  return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+template <typename T>
+static void append(std::vector<uint8_t> &out, const T &value) {
+  const uint8_t *bytes = (const uint8_t *)&value;
+  out.insert(out.end(), bytes, bytes + sizeof(T));
+}
+
+template <typename T>
+static void put(std::vector<uint8_t> &out, size_t offset, const T &value) {
+  memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+static void put16(uint8_t *p, uint16_t value) {
+  p[0] = value & 0xFF;
+  p[1] = value >> 8;
+}
+
+static void put32(uint8_t *p, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    p[i] = (value >> (8 * i)) & 0xFF;
+  }
+}
+
+// FAT short name of one path component (11 bytes, space padded). False if
+// it is not a valid 8.3 name; caseFlags gets the lower case bits.
+static bool shortName(const std::string &name, char out[11], uint8_t &caseFlags) {
+  static const char allowed[] = "$%'-_@~`!(){}^#&";
+  size_t dot = name.find('.');
+  std::string base = name.substr(0, dot);
+  std::string ext = (dot == std::string::npos) ? "" : name.substr(dot + 1);
+  if (base.empty() || base.size() > 8 || ext.size() > 3 || ext.find('.') != std::string::npos ||
+      (dot != std::string::npos && ext.empty())) {
+    return false;
+  }
+  caseFlags = 0;
+  const std::string parts[2] = { base, ext };
+  for (int part = 0; part < 2; part++) {
+    bool lower = false;
+    bool upperCase = false;
+    for (char c : parts[part]) {
+      if (!isalnum((unsigned char)c) && strchr(allowed, c) == NULL) {
+        return false;
+      }
+      lower = lower || islower((unsigned char)c);
+      upperCase = upperCase || isupper((unsigned char)c);
+    }
+    if (lower && !upperCase) {
+      caseFlags |= (part == 0) ? 0x08 : 0x10;
+    }
+  }
+  memset(out, ' ', 11);
+  std::string upperBase = upper(base);
+  std::string upperExt = upper(ext);
+  memcpy(out, upperBase.data(), upperBase.size());
+  memcpy(out + 8, upperExt.data(), upperExt.size());
+  return true;
+}
+
+static std::string parentPath(const std::string &path) {
+  size_t slash = path.rfind('/');
+  return (slash == 0) ? "/" : path.substr(0, slash);
+}
+
+static std::string baseName(const std::string &path) {
+  return path.substr(path.rfind('/') + 1);
+}
+
+// Files the firmware or this tool generate; stale copies are not taken over
+static bool isGeneratedFile(const std::string &path) {
+  static const char *suffixes[] = { ".GB0", ".GB1", ".GM0", ".GM1", ".PROF.TXT" };
+  if (path == upper(CATALOG_FILE) || path == HISTORY_PATH) {
+    return true;
+  }
+  for (const char *suffix : suffixes) {
+    if (endsWith(path, suffix)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// ---- Loading a card ----
+
+static bool readFile(const fs::path &path, std::vector<uint8_t> &data) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) {
+    return false;
+  }
+  data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  return true;
+}
+
+// Add the files under root; existing paths are kept unless replace is set
+static void loadTree(Card &card, const fs::path &root, bool replace) {
+  std::error_code ec;
+  for (auto it = fs::recursive_directory_iterator(root, ec); !ec && it != fs::recursive_directory_iterator();
+       it.increment(ec)) {
+    std::string relative = fs::relative(it->path(), root).generic_string();
+    std::string leaf = it->path().filename().string();
+    if (leaf[0] == '.') {
+      if (it->is_directory()) {
+        it.disable_recursion_pending();
+      }
+      continue;
+    }
+    if (it->is_directory()) {
+      continue;
+    }
+
+    std::string cardPath;
+    uint8_t caseFlags = 0;
+    bool valid = true;
+    for (const auto &component : fs::path(relative)) {
+      char name83[11];
+      valid = valid && shortName(component.string(), name83, caseFlags);
+      cardPath += "/" + upper(component.string());
+    }
+    if (!valid) {
+      card.error(relative + ": not an 8.3 name, the firmware cannot open it");
+      continue;
+    }
+    if (isGeneratedFile(cardPath)) {
+      card.note(relative + ": generated for the image, the copy in the card directory is not used");
+      continue;
+    }
+    if (!replace && card.files.count(cardPath)) {
+      continue;
+    }
+
+    CardFile file;
+    file.path = cardPath;
+    file.source = relative;
+    file.leaf = leaf;
+    if (!readFile(it->path(), file.data)) {
+      card.error(relative + ": cannot read");
+      continue;
+    }
+    card.files[cardPath] = std::move(file);
+  }
+  if (ec) {
+    card.error(root.string() + ": " + ec.message());
+  }
+}
+
+static CardFile *findFile(Card &card, const std::string &path) {
+  auto it = card.files.find(upper(path));
+  return (it == card.files.end()) ? NULL : &it->second;
+}
+
+static void parseConfig(Card &card) {
+  CardFile *config = findFile(card, "/config.txt");
+  if (config == NULL) {
+    card.warning("no config.txt, the firmware defaults apply");
+    return;
+  }
+
+  std::string text(config->data.begin(), config->data.end());
+  size_t start = 0;
+  int lineNumber = 0;
+  while (start < text.size()) {
+    size_t end = text.find('\n', start);
+    if (end == std::string::npos) {
+      end = text.size();
+    }
+    std::string line = trim(text.substr(start, end - start));
+    start = end + 1;
+    lineNumber++;
+    if (line.empty() || line[0] == '#' || line.compare(0, 2, "//") == 0) {
+      continue;
+    }
+    size_t separator = line.find('=');
+    if (separator == std::string::npos) {
+      card.warning("config.txt:" + std::to_string(lineNumber) + ": no '=', line ignored");
+      continue;
+    }
+    std::string key = trim(line.substr(0, separator));
+    std::string value = trim(line.substr(separator + 1));
+    bool off = equalsIgnoreCase(value, "false") || value == "0" || equalsIgnoreCase(value, "no");
+
+    if (equalsIgnoreCase(key, "SCRIPT_MODE")) {
+      card.scriptMode = atoi(value.c_str());
+    } else if (equalsIgnoreCase(key, "DUCKY_SCRIPT_FILE")) {
+      card.duckyScriptFile = (value.compare(0, 1, "/") == 0) ? value : "/" + value;
+    } else if (equalsIgnoreCase(key, "CUSTOM_SCRIPT_FILE")) {
+      card.customScriptFile = (value.compare(0, 1, "/") == 0) ? value : "/" + value;
+    } else if (equalsIgnoreCase(key, "PAYLOAD_INDEX")) {
+      card.payloadIndex = atoi(value.c_str());
+    } else if (equalsIgnoreCase(key, "COMPILE_CACHE")) {
+      card.compileCache = !off;
+    } else if (equalsIgnoreCase(key, "RUN_HISTORY")) {
+      card.runHistory = !off;
+    } else if (equalsIgnoreCase(key, "KEYBOARD_LAYOUT")) {
+      int found = -1;
+      for (int i = 0; i < HOST_LAYOUT_COUNT; i++) {
+        if (equalsIgnoreCase(value, HOST_LAYOUTS[i].name)) {
+          found = i;
+        }
+      }
+      if (found < 0) {
+        card.error("config.txt:" + std::to_string(lineNumber) + ": unknown KEYBOARD_LAYOUT " + value);
+      } else {
+        card.layout = found;
+      }
+    } else if (equalsIgnoreCase(key, "UNICODE_INPUT")) {
+      if (equalsIgnoreCase(value, "linux")) {
+        card.unicodeInput = UNICODE_INPUT_LINUX;
+      } else if (equalsIgnoreCase(value, "windows")) {
+        card.unicodeInput = UNICODE_INPUT_WINDOWS;
+      } else if (equalsIgnoreCase(value, "mac")) {
+        card.unicodeInput = UNICODE_INPUT_MAC;
+      } else {
+        if (!equalsIgnoreCase(value, "none")) {
+          card.warning("config.txt:" + std::to_string(lineNumber) + ": unknown UNICODE_INPUT " + value +
+                       ", none is used");
+        }
+        card.unicodeInput = UNICODE_INPUT_NONE;
+      }
+    }
+  }
+}
+
+// ---- Compiling ----
+
+struct ProgramBuild {
+  Card *card;
+  std::string sourceName;
+  std::vector<uint8_t> code;
+  std::vector<std::string> functionPaths; // As INCLUDEd, in link order
+  std::vector<std::vector<int>> calls;     // Functions each function calls; [0] is the payload
+};
+
+static std::string lineLocation(const std::string &file, uint32_t line) {
+  return file + ":" + std::to_string(line);
+}
+
+// Link a snippet once; returns its index or -1 if it cannot be linked
+static int registerInclude(ProgramBuild &build, const std::string &path, const std::string &where) {
+  for (size_t i = 0; i < build.functionPaths.size(); i++) {
+    if (upper(build.functionPaths[i]) == upper(path)) {
+      return (int)i;
+    }
+  }
+  if (build.functionPaths.size() >= PROGRAM_MAX_FUNCTIONS || path.size() >= PROGRAM_PATH_LENGTH) {
+    build.card->warning(where + ": cannot link INCLUDE " + path + " (more than " +
+                        std::to_string(PROGRAM_MAX_FUNCTIONS) + " snippets or path too long), skipped at run time");
+    return -1;
+  }
+  build.functionPaths.push_back(path);
+  build.calls.push_back(std::vector<int>());
+  return (int)build.functionPaths.size() - 1;
+}
+
+// Warnings for a compiled line the firmware would take without complaint
+// but skip or misread at run time
+static void checkLine(ProgramBuild &build, const CompiledLine &compiled, const std::string &where) {
+  Card &card = *build.card;
+  if (compiled.opcode == OP_LINE && compiled.textLength >= 5 && memcmp(compiled.text, "SPEED", 5) == 0 &&
+      (compiled.textLength == 5 || compiled.text[5] == ' ')) {
+    card.warning(where + ": invalid SPEED parameters, the line is ignored");
+  }
+  if ((compiled.opcode == OP_DELAY || compiled.opcode == OP_DEFAULT_DELAY) && compiled.value == 0) {
+    card.warning(where + ": delay of 0 ms (missing or non-numeric parameter?)");
+  }
+  if ((compiled.opcode == OP_STRING || compiled.opcode == OP_STRINGLN) &&
+      programNeedsTyping(compiled.text, compiled.textLength)) {
+    const TypingLayout &layout = HOST_LAYOUTS[card.layout];
+    int untypable = 0;
+    bool malformed = false;
+    for (size_t i = 0; i < compiled.textLength;) {
+      uint32_t codepoint = utf8Next(compiled.text, compiled.textLength, i);
+      if (codepoint == 0xFFFD) {
+        malformed = true;
+      } else if (codepoint >= 0x80 && card.unicodeInput == UNICODE_INPUT_NONE &&
+                 findUnicodeKey(layout, codepoint) == NULL) {
+        untypable++;
+      }
+    }
+    if (malformed) {
+      card.warning(where + ": text is not valid UTF-8");
+    }
+    if (untypable > 0) {
+      card.warning(where + ": " + std::to_string(untypable) + " character(s) cannot be typed on layout " +
+                   layout.name + " (set UNICODE_INPUT to type them)");
+    }
+  }
+}
+
+// Append the op for one line, like writeCompiledLine() in program_cache.ino;
+// false if the line cannot be compiled
+static bool writeLine(ProgramBuild &build, int function, const CompiledLine &compiled, uint8_t line,
+                      uint32_t srcEnd, const std::string &where) {
+  checkLine(build, compiled, where);
+  ProgramOp op;
+  op.opcode = compiled.opcode;
+  op.line = line;
+  op.srcEnd = srcEnd;
+
+  if (compiled.opcode == OP_CALL) {
+    std::string path = trim(std::string(compiled.text, compiled.textLength));
+    if (path.compare(0, 1, "/") != 0) {
+      path = "/" + path;
+    }
+    int callee = registerInclude(build, path, where);
+    if (callee >= 0) {
+      build.calls[function].push_back(callee + 1);
+    }
+    op.length = path.size();
+    append(build.code, op);
+    build.code.insert(build.code.end(), path.begin(), path.end());
+    return true;
+  }
+
+  if (compiled.textLength > 0xFFFF) {
+    build.card->error(where + ": line longer than 64 KB");
+    return false;
+  }
+  op.length = compiledOperandLength(compiled);
+  append(build.code, op);
+  const uint8_t *operand = compiledOperand(compiled);
+  build.code.insert(build.code.end(), operand, operand + op.length);
+  return true;
+}
+
+// Compile the lines of data[start, end); line numbers start after firstLine
+static bool compileLines(ProgramBuild &build, int function, const std::vector<uint8_t> &data, size_t start,
+                         size_t end, uint32_t firstLine, bool inBlock, const std::string &file) {
+  uint8_t lineIndex = 0;
+  size_t position = start;
+  while (position < end) {
+    size_t lineEnd = position;
+    while (lineEnd < end && data[lineEnd] != '\n') {
+      lineEnd++;
+    }
+    std::string line(data.begin() + position, data.begin() + lineEnd);
+    position = (lineEnd < end) ? lineEnd + 1 : lineEnd;
+
+    CompiledLine compiled;
+    compileDuckyLine(line.c_str(), line.size(), compiled, NULL);
+    std::string where = lineLocation(file, firstLine + lineIndex + 1);
+    if (compiled.opcode != 0 &&
+        !writeLine(build, function, compiled, inBlock ? lineIndex : 0, inBlock ? position - start : 0, where)) {
+      return false;
+    }
+    lineIndex++;
+  }
+  return true;
+}
+
+// Deepest INCLUDE nesting below function (cycles count as too deep)
+static int includeDepth(const ProgramBuild &build, int function, std::vector<int> &state) {
+  if (state[function] == 1) {
+    return PROGRAM_MAX_CALL_DEPTH + 1; // Includes itself
+  }
+  state[function] = 1;
+  int deepest = 0;
+  for (int callee : build.calls[function]) {
+    deepest = std::max(deepest, 1 + includeDepth(build, callee, state));
+  }
+  state[function] = 0;
+  return deepest;
+}
+
+// Build the program files of one payload as buildProgram() would on its
+// first boot: slot 0, generation 1
+static bool compilePayload(Card &card, const CardFile &source) {
+  ProgramBuild build;
+  build.card = &card;
+  build.sourceName = source.source;
+  build.calls.push_back(std::vector<int>()); // The payload itself
+
+  ProgramMapHeader header;
+  programInitMapHeader(header);
+  header.typingId = ((uint16_t)card.layout << 8) | card.unicodeInput;
+  header.generation = 1;
+  header.rangeOffset = 0;
+  header.rangeLength = source.data.size();
+
+  ProgramCodeHeader codeHeader;
+  programInitCodeHeader(codeHeader, header.generation);
+  append(build.code, codeHeader);
+
+  std::vector<uint8_t> blockMap;
+  ProgramBlockScanner scanner;
+  programScannerInit(scanner);
+  bool ok = true;
+  for (size_t i = 0; ok && i <= source.data.size(); i++) {
+    bool blockDone = (i < source.data.size()) ? programScannerFeed(scanner, source.data[i])
+                                              : programScannerFinish(scanner);
+    if (!blockDone) {
+      continue;
+    }
+    ProgramBlock block = scanner.block;
+    ProgramBlockMarker marker = { block.srcOffset, block.firstLine };
+    ProgramOp markerOp = { OP_BLOCK, 0, sizeof(marker), 0 };
+    append(build.code, markerOp);
+    append(build.code, marker);
+    block.codeOffset = build.code.size();
+    ok = compileLines(build, 0, source.data, block.srcOffset, block.srcOffset + block.srcLength,
+                      block.firstLine, true, source.source);
+    block.codeLength = build.code.size() - block.codeOffset;
+    append(blockMap, block);
+    header.blockCount++;
+    programScannerStartBlock(scanner);
+  }
+  if (!ok) {
+    return false;
+  }
+
+  // Link the INCLUDEd snippets (ones they include are linked on the way)
+  codeHeader.blocksEnd = build.code.size();
+  std::vector<ProgramFunction> functions;
+  for (size_t i = 0; i < build.functionPaths.size(); i++) {
+    ProgramFunction function;
+    memset(&function, 0, sizeof(function));
+    strncpy(function.path, build.functionPaths[i].c_str(), PROGRAM_PATH_LENGTH - 1);
+    function.codeOffset = build.code.size();
+    CardFile *snippet = findFile(card, build.functionPaths[i]);
+    if (snippet != NULL) {
+      function.srcSize = snippet->data.size();
+      function.srcCrc = crc32Update(0, snippet->data.data(), snippet->data.size());
+      if (!compileLines(build, i + 1, snippet->data, 0, snippet->data.size(), 0, false, snippet->source)) {
+        return false;
+      }
+    } else {
+      function.flags |= PROGRAM_FUNCTION_MISSING;
+      card.warning(source.source + ": INCLUDE file not found: " + build.functionPaths[i]);
+    }
+    ProgramOp returnOp = { OP_RETURN, 0, 0, 0 };
+    append(build.code, returnOp);
+    functions.push_back(function);
+  }
+  codeHeader.functionTable = build.code.size();
+  codeHeader.functionCount = functions.size();
+  for (const ProgramFunction &function : functions) {
+    append(build.code, function);
+  }
+  put(build.code, 0, codeHeader);
+
+  std::vector<int> state(build.calls.size(), 0);
+  if (includeDepth(build, 0, state) > PROGRAM_MAX_CALL_DEPTH) {
+    card.warning(source.source + ": INCLUDEs nest more than " + std::to_string(PROGRAM_MAX_CALL_DEPTH) +
+                 " levels deep (or include themselves); the deepest ones are skipped at run time");
+  }
+
+  header.lineCount = scanner.lineCount;
+  header.codeSize = build.code.size();
+  header.codeCrc = crc32Update(0, build.code.data(), build.code.size());
+  std::vector<uint8_t> map;
+  append(map, header);
+  map.insert(map.end(), blockMap.begin(), blockMap.end());
+
+  // programFileName(): next to the payload, .gb0 / .gm0
+  std::string base = source.path;
+  size_t dot = base.rfind('.');
+  if (dot != std::string::npos && dot > base.rfind('/')) {
+    base = base.substr(0, dot);
+  }
+  CardFile codeFile;
+  codeFile.path = base + ".GB0";
+  codeFile.source = "(program of " + source.source + ")";
+  codeFile.data = std::move(build.code);
+  CardFile mapFile = codeFile;
+  mapFile.path = base + ".GM0";
+  // Same case as the payload's name, like programFileName() on the card
+  std::string leafBase = source.leaf.substr(0, source.leaf.rfind('.'));
+  bool lower = std::any_of(leafBase.begin(), leafBase.end(), [](char c) { return islower((unsigned char)c); });
+  codeFile.leaf = leafBase + (lower ? ".gb0" : ".GB0");
+  mapFile.leaf = leafBase + (lower ? ".gm0" : ".GM0");
+  mapFile.data = std::move(map);
+  card.files[codeFile.path] = std::move(codeFile);
+  card.files[mapFile.path] = std::move(mapFile);
+
+  card.compiled++;
+  card.blocks += header.blockCount;
+  card.functions += functions.size();
+  return true;
+}
+
+// ---- Catalog and preallocated files ----
+
+// catalogTestPriority() in payload_catalog.ino
+static int testPriority(const std::string &name) {
+  if (name == "TEST-LAYOUT.TXT") return 0;
+  if (name == "KEY-COMBO-TEST.TXT") return 1;
+  if (name == "SHIFT-KEY-TEST.TXT") return 2;
+  return -1;
+}
+
+// Root payloads in directory order, as buildPayloadCatalog() would list them
+static std::vector<CardFile *> catalogPayloads(Card &card) {
+  std::vector<CardFile *> payloads;
+  for (auto &entry : card.files) {
+    CardFile &file = entry.second;
+    if (parentPath(file.path) != "/" || !endsWith(file.path, ".TXT") || file.path == "/CONFIG.TXT" ||
+        endsWith(file.path, ".PROF.TXT")) {
+      continue;
+    }
+    if (payloads.size() == CATALOG_MAX_ENTRIES) {
+      card.warning(file.source + ": more than " + std::to_string(CATALOG_MAX_ENTRIES) +
+                   " payloads, not in the catalog");
+      continue;
+    }
+    payloads.push_back(&file);
+  }
+  return payloads;
+}
+
+static void writeCatalog(Card &card, const std::vector<CardFile *> &payloads) {
+  CatalogHeader header;
+  catalogInitHeader(header);
+  std::vector<uint8_t> data;
+  append(data, header);
+  int bestPriority = 99;
+  for (CardFile *payload : payloads) {
+    CatalogEntry entry;
+    memset(&entry, 0, sizeof(entry));
+    strncpy(entry.name, payload->path.c_str(), CATALOG_NAME_LENGTH - 1);
+    entry.offset = 0;
+    entry.size = payload->data.size();
+    entry.crc = crc32Update(0, payload->data.data(), payload->data.size());
+    std::string base = payload->path.substr(0, payload->path.rfind('.'));
+    if (card.files.count(base + ".GM0")) {
+      entry.flags |= CATALOG_FLAG_COMPILED;
+    }
+    int priority = testPriority(baseName(payload->path));
+    if (priority >= 0) {
+      entry.flags |= CATALOG_FLAG_TEST;
+      if (priority < bestPriority) {
+        bestPriority = priority;
+        header.testEntry = header.entryCount;
+      }
+    }
+    append(data, entry);
+    header.entryCount++;
+  }
+  put(data, 0, header);
+
+  CardFile catalog;
+  catalog.path = "/CATALOG.IDX";
+  catalog.source = "(catalog)";
+  catalog.leaf = "catalog.idx";
+  catalog.data = std::move(data);
+  card.files[catalog.path] = std::move(catalog);
+}
+
+// Preallocated like SdLogWriter does it (lib/log-writer.h): LogFileHeader
+// (magic, version, recordSize, capacity, length, closeCount) in the first
+// sector, then the zeroed records
+static void writeHistoryLog(Card &card) {
+  if (!card.runHistory) {
+    return;
+  }
+  CardFile history;
+  history.path = HISTORY_PATH;
+  history.source = "(run history)";
+  history.leaf = "history.log";
+  history.data.assign(LOG_SECTOR + HISTORY_RECORDS * HISTORY_RECORD_SIZE, 0);
+  memcpy(history.data.data(), "GKLG", 4);
+  put16(history.data.data() + 4, 1);
+  put16(history.data.data() + 6, HISTORY_RECORD_SIZE);
+  put32(history.data.data() + 8, HISTORY_RECORDS * HISTORY_RECORD_SIZE);
+  card.files[history.path] = std::move(history);
+}
+
+// ---- FAT16 image ----
+
+struct FatLayout {
+  uint32_t diskSectors;
+  uint32_t partitionSectors;
+  uint8_t sectorsPerCluster;
+  uint16_t reservedSectors;
+  uint16_t fatSectors;
+  uint32_t rootSectors;
+  uint32_t dataStart;     // Partition-relative sector of cluster 2
+  uint32_t clusterCount;
+};
+
+static bool planFat(uint32_t diskSectors, FatLayout &layout) {
+  layout.diskSectors = diskSectors;
+  layout.partitionSectors = diskSectors - PARTITION_START;
+  layout.rootSectors = ROOT_ENTRIES * 32 / SECTOR;
+  for (uint32_t spc = 1; spc <= 64; spc *= 2) {
+    uint32_t estimate = (layout.partitionSectors - 1 - layout.rootSectors) / spc;
+    uint32_t fatSectors = ((estimate + 2) * 2 + SECTOR - 1) / SECTOR;
+    // Pad the reserved area so clusters line up with the card's erase blocks
+    uint32_t reserved = 1;
+    while ((PARTITION_START + reserved + 2 * fatSectors + layout.rootSectors) % spc != 0) {
+      reserved++;
+    }
+    uint32_t dataStart = reserved + 2 * fatSectors + layout.rootSectors;
+    uint32_t clusters = (layout.partitionSectors - dataStart) / spc;
+    if (clusters >= FAT16_MIN_CLUSTERS && clusters <= FAT16_MAX_CLUSTERS) {
+      layout.sectorsPerCluster = spc;
+      layout.reservedSectors = reserved;
+      layout.fatSectors = fatSectors;
+      layout.dataStart = dataStart;
+      layout.clusterCount = clusters;
+      return true;
+    }
+  }
+  return false;
+}
+
+struct DirEntryRef {
+  std::string name;    // Component name as given (for the 8.3 name and case bits)
+  bool directory;
+  CardFile *file;      // For files
+  std::string path;    // For directories
+};
+
+static void writeDirEntry(uint8_t *p, const std::string &name, uint8_t attributes, uint32_t cluster,
+                          uint32_t size, uint16_t fatTime, uint16_t fatDate) {
+  char name83[11];
+  uint8_t caseFlags = 0;
+  if (name == "." || name == "..") {
+    memset(name83, ' ', 11);
+    memcpy(name83, name.data(), name.size());
+  } else {
+    shortName(name, name83, caseFlags);
+  }
+  memset(p, 0, 32);
+  memcpy(p, name83, 11);
+  p[11] = attributes;
+  p[12] = caseFlags;
+  put16(p + 14, fatTime);
+  put16(p + 16, fatDate);
+  put16(p + 18, fatDate);
+  put16(p + 22, fatTime);
+  put16(p + 24, fatDate);
+  put16(p + 26, cluster);
+  put32(p + 28, size);
+}
+
+static bool writeImage(Card &card, const fs::path &imagePath, uint32_t sizeMb) {
+  FatLayout layout;
+  if (!planFat(sizeMb * 2048, layout)) {
+    card.error("no FAT16 layout for " + std::to_string(sizeMb) + " MB");
+    return false;
+  }
+  uint32_t clusterBytes = layout.sectorsPerCluster * SECTOR;
+
+  // Directory tree; names keep their original case for the case bits.
+  // Directories only come from files loaded from the card directory.
+  std::map<std::string, std::vector<DirEntryRef>> dirs;
+  dirs["/"];
+  for (auto &entry : card.files) {
+    CardFile &file = entry.second;
+    if (file.source[0] == '(') {
+      continue; // Generated; its directory comes from its payload
+    }
+    std::string parent = parentPath(file.path);
+    fs::path sourceDir = fs::path(file.source).parent_path();
+    while (parent != "/" && !dirs.count(parent)) {
+      dirs[parent];
+      dirs[parentPath(parent)].push_back({ sourceDir.filename().string(), true, NULL, parent });
+      parent = parentPath(parent);
+      sourceDir = sourceDir.parent_path();
+    }
+  }
+  for (auto &entry : card.files) {
+    dirs[parentPath(entry.first)].push_back({ entry.second.leaf, false, &entry.second, "" });
+  }
+  if (dirs["/"].size() + 1 > ROOT_ENTRIES) {
+    card.error("more than " + std::to_string(ROOT_ENTRIES - 1) + " files in the root directory");
+    return false;
+  }
+
+  // Place files in consecutive clusters: payloads, their programs, the
+  // catalog and config, then everything else, logs last
+  std::vector<CardFile *> order;
+  for (auto &entry : card.files) {
+    order.push_back(&entry.second);
+  }
+  auto rank = [](const CardFile *file) {
+    if (endsWith(file->path, ".TXT") && parentPath(file->path) == "/" && file->path != "/CONFIG.TXT") return 0;
+    if (endsWith(file->path, ".GB0") || endsWith(file->path, ".GM0")) return 1;
+    if (file->path == "/CATALOG.IDX" || file->path == "/CONFIG.TXT") return 2;
+    if (file->path == HISTORY_PATH) return 4;
+    return 3;
+  };
+  std::stable_sort(order.begin(), order.end(),
+                   [&](const CardFile *a, const CardFile *b) { return rank(a) < rank(b); });
+
+  std::vector<uint16_t> fat(layout.clusterCount + 2, 0);
+  fat[0] = 0xFFF8;
+  fat[1] = 0xFFFF;
+  uint32_t nextCluster = 2;
+  auto allocate = [&](uint32_t bytes, uint32_t &first) {
+    uint32_t count = (bytes + clusterBytes - 1) / clusterBytes;
+    first = 0;
+    if (count == 0) {
+      return true;
+    }
+    if (nextCluster + count > layout.clusterCount + 2) {
+      return false;
+    }
+    first = nextCluster;
+    for (uint32_t i = 0; i < count; i++) {
+      fat[nextCluster + i] = (i + 1 == count) ? 0xFFFF : nextCluster + i + 1;
+    }
+    nextCluster += count;
+    return true;
+  };
+
+  for (CardFile *file : order) {
+    if (!allocate(file->data.size(), file->cluster)) {
+      card.error("files do not fit into " + std::to_string(sizeMb) + " MB (use --size)");
+      return false;
+    }
+  }
+  std::map<std::string, uint32_t> dirClusters;
+  for (auto &dir : dirs) {
+    if (dir.first != "/" && !allocate((dir.second.size() + 3) * 32, dirClusters[dir.first])) {
+      card.error("directories do not fit into " + std::to_string(sizeMb) + " MB (use --size)");
+      return false;
+    }
+  }
+  card.usedClusters = nextCluster - 2;
+  card.totalClusters = layout.clusterCount;
+
+  // Write the image (sparse: only metadata and file data are written)
+  std::error_code ec;
+  fs::remove(imagePath, ec);
+  {
+    std::ofstream create(imagePath, std::ios::binary);
+    if (!create) {
+      card.error("cannot create " + imagePath.string());
+      return false;
+    }
+  }
+  fs::resize_file(imagePath, (uint64_t)layout.diskSectors * SECTOR, ec);
+  std::fstream out(imagePath, std::ios::binary | std::ios::in | std::ios::out);
+  if (ec || !out) {
+    card.error("cannot size " + imagePath.string());
+    return false;
+  }
+  auto writeAt = [&](uint64_t sector, const void *data, size_t length) {
+    out.seekp(sector * SECTOR);
+    out.write((const char *)data, length);
+  };
+  uint64_t partition = PARTITION_START;
+  uint64_t fatStart = partition + layout.reservedSectors;
+  uint64_t rootStart = fatStart + 2 * layout.fatSectors;
+  auto clusterSector = [&](uint32_t cluster) {
+    return partition + layout.dataStart + (uint64_t)(cluster - 2) * layout.sectorsPerCluster;
+  };
+
+  // MBR with one FAT16 (LBA) partition
+  uint8_t sector[SECTOR];
+  memset(sector, 0, sizeof(sector));
+  uint8_t *part = sector + 446;
+  part[1] = 0xFE; part[2] = 0xFF; part[3] = 0xFF;
+  part[4] = 0x0E;
+  part[5] = 0xFE; part[6] = 0xFF; part[7] = 0xFF;
+  put32(part + 8, PARTITION_START);
+  put32(part + 12, layout.partitionSectors);
+  sector[510] = 0x55;
+  sector[511] = 0xAA;
+  writeAt(0, sector, SECTOR);
+
+  // Boot sector (BPB)
+  uint32_t volumeId = crc32Update(0, (const uint8_t *)card.name.data(), card.name.size());
+  memset(sector, 0, sizeof(sector));
+  sector[0] = 0xEB; sector[1] = 0x3C; sector[2] = 0x90;
+  memcpy(sector + 3, "MSWIN4.1", 8);
+  put16(sector + 11, SECTOR);
+  sector[13] = layout.sectorsPerCluster;
+  put16(sector + 14, layout.reservedSectors);
+  sector[16] = 2;
+  put16(sector + 17, ROOT_ENTRIES);
+  put16(sector + 19, layout.partitionSectors < 0x10000 ? layout.partitionSectors : 0);
+  sector[21] = 0xF8;
+  put16(sector + 22, layout.fatSectors);
+  put16(sector + 24, 63);
+  put16(sector + 26, 255);
+  put32(sector + 28, PARTITION_START);
+  put32(sector + 32, layout.partitionSectors < 0x10000 ? 0 : layout.partitionSectors);
+  sector[36] = 0x80;
+  sector[38] = 0x29;
+  put32(sector + 39, volumeId);
+  memcpy(sector + 43, "GHOSTKEY   ", 11);
+  memcpy(sector + 54, "FAT16   ", 8);
+  sector[510] = 0x55;
+  sector[511] = 0xAA;
+  writeAt(partition, sector, SECTOR);
+
+  // Both FATs
+  std::vector<uint8_t> fatBytes(layout.fatSectors * SECTOR, 0);
+  for (size_t i = 0; i < fat.size(); i++) {
+    put16(fatBytes.data() + i * 2, fat[i]);
+  }
+  writeAt(fatStart, fatBytes.data(), fatBytes.size());
+  writeAt(fatStart + layout.fatSectors, fatBytes.data(), fatBytes.size());
+
+  // Directories, timestamped now
+  time_t now = time(NULL);
+  struct tm local;
+  localtime_r(&now, &local);
+  uint16_t fatTime = (local.tm_hour << 11) | (local.tm_min << 5) | (local.tm_sec / 2);
+  uint16_t fatDate = ((local.tm_year - 80) << 9) | ((local.tm_mon + 1) << 5) | local.tm_mday;
+  for (auto &dir : dirs) {
+    bool root = (dir.first == "/");
+    std::vector<uint8_t> entries(root ? ROOT_ENTRIES * 32 : (dir.second.size() + 3) * 32, 0);
+    uint8_t *p = entries.data();
+    if (root) {
+      memset(p, 0, 32);
+      memcpy(p, "GHOSTKEY   ", 11);
+      p[11] = 0x08; // Volume label
+      p += 32;
+    } else {
+      uint32_t parentCluster = (parentPath(dir.first) == "/") ? 0 : dirClusters[parentPath(dir.first)];
+      writeDirEntry(p, ".", 0x10, dirClusters[dir.first], 0, fatTime, fatDate);
+      writeDirEntry(p + 32, "..", 0x10, parentCluster, 0, fatTime, fatDate);
+      p += 64;
+    }
+    for (const DirEntryRef &ref : dir.second) {
+      if (ref.directory) {
+        writeDirEntry(p, ref.name, 0x10, dirClusters[ref.path], 0, fatTime, fatDate);
+      } else {
+        writeDirEntry(p, ref.name, 0x20, ref.file->cluster, ref.file->data.size(), fatTime, fatDate);
+      }
+      p += 32;
+    }
+    if (root) {
+      writeAt(rootStart, entries.data(), entries.size());
+    } else {
+      entries.resize((entries.size() + clusterBytes - 1) / clusterBytes * clusterBytes, 0);
+      writeAt(clusterSector(dirClusters[dir.first]), entries.data(), entries.size());
+    }
+  }
+
+  // File data
+  for (CardFile *file : order) {
+    if (!file->data.empty()) {
+      writeAt(clusterSector(file->cluster), file->data.data(), file->data.size());
+    }
+  }
+  out.close();
+  if (!out) {
+    card.error("cannot write " + imagePath.string());
+    return false;
+  }
+  return true;
+}
+
+// ---- One card ----
+
+static void buildCard(Card &card, const Options &options) {
+  loadTree(card, card.dir, true);
+  if (!options.sharedDir.empty()) {
+    loadTree(card, options.sharedDir, false);
+  }
+  parseConfig(card);
+
+  std::vector<CardFile *> payloads = catalogPayloads(card);
+  card.payloads = payloads.size();
+
+  // The payload setup() picks without a catalog entry selected
+  std::string primary = (card.scriptMode == 1) ? card.duckyScriptFile : card.customScriptFile;
+  std::string fallback = (card.scriptMode == 1) ? card.customScriptFile : card.duckyScriptFile;
+  CardFile *configured = findFile(card, primary);
+  if (configured == NULL) {
+    configured = findFile(card, fallback);
+  }
+  if (card.payloadIndex > (int)payloads.size()) {
+    card.error("PAYLOAD_INDEX " + std::to_string(card.payloadIndex) + " but only " +
+               std::to_string(payloads.size()) + " payload(s) on the card");
+  } else if (card.payloadIndex <= 0 && configured == NULL) {
+    card.error("neither " + primary + " nor " + fallback + " is on the card");
+  }
+
+  // Compile every payload a catalog selection or the config can run
+  if (card.compileCache) {
+    std::vector<CardFile *> sources = payloads;
+    if (configured != NULL && std::find(sources.begin(), sources.end(), configured) == sources.end()) {
+      sources.push_back(configured);
+    }
+    for (CardFile *source : sources) {
+      compilePayload(card, *source);
+    }
+  }
+  writeCatalog(card, payloads);
+  writeHistoryLog(card);
+
+  if (card.errors > 0 || (options.strict && card.warnings > 0) || options.check) {
+    return;
+  }
+  fs::path imagePath = options.outputDir / (card.name + ".img");
+  if (writeImage(card, imagePath, options.sizeMb)) {
+    card.note("-> " + imagePath.string() + " (" + std::to_string(options.sizeMb) + " MB, " +
+              std::to_string(card.usedClusters) + " of " + std::to_string(card.totalClusters) +
+              " clusters used)");
+  }
+}
+
+static void usage() {
+  fprintf(stderr,
+          "usage: gkimage [-j jobs] [-o dir] [--size MB] [--shared dir] [--check] [--strict] card-dir...\n"
+          "  -j, --jobs N     cards built in parallel (default: all cores)\n"
+          "  -o, --output DIR where the images go (default: .), one <card-dir name>.img each\n"
+          "      --size MB    image size, 8-2047 (default 64); FAT16 with 1 MB aligned partition\n"
+          "      --shared DIR files added to every card (a card's own file wins)\n"
+          "      --check      validate and compile only, write no images\n"
+          "      --strict     treat warnings as errors\n");
+}
+
+int main(int argc, char **argv) {
+  Options options;
+  std::vector<fs::path> cardDirs;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if ((arg == "-j" || arg == "--jobs") && hasValue) {
+      options.jobs = atoi(argv[++i]);
+    } else if ((arg == "-o" || arg == "--output") && hasValue) {
+      options.outputDir = argv[++i];
+    } else if (arg == "--size" && hasValue) {
+      options.sizeMb = atoi(argv[++i]);
+    } else if (arg == "--shared" && hasValue) {
+      options.sharedDir = argv[++i];
+    } else if (arg == "--check") {
+      options.check = true;
+    } else if (arg == "--strict") {
+      options.strict = true;
+    } else if (arg == "-h" || arg == "--help") {
+      usage();
+      return 0;
+    } else if (!arg.empty() && arg[0] == '-') {
+      usage();
+      return 2;
+    } else {
+      cardDirs.push_back(arg);
+    }
+  }
+  if (cardDirs.empty() || options.sizeMb < 8 || options.sizeMb > 2047) {
+    usage();
+    return 2;
+  }
+  if (!options.check) {
+    std::error_code ec;
+    fs::create_directories(options.outputDir, ec);
+  }
+
+  std::vector<Card> cards(cardDirs.size());
+  for (size_t i = 0; i < cardDirs.size(); i++) {
+    cards[i].dir = cardDirs[i];
+    cards[i].name = fs::path(cardDirs[i]).lexically_normal().filename().string();
+    if (cards[i].name.empty()) {
+      cards[i].name = fs::path(cardDirs[i]).lexically_normal().parent_path().filename().string();
+    }
+    if (!fs::is_directory(cardDirs[i])) {
+      cards[i].error(cardDirs[i].string() + " is not a directory");
+    }
+  }
+
+  // Cards are independent: each worker takes the next one until none is left
+  unsigned jobs = options.jobs > 0 ? options.jobs : std::max(1u, std::thread::hardware_concurrency());
+  jobs = std::min<unsigned>(jobs, cards.size());
+  std::atomic<size_t> next(0);
+  auto started = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (unsigned j = 0; j < jobs; j++) {
+    workers.emplace_back([&]() {
+      for (size_t i = next++; i < cards.size(); i = next++) {
+        if (cards[i].errors == 0) {
+          buildCard(cards[i], options);
+        }
+      }
+    });
+  }
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+  int failed = 0;
+  for (const Card &card : cards) {
+    bool ok = card.errors == 0 && !(options.strict && card.warnings > 0);
+    printf("%s: %s - %d payload(s), %d compiled (%u blocks, %u snippet(s)), %d error(s), %d warning(s)\n",
+           card.name.c_str(), ok ? "ok" : "FAILED", card.payloads, card.compiled, card.blocks, card.functions,
+           card.errors, card.warnings);
+    for (const std::string &line : card.log) {
+      printf("%s\n", line.c_str());
+    }
+    failed += ok ? 0 : 1;
+  }
+  printf("%zu card(s), %d failed, %u job(s), %.2f s\n", cards.size(), failed, jobs, seconds);
+  return failed > 0 ? 1 : 0;
+}
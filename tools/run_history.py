@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+"""
+Read Ghostkey run histories (/history.log) and compare them across cards.
+
+Every run appends one RunRecord (lib/run-history.h) to /history.log on the
+card. Collect the logs from any number of cards and pass them here:
+
+    tools/run_history.py cardA/history.log cardB/history.log
+    tools/run_history.py --runs history.log          one line per run
+    tools/run_history.py --csv runs.csv logs/*.log   export every run
+    tools/run_history.py --plot trend.png logs/*.log plot the metrics
+
+The summary groups runs by firmware version and card model (CARD_MODEL in
+config.txt) and prints the median of each metric. A firmware whose median
+is clearly worse than the previous firmware's on the same card model is
+flagged as a regression. --plot needs matplotlib.
+"""
+
+import argparse
+import csv
+import os
+import statistics
+import struct
+import sys
+
+LOG_MAGIC = b"GKLG"
+LOG_HEADER = struct.Struct("<4sHHIII")  # LogFileHeader (lib/log-writer.h)
+LOG_SECTOR_SIZE = 512
+
+# RunRecord version -> layout (lib/run-history.h)
+RECORD_FORMATS = {
+    1: struct.Struct("<HHI12sI16sIHBBIIHHHBBIIIIHHIII"),
+}
+RECORD_FIELDS = [
+    "version", "size", "sequence", "firmware", "buildId", "cardModel",
+    "sdMountedMs", "sdMountMs", "sdAttempts", "cacheResult", "configLoadedMs", "runStartMs",
+    "prepareMs", "compiledBlocks", "reusedBlocks", "flags", "layout",
+    "typedChars", "typingMs",
+    "delayRequestedMs", "delayOvershootMs", "delayWorstOvershootMs", "iterations",
+    "runMs", "estimatedMs", "delayWorkMs",
+]
+
+CACHE_RESULTS = ["off", "hit", "rebuilt", "failed"]
+LAYOUTS = ["en_US", "de_DE", "es_ES", "fr_FR", "it_IT", "pt_PT", "sv_SE", "da_DK", "hu_HU"]
+FLAG_NAMES = [(0x01, "aborted"), (0x02, "resumed"), (0x04, "rerun")]
+
+# Metric name, function of a run, True when higher is better
+METRICS = [
+    ("chars/s", lambda r: r["typedChars"] * 1000.0 / r["typingMs"] if r["typingMs"] else None, True),
+    ("sd mount ms", lambda r: r["sdMountMs"], False),
+    ("prepare ms", lambda r: r["prepareMs"], False),
+    ("delay drift %", lambda r: r["delayOvershootMs"] * 100.0 / r["delayRequestedMs"]
+        if r["delayRequestedMs"] else None, False),
+    ("run/estimate", lambda r: r["runMs"] / float(r["estimatedMs"]) if r["estimatedMs"] else None, False),
+]
+
+# A median this much worse than the previous firmware's is a regression
+REGRESSION_THRESHOLD = 0.10
+
+
+def read_history(path):
+    """Return the runs in one history.log as dicts."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < LOG_SECTOR_SIZE or data[:4] != LOG_MAGIC:
+        raise ValueError("%s: not a Ghostkey log" % path)
+    _, _, record_size, _, length, _ = LOG_HEADER.unpack_from(data)
+    if record_size == 0:
+        raise ValueError("%s: byte stream log, not a run history" % path)
+
+    runs = []
+    body = data[LOG_SECTOR_SIZE:LOG_SECTOR_SIZE + length]
+    for offset in range(0, len(body) - record_size + 1, record_size):
+        version, size = struct.unpack_from("<HH", body, offset)
+        layout = RECORD_FORMATS.get(version)
+        if layout is None or size < layout.size:
+            print("%s: skipping record %d with version %d" % (path, offset // record_size, version),
+                  file=sys.stderr)
+            continue
+        run = dict(zip(RECORD_FIELDS, layout.unpack_from(body, offset)))
+        run["firmware"] = run["firmware"].rstrip(b"\0").decode("ascii", "replace")
+        run["cardModel"] = run["cardModel"].rstrip(b"\0").decode("ascii", "replace") or "unknown"
+        run["card"] = path
+        runs.append(run)
+    return runs
+
+
+def describe_flags(flags):
+    return ",".join(name for bit, name in FLAG_NAMES if flags & bit) or "-"
+
+
+def print_runs(runs):
+    print("%-5s %-8s %-12s %-8s %7s %8s %8s %7s %8s %9s  %s" % (
+        "seq", "firmware", "card model", "cache", "mount", "prepare", "chars/s", "drift%",
+        "run s", "estimate", "flags"))
+    for run in runs:
+        values = [metric(run) for _, metric, _ in METRICS]
+        print("%-5d %-8s %-12s %-8s %7d %8d %8s %7s %8.1f %9s  %s" % (
+            run["sequence"], run["firmware"], run["cardModel"][:12],
+            CACHE_RESULTS[run["cacheResult"]] if run["cacheResult"] < len(CACHE_RESULTS) else "?",
+            run["sdMountMs"], run["prepareMs"],
+            "-" if values[0] is None else "%.1f" % values[0],
+            "-" if values[3] is None else "%.1f" % values[3],
+            run["runMs"] / 1000.0,
+            "%.1f" % (run["estimatedMs"] / 1000.0) if run["estimatedMs"] else "-",
+            describe_flags(run["flags"])))
+
+
+def median(runs, metric):
+    values = [v for v in (metric(r) for r in runs) if v is not None]
+    return statistics.median(values) if values else None
+
+
+def firmware_key(version):
+    """Sort firmware versions numerically where they are numbers."""
+    return [int(p) if p.isdigit() else p for p in version.replace("-", ".").split(".")]
+
+
+def summarize(runs):
+    """Print medians per card model and firmware; return the regressions found."""
+    groups = {}
+    for run in runs:
+        if run["flags"] & 0x01:  # Aborted runs do not say much about speed
+            continue
+        groups.setdefault(run["cardModel"], {}).setdefault(run["firmware"], []).append(run)
+
+    regressions = []
+    print("%-16s %-10s %5s  %s" % ("card model", "firmware", "runs",
+                                  "  ".join("%13s" % name for name, _, _ in METRICS)))
+    for model in sorted(groups):
+        previous = None
+        for firmware in sorted(groups[model], key=firmware_key):
+            group = groups[model][firmware]
+            medians = [median(group, metric) for _, metric, _ in METRICS]
+            print("%-16s %-10s %5d  %s" % (model[:16], firmware, len(group), "  ".join(
+                "%13s" % ("-" if m is None else "%.2f" % m) for m in medians)))
+            if previous is not None:
+                for (name, _, higher_better), old, new in zip(METRICS, previous[1], medians):
+                    if old is None or new is None or old == 0:
+                        continue
+                    change = (new - old) / abs(old)
+                    if (change < -REGRESSION_THRESHOLD) if higher_better else (change > REGRESSION_THRESHOLD):
+                        regressions.append((model, previous[0], firmware, name, old, new))
+            previous = (firmware, medians)
+
+    for model, old_fw, new_fw, name, old, new in regressions:
+        print("REGRESSION %s: %s %.2f (firmware %s) -> %.2f (firmware %s)" % (
+            model, name, old, old_fw, new, new_fw))
+    return regressions
+
+
+def write_csv(path, runs):
+    with open(path, "w", newline="") as f:
+        writer = csv.writer(f)
+        writer.writerow(["card"] + RECORD_FIELDS + [name for name, _, _ in METRICS])
+        for run in runs:
+            writer.writerow([run["card"]] + [run[field] for field in RECORD_FIELDS] +
+                            [metric(run) for _, metric, _ in METRICS])
+
+
+def plot(path, runs):
+    try:
+        import matplotlib
+        matplotlib.use("Agg")
+        import matplotlib.pyplot as plt
+    except ImportError:
+        sys.exit("--plot needs matplotlib (pip install matplotlib)")
+
+    fig, axes = plt.subplots(len(METRICS), 1, figsize=(10, 3 * len(METRICS)), sharex=True)
+    series = {}
+    for run in runs:
+        series.setdefault((run["cardModel"], run["card"]), []).append(run)
+    for axis, (name, metric, _) in zip(axes, METRICS):
+        for (model, card), card_runs in sorted(series.items()):
+            points = [(r["sequence"], metric(r)) for r in card_runs if metric(r) is not None]
+            if points:
+                axis.plot(*zip(*points), marker=".", label="%s (%s)" % (model, os.path.basename(
+                    os.path.dirname(os.path.abspath(card))) or card))
+        axis.set_ylabel(name)
+        axis.grid(True, alpha=0.3)
+    axes[0].legend(fontsize="small")
+    axes[-1].set_xlabel("run")
+    fig.tight_layout()
+    fig.savefig(path)
+    print("Wrote %s" % path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Summarize Ghostkey run histories.")
+    parser.add_argument("logs", nargs="+", help="history.log files collected from cards")
+    parser.add_argument("--runs", action="store_true", help="list every run instead of the summary")
+    parser.add_argument("--csv", metavar="FILE", help="also write every run to a CSV file")
+    parser.add_argument("--plot", metavar="FILE", help="also plot the metrics per run (needs matplotlib)")
+    args = parser.parse_args()
+
+    runs = []
+    for path in args.logs:
+        try:
+            runs.extend(read_history(path))
+        except (OSError, ValueError) as error:
+            sys.exit(str(error))
+    if not runs:
+        sys.exit("No runs recorded")
+
+    if args.runs:
+        print_runs(runs)
+        regressions = []
+    else:
+        regressions = summarize(runs)
+    if args.csv:
+        write_csv(args.csv, runs)
+    if args.plot:
+        plot(args.plot, runs)
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
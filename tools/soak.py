@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+"""
+Soak-test a Ghostkey payload on the PC: run it for many REPEAT_COUNT
+repetitions on a virtual clock and fail if memory or timing grows.
+
+The sketch is built for the host against the core in tools/soak/host and
+the harness in tools/soak/soak_main.cpp, then run against a card directory
+(kept in memory, never written):
+
+    tools/soak.py cards/unit1 -n 1000000           a million repetitions
+    tools/soak.py cards/unit1 -n 5000 --heap 12000 less heap, as on a busier build
+    tools/soak.py cards/unit1 --sanitize -n 200    also check memory errors
+    tools/soak.py cards/unit1 --m32 -n 2000000     32 bit build: long and the
+                                                   clock wrap like the board
+    tools/soak.py cards/unit1 --dual-core -n 1000  RP2040 split: engine and USB
+                                                   on two threads
+
+config.txt on the card must set REPEAT_COUNT to at least the repetitions
+asked for (e.g. REPEAT_COUNT = 2000000000 on a soak card). Every repetition
+is sampled where it starts: heap bytes and blocks in use, heap top and
+fragmentation, allocations made and virtual time taken. The soak fails when
+a figure's lowest value in the second half of the run is above its highest
+in the first (a steady leak or slow-down, not the usual ups and downs),
+when the heap top still moves in the second half, when an allocation fails
+against the --heap limit, or when the firmware resets. The cumulative
+timing drift against the first measured repetition is printed as well, and
+so are the card's backward seeks (each one follows the FAT cluster chain
+from the start of the file, as the SD library does) and the blocks read
+directly through lib/extent-file.h.
+
+Options after the card directory are passed to the harness:
+    -n N          repetitions (default 100000)
+    --warmup N    repetitions left out of the comparison (default 2)
+    --heap BYTES  heap left to the sketch (default 16384)
+    --report N    print a row every N repetitions (default n/20)
+    --timeout S   give up after S seconds of real time
+    --verbose     echo the firmware's serial output
+
+With --dual-core the sketch is built as for the RP2040: reports go through
+the inter-core FIFO (lib/report-fifo.h) and a second thread sends them, one
+per virtual USB frame, like core 0 (usb_core.ino). The same repetitions are
+then run on a single-core build as well, and the soak fails unless both
+send exactly the same reports in the same order (the HID report digest).
+The dual-core report also shows how deep the FIFO got and how often the
+engine had to wait for it.
+
+The heap model follows newlib-nano on the SAMD21, but a 64 bit build has
+larger pointers and so somewhat larger structures than the board. Use the
+trend, not the absolute figures.
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+REPO = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SOAK_DIR = os.path.join(REPO, "tools", "soak")
+MAIN_TAB = "Ghostkey_Simple.ino"
+
+# A function definition at the start of a line: return type, name, parameters, brace
+DEFINITION = re.compile(r"^([A-Za-z_][\w:<>\*&\s]*?[\s\*&]([A-Za-z_]\w*)\s*\(([^;{}()]*)\))\s*(?://[^\n]*)?\s*\{",
+                        re.M)
+NOT_FUNCTIONS = {"if", "while", "for", "switch", "return", "else"}
+
+
+def sketch_tabs():
+    """The tabs in the order the Arduino builder joins them."""
+    others = sorted(f for f in os.listdir(REPO) if f.endswith(".ino") and f != MAIN_TAB)
+    return [MAIN_TAB] + others
+
+
+def prototypes(source):
+    """Declarations for every function the tabs define, as the builder adds them."""
+    found = []
+    for match in DEFINITION.finditer(source):
+        signature, name = match.group(1), match.group(2)
+        if name in NOT_FUNCTIONS or signature.split()[0] in ("struct", "class", "else", "return", "typedef"):
+            continue
+        found.append(re.sub(r"\s*=\s*[^,)]+", "", " ".join(signature.split())) + ";")
+    return found
+
+
+def write_sketch(path):
+    """Join the tabs into one translation unit with prototypes after the includes."""
+    parts = []
+    for tab in sketch_tabs():
+        with open(os.path.join(REPO, tab), encoding="utf-8") as f:
+            parts.append('#line 1 "%s"\n%s\n' % (os.path.join(REPO, tab), f.read()))
+    source = "".join(parts)
+
+    # The includes are at the top of the main tab (lines[0] is its #line)
+    lines = source.split("\n")
+    last_include = 0
+    for index, line in enumerate(lines[1:], 1):
+        if line.startswith("#line"):
+            break
+        if line.startswith("#include"):
+            last_include = index
+    main_line = last_include + 1
+    text = "\n".join(["#include <Arduino.h>"] + lines[:last_include + 1] + prototypes(source) +
+                     ['#line %d "%s"' % (main_line, os.path.join(REPO, MAIN_TAB))] +
+                     lines[last_include + 1:])
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(text)
+
+
+def newest_source():
+    paths = [os.path.join(REPO, tab) for tab in sketch_tabs()]
+    for directory in (os.path.join(REPO, "lib"), SOAK_DIR, os.path.join(SOAK_DIR, "host")):
+        paths += [os.path.join(directory, f) for f in os.listdir(directory)
+                  if f.endswith((".h", ".cpp"))]
+    return max(os.path.getmtime(p) for p in paths)
+
+
+def build(args, dual_core=False):
+    flavour = ("m32" if args.m32 else "m64") + ("-asan" if args.sanitize else "") + ("-dual" if dual_core else "")
+    if args.build_dir:
+        build_dir = os.path.join(args.build_dir, "dual") if dual_core else args.build_dir
+    else:
+        build_dir = os.path.join(tempfile.gettempdir(), "ghostkey-soak-" + flavour)
+    os.makedirs(build_dir, exist_ok=True)
+    binary = os.path.join(build_dir, "soak")
+    if os.path.exists(binary) and os.path.getmtime(binary) > newest_source() and not args.rebuild:
+        return binary
+
+    sketch = os.path.join(build_dir, "sketch.cpp")
+    write_sketch(sketch)
+    flags = ["-std=gnu++11", "-g", "-O1" if args.sanitize else "-O2",
+             "-I", os.path.join(SOAK_DIR, "host"), "-I", REPO]
+    if args.m32:
+        flags.append("-m32")
+    if args.sanitize:
+        flags += ["-fsanitize=address,undefined", "-fno-omit-frame-pointer"]
+    if dual_core:
+        flags += ["-DGHOSTKEY_REPORT_FIFO", "-pthread"]
+    print("Building the soak harness in %s" % build_dir, file=sys.stderr)
+    objects = []
+    # The Arduino builder compiles sketches with warnings off; the harness gets them
+    for source, warnings in ((sketch, ["-w"]), (os.path.join(SOAK_DIR, "soak_main.cpp"), ["-Wall"])):
+        target = os.path.join(build_dir, os.path.splitext(os.path.basename(source))[0] + ".o")
+        subprocess.check_call([args.cxx] + flags + warnings + ["-c", source, "-o", target])
+        objects.append(target)
+    subprocess.check_call([args.cxx] + flags + objects + ["-o", binary])
+    return binary
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Soak-test a Ghostkey payload on a virtual clock.",
+                                     epilog="Other options are passed to the harness (see the header "
+                                            "of tools/soak.py).")
+    parser.add_argument("card", help="card directory with config.txt and the payload")
+    parser.add_argument("--cxx", default=os.environ.get("CXX", "c++"), help="C++ compiler (default c++)")
+    parser.add_argument("--m32", action="store_true", help="build 32 bit, like the board (needs multilib)")
+    parser.add_argument("--sanitize", action="store_true", help="build with AddressSanitizer and UBSan")
+    parser.add_argument("--build-dir", metavar="DIR", help="where to build (default: a temp directory)")
+    parser.add_argument("--rebuild", action="store_true", help="build even if the sources did not change")
+    parser.add_argument("--dual-core", action="store_true",
+                        help="run the RP2040 engine/USB split on two threads and compare with one")
+    args, harness_args = parser.parse_known_args()
+
+    try:
+        binary = build(args)
+        dual_binary = build(args, dual_core=True) if args.dual_core else None
+    except (OSError, subprocess.CalledProcessError) as error:
+        sys.exit("Build failed: %s" % error)
+    env = dict(os.environ)
+    if args.sanitize:
+        # The tracked heap is a static arena, so leak checking would only see the harness
+        env.setdefault("ASAN_OPTIONS", "detect_leaks=0")
+    command = harness_args + [args.card]
+    if not args.dual_core:
+        return subprocess.call([binary] + command, env=env)
+
+    print("Single-core reference run...", file=sys.stderr)
+    single = subprocess.run([binary] + command, env=env, stdout=subprocess.PIPE, universal_newlines=True)
+    dual = subprocess.run([dual_binary] + command, env=env, stdout=subprocess.PIPE, universal_newlines=True)
+    sys.stdout.write(dual.stdout)
+    if single.returncode == 2 or dual.returncode == 2:
+        return 2
+    expected, got = report_digest(single.stdout), report_digest(dual.stdout)
+    if expected is None or expected != got:
+        print("FAIL: the dual-core build sent different reports (digest %s, single core %s)" % (got, expected))
+        return 1
+    print("Same reports as the single-core build (digest %s)" % got)
+    return max(single.returncode, dual.returncode)
+
+
+def report_digest(output):
+    match = re.search(r"^HID report digest: (\w+)$", output, re.M)
+    return match.group(1) if match else None
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,403 @@
+/*
+ * Host Arduino Core for the Soak Harness
+ *
+ * Just enough of the Arduino API to build the sketch on a PC (see
+ * tools/soak.py). Time comes from the virtual clock in soak_main.cpp, and
+ * every heap allocation the sketch makes, directly or through String, goes
+ * to the tracked heap there, so a soak run can see leaks and fragmentation
+ * the way the SAMD21's newlib heap would.
+ *
+ * String follows the Arduino core's WString: a heap buffer that is
+ * reallocated to the exact length whenever it has to grow, and an empty
+ * String still allocates one byte. That is what makes String-heavy code
+ * fragment the heap, so the harness keeps the behaviour rather than using
+ * std::string.
+ */
+
+#ifndef SOAK_ARDUINO_H
+#define SOAK_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <new>
+#include <utility>
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define CHANGE 2
+#define FALLING 3
+#define RISING 4
+#define DEC 10
+#define HEX 16
+
+class __FlashStringHelper; // Flash and RAM are the same on the host
+#define PROGMEM
+#define F(string) (reinterpret_cast<const __FlashStringHelper *>(string))
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+#define pgm_read_word(address) (*(const uint16_t *)(address))
+#define PINS_COUNT 26 // Variant pin table size, as a SAMD21 board's variant.h has it
+#define NOT_AN_INTERRUPT -1
+#define digitalPinToInterrupt(pin) (pin)
+#define noInterrupts()
+#define interrupts()
+
+// Virtual clock, tracked heap and reset (soak_main.cpp)
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+void soakActivity(uint32_t micros);
+void *soakMalloc(size_t size);
+void *soakCalloc(size_t count, size_t size);
+void *soakRealloc(void *pointer, size_t size);
+void soakFree(void *pointer);
+void NVIC_SystemReset();
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline int digitalRead(uint8_t) { return HIGH; }
+inline int analogRead(uint8_t) { return 0; }
+inline void attachInterrupt(uint8_t, void (*)(void), int) {}
+inline void detachInterrupt(uint8_t) {}
+
+template <class A, class B> inline auto min(A a, B b) -> decltype(a + b) { return a < b ? a : b; }
+template <class A, class B> inline auto max(A a, B b) -> decltype(a + b) { return a > b ? a : b; }
+template <class T, class L, class H> inline T constrain(T x, L low, H high) {
+  return x < low ? low : (x > high ? high : x);
+}
+
+class String {
+public:
+  String(const char *cstr = "") { init(); if (cstr) copy(cstr, strlen(cstr)); }
+  String(const __FlashStringHelper *text) { init(); *this = (const char *)text; }
+  String(const String &other) { init(); *this = other; }
+  String(String &&other) { init(); move(other); }
+  explicit String(char c) { init(); char text[2] = { c, 0 }; copy(text, 1); }
+  explicit String(unsigned char value, unsigned char base = 10) { init(); formatUnsigned(value, base); }
+  explicit String(int value, unsigned char base = 10) { init(); formatSigned(value, base); }
+  explicit String(unsigned int value, unsigned char base = 10) { init(); formatUnsigned(value, base); }
+  explicit String(long value, unsigned char base = 10) { init(); formatSigned(value, base); }
+  explicit String(unsigned long value, unsigned char base = 10) { init(); formatUnsigned(value, base); }
+  explicit String(float value, unsigned char decimals = 2) { init(); formatFloat(value, decimals); }
+  explicit String(double value, unsigned char decimals = 2) { init(); formatFloat(value, decimals); }
+  ~String() { soakFree(_buffer); }
+
+  String &operator=(const String &other) {
+    if (this == &other) return *this;
+    if (other._buffer) copy(other._buffer, other._len); else invalidate();
+    return *this;
+  }
+  String &operator=(String &&other) { if (this != &other) move(other); return *this; }
+  String &operator=(const char *cstr) {
+    if (cstr) copy(cstr, strlen(cstr)); else invalidate();
+    return *this;
+  }
+
+  bool reserve(unsigned int size) {
+    if (_buffer && _capacity >= size) return true;
+    if (changeBuffer(size)) {
+      if (_len == 0) _buffer[0] = 0;
+      return true;
+    }
+    return false;
+  }
+  unsigned int length() const { return _len; }
+  const char *c_str() const { return _buffer ? _buffer : ""; }
+
+  bool concat(const char *cstr, unsigned int length) {
+    unsigned int newLength = _len + length;
+    if (!cstr) return false;
+    if (length == 0) return true;
+    if (!reserve(newLength)) return false;
+    memmove(_buffer + _len, cstr, length);
+    _len = newLength;
+    _buffer[_len] = 0;
+    return true;
+  }
+  bool concat(const String &other) { return concat(other.c_str(), other._len); }
+  bool concat(const char *cstr) { return cstr && concat(cstr, strlen(cstr)); }
+  bool concat(const __FlashStringHelper *text) { return concat((const char *)text); }
+  bool concat(char c) { return concat(&c, 1); }
+  bool concat(unsigned char value) { return concat(String(value)); }
+  bool concat(int value) { return concat(String(value)); }
+  bool concat(unsigned int value) { return concat(String(value)); }
+  bool concat(long value) { return concat(String(value)); }
+  bool concat(unsigned long value) { return concat(String(value)); }
+  bool concat(double value) { return concat(String(value)); }
+  template <class T> String &operator+=(const T &value) { concat(value); return *this; }
+
+  int compareTo(const String &other) const { return strcmp(c_str(), other.c_str()); }
+  bool equals(const String &other) const { return _len == other._len && compareTo(other) == 0; }
+  bool equals(const char *cstr) const { return strcmp(c_str(), cstr ? cstr : "") == 0; }
+  bool operator==(const String &other) const { return equals(other); }
+  bool operator==(const char *cstr) const { return equals(cstr); }
+  bool operator!=(const String &other) const { return !equals(other); }
+  bool operator!=(const char *cstr) const { return !equals(cstr); }
+  bool operator<(const String &other) const { return compareTo(other) < 0; }
+  bool equalsIgnoreCase(const String &other) const {
+    if (_len != other._len) return false;
+    for (unsigned int i = 0; i < _len; i++) {
+      if (tolower((unsigned char)_buffer[i]) != tolower((unsigned char)other._buffer[i])) return false;
+    }
+    return true;
+  }
+  bool startsWith(const String &prefix, unsigned int offset = 0) const {
+    return offset + prefix._len <= _len && strncmp(c_str() + offset, prefix.c_str(), prefix._len) == 0;
+  }
+  bool endsWith(const String &suffix) const {
+    return suffix._len <= _len && strcmp(c_str() + _len - suffix._len, suffix.c_str()) == 0;
+  }
+
+  char charAt(unsigned int index) const { return index < _len ? _buffer[index] : 0; }
+  void setCharAt(unsigned int index, char c) { if (index < _len) _buffer[index] = c; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  char &operator[](unsigned int index) {
+    static char dummy;
+    if (index >= _len) { dummy = 0; return dummy; }
+    return _buffer[index];
+  }
+  void getBytes(unsigned char *buffer, unsigned int size, unsigned int index = 0) const {
+    if (!size || !buffer) return;
+    if (index >= _len) { buffer[0] = 0; return; }
+    unsigned int n = size - 1;
+    if (n > _len - index) n = _len - index;
+    memcpy(buffer, _buffer + index, n);
+    buffer[n] = 0;
+  }
+  void toCharArray(char *buffer, unsigned int size, unsigned int index = 0) const {
+    getBytes((unsigned char *)buffer, size, index);
+  }
+
+  int indexOf(char c, unsigned int from = 0) const {
+    if (from >= _len) return -1;
+    const char *found = strchr(_buffer + from, c);
+    return found ? (int)(found - _buffer) : -1;
+  }
+  int indexOf(const String &text, unsigned int from = 0) const {
+    if (from >= _len) return -1;
+    const char *found = strstr(_buffer + from, text.c_str());
+    return found ? (int)(found - _buffer) : -1;
+  }
+  int indexOf(const char *text, unsigned int from = 0) const { return indexOf(String(text), from); }
+  int lastIndexOf(char c) const {
+    for (int i = (int)_len - 1; i >= 0; i--) {
+      if (_buffer[i] == c) return i;
+    }
+    return -1;
+  }
+  String substring(unsigned int left) const { return substring(left, _len); }
+  String substring(unsigned int left, unsigned int right) const {
+    if (left > right) std::swap(left, right);
+    String out;
+    if (left >= _len) return out;
+    if (right > _len) right = _len;
+    out.copy(_buffer + left, right - left);
+    return out;
+  }
+
+  void replace(const String &find, const String &replacement) {
+    if (_len == 0 || find._len == 0) return;
+    String out;
+    unsigned int start = 0;
+    int found;
+    while ((found = indexOf(find, start)) >= 0) {
+      out.concat(_buffer + start, found - start);
+      out.concat(replacement);
+      start = found + find._len;
+    }
+    if (start == 0) return;
+    out.concat(_buffer + start, _len - start);
+    *this = std::move(out);
+  }
+  void remove(unsigned int index, unsigned int count = (unsigned int)-1) {
+    if (index >= _len) return;
+    if (count > _len - index) count = _len - index;
+    memmove(_buffer + index, _buffer + index + count, _len - index - count + 1);
+    _len -= count;
+  }
+  void toLowerCase() { for (unsigned int i = 0; i < _len; i++) _buffer[i] = tolower((unsigned char)_buffer[i]); }
+  void toUpperCase() { for (unsigned int i = 0; i < _len; i++) _buffer[i] = toupper((unsigned char)_buffer[i]); }
+  void trim() {
+    if (!_buffer || _len == 0) return;
+    char *begin = _buffer;
+    while (isspace((unsigned char)*begin)) begin++;
+    char *end = _buffer + _len - 1;
+    while (end >= begin && isspace((unsigned char)*end)) end--;
+    _len = end + 1 - begin;
+    if (begin > _buffer) memmove(_buffer, begin, _len);
+    _buffer[_len] = 0;
+  }
+  long toInt() const { return _buffer ? atol(_buffer) : 0; }
+  float toFloat() const { return _buffer ? (float)atof(_buffer) : 0; }
+
+private:
+  char *_buffer;
+  unsigned int _capacity;
+  unsigned int _len;
+
+  void init() { _buffer = NULL; _capacity = 0; _len = 0; }
+  void invalidate() { soakFree(_buffer); init(); }
+  bool changeBuffer(unsigned int maxLength) {
+    char *buffer = (char *)soakRealloc(_buffer, maxLength + 1);
+    if (!buffer) return false;
+    _buffer = buffer;
+    _capacity = maxLength;
+    return true;
+  }
+  void copy(const char *cstr, unsigned int length) {
+    if (!reserve(length)) { invalidate(); return; }
+    _len = length;
+    memmove(_buffer, cstr, length);
+    _buffer[length] = 0;
+  }
+  void move(String &other) {
+    soakFree(_buffer);
+    _buffer = other._buffer;
+    _capacity = other._capacity;
+    _len = other._len;
+    other.init();
+  }
+  void formatSigned(long value, unsigned char base) {
+    char text[34];
+    if (base == 10) snprintf(text, sizeof(text), "%ld", value);
+    else formatBase((unsigned long)value, base, text);
+    copy(text, strlen(text));
+  }
+  void formatUnsigned(unsigned long value, unsigned char base) {
+    char text[34];
+    formatBase(value, base, text);
+    copy(text, strlen(text));
+  }
+  static void formatBase(unsigned long value, unsigned char base, char *text) {
+    char digits[34];
+    int n = 0;
+    do {
+      unsigned digit = value % base;
+      digits[n++] = digit < 10 ? '0' + digit : 'A' + digit - 10;
+      value /= base;
+    } while (value);
+    for (int i = 0; i < n; i++) text[i] = digits[n - 1 - i];
+    text[n] = 0;
+  }
+  void formatFloat(double value, unsigned char decimals) {
+    char text[48];
+    snprintf(text, sizeof(text), "%.*f", decimals, value);
+    copy(text, strlen(text));
+  }
+};
+
+inline String operator+(const String &left, const String &right) { String out(left); out.concat(right); return out; }
+inline String operator+(const String &left, const char *right) { String out(left); out.concat(right); return out; }
+inline String operator+(const char *left, const String &right) { String out(left); out.concat(right); return out; }
+inline String operator+(const String &left, char right) { String out(left); out.concat(right); return out; }
+inline String operator+(const String &left, int right) { String out(left); out.concat(right); return out; }
+inline String operator+(const String &left, unsigned int right) { String out(left); out.concat(right); return out; }
+inline String operator+(const String &left, long right) { String out(left); out.concat(right); return out; }
+inline String operator+(const String &left, unsigned long right) { String out(left); out.concat(right); return out; }
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char *text) { return text ? write((const uint8_t *)text, strlen(text)) : 0; }
+  size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+  int getWriteError() { return _writeError; }
+  void clearWriteError() { _writeError = 0; }
+  virtual void flush() {}
+
+  size_t print(const String &value) { return write((const uint8_t *)value.c_str(), value.length()); }
+  size_t print(const char *value) { return write(value); }
+  size_t print(const __FlashStringHelper *value) { return write((const char *)value); }
+  size_t print(char value) { return write((uint8_t)value); }
+  size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(int value, int base = DEC) { return print((long)value, base); }
+  size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(long value, int base = DEC) {
+    char text[34];
+    if (base == DEC) snprintf(text, sizeof(text), "%ld", value);
+    else snprintf(text, sizeof(text), "%lX", (unsigned long)value);
+    return write(text);
+  }
+  size_t print(unsigned long value, int base = DEC) {
+    char text[34];
+    snprintf(text, sizeof(text), base == DEC ? "%lu" : "%lX", value);
+    return write(text);
+  }
+  size_t print(double value, int decimals = 2) {
+    char text[48];
+    snprintf(text, sizeof(text), "%.*f", decimals, value);
+    return write(text);
+  }
+  size_t println() { return write("\r\n"); }
+  template <class T> size_t println(const T &value) { size_t n = print(value); return n + println(); }
+  template <class T> size_t println(const T &value, int format) { size_t n = print(value, format); return n + println(); }
+
+protected:
+  void setWriteError(int error = 1) { _writeError = error; }
+
+private:
+  int _writeError = 0;
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  String readStringUntil(char terminator) {
+    String out;
+    int c;
+    while ((c = read()) >= 0 && c != terminator) out += (char)c;
+    return out;
+  }
+  String readString() {
+    String out;
+    int c;
+    while ((c = read()) >= 0) out += (char)c;
+    return out;
+  }
+  size_t readBytes(char *buffer, size_t length) {
+    size_t n = 0;
+    int c;
+    while (n < length && (c = read()) >= 0) buffer[n++] = (char)c;
+    return n;
+  }
+};
+
+// USB CDC serial: output goes to the harness line by line, no input
+class Serial_ : public Stream {
+public:
+  void begin(unsigned long) {}
+  operator bool() { return true; }
+  size_t write(uint8_t c) override;
+  using Print::write;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+};
+extern Serial_ Serial;
+
+// The sketch's own malloc()/free() calls use the tracked heap too
+#define malloc(size) soakMalloc(size)
+#define calloc(count, size) soakCalloc(count, size)
+#define realloc(pointer, size) soakRealloc(pointer, size)
+#define free(pointer) soakFree(pointer)
+
+#endif // SOAK_ARDUINO_H
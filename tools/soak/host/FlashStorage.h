@@ -0,0 +1,59 @@
+/*
+ * Host FlashStorage Library for the Soak Harness
+ *
+ * Flash is kept in memory and starts erased (all 0xFF) on every run. Every
+ * row erase is counted (soakFlashErases), so the soak report shows how
+ * hard a payload wears the flash.
+ */
+
+#ifndef SOAK_FLASH_STORAGE_H
+#define SOAK_FLASH_STORAGE_H
+
+#include <Arduino.h>
+
+#define SOAK_FLASH_ROW_BYTES 256
+#define SOAK_FLASH_BYTES 4096 // Largest area one FlashClass can stand for
+
+extern unsigned long long soakFlashErases;
+
+template <class T> class FlashStorageClass {
+public:
+  FlashStorageClass() { memset(&_value, 0xFF, sizeof(T)); }
+  void write(T value) {
+    soakFlashErases += (sizeof(T) + SOAK_FLASH_ROW_BYTES - 1) / SOAK_FLASH_ROW_BYTES;
+    _value = value;
+  }
+  T read() { return _value; }
+
+private:
+  T _value;
+};
+
+#define FlashStorage(name, T) FlashStorageClass<T> name
+
+// Raw access to a reserved flash area; its contents live in _flash here
+class FlashClass {
+public:
+  FlashClass(const void *flash_addr = NULL, uint32_t size = 0) : _base((const uint8_t *)flash_addr) {
+    memset(_flash, 0xFF, sizeof(_flash));
+    (void)size;
+  }
+  void erase(const volatile void *flash_ptr, uint32_t size) {
+    soakFlashErases += (size + SOAK_FLASH_ROW_BYTES - 1) / SOAK_FLASH_ROW_BYTES;
+    memset(_flash + offset(flash_ptr), 0xFF, size);
+  }
+  void write(const volatile void *flash_ptr, const void *data, uint32_t size) {
+    memcpy(_flash + offset(flash_ptr), data, size);
+  }
+  void read(const volatile void *flash_ptr, void *data, uint32_t size) {
+    memcpy(data, _flash + offset(flash_ptr), size);
+  }
+
+private:
+  size_t offset(const volatile void *flash_ptr) const { return (const uint8_t *)flash_ptr - _base; }
+
+  const uint8_t *_base;
+  uint8_t _flash[SOAK_FLASH_BYTES];
+};
+
+#endif // SOAK_FLASH_STORAGE_H
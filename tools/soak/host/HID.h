@@ -0,0 +1,30 @@
+/*
+ * Host HID Core for the Soak Harness
+ *
+ * Reports are counted and cost one USB frame on the virtual clock
+ * (soak_main.cpp); nothing reaches a host.
+ */
+
+#ifndef SOAK_HID_H
+#define SOAK_HID_H
+
+#include <Arduino.h>
+
+#define _USING_HID
+
+void soakHidReport(const void *data, int length);
+
+class HID_ {
+public:
+  int SendReport(uint8_t, const void *data, int length) {
+    soakHidReport(data, length);
+    return length;
+  }
+};
+
+inline HID_ &HID() {
+  static HID_ hid;
+  return hid;
+}
+
+#endif // SOAK_HID_H
@@ -0,0 +1,14 @@
+/*
+ * Host Keyboard Library for the Soak Harness
+ *
+ * The sketch only uses the Keyboard library for its key codes, layouts
+ * and begin(); HidKeyboard (lib/hid-output.h) builds the reports itself.
+ */
+
+#ifndef SOAK_KEYBOARD_H
+#define SOAK_KEYBOARD_H
+
+#include "HID.h"
+#include "../../../lib/Keyboard.h"
+
+#endif // SOAK_KEYBOARD_H
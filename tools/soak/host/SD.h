@@ -0,0 +1,282 @@
+/*
+ * Host SD Library for the Soak Harness
+ *
+ * The card is a directory on the PC, loaded into memory when the harness
+ * starts; everything the sketch writes (checkpoints, history, logs, the
+ * program cache) stays in memory, so a soak run never changes the card
+ * directory. Names are matched case-insensitively, as on FAT.
+ *
+ * Like the Arduino SD library, opening a file allocates its SdFile on the
+ * heap and close() frees it, so a File that is never closed shows up as a
+ * leak in the soak report. Seeks cost what following the FAT cluster chain
+ * costs there (soakCardSeek()).
+ *
+ * The card is also laid out as a FAT16 volume, clusters allocated as files
+ * grow, so Sd2Card, SdVolume and SdFile give lib/extent-file.h the first
+ * clusters, the FAT and the data blocks it reads on the SAMD21.
+ */
+
+#ifndef SOAK_SD_H
+#define SOAK_SD_H
+
+#include <Arduino.h>
+#include <strings.h>
+
+#define O_READ 0x01
+#define O_RDONLY O_READ
+#define O_WRITE 0x02
+#define O_WRONLY O_WRITE
+#define O_RDWR (O_READ | O_WRITE)
+#define O_APPEND 0x04
+#define O_CREAT 0x10
+#define O_TRUNC 0x40
+
+#define FILE_READ O_READ
+#define FILE_WRITE (O_READ | O_WRITE | O_CREAT | O_APPEND)
+
+// Sd2Card, SdVolume and SdFile below are the SAMD SD library's; see
+// lib/extent-file.h
+#define SD_LEGACY_SDFAT_CLASSES
+
+#define SOAK_SDFILE_BYTES 36 // sizeof(SdFile) on the SAMD21
+
+// FAT16 volume of SOAK_CARD_BYTES (soak_main.cpp): 2 KB clusters, one FAT
+// from block 1, data right after it
+#define SOAK_BLOCKS_PER_CLUSTER 4
+#define SOAK_CLUSTER_BYTES (SOAK_BLOCKS_PER_CLUSTER * 512)
+#define SOAK_FAT_START_BLOCK 1
+#define SOAK_DATA_START_BLOCK 66 // 16386 FAT entries in 65 blocks
+
+// In-memory card (soak_main.cpp); a node is a file or a directory
+int soakCardFind(const char *path);
+int soakCardCreate(const char *path, bool directory);
+bool soakCardRemove(const char *path, bool directory);
+bool soakCardIsDirectory(int node);
+const char *soakCardName(int node);
+int soakCardChild(int node, int index);
+uint32_t soakCardSize(int node);
+size_t soakCardRead(int node, uint32_t position, uint8_t *buffer, size_t size);
+size_t soakCardWrite(int node, uint32_t position, const uint8_t *buffer, size_t size);
+void soakCardTruncate(int node);
+void soakCardSeek(uint32_t from, uint32_t to);
+uint32_t soakCardFirstCluster(int node);
+void soakCardWriteStamp(int node, uint16_t &date, uint16_t &time);
+bool soakCardReadBlock(uint32_t block, uint8_t *buffer);
+
+// The part of an open file that lives on the heap
+struct SoakOpenFile {
+  int node;
+  uint32_t position;
+  uint8_t mode;
+  int nextChild; // Directories: next entry for openNextFile()
+};
+
+class File : public Stream {
+public:
+  File() : _file(NULL) { _name[0] = 0; }
+  File(int node, uint8_t mode) : _file(NULL) {
+    _name[0] = 0;
+    void *memory = soakMalloc(SOAK_SDFILE_BYTES > sizeof(SoakOpenFile) ? SOAK_SDFILE_BYTES : sizeof(SoakOpenFile));
+    if (!memory) {
+      return;
+    }
+    _file = (SoakOpenFile *)memory;
+    _file->node = node;
+    _file->mode = mode;
+    _file->nextChild = 0;
+    _file->position = (mode & O_APPEND) ? soakCardSize(node) : 0;
+    strncpy(_name, soakCardName(node), sizeof(_name) - 1);
+    _name[sizeof(_name) - 1] = 0;
+  }
+
+  operator bool() const { return _file != NULL; }
+  char *name() { return _name; }
+  bool isDirectory() const { return _file && soakCardIsDirectory(_file->node); }
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override {
+    if (!_file || !(_file->mode & O_WRITE)) {
+      setWriteError();
+      return 0;
+    }
+    if (_file->mode & O_APPEND) {
+      _file->position = soakCardSize(_file->node);
+    }
+    size_t written = soakCardWrite(_file->node, _file->position, buffer, size);
+    _file->position += written;
+    return written;
+  }
+  using Print::write;
+
+  int read() override {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+  }
+  int read(void *buffer, uint16_t size) {
+    if (!_file) {
+      return -1;
+    }
+    size_t n = soakCardRead(_file->node, _file->position, (uint8_t *)buffer, size);
+    _file->position += n;
+    return (int)n;
+  }
+  int peek() override {
+    uint8_t c;
+    return (_file && soakCardRead(_file->node, _file->position, &c, 1) == 1) ? c : -1;
+  }
+  int available() override {
+    if (!_file) {
+      return 0;
+    }
+    uint32_t size = soakCardSize(_file->node);
+    return size > _file->position ? (int)(size - _file->position) : 0;
+  }
+  void flush() override {}
+  bool seek(uint32_t position) {
+    if (!_file || position > soakCardSize(_file->node)) {
+      return false;
+    }
+    soakCardSeek(_file->position, position);
+    _file->position = position;
+    return true;
+  }
+  uint32_t position() { return _file ? _file->position : 0; }
+  uint32_t size() { return _file ? soakCardSize(_file->node) : 0; }
+
+  void close() {
+    if (_file) {
+      soakFree(_file);
+      _file = NULL;
+    }
+  }
+
+  File openNextFile(uint8_t mode = O_RDONLY) {
+    if (!_file) {
+      return File();
+    }
+    int child = soakCardChild(_file->node, _file->nextChild);
+    if (child < 0) {
+      return File();
+    }
+    _file->nextChild++;
+    return File(child, mode);
+  }
+  void rewindDirectory() {
+    if (_file) {
+      _file->nextChild = 0;
+    }
+  }
+
+private:
+  SoakOpenFile *_file;
+  char _name[13];
+};
+
+class SDClass {
+public:
+  bool begin(uint8_t) { return true; }
+  File open(const char *path, uint8_t mode = FILE_READ) {
+    int node = soakCardFind(path);
+    if (node < 0 && (mode & O_CREAT)) {
+      node = soakCardCreate(path, false);
+    }
+    if (node < 0) {
+      return File();
+    }
+    if ((mode & O_TRUNC) && !soakCardIsDirectory(node)) {
+      soakCardTruncate(node);
+    }
+    return File(node, mode);
+  }
+  File open(const String &path, uint8_t mode = FILE_READ) { return open(path.c_str(), mode); }
+  bool exists(const char *path) { return soakCardFind(path) >= 0; }
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool remove(const char *path) { return soakCardRemove(path, false); }
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool mkdir(const char *path) { return soakCardCreate(path, true) >= 0; }
+  bool mkdir(const String &path) { return mkdir(path.c_str()); }
+  bool rmdir(const char *path) { return soakCardRemove(path, true); }
+  bool rmdir(const String &path) { return rmdir(path.c_str()); }
+};
+extern SDClass SD;
+
+// The SdFat classes under the SD library, as far as lib/extent-file.h uses them
+class Sd2Card {
+public:
+  uint8_t readBlock(uint32_t block, uint8_t *dst) { return soakCardReadBlock(block, dst); }
+};
+
+class SdVolume {
+public:
+  uint8_t init(Sd2Card *dev) { return dev != NULL; }
+  uint8_t blocksPerCluster() const { return SOAK_BLOCKS_PER_CLUSTER; }
+  uint32_t dataStartBlock() const { return SOAK_DATA_START_BLOCK; }
+  uint32_t fatStartBlock() const { return SOAK_FAT_START_BLOCK; }
+  uint8_t fatType() const { return 16; }
+  static Sd2Card *sdCard() {
+    static Sd2Card card;
+    return &card;
+  }
+};
+
+// The fields of the FAT directory entry (utility/FatStructs.h)
+typedef struct {
+  uint8_t name[11];
+  uint8_t attributes;
+  uint8_t reservedNT;
+  uint8_t creationTimeTenths;
+  uint16_t creationTime;
+  uint16_t creationDate;
+  uint16_t lastAccessDate;
+  uint16_t firstClusterHigh;
+  uint16_t lastWriteTime;
+  uint16_t lastWriteDate;
+  uint16_t firstClusterLow;
+  uint32_t fileSize;
+} dir_t;
+
+class SdFile {
+public:
+  SdFile() : _node(-1) {}
+  uint8_t openRoot(SdVolume *) {
+    _node = 0;
+    return true;
+  }
+  uint8_t open(SdFile *dirFile, const char *fileName, uint8_t) {
+    if (_node >= 0 || !dirFile || !dirFile->isDir()) {
+      return false;
+    }
+    for (int i = 0, child; (child = soakCardChild(dirFile->_node, i)) >= 0; i++) {
+      if (strcasecmp(soakCardName(child), fileName) == 0) {
+        _node = child;
+        return true;
+      }
+    }
+    return false;
+  }
+  uint8_t close() {
+    _node = -1;
+    return true;
+  }
+  uint8_t isDir() const { return _node >= 0 && soakCardIsDirectory(_node); }
+  uint32_t fileSize() const { return _node >= 0 ? soakCardSize(_node) : 0; }
+  uint32_t firstCluster() const { return _node >= 0 ? soakCardFirstCluster(_node) : 0; }
+  uint8_t dirEntry(dir_t *dir) {
+    if (_node <= 0) {
+      return false; // The root directory has no entry
+    }
+    memset(dir, 0, sizeof(*dir));
+    uint32_t cluster = soakCardFirstCluster(_node);
+    dir->attributes = isDir() ? 0x10 : 0x20;
+    dir->firstClusterHigh = cluster >> 16;
+    dir->firstClusterLow = cluster & 0xFFFF;
+    dir->fileSize = fileSize();
+    soakCardWriteStamp(_node, dir->lastWriteDate, dir->lastWriteTime);
+    return true;
+  }
+
+private:
+  int _node;
+};
+
+#endif // SOAK_SD_H
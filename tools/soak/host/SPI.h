@@ -0,0 +1,49 @@
+/*
+ * Host SPI Library for the Soak Harness (the SD card is in memory)
+ */
+
+#ifndef SOAK_SPI_H
+#define SOAK_SPI_H
+
+#include <Arduino.h>
+
+#define SPI_MODE0 0x00
+#define MSBFIRST 1
+
+class SPISettings {
+public:
+  SPISettings() {}
+  SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass {
+public:
+  void begin() {}
+  void end() {}
+  void beginTransaction(SPISettings) {}
+  void endTransaction() {}
+  // The card answers CMD0 (the mount probe) with "idle", and nothing else
+  uint8_t transfer(uint8_t data) {
+    if (_commandBytes > 0) {
+      _commandBytes--;
+      _answer = _commandBytes == 0;
+      return 0xFF;
+    }
+    if (data == 0x40) {
+      _commandBytes = 5;
+      return 0xFF;
+    }
+    if (_answer) {
+      _answer = false;
+      return 0x01;
+    }
+    return 0xFF;
+  }
+
+private:
+  uint8_t _commandBytes = 0;
+  bool _answer = false;
+};
+extern SPIClass SPI;
+
+#endif // SOAK_SPI_H
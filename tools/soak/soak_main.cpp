@@ -0,0 +1,1014 @@
+/*
+ * Soak Harness for Ghostkey - Host Side
+ *
+ * Runs the sketch on a PC against a card directory for as many payload
+ * repetitions (REPEAT_COUNT) as asked, and checks that nothing grows from
+ * one repetition to the next. Build and run it with tools/soak.py, which
+ * concatenates the sketch tabs the way the Arduino builder does and links
+ * them with this file and the host core in tools/soak/host.
+ *
+ * What it provides:
+ *   - a virtual clock: time only moves when the sketch waits, sends a
+ *     report or reads and writes the card (at SPI card speeds), so hours
+ *     of payload run in seconds. Each clock read moves it a little; reads
+ *     with nothing else happening in between (a wait loop) move it further
+ *     each time, up to 1 ms, so waits finish quickly while code that does
+ *     work between reads still sees fine-grained time
+ *   - a tracked heap modelled on newlib-nano's malloc (first fit, split
+ *     off the top of a free chunk, realloc never shrinks, freed memory is
+ *     coalesced but never returned), capped at --heap bytes
+ *   - the card in memory (32 MB), so the card directory is never written
+ *
+ * Every repetition starts with the sketch's "Opening script file..." line.
+ * At that point the harness samples the heap (bytes and blocks in use, heap
+ * top, fragmentation) and the clock; each repetition also records how many
+ * allocations it made and how long it took. After --warmup repetitions the
+ * rest are split into two halves. A figure grows when even its lowest value
+ * in the second half is above its highest in the first: that ignores the
+ * ups and downs of String sizes from one repetition to the next but catches
+ * any steady leak once the run is long enough. The soak fails when a figure
+ * grows, when the heap top moves in the second half, when an allocation
+ * fails or when the firmware resets the board.
+ *
+ * Built with GHOSTKEY_REPORT_FIFO (tools/soak.py --dual-core), the sketch
+ * queues its reports on hidReportFifo the way the RP2040 build does, and a
+ * second thread plays core 0 (usb_core.ino): it takes one report off the
+ * ring per USB frame of virtual time. Time cannot pass a frame at which a
+ * report is due until that thread has taken it, so both threads see the
+ * same timeline on every run and the result does not depend on how the PC
+ * schedules them. Every report reaching the "host" goes into a digest; a
+ * dual-core run must end with the same digest as a single-core run.
+ *
+ * Exit status: 0 passed, 1 something grew or failed, 2 the payload stopped
+ * before the requested repetitions (raise REPEAT_COUNT) or usage error.
+ */
+
+#include <dirent.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <atomic>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <SD.h>
+#include <SPI.h>
+#include <Keyboard.h>
+
+#ifdef GHOSTKEY_REPORT_FIFO
+#include <thread>
+#include "lib/report-fifo.h"
+
+extern ReportFifo<KeyReport, REPORT_FIFO_DEPTH> hidReportFifo;
+#endif
+
+// The harness itself uses the C library's heap
+#undef malloc
+#undef calloc
+#undef realloc
+#undef free
+
+#define SOAK_HEAP_MAX (1024UL * 1024UL)   // Largest --heap
+#define SOAK_HEAP_DEFAULT 16384UL         // Heap left to the sketch on the SAMD21 (approximate)
+#define SOAK_CHUNK_HEADER 8               // Size word, padded to the alignment
+#define SOAK_CHUNK_MIN 16
+#define SOAK_SPIN_MAX_MICROS 1000         // Longest clock step in a wait loop
+#define SOAK_REPORT_MICROS 1000           // One USB frame per HID report
+#define SOAK_READ_NANOS_PER_BYTE 1000     // Card over SPI: about 1 MB/s reading
+#define SOAK_WRITE_NANOS_PER_BYTE 2000    // and 500 KB/s writing
+#define SOAK_CARD_BYTES (32UL * 1024UL * 1024UL) // The card is full beyond this
+#define SOAK_CARD_CLUSTERS (SOAK_CARD_BYTES / SOAK_CLUSTER_BYTES) // FAT16 clusters (SD.h)
+#define SOAK_FAT_ENTRY_NANOS 2000         // Following one FAT entry in the block cache
+#define SOAK_ITERATION_LINE "Opening script file..."
+
+void setup();
+void loop();
+
+Serial_ Serial;
+SDClass SD;
+SPIClass SPI;
+Keyboard_ Keyboard;
+
+// ---------------------------------------------------------------------------
+// Options
+
+static unsigned long soakIterations = 100000;
+static unsigned long soakWarmup = 2;
+static unsigned long soakReportEvery = 0;
+static unsigned long soakHeapLimit = SOAK_HEAP_DEFAULT;
+static bool soakVerbose = false;
+
+// ---------------------------------------------------------------------------
+// Tracked heap
+
+struct SoakFreeChunk {
+  uint32_t size;
+  uint32_t next; // Offset of the next free chunk, 0 at the end of the list
+};
+
+alignas(16) static uint8_t soakArena[SOAK_HEAP_MAX];
+static uint32_t soakHeapTop = SOAK_CHUNK_HEADER; // Offset 0 is never a chunk, so 0 can end the list
+static uint32_t soakFreeList = 0;
+static unsigned long soakLiveBytes = 0;
+static unsigned long soakLiveBlocks = 0;
+static unsigned long soakPeakLiveBytes = 0;
+static unsigned long long soakAllocations = 0;
+static unsigned long soakFailedAllocations = 0;
+
+static inline uint32_t &chunkSize(uint32_t chunk) { return *(uint32_t *)(soakArena + chunk); }
+static inline SoakFreeChunk *freeChunk(uint32_t chunk) { return (SoakFreeChunk *)(soakArena + chunk); }
+static inline uint32_t chunkOf(void *pointer) { return (uint32_t)((uint8_t *)pointer - soakArena) - SOAK_CHUNK_HEADER; }
+
+static void *heapAllocate(size_t size) {
+  uint32_t need = (uint32_t)((size + SOAK_CHUNK_HEADER + 7) & ~(size_t)7);
+  if (need < SOAK_CHUNK_MIN) {
+    need = SOAK_CHUNK_MIN;
+  }
+  uint32_t previous = 0;
+  uint32_t chunk = soakFreeList;
+  while (chunk && freeChunk(chunk)->size < need) {
+    previous = chunk;
+    chunk = freeChunk(chunk)->next;
+  }
+  if (chunk) {
+    uint32_t rest = freeChunk(chunk)->size - need;
+    if (rest >= SOAK_CHUNK_MIN) {
+      // Hand out the top of the chunk, the rest stays on the list
+      freeChunk(chunk)->size = rest;
+      chunk += rest;
+      chunkSize(chunk) = need;
+    } else if (previous) {
+      freeChunk(previous)->next = freeChunk(chunk)->next;
+    } else {
+      soakFreeList = freeChunk(chunk)->next;
+    }
+  } else {
+    if (soakHeapTop + need > soakHeapLimit) {
+      soakFailedAllocations++;
+      return NULL;
+    }
+    chunk = soakHeapTop;
+    soakHeapTop += need;
+    chunkSize(chunk) = need;
+  }
+  soakLiveBytes += chunkSize(chunk);
+  soakLiveBlocks++;
+  if (soakLiveBytes > soakPeakLiveBytes) {
+    soakPeakLiveBytes = soakLiveBytes;
+  }
+  return soakArena + chunk + SOAK_CHUNK_HEADER;
+}
+
+static void heapRelease(void *pointer) {
+  uint32_t chunk = chunkOf(pointer);
+  uint32_t size = chunkSize(chunk);
+  soakLiveBytes -= size;
+  soakLiveBlocks--;
+
+  // Insert by address and merge with the neighbours
+  uint32_t previous = 0;
+  uint32_t next = soakFreeList;
+  while (next && next < chunk) {
+    previous = next;
+    next = freeChunk(next)->next;
+  }
+  freeChunk(chunk)->size = size;
+  freeChunk(chunk)->next = next;
+  if (next && chunk + size == next) {
+    freeChunk(chunk)->size += freeChunk(next)->size;
+    freeChunk(chunk)->next = freeChunk(next)->next;
+  }
+  if (previous && previous + freeChunk(previous)->size == chunk) {
+    freeChunk(previous)->size += freeChunk(chunk)->size;
+    freeChunk(previous)->next = freeChunk(chunk)->next;
+  } else if (previous) {
+    freeChunk(previous)->next = chunk;
+  } else {
+    soakFreeList = chunk;
+  }
+}
+
+void *soakMalloc(size_t size) {
+  soakAllocations++;
+  return heapAllocate(size);
+}
+
+void *soakCalloc(size_t count, size_t size) {
+  if (size != 0 && count > (size_t)-1 / size) {
+    return NULL;
+  }
+  void *pointer = soakMalloc(count * size);
+  if (pointer) {
+    memset(pointer, 0, count * size);
+  }
+  return pointer;
+}
+
+void soakFree(void *pointer) {
+  if (pointer) {
+    heapRelease(pointer);
+  }
+}
+
+void *soakRealloc(void *pointer, size_t size) {
+  if (!pointer) {
+    return soakMalloc(size);
+  }
+  if (size == 0) {
+    soakFree(pointer);
+    return NULL;
+  }
+  soakAllocations++;
+  uint32_t oldSize = chunkSize(chunkOf(pointer)) - SOAK_CHUNK_HEADER;
+  if (oldSize >= size) {
+    return pointer;
+  }
+  void *moved = heapAllocate(size);
+  if (moved) {
+    memcpy(moved, pointer, oldSize);
+    heapRelease(pointer);
+  }
+  return moved;
+}
+
+struct SoakHeapState {
+  unsigned long liveBytes;
+  unsigned long liveBlocks;
+  unsigned long top;
+  unsigned long largestFree; // Largest allocation that would still succeed
+  unsigned long fragmentation; // Per mille of the free memory not in the largest block
+};
+
+static SoakHeapState heapState() {
+  SoakHeapState state;
+  state.liveBytes = soakLiveBytes;
+  state.liveBlocks = soakLiveBlocks;
+  state.top = soakHeapTop;
+  unsigned long freeBytes = soakHeapLimit - soakHeapTop;
+  unsigned long largest = freeBytes;
+  for (uint32_t chunk = soakFreeList; chunk; chunk = freeChunk(chunk)->next) {
+    freeBytes += freeChunk(chunk)->size;
+    if (freeChunk(chunk)->size > largest) {
+      largest = freeChunk(chunk)->size;
+    }
+  }
+  state.largestFree = largest > SOAK_CHUNK_HEADER ? largest - SOAK_CHUNK_HEADER : 0;
+  state.fragmentation = freeBytes ? (unsigned long)((freeBytes - largest) * 1000ULL / freeBytes) : 0;
+  return state;
+}
+
+// ---------------------------------------------------------------------------
+// Virtual clock
+
+// Only the sketch's thread moves the clock; the core 0 thread reads it
+static std::atomic<unsigned long long> soakClockMicros(0);
+static unsigned long soakSpinStep = 1;
+
+#ifdef GHOSTKEY_REPORT_FIFO
+static std::atomic<unsigned long long> soakUsbFrame(0); // Virtual time the endpoint is free again
+
+// Hold the clock while a queued report is due and core 0 has not taken it
+static void waitForUsbCore() {
+  while (!hidReportFifo.empty() && soakClockMicros >= soakUsbFrame) {
+    std::this_thread::yield();
+  }
+}
+#endif
+
+static void advanceClock(unsigned long long micros) {
+#ifdef GHOSTKEY_REPORT_FIFO
+  // Stop at the next frame a report is due at, so core 0 sends it on time
+  while (micros > 0) {
+    waitForUsbCore();
+    unsigned long long clock = soakClockMicros;
+    unsigned long long step = micros;
+    if (!hidReportFifo.empty() && soakUsbFrame - clock < step) {
+      step = soakUsbFrame - clock;
+    }
+    soakClockMicros = clock + step;
+    micros -= step;
+  }
+  waitForUsbCore();
+#else
+  soakClockMicros += micros;
+#endif
+}
+
+static unsigned long long readClock() {
+#ifdef GHOSTKEY_REPORT_FIFO
+  // A queued report is the sketch sending, not a wait loop
+  if (!hidReportFifo.empty()) {
+    soakSpinStep = 1;
+  }
+#endif
+  advanceClock(soakSpinStep);
+  if (soakSpinStep < SOAK_SPIN_MAX_MICROS) {
+    soakSpinStep = (soakSpinStep * 2 < SOAK_SPIN_MAX_MICROS) ? soakSpinStep * 2 : SOAK_SPIN_MAX_MICROS;
+  }
+  return soakClockMicros;
+}
+
+// The sketch did something other than read the clock
+void soakActivity(uint32_t micros) {
+  advanceClock(micros);
+  soakSpinStep = 1;
+}
+
+// Truncated to the width of unsigned long, so a 32 bit build wraps like the board
+unsigned long micros() { return (unsigned long)readClock(); }
+unsigned long millis() { return (unsigned long)(readClock() / 1000); }
+
+// The SAMD core's delay(): yield() on every pass until the time is up
+void delay(unsigned long ms) {
+  if (ms == 0) {
+    return;
+  }
+  unsigned long start = micros();
+  while (ms > 0) {
+    yield();
+    while (ms > 0 && (micros() - start) >= 1000) {
+      ms--;
+      start += 1000;
+    }
+  }
+}
+
+void delayMicroseconds(unsigned int us) {
+  soakActivity(us);
+}
+
+// ---------------------------------------------------------------------------
+// In-memory card
+
+struct SoakNode {
+  std::string name;
+  std::string key; // Lower-case path
+  bool directory;
+  std::vector<uint8_t> data;
+  std::vector<uint32_t> clusters; // Cluster chain on the FAT16 volume
+  std::vector<int> children;
+  int parent;
+  uint16_t writeDate; // FAT date and time of the last write
+  uint16_t writeTime;
+};
+
+static std::vector<SoakNode> soakNodes;
+static std::map<std::string, int> soakPaths;
+static unsigned long long soakCardUsed = 0; // Bytes in all files
+
+// The FAT16 volume: cluster chains, and the file and file cluster behind
+// every cluster so data blocks can be read
+static std::vector<uint16_t> soakFat(SOAK_CARD_CLUSTERS + 2, 0);
+static std::vector<int> soakClusterNode(SOAK_CARD_CLUSTERS + 2, -1);
+static std::vector<uint32_t> soakClusterIndex(SOAK_CARD_CLUSTERS + 2, 0);
+static uint32_t soakAllocStart = 2;
+
+// Grow or shrink a file's chain to the clusters size needs. Like SdFat, a
+// growing file takes the next free cluster after its last one, so files
+// written at the same time interleave. False when the card is full.
+static bool fitClusters(int node, size_t size) {
+  std::vector<uint32_t> &clusters = soakNodes[node].clusters;
+  size_t needed = (size + SOAK_CLUSTER_BYTES - 1) / SOAK_CLUSTER_BYTES;
+  while (clusters.size() > needed) {
+    soakFat[clusters.back()] = 0;
+    soakClusterNode[clusters.back()] = -1;
+    clusters.pop_back();
+    if (!clusters.empty()) {
+      soakFat[clusters.back()] = 0xFFFF;
+    }
+  }
+  while (clusters.size() < needed) {
+    uint32_t start = clusters.empty() ? soakAllocStart : clusters.back() + 1;
+    uint32_t cluster = 0;
+    for (uint32_t i = 0; i < SOAK_CARD_CLUSTERS && cluster == 0; i++) {
+      uint32_t candidate = 2 + (start - 2 + i) % SOAK_CARD_CLUSTERS;
+      if (soakClusterNode[candidate] < 0) {
+        cluster = candidate;
+      }
+    }
+    if (cluster == 0) {
+      return false;
+    }
+    if (clusters.empty()) {
+      soakAllocStart = cluster + 1;
+    } else {
+      soakFat[clusters.back()] = (uint16_t)cluster;
+    }
+    soakFat[cluster] = 0xFFFF;
+    soakClusterNode[cluster] = node;
+    soakClusterIndex[cluster] = (uint32_t)clusters.size();
+    clusters.push_back(cluster);
+  }
+  return true;
+}
+
+static std::string cardKey(const char *path) {
+  std::string key = "/";
+  for (const char *c = path; *c; c++) {
+    if (*c == '/' && key.back() == '/') {
+      continue;
+    }
+    key += (char)tolower((unsigned char)*c);
+  }
+  if (key.size() > 1 && key.back() == '/') {
+    key.pop_back();
+  }
+  return key;
+}
+
+static int addNode(int parent, const std::string &name, bool directory) {
+  SoakNode node;
+  node.name = name;
+  node.key = parent < 0 ? "/" : cardKey((soakNodes[parent].key + "/" + name).c_str());
+  node.directory = directory;
+  node.parent = parent;
+  node.writeDate = (20 << 9) | (1 << 5) | 1; // 2000-01-01, as SdFat without a dateTime callback
+  node.writeTime = 0;
+  soakNodes.push_back(node);
+  int index = (int)soakNodes.size() - 1;
+  soakPaths[soakNodes[index].key] = index;
+  if (parent >= 0) {
+    soakNodes[parent].children.push_back(index);
+  }
+  return index;
+}
+
+static bool loadDirectory(const std::string &path, int parent) {
+  DIR *dir = opendir(path.c_str());
+  if (!dir) {
+    return false;
+  }
+  std::vector<std::string> names;
+  while (struct dirent *entry = readdir(dir)) {
+    if (entry->d_name[0] != '.') {
+      names.push_back(entry->d_name);
+    }
+  }
+  closedir(dir);
+  for (size_t i = 0; i < names.size(); i++) {
+    std::string full = path + "/" + names[i];
+    struct stat info;
+    if (stat(full.c_str(), &info) != 0) {
+      continue;
+    }
+    if (S_ISDIR(info.st_mode)) {
+      loadDirectory(full, addNode(parent, names[i], true));
+    } else if (S_ISREG(info.st_mode)) {
+      int node = addNode(parent, names[i], false);
+      struct tm local;
+      localtime_r(&info.st_mtime, &local);
+      soakNodes[node].writeDate = ((local.tm_year - 80) << 9) | ((local.tm_mon + 1) << 5) | local.tm_mday;
+      soakNodes[node].writeTime = (local.tm_hour << 11) | (local.tm_min << 5) | (local.tm_sec / 2);
+      FILE *file = fopen(full.c_str(), "rb");
+      if (file) {
+        uint8_t buffer[4096];
+        size_t n;
+        while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+          soakNodes[node].data.insert(soakNodes[node].data.end(), buffer, buffer + n);
+          soakCardUsed += n;
+        }
+        fclose(file);
+      }
+      fitClusters(node, soakNodes[node].data.size());
+    }
+  }
+  return true;
+}
+
+int soakCardFind(const char *path) {
+  std::map<std::string, int>::iterator found = soakPaths.find(cardKey(path));
+  return found == soakPaths.end() ? -1 : found->second;
+}
+
+int soakCardCreate(const char *path, bool directory) {
+  soakActivity(0);
+  std::string key = cardKey(path);
+  if (soakPaths.count(key)) {
+    return directory ? -1 : soakPaths[key];
+  }
+  size_t slash = key.rfind('/');
+  int parent = soakCardFind(slash == 0 ? "/" : key.substr(0, slash).c_str());
+  if (parent < 0 || !soakNodes[parent].directory) {
+    return -1;
+  }
+  const char *name = path + strlen(path);
+  while (name > path && name[-1] != '/') {
+    name--;
+  }
+  return addNode(parent, name, directory);
+}
+
+bool soakCardRemove(const char *path, bool directory) {
+  soakActivity(0);
+  int node = soakCardFind(path);
+  if (node <= 0 || soakNodes[node].directory != directory ||
+      (directory && !soakNodes[node].children.empty())) {
+    return false;
+  }
+  std::vector<int> &siblings = soakNodes[soakNodes[node].parent].children;
+  for (size_t i = 0; i < siblings.size(); i++) {
+    if (siblings[i] == node) {
+      siblings.erase(siblings.begin() + i);
+      break;
+    }
+  }
+  soakPaths.erase(soakNodes[node].key);
+  soakCardUsed -= soakNodes[node].data.size();
+  std::vector<uint8_t>().swap(soakNodes[node].data); // Open handles read an empty file
+  fitClusters(node, 0);
+  return true;
+}
+
+bool soakCardIsDirectory(int node) { return soakNodes[node].directory; }
+const char *soakCardName(int node) { return node == 0 ? "/" : soakNodes[node].name.c_str(); }
+uint32_t soakCardSize(int node) { return (uint32_t)soakNodes[node].data.size(); }
+
+int soakCardChild(int node, int index) {
+  const std::vector<int> &children = soakNodes[node].children;
+  return index < (int)children.size() ? children[index] : -1;
+}
+
+// Row erases of the emulated EEPROM (FlashStorage.h)
+unsigned long long soakFlashErases = 0;
+
+// Card transfers take time on the virtual clock
+static unsigned long long soakCardNanos = 0;
+
+static void cardTransfer(size_t bytes, unsigned long nanosPerByte) {
+  soakCardNanos += bytes * nanosPerByte;
+  soakActivity((uint32_t)(soakCardNanos / 1000));
+  soakCardNanos %= 1000;
+}
+
+size_t soakCardRead(int node, uint32_t position, uint8_t *buffer, size_t size) {
+  const std::vector<uint8_t> &data = soakNodes[node].data;
+  if (position >= data.size()) {
+    soakActivity(0);
+    return 0;
+  }
+  size_t n = std::min(size, data.size() - position);
+  memcpy(buffer, data.data() + position, n);
+  cardTransfer(n, SOAK_READ_NANOS_PER_BYTE);
+  return n;
+}
+
+// SdFile::seekSet(): the chain is followed from the current cluster, or
+// from the file's first cluster when the target lies in an earlier one.
+// The FAT sector has to be read first (the block cache holds file data).
+static unsigned long long soakCardRewinds = 0;
+static unsigned long long soakCardChainSteps = 0;
+
+void soakCardSeek(uint32_t from, uint32_t to) {
+  if (to == 0) {
+    return; // Back to the first cluster without reading the FAT
+  }
+  uint32_t target = (to - 1) / SOAK_CLUSTER_BYTES;
+  uint32_t current = (from > 0) ? (from - 1) / SOAK_CLUSTER_BYTES : 0;
+  uint32_t steps;
+  if (from == 0 || target < current) {
+    soakCardRewinds += (from > 0);
+    steps = target;
+  } else {
+    steps = target - current;
+  }
+  if (steps > 0) {
+    soakCardChainSteps += steps;
+    cardTransfer(512, SOAK_READ_NANOS_PER_BYTE);
+    cardTransfer(steps, SOAK_FAT_ENTRY_NANOS);
+  }
+}
+
+size_t soakCardWrite(int node, uint32_t position, const uint8_t *buffer, size_t size) {
+  cardTransfer(size, SOAK_WRITE_NANOS_PER_BYTE);
+  std::vector<uint8_t> &data = soakNodes[node].data;
+  if (position + size > data.size()) {
+    if (soakCardUsed + position + size - data.size() > SOAK_CARD_BYTES) {
+      return 0;
+    }
+    if (!fitClusters(node, position + size)) {
+      fitClusters(node, data.size());
+      return 0;
+    }
+    soakCardUsed += position + size - data.size();
+    data.resize(position + size);
+  }
+  memcpy(data.data() + position, buffer, size);
+  return size;
+}
+
+void soakCardTruncate(int node) {
+  soakCardUsed -= soakNodes[node].data.size();
+  soakNodes[node].data.clear();
+  fitClusters(node, 0);
+}
+
+uint32_t soakCardFirstCluster(int node) {
+  return soakNodes[node].clusters.empty() ? 0 : soakNodes[node].clusters[0];
+}
+
+// Files the sketch writes keep the date they were created with: the SD
+// library only stamps a write when a dateTime callback is set
+void soakCardWriteStamp(int node, uint16_t &date, uint16_t &time) {
+  date = soakNodes[node].writeDate;
+  time = soakNodes[node].writeTime;
+}
+
+// Sd2Card::readBlock(): the FAT, or a data block of whichever file owns
+// its cluster (zeros past the end of the file or in a free cluster)
+static unsigned long long soakCardBlockReads = 0;
+
+bool soakCardReadBlock(uint32_t block, uint8_t *buffer) {
+  cardTransfer(512, SOAK_READ_NANOS_PER_BYTE);
+  soakCardBlockReads++;
+  memset(buffer, 0, 512);
+  if (block >= SOAK_FAT_START_BLOCK && block < SOAK_DATA_START_BLOCK) {
+    size_t first = (block - SOAK_FAT_START_BLOCK) * 256;
+    for (size_t i = 0; i < 256 && first + i < soakFat.size(); i++) {
+      buffer[2 * i] = soakFat[first + i] & 0xFF;
+      buffer[2 * i + 1] = soakFat[first + i] >> 8;
+    }
+    return true;
+  }
+  if (block < SOAK_DATA_START_BLOCK) {
+    return true; // Boot sector
+  }
+  uint32_t cluster = 2 + (block - SOAK_DATA_START_BLOCK) / SOAK_BLOCKS_PER_CLUSTER;
+  if (cluster >= soakFat.size()) {
+    return false;
+  }
+  int node = soakClusterNode[cluster];
+  if (node >= 0) {
+    const std::vector<uint8_t> &data = soakNodes[node].data;
+    size_t offset = (size_t)soakClusterIndex[cluster] * SOAK_CLUSTER_BYTES +
+                    (block - SOAK_DATA_START_BLOCK) % SOAK_BLOCKS_PER_CLUSTER * 512;
+    if (offset < data.size()) {
+      memcpy(buffer, data.data() + offset, std::min((size_t)512, data.size() - offset));
+    }
+  }
+  return true;
+}
+
+// ---------------------------------------------------------------------------
+// Keyboard library: only begin() and the layouts are used (lib/hid-output.h)
+
+static unsigned long long soakReports = 0;
+static unsigned long long soakReportDigest = 14695981039346656037ULL; // FNV-1a over every report sent
+
+static void digestReport(const void *report, int length) {
+  const uint8_t *bytes = (const uint8_t *)report;
+  for (int i = 0; i < length; i++) {
+    soakReportDigest = (soakReportDigest ^ bytes[i]) * 1099511628211ULL;
+  }
+  soakReports++;
+}
+
+void soakHidReport(const void *report, int length) {
+  digestReport(report, length);
+  soakActivity(SOAK_REPORT_MICROS);
+}
+
+#ifdef GHOSTKEY_REPORT_FIFO
+// ---------------------------------------------------------------------------
+// Core 0: one queued report per USB frame (usb_core.ino)
+
+static std::atomic<bool> soakUsbCoreRunning(false);
+static std::thread soakUsbCore;
+static uint16_t soakFifoDeepest = 0;
+
+static void usbCoreLoop() {
+  while (soakUsbCoreRunning) {
+    KeyReport report;
+    // The clock is read after the report is seen: from then on it holds at a due frame
+    if (hidReportFifo.peek(report) && soakClockMicros >= soakUsbFrame) {
+      uint16_t depth = hidReportFifo.depth();
+      soakFifoDeepest = std::max(soakFifoDeepest, depth);
+      digestReport(&report, sizeof(report));
+      soakUsbFrame = soakClockMicros + SOAK_REPORT_MICROS;
+      hidReportFifo.pop();
+    } else {
+      std::this_thread::yield();
+    }
+  }
+}
+
+static void startUsbCore() {
+  soakUsbCoreRunning = true;
+  soakUsbCore = std::thread(usbCoreLoop);
+}
+
+// Let core 0 send what is still queued, then stop it
+static void stopUsbCore() {
+  if (!soakUsbCoreRunning) {
+    return;
+  }
+  while (!hidReportFifo.empty()) {
+    advanceClock(SOAK_REPORT_MICROS);
+  }
+  soakUsbCoreRunning = false;
+  soakUsbCore.join();
+}
+#endif
+
+Keyboard_::Keyboard_(void) : _asciimap(KeyboardLayout_en_US) { memset(&_keyReport, 0, sizeof(_keyReport)); }
+void Keyboard_::begin(const uint8_t *layout) { _asciimap = layout; }
+void Keyboard_::end(void) {}
+void Keyboard_::sendReport(KeyReport *keys) { HID().SendReport(2, keys, sizeof(KeyReport)); }
+size_t Keyboard_::press(uint8_t) { return 1; }
+size_t Keyboard_::release(uint8_t) { return 1; }
+void Keyboard_::releaseAll(void) {}
+size_t Keyboard_::write(uint8_t) { return 1; }
+size_t Keyboard_::write(const uint8_t *, size_t size) { return size; }
+
+// Which keys a soak types does not matter, so every layout uses the US map
+#define SHIFT 0x80
+#define SOAK_LAYOUT { \
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x2b, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x2c, 0x1e | SHIFT, 0x34 | SHIFT, 0x20 | SHIFT, 0x21 | SHIFT, 0x22 | SHIFT, 0x24 | SHIFT, 0x34, \
+  0x26 | SHIFT, 0x27 | SHIFT, 0x25 | SHIFT, 0x2e | SHIFT, 0x36, 0x2d, 0x37, 0x38, \
+  0x27, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, \
+  0x33 | SHIFT, 0x33, 0x36 | SHIFT, 0x2e, 0x37 | SHIFT, 0x38 | SHIFT, \
+  0x1f | SHIFT, 0x04 | SHIFT, 0x05 | SHIFT, 0x06 | SHIFT, 0x07 | SHIFT, 0x08 | SHIFT, 0x09 | SHIFT, 0x0a | SHIFT, \
+  0x0b | SHIFT, 0x0c | SHIFT, 0x0d | SHIFT, 0x0e | SHIFT, 0x0f | SHIFT, 0x10 | SHIFT, 0x11 | SHIFT, 0x12 | SHIFT, \
+  0x13 | SHIFT, 0x14 | SHIFT, 0x15 | SHIFT, 0x16 | SHIFT, 0x17 | SHIFT, 0x18 | SHIFT, 0x19 | SHIFT, 0x1a | SHIFT, \
+  0x1b | SHIFT, 0x1c | SHIFT, 0x1d | SHIFT, 0x2f, 0x31, 0x30, 0x23 | SHIFT, 0x2d | SHIFT, \
+  0x35, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, \
+  0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, \
+  0x2f | SHIFT, 0x31 | SHIFT, 0x30 | SHIFT, 0x35 | SHIFT, 0x00 }
+
+const uint8_t KeyboardLayout_en_US[128] = SOAK_LAYOUT;
+const uint8_t KeyboardLayout_de_DE[128] = SOAK_LAYOUT;
+const uint8_t KeyboardLayout_es_ES[128] = SOAK_LAYOUT;
+const uint8_t KeyboardLayout_fr_FR[128] = SOAK_LAYOUT;
+const uint8_t KeyboardLayout_it_IT[128] = SOAK_LAYOUT;
+const uint8_t KeyboardLayout_pt_PT[128] = SOAK_LAYOUT;
+const uint8_t KeyboardLayout_sv_SE[128] = SOAK_LAYOUT;
+const uint8_t KeyboardLayout_da_DK[128] = SOAK_LAYOUT;
+const uint8_t KeyboardLayout_hu_HU[128] = SOAK_LAYOUT;
+
+// ---------------------------------------------------------------------------
+// Repetitions
+
+struct SoakSample {
+  unsigned long long micros;
+  unsigned long long allocations;
+  SoakHeapState heap;
+};
+
+// Lowest and highest value of a figure over half of the measured repetitions
+struct SoakRange {
+  unsigned long long low;
+  unsigned long long high;
+};
+
+enum SoakFigure { FIGURE_HEAP_USED, FIGURE_BLOCKS, FIGURE_FRAGMENTATION, FIGURE_ALLOCATIONS, FIGURE_MICROS, FIGURE_COUNT };
+
+static const char *const SOAK_FIGURE_NAMES[FIGURE_COUNT] = {
+  "heap used", "blocks in use", "fragmentation (per mille)", "allocations/rep", "us/rep"
+};
+
+struct SoakHalf {
+  unsigned long repetitions;
+  SoakRange figures[FIGURE_COUNT];
+  unsigned long maxTop;
+};
+
+static unsigned long soakStarted = 0; // Repetitions started so far
+static SoakSample soakLast;
+static SoakHalf soakHalves[2];
+static unsigned long long soakFirstMicros = 0; // Duration of the first measured repetition
+static long long soakDriftMicros = 0;          // Sum of (duration - first duration)
+static unsigned long soakMinLargestFree = (unsigned long)-1;
+
+static SoakSample takeSample() {
+  SoakSample sample;
+  sample.micros = soakClockMicros;
+  sample.allocations = soakAllocations;
+  sample.heap = heapState();
+  return sample;
+}
+
+static void printRowHeader() {
+  printf("%10s %12s %10s %7s %9s %6s %10s %10s\n", "repetition", "virtual s", "heap used", "blocks",
+         "heap top", "frag%", "allocs/rep", "ms/rep");
+}
+
+static void printRow(unsigned long repetition, const SoakSample &sample, unsigned long long allocations,
+                     unsigned long long micros) {
+  printf("%10lu %12.1f %10lu %7lu %9lu %6.1f %10llu %10.2f\n", repetition, sample.micros / 1e6,
+         sample.heap.liveBytes, sample.heap.liveBlocks, sample.heap.top,
+         sample.heap.fragmentation / 10.0, allocations, micros / 1000.0);
+}
+
+// Repetition `repetition` has ended with `sample`
+static void recordRepetition(unsigned long repetition, const SoakSample &sample) {
+  unsigned long long allocations = sample.allocations - soakLast.allocations;
+  unsigned long long micros = sample.micros - soakLast.micros;
+  if (sample.heap.largestFree < soakMinLargestFree) {
+    soakMinLargestFree = sample.heap.largestFree;
+  }
+  if (repetition % soakReportEvery == 0 || repetition == 1) {
+    printRow(repetition, sample, allocations, micros);
+  }
+  if (repetition <= soakWarmup) {
+    return;
+  }
+  unsigned long measured = soakIterations - soakWarmup;
+  SoakHalf &half = soakHalves[(repetition - soakWarmup - 1) < measured / 2 ? 0 : 1];
+  // The heap is sampled where the next repetition starts, after this one cleaned up
+  unsigned long long values[FIGURE_COUNT] = {
+    sample.heap.liveBytes, sample.heap.liveBlocks, sample.heap.fragmentation, allocations, micros
+  };
+  for (int i = 0; i < FIGURE_COUNT; i++) {
+    SoakRange &range = half.figures[i];
+    if (half.repetitions == 0 || values[i] < range.low) {
+      range.low = values[i];
+    }
+    if (half.repetitions == 0 || values[i] > range.high) {
+      range.high = values[i];
+    }
+  }
+  half.maxTop = std::max(half.maxTop, sample.heap.top);
+  half.repetitions++;
+  if (repetition == soakWarmup + 1) {
+    soakFirstMicros = micros;
+  }
+  soakDriftMicros += (long long)micros - (long long)soakFirstMicros;
+}
+
+static int finishSoak(bool completed, const char *reason) {
+#ifdef GHOSTKEY_REPORT_FIFO
+  stopUsbCore();
+#endif
+  fflush(stdout);
+  printf("\nSoak: %lu of %lu repetitions, %.1f virtual hours, %llu HID reports\n",
+         completed ? soakIterations : soakStarted, soakIterations,
+         soakClockMicros / 3.6e9, soakReports);
+  SoakHeapState heap = heapState();
+  printf("Heap: %lu bytes limit, peak %lu bytes in use, top %lu, smallest largest free block %lu\n",
+         soakHeapLimit, soakPeakLiveBytes, heap.top,
+         soakMinLargestFree == (unsigned long)-1 ? heap.largestFree : soakMinLargestFree);
+  printf("Cumulative drift against the first measured repetition: %+.3f ms\n", soakDriftMicros / 1000.0);
+  printf("HID report digest: %016llx\n", soakReportDigest);
+  printf("Flash row erases: %llu\n", soakFlashErases);
+  printf("Card seeks: %llu backwards, %llu FAT entries followed; %llu blocks read through extent maps\n",
+         soakCardRewinds, soakCardChainSteps, soakCardBlockReads);
+#ifdef GHOSTKEY_REPORT_FIFO
+  printf("Report FIFO: deepest %u of %d, %lu reports waited for a free slot\n", soakFifoDeepest,
+         REPORT_FIFO_DEPTH, (unsigned long)hidReportFifo.fullWaits());
+#endif
+
+  int failures = 0;
+  if (reason) {
+    printf("FAIL: %s\n", reason);
+    failures++;
+  }
+  if (soakFailedAllocations) {
+    printf("FAIL: %lu allocations failed (heap limit %lu bytes)\n", soakFailedAllocations, soakHeapLimit);
+    failures++;
+  }
+  const SoakHalf &first = soakHalves[0];
+  const SoakHalf &second = soakHalves[1];
+  if (first.repetitions == 0 || second.repetitions == 0) {
+    printf("Too few repetitions after the warm-up to compare (need at least 2)\n");
+  } else {
+    printf("%-26s %23s %23s\n", "low..high", "first half", "second half");
+    for (int i = 0; i < FIGURE_COUNT; i++) {
+      const SoakRange &a = first.figures[i];
+      const SoakRange &b = second.figures[i];
+      printf("%-26s %11llu..%-11llu %11llu..%-11llu\n", SOAK_FIGURE_NAMES[i], a.low, a.high, b.low, b.high);
+      if (b.low > a.high) {
+        printf("FAIL: %s grows\n", SOAK_FIGURE_NAMES[i]);
+        failures++;
+      }
+    }
+    if (second.maxTop > first.maxTop) {
+      printf("FAIL: heap top grows (%lu -> %lu bytes)\n", first.maxTop, second.maxTop);
+      failures++;
+    }
+  }
+  if (!completed && !reason) {
+    printf("The payload stopped after %lu repetitions; set REPEAT_COUNT in config.txt to at least %lu\n",
+           soakStarted, soakIterations);
+    return failures ? 1 : 2;
+  }
+  printf(failures ? "Soak FAILED\n" : "Soak passed\n");
+  return failures ? 1 : 0;
+}
+
+static void serialLine(const char *line) {
+  if (strcmp(line, SOAK_ITERATION_LINE) != 0) {
+    return;
+  }
+  SoakSample sample = takeSample();
+  if (soakStarted > 0) {
+    recordRepetition(soakStarted, sample);
+  }
+  soakLast = sample;
+  if (soakStarted == soakIterations) {
+    exit(finishSoak(true, NULL));
+  }
+  soakStarted++;
+}
+
+size_t Serial_::write(uint8_t c) {
+  static char line[256];
+  static size_t length = 0;
+  if (soakVerbose) {
+    fputc(c, stdout);
+  }
+  if (c == '\n') {
+    line[length] = 0;
+    if (length && line[length - 1] == '\r') {
+      line[length - 1] = 0;
+    }
+    length = 0;
+    soakActivity(0);
+    serialLine(line);
+  } else if (length < sizeof(line) - 1) {
+    line[length++] = (char)c;
+  }
+  return 1;
+}
+
+void NVIC_SystemReset() {
+  exit(finishSoak(false, "the firmware reset the board"));
+}
+
+static void timedOut(int) {
+  static const char message[] = "\nFAIL: timed out (the firmware may have halted, see --verbose)\n";
+  if (write(STDOUT_FILENO, message, sizeof(message) - 1) < 0) {
+    // Nothing left to report to
+  }
+  _exit(1);
+}
+
+static void usage() {
+  fprintf(stderr,
+          "usage: soak [-n repetitions] [--warmup n] [--heap bytes] [--report n] [--timeout s]\n"
+          "            [--verbose] card-dir\n");
+  exit(2);
+}
+
+int main(int argc, char **argv) {
+  const char *card = NULL;
+  unsigned long timeout = 0;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    bool more = i + 1 < argc;
+    if ((arg == "-n" || arg == "--repetitions") && more) {
+      soakIterations = strtoul(argv[++i], NULL, 10);
+    } else if (arg == "--warmup" && more) {
+      soakWarmup = strtoul(argv[++i], NULL, 10);
+    } else if (arg == "--heap" && more) {
+      soakHeapLimit = strtoul(argv[++i], NULL, 10);
+    } else if (arg == "--report" && more) {
+      soakReportEvery = strtoul(argv[++i], NULL, 10);
+    } else if (arg == "--timeout" && more) {
+      timeout = strtoul(argv[++i], NULL, 10);
+    } else if (arg == "--verbose") {
+      soakVerbose = true;
+    } else if (arg[0] != '-' && !card) {
+      card = argv[i];
+    } else {
+      usage();
+    }
+  }
+  if (!card || soakIterations == 0) {
+    usage();
+  }
+  // Globals of the sketch have allocated already; the limit cannot go below that
+  if (soakHeapLimit > SOAK_HEAP_MAX || soakHeapLimit < soakHeapTop) {
+    fprintf(stderr, "--heap must be between %u and %lu bytes\n", soakHeapTop, SOAK_HEAP_MAX);
+    return 2;
+  }
+  if (soakReportEvery == 0) {
+    soakReportEvery = soakIterations >= 20 ? soakIterations / 20 : 1;
+  }
+
+  addNode(-1, "", true);
+  if (!loadDirectory(card, 0)) {
+    fprintf(stderr, "Cannot read card directory %s\n", card);
+    return 2;
+  }
+  if (timeout) {
+    signal(SIGALRM, timedOut);
+    alarm(timeout);
+  }
+
+  printf("Soaking %s: %lu repetitions, %lu warm-up, heap %lu bytes\n", card, soakIterations, soakWarmup,
+         soakHeapLimit);
+  printRowHeader();
+#ifdef GHOSTKEY_REPORT_FIFO
+  startUsbCore();
+#endif
+  setup();
+  // setup() returns once the boot run is over; the end of the run closes the last repetition
+  SoakSample sample = takeSample();
+  if (soakStarted > 0) {
+    recordRepetition(soakStarted, sample);
+  }
+  return finishSoak(soakStarted >= soakIterations, NULL);
+}
@@ -0,0 +1,458 @@
+#!/usr/bin/env python3
+"""
+Generate lib/unicode-layouts.h from the host's XKB keymaps.
+
+For every layout the Keyboard library ships (see lib/Keyboard.h) the
+keymap is compiled with libxkbcommon, each key of the main block is read
+at the four levels Ghostkey can send (plain, Shift, AltGr, Shift+AltGr),
+and every dead key is combined with every plain character through the
+Compose table. Non-ASCII characters that can be typed that way end up in
+the layout's UnicodeKeyEntry table; ASCII keeps coming from the Keyboard
+library's own tables.
+
+    tools/xkb_layouts.py                 write lib/unicode-layouts.h
+    tools/xkb_layouts.py --verify        check the header against XKB
+
+--verify parses the header that is on disk, replays every entry through
+libxkbcommon (dead keys through the Compose table) and checks that each
+produces its character, and that every character a layout can type is in
+its table. It then builds and runs tools/xkb_roundtrip.cpp, which resolves
+every printable ASCII character and every table entry through the
+firmware's own resolveTypingChar() - with the Keyboard library's ASCII
+tables - and replays the typing steps through libxkbcommon. It exits
+non-zero on any mismatch.
+
+    tools/xkb_layouts.py --verify --keyboard-lib ~/Arduino/libraries/Keyboard
+
+The Keyboard library is looked for where the Arduino IDE installs it if
+--keyboard-lib is not given. --verify prints the name and version from its
+library.properties, and warns when there is none (a copy or a stand-in
+rather than a released library, so the round trip says nothing about the
+tables the firmware is built with).
+
+Needs libxkbcommon and the XKB data (xkb-data / xkeyboard-config) that
+every Linux desktop has installed.
+"""
+
+import argparse
+import ctypes
+import ctypes.util
+import os
+import glob
+import re
+import subprocess
+import sys
+import tempfile
+
+REPO = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEFAULT_OUTPUT = os.path.join(REPO, "lib", "unicode-layouts.h")
+ROUNDTRIP_SOURCE = os.path.join(REPO, "tools", "xkb_roundtrip.cpp")
+HOST_CORE = os.path.join(REPO, "tools", "soak", "host")
+
+# Where the Arduino IDE keeps the Keyboard library (user library first)
+KEYBOARD_LIBRARY_GLOBS = [
+    "~/Arduino/libraries/Keyboard",
+    "~/.arduino15/libraries/Keyboard",
+    "~/.arduino15/packages/*/hardware/*/*/libraries/Keyboard",
+    "/usr/share/arduino/libraries/Keyboard",
+]
+
+# Keyboard library layout -> XKB layout and variant
+LAYOUTS = [
+    ("en_US", "us", ""),
+    ("de_DE", "de", ""),
+    ("es_ES", "es", ""),
+    ("fr_FR", "fr", ""),
+    ("it_IT", "it", ""),
+    ("pt_PT", "pt", ""),
+    ("sv_SE", "se", ""),
+    ("da_DK", "dk", ""),
+    ("hu_HU", "hu", ""),
+]
+
+# XKB key names of the main block -> HID usage IDs (US key positions)
+HID_USAGES = {
+    "TLDE": 0x35, "AE01": 0x1E, "AE02": 0x1F, "AE03": 0x20, "AE04": 0x21,
+    "AE05": 0x22, "AE06": 0x23, "AE07": 0x24, "AE08": 0x25, "AE09": 0x26,
+    "AE10": 0x27, "AE11": 0x2D, "AE12": 0x2E,
+    "AD01": 0x14, "AD02": 0x1A, "AD03": 0x08, "AD04": 0x15, "AD05": 0x17,
+    "AD06": 0x1C, "AD07": 0x18, "AD08": 0x0C, "AD09": 0x12, "AD10": 0x13,
+    "AD11": 0x2F, "AD12": 0x30, "BKSL": 0x31,
+    "AC01": 0x04, "AC02": 0x16, "AC03": 0x07, "AC04": 0x09, "AC05": 0x0A,
+    "AC06": 0x0B, "AC07": 0x0D, "AC08": 0x0E, "AC09": 0x0F, "AC10": 0x33,
+    "AC11": 0x34,
+    "LSGT": 0x64, "AB01": 0x1D, "AB02": 0x1B, "AB03": 0x06, "AB04": 0x19,
+    "AB05": 0x05, "AB06": 0x11, "AB07": 0x10, "AB08": 0x36, "AB09": 0x37,
+    "AB10": 0x38,
+    "SPCE": 0x2C,
+}
+
+MOD_SHIFT = 0x02   # Left Shift
+MOD_ALT_GR = 0x40  # Right Alt
+LEVELS = [0, MOD_SHIFT, MOD_ALT_GR, MOD_SHIFT | MOD_ALT_GR]
+MODIFIER_KEYS = {MOD_SHIFT: "LFSH", MOD_ALT_GR: "RALT"}
+
+XKB_KEY_DOWN = 1
+XKB_KEY_UP = 0
+XKB_COMPOSE_COMPOSED = 2
+
+MAX_CODEPOINT = 0xFFFF  # UnicodeKeyEntry.codepoint is 16 bits
+
+
+class RuleNames(ctypes.Structure):
+    _fields_ = [(name, ctypes.c_char_p) for name in ("rules", "model", "layout", "variant", "options")]
+
+
+def load_xkbcommon():
+    path = ctypes.util.find_library("xkbcommon") or "libxkbcommon.so.0"
+    try:
+        xkb = ctypes.CDLL(path)
+    except OSError:
+        sys.exit("xkb_layouts: libxkbcommon not found (install libxkbcommon)")
+
+    vp, u32, i32 = ctypes.c_void_p, ctypes.c_uint32, ctypes.c_int
+    signatures = {
+        "xkb_context_new": (vp, [i32]),
+        "xkb_keymap_new_from_names": (vp, [vp, ctypes.POINTER(RuleNames), i32]),
+        "xkb_keymap_unref": (None, [vp]),
+        "xkb_keymap_key_by_name": (u32, [vp, ctypes.c_char_p]),
+        "xkb_state_new": (vp, [vp]),
+        "xkb_state_unref": (None, [vp]),
+        "xkb_state_update_key": (i32, [vp, u32, i32]),
+        "xkb_state_key_get_one_sym": (u32, [vp, u32]),
+        "xkb_state_key_get_utf32": (u32, [vp, u32]),
+        "xkb_keysym_get_name": (i32, [u32, ctypes.c_char_p, ctypes.c_size_t]),
+        "xkb_compose_table_new_from_locale": (vp, [vp, ctypes.c_char_p, i32]),
+        "xkb_compose_state_new": (vp, [vp, i32]),
+        "xkb_compose_state_reset": (None, [vp]),
+        "xkb_compose_state_feed": (i32, [vp, u32]),
+        "xkb_compose_state_get_status": (i32, [vp]),
+        "xkb_compose_state_get_utf8": (i32, [vp, ctypes.c_char_p, ctypes.c_size_t]),
+    }
+    for name, (restype, argtypes) in signatures.items():
+        function = getattr(xkb, name)
+        function.restype = restype
+        function.argtypes = argtypes
+    return xkb
+
+
+class Keymap:
+    """One XKB layout, typed on a pc105 keyboard."""
+
+    def __init__(self, xkb, context, compose, layout, variant):
+        self.xkb = xkb
+        self.compose = compose
+        names = RuleNames(b"evdev", b"pc105", layout.encode(), variant.encode(), b"")
+        self.keymap = xkb.xkb_keymap_new_from_names(context, ctypes.byref(names), 0)
+        if not self.keymap:
+            sys.exit("xkb_layouts: XKB layout '%s' not found" % layout)
+        self.keycodes = {}
+        for name in list(HID_USAGES) + list(MODIFIER_KEYS.values()):
+            keycode = xkb.xkb_keymap_key_by_name(self.keymap, name.encode())
+            if keycode != 0xFFFFFFFF:
+                self.keycodes[name] = keycode
+        self.usage_keys = {usage: name for name, usage in HID_USAGES.items()}
+
+    def close(self):
+        self.xkb.xkb_keymap_unref(self.keymap)
+
+    def sym_name(self, sym):
+        buffer = ctypes.create_string_buffer(64)
+        self.xkb.xkb_keysym_get_name(sym, buffer, len(buffer))
+        return buffer.value.decode()
+
+    def press(self, modifiers, usage):
+        """Keysym and character (or None) of one key press."""
+        state = self.xkb.xkb_state_new(self.keymap)
+        for bit, name in MODIFIER_KEYS.items():
+            if modifiers & bit and name in self.keycodes:
+                self.xkb.xkb_state_update_key(state, self.keycodes[name], XKB_KEY_DOWN)
+        keycode = self.keycodes.get(self.usage_keys.get(usage))
+        sym = codepoint = 0
+        if keycode is not None:
+            sym = self.xkb.xkb_state_key_get_one_sym(state, keycode)
+            codepoint = self.xkb.xkb_state_key_get_utf32(state, keycode)
+        self.xkb.xkb_state_unref(state)
+        return sym, (codepoint or None)
+
+    def compose_pair(self, first, second):
+        """Character the Compose table makes of two keysyms (or None)."""
+        state = self.xkb.xkb_compose_state_new(self.compose, 0)
+        self.xkb.xkb_compose_state_feed(state, first)
+        self.xkb.xkb_compose_state_feed(state, second)
+        text = None
+        if self.xkb.xkb_compose_state_get_status(state) == XKB_COMPOSE_COMPOSED:
+            buffer = ctypes.create_string_buffer(16)
+            self.xkb.xkb_compose_state_get_utf8(state, buffer, len(buffer))
+            text = buffer.value.decode("utf-8", "replace")
+        return ord(text) if text is not None and len(text) == 1 else None
+
+    def type_entry(self, entry):
+        """Replay a table entry; the character it produces (or None)."""
+        codepoint, dead_modifiers, dead_usage, modifiers, usage = entry
+        sym, produced = self.press(modifiers, usage)
+        if dead_usage == 0:
+            return produced
+        dead_sym, _ = self.press(dead_modifiers, dead_usage)
+        return self.compose_pair(dead_sym, sym)
+
+    def entries(self):
+        """Non-ASCII characters of the layout: codepoint -> entry."""
+        direct = {}
+        dead_keys = []
+        plain = []
+        for name, usage in HID_USAGES.items():
+            if name not in self.keycodes:
+                continue
+            for modifiers in LEVELS:
+                sym, codepoint = self.press(modifiers, usage)
+                if sym == 0:
+                    continue
+                if self.sym_name(sym).startswith("dead_"):
+                    dead_keys.append((sym, modifiers, usage))
+                elif codepoint is not None and codepoint >= 0x20:
+                    plain.append((sym, modifiers, usage))
+                    if codepoint >= 0x80 and codepoint <= MAX_CODEPOINT and codepoint not in direct:
+                        direct[codepoint] = (codepoint, 0, 0, modifiers, usage)
+
+        table = dict(direct)
+        for dead_sym, dead_modifiers, dead_usage in dead_keys:
+            for sym, modifiers, usage in plain:
+                codepoint = self.compose_pair(dead_sym, sym)
+                if codepoint is None or codepoint < 0x80 or codepoint > MAX_CODEPOINT or codepoint in table:
+                    continue
+                table[codepoint] = (codepoint, dead_modifiers, dead_usage, modifiers, usage)
+        return table
+
+
+def modifier_name(modifiers):
+    return {0: "UK_PLAIN", MOD_SHIFT: "UK_SHIFT", MOD_ALT_GR: "UK_ALT_GR",
+            MOD_SHIFT | MOD_ALT_GR: "UK_SHIFT_ALT_GR"}[modifiers]
+
+
+def char_comment(codepoint):
+    char = chr(codepoint)
+    return char if char.isprintable() and not char.isspace() else "U+%04X" % codepoint
+
+
+def write_header(path, tables):
+    lines = [
+        "/*",
+        " * Unicode Key Tables for Ghostkey",
+        " *",
+        " * Non-ASCII characters each keyboard layout can type directly, either as",
+        " * a key with Shift/AltGr or as a dead key followed by a second key. ASCII",
+        " * comes from the Keyboard library's layout tables. Entries are sorted by",
+        " * code point (they are binary searched).",
+        " *",
+        " * Usage IDs are the physical keys of a US keyboard, as in the Keyboard",
+        " * library's KeyboardLayout_*.cpp files.",
+        " *",
+        " * Generated by tools/xkb_layouts.py from the XKB keymaps - do not edit.",
+        " * Check it against the installed XKB data with --verify.",
+        " */",
+        "",
+        "#ifndef UNICODE_LAYOUTS_H",
+        "#define UNICODE_LAYOUTS_H",
+        "",
+        '#include "unicode-typing.h"',
+        "",
+        "#define UK_PLAIN 0x00",
+        "#define UK_SHIFT TYPING_MOD_SHIFT",
+        "#define UK_ALT_GR TYPING_MOD_ALT_GR",
+        "#define UK_SHIFT_ALT_GR (TYPING_MOD_SHIFT | TYPING_MOD_ALT_GR)",
+        "",
+        "// Plain key, and key after a dead key",
+        "#define UK_KEY(codepoint, modifiers, usage) { codepoint, 0, 0, modifiers, usage }",
+        "#define UK_DEAD(codepoint, deadModifiers, deadUsage, modifiers, usage) \\",
+        "  { codepoint, deadModifiers, deadUsage, modifiers, usage }",
+        "",
+        "#define UNICODE_KEY_COUNT(table) ((uint16_t)(sizeof(table) / sizeof(table[0])))",
+        "",
+        "// UNICODE_KEYS_<layout> expands to the table and its length (NULL, 0 if",
+        "// the layout types nothing beyond ASCII)",
+    ]
+    for name, xkb_layout, table in tables:
+        lines.append("")
+        if not table:
+            lines.append("// %s (XKB \"%s\"): ASCII only" % (name, xkb_layout))
+            lines.append("#define UNICODE_KEYS_%s NULL, 0" % name)
+            continue
+        dead = sum(1 for entry in table.values() if entry[2] != 0)
+        lines.append("// %s (XKB \"%s\"): %d characters, %d of them after a dead key"
+                     % (name, xkb_layout, len(table), dead))
+        lines.append("static const UnicodeKeyEntry UnicodeKeys_%s[] = {" % name)
+        for codepoint in sorted(table):
+            _, dead_modifiers, dead_usage, modifiers, usage = table[codepoint]
+            if dead_usage:
+                entry = "UK_DEAD(0x%04X, %s, 0x%02X, %s, 0x%02X)," % (
+                    codepoint, modifier_name(dead_modifiers), dead_usage, modifier_name(modifiers), usage)
+            else:
+                entry = "UK_KEY(0x%04X, %s, 0x%02X)," % (codepoint, modifier_name(modifiers), usage)
+            lines.append("  %-52s // %s" % (entry, char_comment(codepoint)))
+        lines.append("};")
+        lines.append("#define UNICODE_KEYS_%s UnicodeKeys_%s, UNICODE_KEY_COUNT(UnicodeKeys_%s)"
+                     % (name, name, name))
+    lines += ["", "#endif // UNICODE_LAYOUTS_H", ""]
+    with open(path, "w", encoding="utf-8") as header:
+        header.write("\n".join(lines))
+
+
+MODIFIER_VALUES = {"UK_PLAIN": 0, "UK_SHIFT": MOD_SHIFT, "UK_ALT_GR": MOD_ALT_GR,
+                   "UK_SHIFT_ALT_GR": MOD_SHIFT | MOD_ALT_GR}
+
+
+def read_header(path):
+    """Tables of a generated header: layout -> list of entries."""
+    tables = {}
+    current = None
+    with open(path, encoding="utf-8") as header:
+        for line in header:
+            match = re.match(r"static const UnicodeKeyEntry UnicodeKeys_(\w+)\[\]", line)
+            if match:
+                current = tables.setdefault(match.group(1), [])
+                continue
+            match = re.match(r"#define UNICODE_KEYS_(\w+) NULL, 0", line)
+            if match:
+                tables.setdefault(match.group(1), [])
+                continue
+            if line.startswith("};"):
+                current = None
+                continue
+            match = re.match(r"\s*UK_(KEY|DEAD)\(([^)]*)\)", line)
+            if match and current is not None:
+                fields = [field.strip() for field in match.group(2).split(",")]
+                values = [MODIFIER_VALUES[f] if f in MODIFIER_VALUES else int(f, 0) for f in fields]
+                if match.group(1) == "KEY":
+                    values = [values[0], 0, 0, values[1], values[2]]
+                current.append(tuple(values))
+    return tables
+
+
+def verify(path, keymaps):
+    tables = read_header(path)
+    failures = 0
+    for name, xkb_layout, keymap in keymaps:
+        if name not in tables:
+            print("%s: missing from %s" % (name, path))
+            failures += 1
+            continue
+        entries = tables[name]
+        codepoints = [entry[0] for entry in entries]
+        if codepoints != sorted(set(codepoints)):
+            print("%s: table is not sorted or has duplicates" % name)
+            failures += 1
+
+        wrong = 0
+        for entry in entries:
+            produced = keymap.type_entry(entry)
+            if produced != entry[0]:
+                print("%s: U+%04X types %s" % (name, entry[0],
+                                               "nothing" if produced is None else "U+%04X" % produced))
+                wrong += 1
+        missing = sorted(set(keymap.entries()) - set(codepoints))
+        for codepoint in missing:
+            print("%s: U+%04X (%s) can be typed but is not in the table"
+                  % (name, codepoint, char_comment(codepoint)))
+
+        failures += wrong + len(missing)
+        print("%s: %d characters round-trip, %d wrong, %d missing"
+              % (name, len(entries) - wrong, wrong, len(missing)))
+    return failures == 0
+
+
+def find_keyboard_library(given):
+    """src directory of the Keyboard library with its KeyboardLayout_*.cpp files."""
+    candidates = [given] if given else [path for pattern in KEYBOARD_LIBRARY_GLOBS
+                                        for path in sorted(glob.glob(os.path.expanduser(pattern)))]
+    for path in candidates:
+        src = os.path.join(path, "src")
+        if glob.glob(os.path.join(src, "KeyboardLayout_*.cpp")):
+            return src
+    return None
+
+
+def keyboard_library_provenance(keyboard_src):
+    """Print where the Keyboard library comes from; False if it lacks a layout Ghostkey uses."""
+    root = os.path.dirname(os.path.abspath(keyboard_src))
+    properties = {}
+    try:
+        with open(os.path.join(root, "library.properties"), encoding="utf-8") as f:
+            for line in f:
+                key, sep, value = line.partition("=")
+                if sep:
+                    properties[key.strip()] = value.strip()
+    except OSError:
+        pass
+    if properties.get("name") == "Keyboard":
+        print("Keyboard library: %s %s (%s) in %s" % (properties["name"], properties.get("version", "?"),
+                                                    properties.get("maintainer", "unknown maintainer"), root))
+    elif properties:
+        print("WARNING: %s is %s %s, not the Arduino Keyboard library" %
+              (root, properties.get("name", "?"), properties.get("version", "?")))
+    else:
+        print("WARNING: %s has no library.properties; not a released Keyboard library, so the round "
+              "trip only covers these sources" % root)
+    missing = [name for name, _, _ in LAYOUTS
+               if not os.path.exists(os.path.join(keyboard_src, "KeyboardLayout_%s.cpp" % name))]
+    if missing:
+        print("Keyboard library has no %s layout (needs version 1.0.5 or later)" % ", ".join(missing))
+    return not missing
+
+
+def roundtrip(keyboard_src, compose_locale):
+    """Build and run tools/xkb_roundtrip.cpp; True if every character round-trips."""
+    layouts = sorted(glob.glob(os.path.join(keyboard_src, "KeyboardLayout_*.cpp")))
+    with tempfile.TemporaryDirectory() as build:
+        binary = os.path.join(build, "xkb_roundtrip")
+        command = ["c++", "-std=c++17", "-O2", "-I" + HOST_CORE, "-I" + keyboard_src, "-o", binary,
+                   ROUNDTRIP_SOURCE] + layouts + ["-ldl"]
+        if subprocess.call(command) != 0:
+            print("xkb_roundtrip: build failed")
+            return False
+        return subprocess.call([binary, compose_locale]) == 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate Ghostkey's Unicode key tables from XKB.")
+    parser.add_argument("--output", default=DEFAULT_OUTPUT, help="header to write or verify")
+    parser.add_argument("--verify", action="store_true", help="check the header instead of writing it")
+    parser.add_argument("--compose-locale", default="en_US.UTF-8", help="locale of the Compose table")
+    parser.add_argument("--keyboard-lib", help="Arduino Keyboard library (for --verify's ASCII tables)")
+    args = parser.parse_args()
+
+    keyboard_src = None
+    if args.verify:
+        keyboard_src = find_keyboard_library(args.keyboard_lib)
+        if keyboard_src is None:
+            sys.exit("xkb_layouts: Keyboard library sources not found; pass --keyboard-lib DIR "
+                     "(the directory with src/KeyboardLayout_*.cpp)")
+
+    xkb = load_xkbcommon()
+    context = xkb.xkb_context_new(0)
+    compose = xkb.xkb_compose_table_new_from_locale(context, args.compose_locale.encode(), 0)
+    if not context or not compose:
+        sys.exit("xkb_layouts: cannot load the XKB context or the Compose table")
+
+    keymaps = [(name, layout, Keymap(xkb, context, compose, layout, variant))
+               for name, layout, variant in LAYOUTS]
+    if args.verify:
+        ok = verify(args.output, keymaps)
+        if keyboard_library_provenance(keyboard_src):
+            ok = roundtrip(keyboard_src, args.compose_locale) and ok
+        else:
+            ok = False
+    else:
+        tables = [(name, layout, keymap.entries()) for name, layout, keymap in keymaps]
+        write_header(args.output, tables)
+        for name, _, table in tables:
+            print("%s: %d characters" % (name, len(table)))
+        print("Wrote %s" % args.output)
+        ok = True
+    for _, _, keymap in keymaps:
+        keymap.close()
+    return 0 if ok else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,337 @@
+/*
+ * Keyboard Layout Round-Trip Test
+ *
+ * Types every character a layout can type through the firmware's own code
+ * and checks what a host with that XKB layout receives. For each layout of
+ * TYPING_LAYOUTS (lib/layout-utils.h), every printable ASCII character and
+ * every character of its Unicode table (lib/unicode-layouts.h) is resolved
+ * with resolveTypingChar() (lib/unicode-typing.h, findUnicodeKey() for
+ * non-ASCII), and the typing steps are replayed key by key through
+ * libxkbcommon: modifiers down, key down, the keysym through the Compose
+ * table (dead keys), everything up again. The characters that come out
+ * must be exactly the one that went in.
+ *
+ * ASCII comes from the Keyboard library's KeyboardLayout_*.cpp tables, so
+ * those are compiled in against the host core of the soak harness
+ * (tools/soak/host/Arduino.h). tools/xkb_layouts.py --verify builds and
+ * runs this test; by hand:
+ *
+ *     c++ -std=c++17 -O2 -Itools/soak/host -I<Keyboard>/src -o xkb_roundtrip \
+ *         tools/xkb_roundtrip.cpp <Keyboard>/src/KeyboardLayout_*.cpp -ldl
+ *     ./xkb_roundtrip [compose-locale]
+ *
+ * libxkbcommon is loaded at run time (as the Python tool does), so only
+ * the library, not its headers, has to be installed.
+ *
+ * Exit status: 0 if every character round-trips, 1 if any does not, 2 if
+ * libxkbcommon, a keymap or the Compose table cannot be loaded.
+ */
+
+#include <dlfcn.h>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "../lib/unicode-layouts.h"
+
+extern const uint8_t KeyboardLayout_en_US[];
+extern const uint8_t KeyboardLayout_de_DE[];
+extern const uint8_t KeyboardLayout_es_ES[];
+extern const uint8_t KeyboardLayout_fr_FR[];
+extern const uint8_t KeyboardLayout_it_IT[];
+extern const uint8_t KeyboardLayout_pt_PT[];
+extern const uint8_t KeyboardLayout_sv_SE[];
+extern const uint8_t KeyboardLayout_da_DK[];
+extern const uint8_t KeyboardLayout_hu_HU[];
+
+struct RoundTripLayout {
+  TypingLayout layout; // As TYPING_LAYOUTS has it
+  const char *xkbLayout;
+  const char *xkbVariant;
+};
+
+// Same layouts as TYPING_LAYOUTS and LAYOUTS in tools/xkb_layouts.py
+static const RoundTripLayout LAYOUTS[] = {
+  { { "en_US", KeyboardLayout_en_US, UNICODE_KEYS_en_US }, "us", "" },
+  { { "de_DE", KeyboardLayout_de_DE, UNICODE_KEYS_de_DE }, "de", "" },
+  { { "es_ES", KeyboardLayout_es_ES, UNICODE_KEYS_es_ES }, "es", "" },
+  { { "fr_FR", KeyboardLayout_fr_FR, UNICODE_KEYS_fr_FR }, "fr", "" },
+  { { "it_IT", KeyboardLayout_it_IT, UNICODE_KEYS_it_IT }, "it", "" },
+  { { "pt_PT", KeyboardLayout_pt_PT, UNICODE_KEYS_pt_PT }, "pt", "" },
+  { { "sv_SE", KeyboardLayout_sv_SE, UNICODE_KEYS_sv_SE }, "se", "" },
+  { { "da_DK", KeyboardLayout_da_DK, UNICODE_KEYS_da_DK }, "dk", "" },
+  { { "hu_HU", KeyboardLayout_hu_HU, UNICODE_KEYS_hu_HU }, "hu", "" },
+};
+
+// XKB key names of the HID usages the layouts use (HID_USAGES in
+// tools/xkb_layouts.py, US key positions)
+static const struct {
+  uint8_t usage;
+  const char *name;
+} KEY_NAMES[] = {
+  { 0x35, "TLDE" }, { 0x1E, "AE01" }, { 0x1F, "AE02" }, { 0x20, "AE03" }, { 0x21, "AE04" },
+  { 0x22, "AE05" }, { 0x23, "AE06" }, { 0x24, "AE07" }, { 0x25, "AE08" }, { 0x26, "AE09" },
+  { 0x27, "AE10" }, { 0x2D, "AE11" }, { 0x2E, "AE12" },
+  { 0x14, "AD01" }, { 0x1A, "AD02" }, { 0x08, "AD03" }, { 0x15, "AD04" }, { 0x17, "AD05" },
+  { 0x1C, "AD06" }, { 0x18, "AD07" }, { 0x0C, "AD08" }, { 0x12, "AD09" }, { 0x13, "AD10" },
+  { 0x2F, "AD11" }, { 0x30, "AD12" }, { 0x31, "BKSL" },
+  { 0x04, "AC01" }, { 0x16, "AC02" }, { 0x07, "AC03" }, { 0x09, "AC04" }, { 0x0A, "AC05" },
+  { 0x0B, "AC06" }, { 0x0D, "AC07" }, { 0x0E, "AC08" }, { 0x0F, "AC09" }, { 0x33, "AC10" },
+  { 0x34, "AC11" },
+  { 0x64, "LSGT" }, { 0x1D, "AB01" }, { 0x1B, "AB02" }, { 0x06, "AB03" }, { 0x19, "AB04" },
+  { 0x05, "AB05" }, { 0x11, "AB06" }, { 0x10, "AB07" }, { 0x36, "AB08" }, { 0x37, "AB09" },
+  { 0x38, "AB10" },
+  { 0x2C, "SPCE" },
+};
+
+// Modifier keys of the report's modifier bits
+static const struct {
+  uint8_t bit;
+  const char *name;
+} MODIFIER_NAMES[] = {
+  { TYPING_MOD_CTRL, "LCTL" }, { TYPING_MOD_SHIFT, "LFSH" }, { TYPING_MOD_ALT, "LALT" }, { TYPING_MOD_ALT_GR, "RALT" },
+};
+
+// ---- libxkbcommon, loaded at run time ----
+
+struct XkbRuleNames {
+  const char *rules;
+  const char *model;
+  const char *layout;
+  const char *variant;
+  const char *options;
+};
+
+enum { XKB_KEY_UP = 0, XKB_KEY_DOWN = 1 };
+enum { XKB_COMPOSE_NOTHING = 0, XKB_COMPOSE_COMPOSING, XKB_COMPOSE_COMPOSED, XKB_COMPOSE_CANCELLED };
+static const uint32_t XKB_KEYCODE_INVALID = 0xFFFFFFFF;
+
+static struct {
+  void *(*contextNew)(int);
+  void (*contextUnref)(void *);
+  void *(*keymapNewFromNames)(void *, const XkbRuleNames *, int);
+  void (*keymapUnref)(void *);
+  uint32_t (*keymapKeyByName)(void *, const char *);
+  void *(*stateNew)(void *);
+  void (*stateUnref)(void *);
+  int (*stateUpdateKey)(void *, uint32_t, int);
+  uint32_t (*stateKeyGetOneSym)(void *, uint32_t);
+  uint32_t (*stateKeyGetUtf32)(void *, uint32_t);
+  void *(*composeTableNewFromLocale)(void *, const char *, int);
+  void (*composeTableUnref)(void *);
+  void *(*composeStateNew)(void *, int);
+  void (*composeStateUnref)(void *);
+  int (*composeStateFeed)(void *, uint32_t);
+  int (*composeStateGetStatus)(void *);
+  int (*composeStateGetUtf8)(void *, char *, size_t);
+  void (*composeStateReset)(void *);
+} xkb;
+
+template <typename T> static bool loadSymbol(void *library, const char *name, T &function) {
+  function = reinterpret_cast<T>(dlsym(library, name));
+  if (function == nullptr) {
+    fprintf(stderr, "xkb_roundtrip: libxkbcommon has no %s\n", name);
+  }
+  return function != nullptr;
+}
+
+static bool loadXkbcommon() {
+  void *library = dlopen("libxkbcommon.so.0", RTLD_NOW);
+  if (library == nullptr) {
+    fprintf(stderr, "xkb_roundtrip: libxkbcommon not found (install libxkbcommon)\n");
+    return false;
+  }
+  return loadSymbol(library, "xkb_context_new", xkb.contextNew) &&
+         loadSymbol(library, "xkb_context_unref", xkb.contextUnref) &&
+         loadSymbol(library, "xkb_keymap_new_from_names", xkb.keymapNewFromNames) &&
+         loadSymbol(library, "xkb_keymap_unref", xkb.keymapUnref) &&
+         loadSymbol(library, "xkb_keymap_key_by_name", xkb.keymapKeyByName) &&
+         loadSymbol(library, "xkb_state_new", xkb.stateNew) &&
+         loadSymbol(library, "xkb_state_unref", xkb.stateUnref) &&
+         loadSymbol(library, "xkb_state_update_key", xkb.stateUpdateKey) &&
+         loadSymbol(library, "xkb_state_key_get_one_sym", xkb.stateKeyGetOneSym) &&
+         loadSymbol(library, "xkb_state_key_get_utf32", xkb.stateKeyGetUtf32) &&
+         loadSymbol(library, "xkb_compose_table_new_from_locale", xkb.composeTableNewFromLocale) &&
+         loadSymbol(library, "xkb_compose_table_unref", xkb.composeTableUnref) &&
+         loadSymbol(library, "xkb_compose_state_new", xkb.composeStateNew) &&
+         loadSymbol(library, "xkb_compose_state_unref", xkb.composeStateUnref) &&
+         loadSymbol(library, "xkb_compose_state_feed", xkb.composeStateFeed) &&
+         loadSymbol(library, "xkb_compose_state_get_status", xkb.composeStateGetStatus) &&
+         loadSymbol(library, "xkb_compose_state_get_utf8", xkb.composeStateGetUtf8) &&
+         loadSymbol(library, "xkb_compose_state_reset", xkb.composeStateReset);
+}
+
+// ---- Replay ----
+
+// One layout's keymap with a fresh key state per character
+struct Host {
+  void *keymap;
+  void *compose;
+  uint32_t keycodes[256];  // HID usage -> XKB keycode
+  uint32_t modifierKeys[8]; // Modifier bit -> XKB keycode
+};
+
+static void appendUtf8(std::string &text, uint32_t codepoint) {
+  if (codepoint < 0x80) {
+    text += (char)codepoint;
+  } else if (codepoint < 0x800) {
+    text += (char)(0xC0 | (codepoint >> 6));
+    text += (char)(0x80 | (codepoint & 0x3F));
+  } else if (codepoint < 0x10000) {
+    text += (char)(0xE0 | (codepoint >> 12));
+    text += (char)(0x80 | ((codepoint >> 6) & 0x3F));
+    text += (char)(0x80 | (codepoint & 0x3F));
+  } else {
+    text += (char)(0xF0 | (codepoint >> 18));
+    text += (char)(0x80 | ((codepoint >> 12) & 0x3F));
+    text += (char)(0x80 | ((codepoint >> 6) & 0x3F));
+    text += (char)(0x80 | (codepoint & 0x3F));
+  }
+}
+
+// Send the modifier keys of bits up or down
+static void pressModifiers(const Host &host, void *state, uint8_t bits, int direction) {
+  for (int bit = 0; bit < 8; bit++) {
+    if ((bits & (1 << bit)) && host.modifierKeys[bit] != XKB_KEYCODE_INVALID) {
+      xkb.stateUpdateKey(state, host.modifierKeys[bit], direction);
+    }
+  }
+}
+
+// Replay steps as the host sees them; the UTF-8 text they produce, or
+// false with the reason in error
+static bool replaySteps(const Host &host, const TypingStep *steps, size_t count, std::string &text,
+                        std::string &error) {
+  void *state = xkb.stateNew(host.keymap);
+  void *compose = xkb.composeStateNew(host.compose, 0);
+  bool ok = true;
+  for (size_t i = 0; i < count && ok; i++) {
+    const TypingStep &step = steps[i];
+    if (step.flags & (TYPING_STEP_SILENT | TYPING_STEP_RELEASE)) {
+      error = (step.flags & TYPING_STEP_SILENT) ? "silent step" : "release step";
+      ok = false;
+      break;
+    }
+    uint32_t keycode = host.keycodes[step.usage];
+    if (keycode == XKB_KEYCODE_INVALID) {
+      char buffer[48];
+      snprintf(buffer, sizeof(buffer), "usage 0x%02X has no XKB key", step.usage);
+      error = buffer;
+      ok = false;
+      break;
+    }
+
+    uint8_t modifiers = step.held | step.modifiers;
+    pressModifiers(host, state, modifiers, XKB_KEY_DOWN);
+    uint32_t sym = xkb.stateKeyGetOneSym(state, keycode);
+    uint32_t codepoint = xkb.stateKeyGetUtf32(state, keycode);
+    xkb.stateUpdateKey(state, keycode, XKB_KEY_DOWN);
+    xkb.stateUpdateKey(state, keycode, XKB_KEY_UP);
+    pressModifiers(host, state, modifiers, XKB_KEY_UP);
+
+    xkb.composeStateFeed(compose, sym);
+    switch (xkb.composeStateGetStatus(compose)) {
+      case XKB_COMPOSE_COMPOSING:
+        break; // Dead key, wait for the next one
+      case XKB_COMPOSE_COMPOSED: {
+        char buffer[16];
+        xkb.composeStateGetUtf8(compose, buffer, sizeof(buffer));
+        text += buffer;
+        xkb.composeStateReset(compose);
+        break;
+      }
+      case XKB_COMPOSE_CANCELLED:
+        error = "dead key sequence cancelled";
+        ok = false;
+        break;
+      default:
+        if (codepoint != 0) {
+          appendUtf8(text, codepoint);
+        }
+        break;
+    }
+  }
+  if (ok && xkb.composeStateGetStatus(compose) == XKB_COMPOSE_COMPOSING) {
+    error = "dead key left pending";
+    ok = false;
+  }
+  xkb.composeStateUnref(compose);
+  xkb.stateUnref(state);
+  return ok;
+}
+
+// Resolve one character with the firmware code and replay it; false (and
+// a line on stdout) if the host receives anything else
+static bool roundTrip(const Host &host, const TypingLayout &layout, uint32_t codepoint) {
+  TypingStep steps[TYPING_MAX_STEPS];
+  size_t count = resolveTypingChar(layout, UNICODE_INPUT_NONE, codepoint, steps);
+  std::string expected, text, error;
+  appendUtf8(expected, codepoint);
+  if (count == 0) {
+    error = "cannot be resolved";
+  } else if (replaySteps(host, steps, count, text, error) && text != expected) {
+    error = text.empty() ? "types nothing" : "types \"" + text + "\"";
+  }
+  if (error.empty()) {
+    return true;
+  }
+  printf("%s: U+%04X (%s) %s\n", layout.name, codepoint, codepoint >= 0x20 ? expected.c_str() : "?", error.c_str());
+  return false;
+}
+
+int main(int argc, char **argv) {
+  const char *composeLocale = (argc > 1) ? argv[1] : "en_US.UTF-8";
+  if (!loadXkbcommon()) {
+    return 2;
+  }
+  void *context = xkb.contextNew(0);
+  void *composeTable = context ? xkb.composeTableNewFromLocale(context, composeLocale, 0) : nullptr;
+  if (composeTable == nullptr) {
+    fprintf(stderr, "xkb_roundtrip: cannot load the XKB context or the Compose table for %s\n", composeLocale);
+    return 2;
+  }
+
+  unsigned long failures = 0;
+  for (const RoundTripLayout &entry : LAYOUTS) {
+    XkbRuleNames names = { "evdev", "pc105", entry.xkbLayout, entry.xkbVariant, "" };
+    Host host;
+    host.keymap = xkb.keymapNewFromNames(context, &names, 0);
+    if (host.keymap == nullptr) {
+      fprintf(stderr, "xkb_roundtrip: XKB layout '%s' not found\n", entry.xkbLayout);
+      return 2;
+    }
+    host.compose = composeTable;
+    for (uint32_t &keycode : host.keycodes) {
+      keycode = XKB_KEYCODE_INVALID;
+    }
+    for (const auto &key : KEY_NAMES) {
+      host.keycodes[key.usage] = xkb.keymapKeyByName(host.keymap, key.name);
+    }
+    for (int bit = 0; bit < 8; bit++) {
+      host.modifierKeys[bit] = XKB_KEYCODE_INVALID;
+    }
+    for (const auto &modifier : MODIFIER_NAMES) {
+      host.modifierKeys[__builtin_ctz(modifier.bit)] = xkb.keymapKeyByName(host.keymap, modifier.name);
+    }
+
+    const TypingLayout &layout = entry.layout;
+    unsigned long ascii = 0, asciiWrong = 0, unicode = 0, unicodeWrong = 0;
+    for (uint32_t codepoint = 0x20; codepoint < 0x7F; codepoint++) {
+      ascii++;
+      asciiWrong += roundTrip(host, layout, codepoint) ? 0 : 1;
+    }
+    for (uint16_t i = 0; i < layout.entryCount; i++) {
+      unicode++;
+      unicodeWrong += roundTrip(host, layout, layout.entries[i].codepoint) ? 0 : 1;
+    }
+    printf("%s: ASCII %lu of %lu and Unicode table %lu of %lu characters round-trip\n", layout.name,
+           ascii - asciiWrong, ascii, unicode - unicodeWrong, unicode);
+    failures += asciiWrong + unicodeWrong;
+    xkb.keymapUnref(host.keymap);
+  }
+
+  xkb.composeTableUnref(composeTable);
+  xkb.contextUnref(context);
+  return failures == 0 ? 0 : 1;
+}
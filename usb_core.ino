@@ -0,0 +1,43 @@
+/*
+ * USB Core - RP2040 Dual-Core Split
+ *
+ * On the RP2040 the two cores split the work: core 1 runs everything the
+ * SAMD21 build runs in setup()/loop() (SD card, config, payload compiling
+ * and the interpreter, see GHOSTKEY_SETUP in the main tab), and core 0
+ * does nothing but move HID reports from hidReportFifo (lib/hid-output.h)
+ * to TinyUSB. A slow card read or a long compile on core 1 no longer
+ * delays reports already queued, and waiting for a free USB frame no
+ * longer stalls the interpreter.
+ *
+ * A report leaves the ring only once TinyUSB has accepted it, so nothing
+ * is dropped when the host is slow to poll; core 1 waits instead (the
+ * ring's fullWaits count). Serial stays usable from core 1: the core's
+ * USB mutex serialises it with the reports sent here.
+ */
+
+#if defined(ARDUINO_ARCH_RP2040)
+#include <USB.h>
+#include <CoreMutex.h>
+#include "tusb.h"
+
+void setup() {
+  // USB is started by the core before setup(); the engine starts itself on core 1
+}
+
+void loop() {
+  sendQueuedReport();
+}
+
+// Hand the oldest queued report to TinyUSB once the endpoint is free
+void sendQueuedReport() {
+  KeyReport report;
+  if (!hidReportFifo.peek(report)) {
+    return;
+  }
+  CoreMutex m(&__usb_mutex);
+  tud_task();
+  if (tud_hid_ready() && tud_hid_keyboard_report(__USBGetKeyboardReportID(), report.modifiers, report.keys)) {
+    hidReportFifo.pop();
+  }
+}
+#endif